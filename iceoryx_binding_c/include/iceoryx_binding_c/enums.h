@@ -155,6 +155,7 @@ enum iox_ListenerResult
     ListenerResult_LISTENER_FULL,
     ListenerResult_EVENT_ALREADY_ATTACHED,
     ListenerResult_EMPTY_EVENT_CALLBACK,
+    ListenerResult_INVALID_WORKER_INDEX,
     ListenerResult_UNDEFINED_ERROR,
     ListenerResult_SUCCESS
 };
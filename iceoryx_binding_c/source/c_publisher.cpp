@@ -110,7 +110,8 @@ void iox_pub_deinit(iox_pub_t const self)
 {
     iox::cxx::Expects(self != nullptr);
 
-    self->m_portData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+    iox::popo::PublisherPortUser(self->m_portData).destroy();
+    self->m_portData = nullptr;
     delete self;
 }
 
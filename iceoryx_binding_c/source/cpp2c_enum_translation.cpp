@@ -123,6 +123,8 @@ iox_ListenerResult listenerResult(const iox::popo::ListenerError value) noexcept
         return ListenerResult_LISTENER_FULL;
     case ListenerError::EMPTY_EVENT_CALLBACK:
         return ListenerResult_EMPTY_EVENT_CALLBACK;
+    case ListenerError::INVALID_WORKER_INDEX:
+        return ListenerResult_INVALID_WORKER_INDEX;
     }
     return ListenerResult_UNDEFINED_ERROR;
 }
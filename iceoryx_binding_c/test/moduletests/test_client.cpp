@@ -20,6 +20,7 @@
 #include "iceoryx_hoofs/testing/watch_dog.hpp"
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_roudi.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_posh/popo/untyped_client.hpp"
@@ -70,7 +71,8 @@ class iox_client_test : public Test
         sutPort->m_connectRequested.store(true);
         sutPort->m_connectionState = iox::ConnectionState::CONNECTED;
 
-        sutPort->m_chunkSenderData.m_queues.emplace_back(&serverChunkQueueData);
+        iox::popo::ChunkDistributor<iox::popo::ClientChunkDistributorData_t> distributor{&sutPort->m_chunkSenderData};
+        ASSERT_FALSE(distributor.tryAddQueue(&serverChunkQueueData).has_error());
     }
 
     void receiveChunk(const int64_t chunkValue = 0)
@@ -79,7 +81,7 @@ class iox_client_test : public Test
             sizeof(int64_t), iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT, sizeof(ResponseHeader)));
         ASSERT_FALSE(chunk.has_error());
         new (chunk->getChunkHeader()->userHeader())
-            ResponseHeader(iox::UniqueId(), RpcBaseHeader::UNKNOWN_CLIENT_QUEUE_INDEX, 0U);
+            ResponseHeader(iox::UniqueId(), RpcBaseHeader::UNKNOWN_CLIENT_QUEUE_HANDLE, 0U);
         *static_cast<int64_t*>(chunk->getUserPayload()) = chunkValue;
         iox::popo::ChunkQueuePusher<ClientChunkQueueData_t> pusher{&sutPort->m_chunkReceiverData};
         pusher.push(*chunk);
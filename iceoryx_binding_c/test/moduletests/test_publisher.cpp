@@ -33,10 +33,14 @@ extern "C" {
 #include "iceoryx_binding_c/chunk.h"
 #include "iceoryx_binding_c/publisher.h"
 #include "iceoryx_binding_c/runtime.h"
+#include "iceoryx_binding_c/service_discovery.h"
 }
 
 #include "test.hpp"
 
+#include <chrono>
+#include <thread>
+
 namespace
 {
 using namespace ::testing;
@@ -155,6 +159,56 @@ TEST_F(iox_pub_test, initPublisherWithDefaultOptionsWorks)
     iox_pub_deinit(sut);
 }
 
+bool isServiceOffered(iox_service_discovery_t const serviceDiscovery)
+{
+    constexpr uint64_t SERVICE_CONTAINER_CAPACITY{1U};
+    iox_service_description_t serviceContainer[SERVICE_CONTAINER_CAPACITY];
+    uint64_t missedServices{0U};
+    return iox_service_discovery_find_service(serviceDiscovery,
+                                              "a",
+                                              "b",
+                                              "c",
+                                              serviceContainer,
+                                              SERVICE_CONTAINER_CAPACITY,
+                                              &missedServices,
+                                              MessagingPattern_PUB_SUB)
+           != 0U;
+}
+
+TEST_F(iox_pub_test, deinitPublisherStopOffersServiceAndReleasesPortPoolSlot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2748b81a-3189-4c72-b482-2dcbf685140f");
+    iox::roudi::RouDiEnvironment roudiEnv;
+
+    iox_runtime_init("hypnotoad");
+    iox_service_discovery_storage_t serviceDiscoveryStorage;
+    auto serviceDiscovery = iox_service_discovery_init(&serviceDiscoveryStorage);
+
+    iox_pub_options_t options;
+    iox_pub_options_init(&options);
+
+    // more publishers than the PortPool has slots can only be created one after another when every
+    // deinitialized publisher is stop offered and its slot is released by RouDi
+    constexpr uint32_t MAX_NUMBER_OF_POLLS{1000U};
+    for (uint32_t i = 0U; i <= iox::MAX_PUBLISHERS; ++i)
+    {
+        iox_pub_storage_t storage;
+        auto sut = iox_pub_init(&storage, "a", "b", "c", &options);
+        ASSERT_THAT(sut, Ne(nullptr));
+        ASSERT_TRUE(iox_pub_is_offered(sut));
+
+        iox_pub_deinit(sut);
+
+        for (uint32_t poll = 0U; poll < MAX_NUMBER_OF_POLLS && isServiceOffered(serviceDiscovery); ++poll)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        ASSERT_FALSE(isServiceOffered(serviceDiscovery));
+    }
+
+    iox_service_discovery_deinit(serviceDiscovery);
+}
+
 TEST_F(iox_pub_test, initialStateOfIsOfferedIsAsExpected)
 {
     ::testing::Test::RecordProperty("TEST_ID", "fa757a54-a8df-420e-b32d-a9d5724a7d20");
@@ -21,6 +21,8 @@
 #include "iceoryx_dust/cxx/convert.hpp"
 #include "iceoryx_posh/popo/publisher.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "mq.hpp"
 #include "topic_data.hpp"
@@ -28,6 +30,8 @@
 
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include <thread>
 #include <vector>
 
 //! [use constants instead of magic values]
@@ -95,6 +99,108 @@ void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology) noexcept
 }
 //! [do the measurement for a single technology]
 
+//! [measure the publish duration for a fan-out]
+iox::units::Duration IcePerfLeader::measurePublishDuration(const iox::popo::PublisherOptions& publisherOptions,
+                                                           const uint32_t numberOfSubscribers) noexcept
+{
+    iox::popo::UntypedPublisher publisher({"IcePerf", "FanOut", "C++-API"}, publisherOptions);
+
+    std::vector<std::unique_ptr<iox::popo::UntypedSubscriber>> subscribers;
+    for (uint32_t i = 0U; i < numberOfSubscribers; ++i)
+    {
+        subscribers.emplace_back(new iox::popo::UntypedSubscriber({"IcePerf", "FanOut", "C++-API"}));
+    }
+    for (auto& subscriber : subscribers)
+    {
+        while (subscriber->getSubscriptionState() != iox::SubscribeState::SUBSCRIBED)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    std::chrono::nanoseconds publishDuration{0};
+    for (uint64_t i = 0U; i < m_settings.numberOfSamples; ++i)
+    {
+        auto start = std::chrono::steady_clock::now();
+        publisher.loan(sizeof(PerfTopic)).and_then([&](auto& userPayload) {
+            auto sendSample = static_cast<PerfTopic*>(userPayload);
+            sendSample->payloadSize = sizeof(PerfTopic);
+            sendSample->runFlag = RunFlag::RUN;
+            sendSample->subPackets = 1;
+
+            publisher.publish(userPayload);
+        });
+        publishDuration += std::chrono::steady_clock::now() - start;
+
+        // the subscribers are drained outside of the measured section to keep the mempool from running empty
+        for (auto& subscriber : subscribers)
+        {
+            subscriber->take().and_then([&](const void* data) { subscriber->release(data); });
+        }
+    }
+
+    return iox::units::Duration::fromNanoseconds(static_cast<uint64_t>(publishDuration.count())
+                                                 / m_settings.numberOfSamples);
+}
+//! [measure the publish duration for a fan-out]
+
+//! [measure the per subscriber cost of a fan-out]
+void IcePerfLeader::doFanOutMeasurement() noexcept
+{
+    const auto numberOfSubscribers = m_settings.numberOfFanOutSubscribers;
+    std::cout << "Measurement for: 0 and " << numberOfSubscribers << " subscribers" << std::endl;
+
+    iox::popo::PublisherOptions perQueueOptions;
+
+    iox::popo::PublisherOptions broadcastOptions;
+    broadcastOptions.broadcastDeliveryThreshold = 1U;
+
+    iox::popo::PublisherOptions parallelBroadcastOptions;
+    parallelBroadcastOptions.broadcastDeliveryThreshold = 1U;
+    parallelBroadcastOptions.parallelBroadcastDelivery = true;
+
+    const std::vector<std::tuple<const char*, iox::popo::PublisherOptions>> deliveryModes{
+        std::make_tuple("per queue", perQueueOptions),
+        std::make_tuple("broadcast", broadcastOptions),
+        std::make_tuple("parallel broadcast", parallelBroadcastOptions)};
+
+    std::vector<std::tuple<const char*, iox::units::Duration, iox::units::Duration>> fanOutMeasurements;
+    for (const auto& deliveryMode : deliveryModes)
+    {
+        const auto& options = std::get<1>(deliveryMode);
+        auto baseline = measurePublishDuration(options, 0U);
+        auto fanOut = measurePublishDuration(options, numberOfSubscribers);
+        fanOutMeasurements.push_back(std::make_tuple(std::get<0>(deliveryMode), baseline, fanOut));
+    }
+
+    std::cout << std::endl;
+    std::cout << "#### Fan-Out Measurement Result ####" << std::endl;
+    std::cout << m_settings.numberOfSamples << " publishes to " << numberOfSubscribers << " subscribers for each mode."
+              << std::endl;
+    std::cout << std::endl;
+    std::cout << "| Delivery Mode      | Publish w/o Subscribers [ns] | Publish [ns] | Per Subscriber [ns] |"
+              << std::endl;
+    std::cout << "|:-------------------|-----------------------------:|-------------:|--------------------:|"
+              << std::endl;
+    for (const auto& fanOutMeasurement : fanOutMeasurements)
+    {
+        auto baselineInNanoseconds = std::get<1>(fanOutMeasurement).toNanoseconds();
+        auto fanOutInNanoseconds = std::get<2>(fanOutMeasurement).toNanoseconds();
+        auto perSubscriberInNanoseconds =
+            (fanOutInNanoseconds > baselineInNanoseconds)
+                ? static_cast<double>(fanOutInNanoseconds - baselineInNanoseconds) / numberOfSubscribers
+                : 0.0;
+        std::cout << "| " << std::left << std::setw(18) << std::get<0>(fanOutMeasurement) << std::right << " | "
+                  << std::setw(28) << baselineInNanoseconds << " | " << std::setw(12) << fanOutInNanoseconds << " | "
+                  << std::setw(19) << std::fixed << std::setprecision(1) << perSubscriberInNanoseconds
+                  << std::defaultfloat << " |" << std::endl;
+    }
+
+    std::cout << std::endl;
+    std::cout << "Finished!" << std::endl;
+}
+//! [measure the per subscriber cost of a fan-out]
+
 //! [run all technologies]
 int IcePerfLeader::run() noexcept
 {
@@ -147,6 +253,13 @@ int IcePerfLeader::run() noexcept
         IceoryxC iceoryxc(PUBLISHER, SUBSCRIBER);
         doMeasurement(iceoryxc);
     }
+
+    if (m_settings.numberOfFanOutSubscribers > 0U
+        && (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_API))
+    {
+        std::cout << std::endl << "******  ICEORYX FAN-OUT   ********" << std::endl;
+        doFanOutMeasurement();
+    }
     //! [create an run technologies]
 
     return EXIT_SUCCESS;
@@ -21,6 +21,8 @@
 #include "example_common.hpp"
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iox/duration.hpp"
 
 class IcePerfLeader
 {
@@ -31,6 +33,9 @@ class IcePerfLeader
 
   private:
     void doMeasurement(IcePerfBase& ipcTechnology) noexcept;
+    void doFanOutMeasurement() noexcept;
+    iox::units::Duration measurePublishDuration(const iox::popo::PublisherOptions& publisherOptions,
+                                                const uint32_t numberOfSubscribers) noexcept;
 
   private:
     const PerfSettings m_settings;
@@ -33,10 +33,11 @@ int main(int argc, char* argv[])
                                       {"benchmark", required_argument, nullptr, 'b'},
                                       {"technology", required_argument, nullptr, 't'},
                                       {"number-of-samples", required_argument, nullptr, 't'},
+                                      {"fan-out", required_argument, nullptr, 'f'},
                                       {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* shortOptions = "hb:t:n:";
+    constexpr const char* shortOptions = "hb:t:n:f:";
     int32_t index{0};
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, shortOptions, longOptions, &index), opt != -1))
@@ -60,6 +61,11 @@ int main(int argc, char* argv[])
             std::cout << "-n, --number-of-samples <N>       Set the number of samples sent in a benchmark round"
                       << std::endl;
             std::cout << "                                  default = '10000'" << std::endl;
+            std::cout << "-f, --fan-out <N>                 Additionally measure the per subscriber cost of publishing"
+                      << std::endl;
+            std::cout << "                                  to N local subscribers; requires the iceoryx C++ API"
+                      << std::endl;
+            std::cout << "                                  default = '0' (disabled)" << std::endl;
 
             return EXIT_SUCCESS;
         case 'b':
@@ -117,6 +123,15 @@ int main(int argc, char* argv[])
                 return EXIT_FAILURE;
             }
             break;
+        case 'f':
+            if (!iox::cxx::convert::fromString(optarg, settings.numberOfFanOutSubscribers)
+                || settings.numberOfFanOutSubscribers > iox::MAX_SUBSCRIBERS_PER_PUBLISHER)
+            {
+                std::cerr << "Could not parse 'fan-out' parameter or it exceeds the maximum of "
+                          << iox::MAX_SUBSCRIBERS_PER_PUBLISHER << " subscribers!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
         default:
             return EXIT_FAILURE;
         };
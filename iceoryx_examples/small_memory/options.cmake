@@ -19,9 +19,13 @@ set(IOX_MAX_SUBSCRIBERS 8 CACHE STRING "")
 set(IOX_MAX_INTERFACE_NUMBER 2 CACHE STRING "")
 set(IOX_MAX_SUBSCRIBERS_PER_PUBLISHER 2 CACHE STRING "")
 set(IOX_MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY 2 CACHE STRING "")
+set(IOX_MAX_CHUNKS_PER_PUBLISHER_BATCH 2 CACHE STRING "")
 set(IOX_MAX_PUBLISHER_HISTORY 2 CACHE STRING "")
 set(IOX_MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY 2 CACHE STRING "")
+set(IOX_MAX_CHUNK_MAGAZINE_CAPACITY 2 CACHE STRING "")
+set(IOX_MAX_CHUNK_RINGS_PER_SUBSCRIBER 1 CACHE STRING "")
 set(IOX_MAX_PROCESS_NUMBER 2 CACHE STRING "")
+set(IOX_MAX_CONTROL_CHANNEL_REQUESTS 2 CACHE STRING "")
 set(IOX_MAX_NODE_NUMBER 8 CACHE STRING "")
 set(IOX_MAX_NODE_PER_PROCESS 8 CACHE STRING "")
 set(IOX_MAX_SHM_SEGMENTS 2 CACHE STRING "")
@@ -87,11 +87,26 @@ class LoFFLi
     /// @return true if index is valid, false otherwise
     bool pop(Index_t& index) noexcept;
 
+    /// Pop multiple values from the free-list with a single compare-and-swap on the head
+    /// @param [out] indices array with at least 'count' elements which receives the indices of the elements to use
+    /// @param [in] count is the number of values to pop
+    /// @return true if all 'count' indices are valid, false if the free-list contains less than 'count' elements; in
+    ///         this case no value is popped
+    /// @note an element of 'indices' is written only after the corresponding value is popped, hence 'indices' never
+    ///       contains a value which is still in the free-list, even if the caller terminates during the pop
+    bool pop(Index_t* const indices, const uint32_t count) noexcept;
+
     /// Push previously poped element
     /// @param [in] index to previously poped element
     /// @return true if index is valid or not yet pushed, false otherwise
     bool push(const Index_t index) noexcept;
 
+    /// Push multiple previously poped elements with a single compare-and-swap on the head
+    /// @param [in] indices array with 'count' indices of previously poped elements
+    /// @param [in] count is the number of values to push
+    /// @return true if all indices are valid and not yet pushed, false otherwise; in this case no value is pushed
+    bool push(const Index_t* const indices, const uint32_t count) noexcept;
+
     /// Calculates the required memory size for a free-list
     /// @param [in] capacity is the number of elements of the free-list
     /// @return the required memory size for a free-list with the requested capacity
@@ -38,6 +38,12 @@ using ThreadName_t = string<MAX_THREAD_NAME_LENGTH>;
 void setThreadName(std::thread::native_handle_type thread, const ThreadName_t& name) noexcept;
 ThreadName_t getThreadName(std::thread::native_handle_type thread) noexcept;
 
+/// @brief Restricts the execution of the thread to the provided cpu
+/// @param[in] thread the native handle of the thread
+/// @param[in] cpu the index of the cpu the thread shall run on
+/// @return true if the affinity was set, false if the cpu does not exist or the platform does not support it
+bool setThreadCpuAffinity(std::thread::native_handle_type thread, const uint32_t cpu) noexcept;
+
 enum class ThreadError
 {
     INSUFFICIENT_MEMORY,
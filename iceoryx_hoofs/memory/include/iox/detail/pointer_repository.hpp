@@ -21,6 +21,8 @@
 #include "iox/optional.hpp"
 #include "iox/vector.hpp"
 
+#include <atomic>
+
 namespace iox
 {
 constexpr uint64_t MAX_POINTER_REPO_CAPACITY{10000U};
@@ -30,14 +32,29 @@ constexpr uint64_t MAX_POINTER_REPO_CAPACITY{10000U};
 /// Up to CAPACITY segments can be registered with MIN_ID = 1 to MAX_ID = CAPACITY - 1
 /// id 0 is reserved and allows relative pointers to behave like normal pointers
 /// (which is equivalent to measure the offset relative to 0).
+/// As long as the registered segments do not overlap, the ids are additionally kept sorted by their base pointer and
+/// searchId uses a binary search and a cache of the last found id. Overlapping segments are searched linearly in order
+/// to return the lowest id whose segment contains the pointer.
+/// searchId and getBasePtr can be called concurrently with the registration and unregistration of segments. The sorted
+/// ids are double buffered and a search is repeated when the buffer it used was modified in the meantime. The
+/// registration and unregistration of segments must not be called concurrently with each other.
 template <typename id_t, typename ptr_t, uint64_t CAPACITY = MAX_POINTER_REPO_CAPACITY>
 class PointerRepository final
 {
   private:
     struct Info
     {
-        ptr_t basePtr{nullptr};
-        ptr_t endPtr{nullptr};
+        std::atomic<ptr_t> basePtr{nullptr};
+        std::atomic<ptr_t> endPtr{nullptr};
+    };
+
+    struct SortedIds
+    {
+        /// @note the ids are not initialized; only the first 'size' ids are written before they are published
+        // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+        std::atomic<id_t> ids[CAPACITY];
+        std::atomic<uint64_t> size{0U};
+        std::atomic_bool hasOverlappingSegments{false};
     };
 
     static constexpr id_t MIN_ID{1U};
@@ -96,16 +113,25 @@ class PointerRepository final
     id_t searchId(const ptr_t ptr) const noexcept;
 
   private:
-    /// @todo iox-#1701 if required protect vector against concurrent modification
-    /// whether this is required depends on the use case, we currently do not need it
-    /// we control the ids, so if they are consecutive we only need a vector/array to get the address
+    /// @note we control the ids, so if they are consecutive we only need a vector/array to get the address
     /// this variable exists once per application using relative pointers,
     /// and each needs to initialize it via register calls above
-
     iox::vector<Info, CAPACITY> m_info;
-    uint64_t m_maxRegistered{0U};
+
+    /// @note the buffer with the index 'm_sortedIdsVersion % 2' is published, the other one is modified
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    SortedIds m_sortedIds[2U];
+    std::atomic<uint64_t> m_sortedIdsVersion{0U};
+    mutable std::atomic<id_t> m_lastFoundId{RAW_POINTER_BEHAVIOUR_ID};
 
     bool addPointerIfIdIsFree(const id_t id, const ptr_t ptr, const uint64_t size) noexcept;
+    bool isInSegment(const id_t id, const ptr_t ptr) const noexcept;
+    id_t searchIdLinear(const SortedIds& sortedIds, const ptr_t ptr) const noexcept;
+    id_t searchIdSorted(const SortedIds& sortedIds, const ptr_t ptr) const noexcept;
+    void addToSortedIds(const id_t id) noexcept;
+    void removeFromSortedIds(const id_t id) noexcept;
+    SortedIds& beginModificationOfSortedIds() noexcept;
+    void publishSortedIds(SortedIds& sortedIds, const uint64_t size) noexcept;
 };
 } // namespace iox
 
@@ -60,9 +60,12 @@ inline bool PointerRepository<id_t, ptr_t, CAPACITY>::unregisterPtr(const id_t i
 {
     if ((id <= MAX_ID) && (id >= MIN_ID))
     {
-        if (m_info[id].basePtr != nullptr)
+        if (m_info[id].basePtr.load(std::memory_order_relaxed) != nullptr)
         {
-            m_info[id].basePtr = nullptr;
+            // a search must not find the id anymore before its segment is reset
+            removeFromSortedIds(id);
+            m_info[id].basePtr.store(nullptr, std::memory_order_relaxed);
+            m_info[id].endPtr.store(nullptr, std::memory_order_relaxed);
 
             /// @note do not search for next lower registered index but we could do it here
             return true;
@@ -75,11 +78,13 @@ inline bool PointerRepository<id_t, ptr_t, CAPACITY>::unregisterPtr(const id_t i
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
 inline void PointerRepository<id_t, ptr_t, CAPACITY>::unregisterAll() noexcept
 {
+    publishSortedIds(beginModificationOfSortedIds(), 0U);
     for (auto& info : m_info)
     {
-        info.basePtr = nullptr;
+        info.basePtr.store(nullptr, std::memory_order_relaxed);
+        info.endPtr.store(nullptr, std::memory_order_relaxed);
     }
-    m_maxRegistered = 0U;
+    m_lastFoundId.store(RAW_POINTER_BEHAVIOUR_ID, std::memory_order_relaxed);
 }
 
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
@@ -87,7 +92,7 @@ inline ptr_t PointerRepository<id_t, ptr_t, CAPACITY>::getBasePtr(const id_t id)
 {
     if ((id <= MAX_ID) && (id >= MIN_ID))
     {
-        return m_info[id].basePtr;
+        return m_info[id].basePtr.load(std::memory_order_acquire);
     }
 
     /// @note for id 0 nullptr is returned, meaning we will later interpret a relative pointer by casting the offset
@@ -100,36 +105,195 @@ inline ptr_t PointerRepository<id_t, ptr_t, CAPACITY>::getBasePtr(const id_t id)
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
 inline id_t PointerRepository<id_t, ptr_t, CAPACITY>::searchId(const ptr_t ptr) const noexcept
 {
-    for (id_t id{1U}; id <= m_maxRegistered; ++id)
+    while (true)
     {
-        // return first id where the ptr is in the corresponding interval
-        // AXIVION Next Construct AutosarC++19_03-M5.14.1 : False positive. vector::operator[](index) has no side-effect when index is less than vector size which is guaranteed by PointerRepository design
-        if ((ptr >= m_info[id].basePtr) && (ptr <= m_info[id].endPtr))
+        const auto version = m_sortedIdsVersion.load(std::memory_order_acquire);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) the index is always 0 or 1
+        const auto& sortedIds = m_sortedIds[version % 2U];
+        const auto id = sortedIds.hasOverlappingSegments.load(std::memory_order_relaxed)
+                            ? searchIdLinear(sortedIds, ptr)
+                            : searchIdSorted(sortedIds, ptr);
+
+        // the buffer is only modified after the other one was published; if the version did not change, the search
+        // read a consistent state
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_sortedIdsVersion.load(std::memory_order_relaxed) == version)
         {
             return id;
         }
     }
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline bool PointerRepository<id_t, ptr_t, CAPACITY>::isInSegment(const id_t id, const ptr_t ptr) const noexcept
+{
+    if ((id < MIN_ID) || (id > MAX_ID))
+    {
+        return false;
+    }
+    // AXIVION Next Construct AutosarC++19_03-M5.14.1 : False positive. vector::operator[](index) has no side-effect when index is less than vector size which is guaranteed by PointerRepository design
+    const auto basePtr = m_info[id].basePtr.load(std::memory_order_relaxed);
+    return (basePtr != nullptr) && (ptr >= basePtr) && (ptr <= m_info[id].endPtr.load(std::memory_order_relaxed));
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline id_t PointerRepository<id_t, ptr_t, CAPACITY>::searchIdLinear(const SortedIds& sortedIds,
+                                                                     const ptr_t ptr) const noexcept
+{
+    // return the lowest id where the ptr is in the corresponding interval
+    id_t foundId{RAW_POINTER_BEHAVIOUR_ID};
+    const auto size = sortedIds.size.load(std::memory_order_acquire);
+    for (uint64_t i = 0U; i < size; ++i)
+    {
+        const auto id = sortedIds.ids[i].load(std::memory_order_relaxed);
+        if (((foundId == RAW_POINTER_BEHAVIOUR_ID) || (id < foundId)) && isInSegment(id, ptr))
+        {
+            foundId = id;
+        }
+    }
     /// @note treat the pointer as a regular pointer if not found
-    /// by setting id to RAW_POINTER_BEHAVIOUR_ID
-    return RAW_POINTER_BEHAVIOUR_ID;
+    /// by keeping the id RAW_POINTER_BEHAVIOUR_ID
+    return foundId;
 }
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline id_t PointerRepository<id_t, ptr_t, CAPACITY>::searchIdSorted(const SortedIds& sortedIds,
+                                                                     const ptr_t ptr) const noexcept
+{
+    // consecutive pointers usually belong to the same segment
+    const auto lastFoundId = m_lastFoundId.load(std::memory_order_relaxed);
+    if (isInSegment(lastFoundId, ptr))
+    {
+        return lastFoundId;
+    }
+
+    // find the segment with the largest base pointer which is not larger than ptr; since the segments do not overlap,
+    // this is the only candidate
+    uint64_t begin{0U};
+    uint64_t end{sortedIds.size.load(std::memory_order_acquire)};
+    while (begin < end)
+    {
+        const auto middle = begin + ((end - begin) / 2U);
+        if (m_info[sortedIds.ids[middle].load(std::memory_order_relaxed)].basePtr.load(std::memory_order_relaxed)
+            <= ptr)
+        {
+            begin = middle + 1U;
+        }
+        else
+        {
+            end = middle;
+        }
+    }
+
+    if (begin == 0U)
+    {
+        /// @note treat the pointer as a regular pointer if not found
+        /// by setting id to RAW_POINTER_BEHAVIOUR_ID
+        return RAW_POINTER_BEHAVIOUR_ID;
+    }
+
+    const auto candidate = sortedIds.ids[begin - 1U].load(std::memory_order_relaxed);
+    if (!isInSegment(candidate, ptr))
+    {
+        return RAW_POINTER_BEHAVIOUR_ID;
+    }
+    m_lastFoundId.store(candidate, std::memory_order_relaxed);
+    return candidate;
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::addToSortedIds(const id_t id) noexcept
+{
+    const auto& publishedIds = m_sortedIds[m_sortedIdsVersion.load(std::memory_order_relaxed) % 2U];
+    auto& modifiedIds = beginModificationOfSortedIds();
+    const auto basePtr = m_info[id].basePtr.load(std::memory_order_relaxed);
+
+    // there are at most CAPACITY ids, hence there is always space
+    const auto publishedSize = publishedIds.size.load(std::memory_order_relaxed);
+    uint64_t size{0U};
+    bool isAdded{false};
+    for (uint64_t i = 0U; i < publishedSize; ++i)
+    {
+        const auto publishedId = publishedIds.ids[i].load(std::memory_order_relaxed);
+        if (!isAdded && (basePtr < m_info[publishedId].basePtr.load(std::memory_order_relaxed)))
+        {
+            modifiedIds.ids[size++].store(id, std::memory_order_relaxed);
+            isAdded = true;
+        }
+        modifiedIds.ids[size++].store(publishedId, std::memory_order_relaxed);
+    }
+    if (!isAdded)
+    {
+        modifiedIds.ids[size++].store(id, std::memory_order_relaxed);
+    }
+    publishSortedIds(modifiedIds, size);
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::removeFromSortedIds(const id_t id) noexcept
+{
+    const auto& publishedIds = m_sortedIds[m_sortedIdsVersion.load(std::memory_order_relaxed) % 2U];
+    auto& modifiedIds = beginModificationOfSortedIds();
+
+    const auto publishedSize = publishedIds.size.load(std::memory_order_relaxed);
+    uint64_t size{0U};
+    for (uint64_t i = 0U; i < publishedSize; ++i)
+    {
+        const auto publishedId = publishedIds.ids[i].load(std::memory_order_relaxed);
+        if (publishedId != id)
+        {
+            modifiedIds.ids[size++].store(publishedId, std::memory_order_relaxed);
+        }
+    }
+    publishSortedIds(modifiedIds, size);
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline typename PointerRepository<id_t, ptr_t, CAPACITY>::SortedIds&
+PointerRepository<id_t, ptr_t, CAPACITY>::beginModificationOfSortedIds() noexcept
+{
+    // orders the modification after the publication of the current version; a search which reads a modified id
+    // therefore sees a newer version afterwards and is repeated
+    std::atomic_thread_fence(std::memory_order_release);
+    return m_sortedIds[(m_sortedIdsVersion.load(std::memory_order_relaxed) + 1U) % 2U];
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::publishSortedIds(SortedIds& sortedIds,
+                                                                       const uint64_t size) noexcept
+{
+    bool hasOverlappingSegments{false};
+    for (uint64_t i = 1U; (i < size) && !hasOverlappingSegments; ++i)
+    {
+        hasOverlappingSegments =
+            m_info[sortedIds.ids[i].load(std::memory_order_relaxed)].basePtr.load(std::memory_order_relaxed)
+            <= m_info[sortedIds.ids[i - 1U].load(std::memory_order_relaxed)].endPtr.load(std::memory_order_relaxed);
+    }
+    sortedIds.hasOverlappingSegments.store(hasOverlappingSegments, std::memory_order_relaxed);
+    sortedIds.size.store(size, std::memory_order_release);
+
+    m_sortedIdsVersion.fetch_add(1U, std::memory_order_release);
+}
+
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
 inline bool PointerRepository<id_t, ptr_t, CAPACITY>::addPointerIfIdIsFree(const id_t id,
                                                                            const ptr_t ptr,
                                                                            const uint64_t size) noexcept
 {
-    if (m_info[id].basePtr == nullptr)
+    if (m_info[id].basePtr.load(std::memory_order_relaxed) == nullptr)
     {
-        m_info[id].basePtr = ptr;
         // AXIVION Next Construct AutosarC++19_03-M5.2.9 : Used for pointer arithmetic with void pointer, uintptr_t is capable of holding a void ptr
         // AXIVION Next Construct AutosarC++19_03-A5.2.4 : Cast is needed for pointer arithmetic and casted back
         // to the original type
         // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-        m_info[id].endPtr = reinterpret_cast<ptr_t>(reinterpret_cast<uintptr_t>(ptr) + (size - 1U));
+        m_info[id].endPtr.store(reinterpret_cast<ptr_t>(reinterpret_cast<uintptr_t>(ptr) + (size - 1U)),
+                                std::memory_order_relaxed);
+        m_info[id].basePtr.store(ptr, std::memory_order_release);
 
-        if (id > m_maxRegistered)
+        // the segment must be set before a search can find the id
+        if (ptr != nullptr)
         {
-            m_maxRegistered = id;
+            addToSortedIds(id);
         }
         return true;
     }
@@ -24,6 +24,10 @@
 #include <cstdint>
 #include <limits>
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 namespace iox
 {
 namespace algorithm
@@ -229,6 +233,16 @@ constexpr bool isPowerOfTwo(const T n) noexcept
     // AXIVION Next Construct AutosarC++19_03-M0.1.2, AutosarC++19_03-M0.1.9, FaultDetection-DeadBranches : False positive! 'n' can be zero.
     return (n > 0) && ((n & (n - 1U)) == 0U);
 }
+
+/// @brief Counts the number of consecutive zero bits starting with the least significant bit
+/// @param[in] value which must not be 0
+/// @return the index of the least significant bit which is set
+inline uint64_t countTrailingZeros(const uint64_t value) noexcept;
+
+/// @brief Determines the position of the most significant set bit, i.e. floor(log2(value))
+/// @param[in] value which must not be 0
+/// @return the index of the most significant bit which is set
+inline uint64_t indexOfMostSignificantBit(const uint64_t value) noexcept;
 } // namespace iox
 
 #include "iox/detail/algorithm.inl"
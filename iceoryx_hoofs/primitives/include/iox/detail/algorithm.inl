@@ -86,6 +86,31 @@ doesContainValue(const T1 value, const T2 firstValueListEntry, const ValueList..
 }
 
 } // namespace algorithm
+
+inline uint64_t countTrailingZeros(const uint64_t value) noexcept
+{
+    cxx::Expects(value != 0U);
+#if defined(_MSC_VER)
+    unsigned long index{0U};
+    _BitScanForward64(&index, value);
+    return index;
+#else
+    return static_cast<uint64_t>(__builtin_ctzll(value));
+#endif
+}
+
+inline uint64_t indexOfMostSignificantBit(const uint64_t value) noexcept
+{
+    cxx::Expects(value != 0U);
+#if defined(_MSC_VER)
+    unsigned long index{0U};
+    _BitScanReverse64(&index, value);
+    return index;
+#else
+    constexpr uint64_t INDEX_OF_MOST_SIGNIFICANT_BIT{63U};
+    return INDEX_OF_MOST_SIGNIFICANT_BIT - static_cast<uint64_t>(__builtin_clzll(value));
+#endif
+}
 } // namespace iox
 
 #endif // IOX_HOOFS_PRIMITIVES_ALGORITHM_INL
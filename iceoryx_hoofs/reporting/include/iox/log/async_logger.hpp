@@ -0,0 +1,203 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_REPORTING_LOG_ASYNC_LOGGER_HPP
+#define IOX_HOOFS_REPORTING_LOG_ASYNC_LOGGER_HPP
+
+#include "iox/log/logger.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
+#include <mutex>
+#include <thread>
+
+namespace iox
+{
+namespace log
+{
+/// @brief Options to adjust the output of the AsyncLogger
+struct AsyncLoggerOptions
+{
+    /// @brief the interval in milliseconds in which the background thread formats the pending log messages
+    uint32_t formatIntervalMs{10U};
+
+    /// @brief the maximum number of log messages which are written per second; the surplus messages are suppressed
+    /// and only their number is reported; 0 disables the rate limit
+    uint32_t maxLogMessagesPerSecond{0U};
+
+    /// @brief if true, repetitions of the same log message are collapsed into a single line with the number of
+    /// repetitions
+    bool deduplicateLogMessages{false};
+
+    /// @brief Writes a completely formatted and null terminated log message including the header; if not set, the log
+    /// messages are written to the console
+    /// @note The sink is called from the background thread or from the thread which processes the pending log messages
+    /// but never concurrently; it and its context must outlive the logger
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but a low-level C-style string
+    void (*logMessageSink)(const char* logMessage, void* context){nullptr};
+
+    /// @brief passed unchanged to every call of the logMessageSink
+    void* logMessageSinkContext{nullptr};
+};
+
+/// @brief A logger which moves the formatting and the output of the log messages off the calling thread. Each thread
+/// writes its log messages as fixed size records into its own lock-free ring buffer and only takes the raw timestamp;
+/// a background thread merges the records of all threads in timestamp order, creates the log message header and writes
+/// the messages to the console or to the logMessageSink of the options. The background thread does not call any
+/// virtual method, therefore a derived class does not need to stop it before its own destruction. When a ring buffer is full, the log message is dropped instead of blocking the calling
+/// thread and the number of dropped messages is reported later on.
+/// @code
+/// static iox::log::AsyncLogger asyncLogger{options};
+/// iox::log::Logger::setActiveLogger(asyncLogger);
+/// iox::log::Logger::init();
+/// @endcode
+/// @note The logger must outlive all threads which are logging. Log messages longer than MAX_LOG_MESSAGE_LENGTH are
+/// truncated and at most MAX_NUMBER_OF_THREADS threads can log concurrently; the log messages of further threads are
+/// dropped until the ring buffer of a finished thread is released.
+class AsyncLogger : public Logger
+{
+  public:
+    static constexpr uint32_t MAX_NUMBER_OF_THREADS{32U};
+    static constexpr uint32_t RING_BUFFER_CAPACITY{64U};
+    static constexpr uint32_t MAX_LOG_MESSAGE_LENGTH{512U};
+
+    explicit AsyncLogger(const AsyncLoggerOptions& options = {}) noexcept;
+    ~AsyncLogger() override;
+
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger(AsyncLogger&&) = delete;
+
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(AsyncLogger&&) = delete;
+
+    /// @brief Formats and writes all pending log messages from the calling thread, e.g. before the application
+    /// terminates
+    void processPendingLogMessages() noexcept;
+
+    /// @brief The number of log messages which were dropped since a ring buffer was full or no ring buffer was
+    /// available for the logging thread
+    /// @return the number of dropped log messages
+    uint64_t getNumberOfDroppedLogMessages() const noexcept;
+
+  protected:
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : See ConsoleLogger::createLogMessageHeader
+    void createLogMessageHeader(const char* file,
+                                const int line,
+                                const char* function,
+                                LogLevel logLevel) noexcept override;
+
+    void flush() noexcept override;
+
+  private:
+    struct Record
+    {
+        timespec timestamp{0, 0};
+        LogLevel logLevel{LogLevel::OFF};
+        // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but a low-level C-style string
+        const char* file{nullptr};
+        int line{0};
+        uint32_t length{0U};
+        // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but as actual character
+        // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+        char message[MAX_LOG_MESSAGE_LENGTH + 1U];
+    };
+
+    enum class RingState : uint8_t
+    {
+        FREE,
+        CLAIMING,
+        OWNED,
+        ABANDONED,
+        DETACHED,
+    };
+
+    /// @brief Single producer single consumer ring buffer; the producer is the thread which claimed the ring and the
+    /// consumer is the background thread of the owning logger
+    struct Ring
+    {
+        std::atomic<RingState> state{RingState::FREE};
+        std::atomic<uint64_t> ownerId{0U};
+        std::atomic<uint64_t> writeIndex{0U};
+        std::atomic<uint64_t> readIndex{0U};
+        // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+        Record records[RING_BUFFER_CAPACITY];
+    };
+
+    /// @brief The ring of the calling thread; the ring is given back when the thread terminates or logs to another
+    /// AsyncLogger
+    struct ThreadLocalData
+    {
+        ThreadLocalData() noexcept = default;
+        ~ThreadLocalData();
+
+        ThreadLocalData(const ThreadLocalData&) = delete;
+        ThreadLocalData(ThreadLocalData&&) = delete;
+
+        ThreadLocalData& operator=(const ThreadLocalData&) = delete;
+        ThreadLocalData& operator=(ThreadLocalData&&) = delete;
+
+        void releaseRing() noexcept;
+
+        Ring* ring{nullptr};
+        uint64_t loggerId{0U};
+        Record header;
+    };
+
+    static ThreadLocalData& getThreadLocalData() noexcept;
+
+    /// @brief The rings are shared by all AsyncLogger instances and live until the end of the application, this
+    /// ensures that a terminating thread can always give back its ring
+    static Ring* rings() noexcept;
+
+    Ring* acquireRing() noexcept;
+    void run() noexcept;
+    void stopFormatter() noexcept;
+    void processRecord(const Record& record) noexcept;
+    void writeRecord(const Record& record) noexcept;
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but a low-level C-style string
+    void writeLogMessage(const char* logMessage) noexcept;
+    void writeSummary(const LogLevel logLevel, const char* message) noexcept;
+    void writeRepetitionSummary() noexcept;
+    void writeRepetitionSummaryIfOutdated(const uint64_t nowNs) noexcept;
+    void startNewRateLimitWindowIfElapsed(const uint64_t nowNs) noexcept;
+    bool isRateLimitExceeded(const uint64_t nowNs) noexcept;
+    static uint64_t steadyTimeNs() noexcept;
+
+    const AsyncLoggerOptions m_options;
+    const uint64_t m_id;
+    std::atomic<uint64_t> m_droppedLogMessages{0U};
+
+    std::mutex m_processingMutex;
+    uint64_t m_reportedDroppedLogMessages{0U};
+    Record m_lastRecord;
+    uint64_t m_repetitions{0U};
+    uint64_t m_firstRepetitionNs{0U};
+    uint64_t m_suppressedLogMessages{0U};
+    uint64_t m_rateLimitWindowStartNs{0U};
+    uint64_t m_logMessagesInRateLimitWindow{0U};
+
+    std::mutex m_wakeUpMutex;
+    std::condition_variable m_wakeUp;
+    bool m_stop{false};
+    std::thread m_formatter;
+};
+
+} // namespace log
+} // namespace iox
+
+#endif // IOX_HOOFS_REPORTING_LOG_ASYNC_LOGGER_HPP
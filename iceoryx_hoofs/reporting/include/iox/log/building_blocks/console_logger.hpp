@@ -24,6 +24,7 @@
 #include <atomic>
 #include <cstdint>
 #include <cstdio>
+#include <ctime>
 #include <mutex>
 
 namespace iox
@@ -66,6 +67,18 @@ class ConsoleLogger
 
     virtual void flush() noexcept;
 
+    /// @brief Writes the header of a log message with the timestamp and the log level into the provided buffer
+    /// @param[in] buffer the buffer for the header
+    /// @param[in] nullTerminatedBufferSize the size of the buffer including the null termination
+    /// @param[in] timestamp the point in time of the log message
+    /// @param[in] logLevel the log level of the log message
+    /// @return the number of characters of the header without the null termination
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but as actual character
+    static uint32_t formatLogMessageHeader(char* buffer,
+                                           const uint32_t nullTerminatedBufferSize,
+                                           const timespec& timestamp,
+                                           const LogLevel logLevel) noexcept;
+
     LogBuffer getLogBuffer() const noexcept;
 
     void assumeFlushed() noexcept;
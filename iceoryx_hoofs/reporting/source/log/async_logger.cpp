@@ -0,0 +1,450 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/log/async_logger.hpp"
+#include "iceoryx_platform/time.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+namespace iox
+{
+namespace log
+{
+namespace
+{
+constexpr uint64_t NANOSECONDS_PER_SECOND{1000000000U};
+/// a repeated log message is summarized at least once per second even when it is still repeated
+constexpr uint64_t REPETITION_SUMMARY_INTERVAL_NS{NANOSECONDS_PER_SECOND};
+/// large enough for the timestamp, the log level and the color codes of the log message header
+constexpr uint32_t MAX_LOG_MESSAGE_HEADER_LENGTH{128U};
+
+bool isEarlier(const timespec& lhs, const timespec& rhs) noexcept
+{
+    return (lhs.tv_sec < rhs.tv_sec) || ((lhs.tv_sec == rhs.tv_sec) && (lhs.tv_nsec < rhs.tv_nsec));
+}
+
+timespec realtimeNow() noexcept
+{
+    timespec timestamp{0, 0};
+    // intentionally avoid using 'iox::posixCall' here to keep the logger dependency free
+    if (clock_gettime(CLOCK_REALTIME, &timestamp) != 0)
+    {
+        // a timestamp from 01.01.1970 already indicates an issue with the clock
+        timestamp = {0, 0};
+    }
+    return timestamp;
+}
+
+uint64_t nextLoggerId() noexcept
+{
+    static std::atomic<uint64_t> s_loggerId{0U};
+    return s_loggerId.fetch_add(1U, std::memory_order_relaxed) + 1U;
+}
+} // namespace
+
+AsyncLogger::AsyncLogger(const AsyncLoggerOptions& options) noexcept
+    : m_options(options)
+    , m_id(nextLoggerId())
+    , m_formatter([this] { run(); })
+{
+}
+
+AsyncLogger::~AsyncLogger()
+{
+    stopFormatter();
+
+    // the rings of threads which are still alive are given back when these threads terminate
+    auto* allRings = rings();
+    for (uint32_t i = 0U; i < MAX_NUMBER_OF_THREADS; ++i)
+    {
+        auto& ring = allRings[i];
+        if (ring.ownerId.load(std::memory_order_acquire) != m_id)
+        {
+            continue;
+        }
+        auto expected = RingState::OWNED;
+        if (!ring.state.compare_exchange_strong(expected, RingState::DETACHED, std::memory_order_acq_rel)
+            && expected == RingState::ABANDONED)
+        {
+            ring.state.compare_exchange_strong(expected, RingState::FREE, std::memory_order_acq_rel);
+        }
+    }
+}
+
+AsyncLogger::ThreadLocalData& AsyncLogger::getThreadLocalData() noexcept
+{
+    thread_local static ThreadLocalData data;
+    return data;
+}
+
+AsyncLogger::ThreadLocalData::~ThreadLocalData()
+{
+    releaseRing();
+}
+
+void AsyncLogger::ThreadLocalData::releaseRing() noexcept
+{
+    if (ring != nullptr)
+    {
+        auto expected = RingState::OWNED;
+        if (!ring->state.compare_exchange_strong(expected, RingState::ABANDONED, std::memory_order_acq_rel)
+            && expected == RingState::DETACHED)
+        {
+            // the owning logger is already gone and nobody consumes the remaining records
+            ring->state.store(RingState::FREE, std::memory_order_release);
+        }
+    }
+    ring = nullptr;
+    loggerId = 0U;
+}
+
+AsyncLogger::Ring* AsyncLogger::rings() noexcept
+{
+    // NOLINTJUSTIFICATION the rings must outlive every AsyncLogger and every thread
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    static Ring s_rings[MAX_NUMBER_OF_THREADS];
+    return &s_rings[0];
+}
+
+AsyncLogger::Ring* AsyncLogger::acquireRing() noexcept
+{
+    auto* allRings = rings();
+    for (uint32_t i = 0U; i < MAX_NUMBER_OF_THREADS; ++i)
+    {
+        auto& ring = allRings[i];
+        auto expected = RingState::FREE;
+        if (ring.state.compare_exchange_strong(expected, RingState::CLAIMING, std::memory_order_acq_rel))
+        {
+            // discard the records which a detached logger did not consume anymore
+            ring.readIndex.store(ring.writeIndex.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            ring.ownerId.store(m_id, std::memory_order_relaxed);
+            ring.state.store(RingState::OWNED, std::memory_order_release);
+            return &ring;
+        }
+    }
+    return nullptr;
+}
+
+// AXIVION Next Construct AutosarC++19_03-A3.9.1 : See at declaration in header
+void AsyncLogger::createLogMessageHeader(const char* file, const int line, const char*, LogLevel logLevel) noexcept
+{
+    // only the raw timestamp is taken; the expensive conversion to the local time is done by the background thread
+    auto& header = getThreadLocalData().header;
+    header.timestamp = realtimeNow();
+    header.logLevel = logLevel;
+    header.file = file;
+    header.line = line;
+    assumeFlushed();
+}
+
+void AsyncLogger::flush() noexcept
+{
+    auto& data = getThreadLocalData();
+    if (data.ring == nullptr || data.loggerId != m_id)
+    {
+        data.releaseRing();
+        data.ring = acquireRing();
+        data.loggerId = m_id;
+    }
+
+    auto* ring = data.ring;
+    if (ring == nullptr)
+    {
+        m_droppedLogMessages.fetch_add(1U, std::memory_order_relaxed);
+        assumeFlushed();
+        return;
+    }
+
+    const auto writeIndex = ring->writeIndex.load(std::memory_order_relaxed);
+    if (writeIndex - ring->readIndex.load(std::memory_order_acquire) >= RING_BUFFER_CAPACITY)
+    {
+        m_droppedLogMessages.fetch_add(1U, std::memory_order_relaxed);
+        assumeFlushed();
+        return;
+    }
+
+    auto& record = ring->records[writeIndex % RING_BUFFER_CAPACITY];
+    const auto logBuffer = getLogBuffer();
+    record.timestamp = data.header.timestamp;
+    record.logLevel = data.header.logLevel;
+    record.file = data.header.file;
+    record.line = data.header.line;
+    record.length = static_cast<uint32_t>(
+        (logBuffer.writeIndex < MAX_LOG_MESSAGE_LENGTH) ? logBuffer.writeIndex : MAX_LOG_MESSAGE_LENGTH);
+    std::memcpy(&record.message[0], logBuffer.buffer, record.length);
+    record.message[record.length] = '\0';
+    ring->writeIndex.store(writeIndex + 1U, std::memory_order_release);
+
+    assumeFlushed();
+}
+
+void AsyncLogger::stopFormatter() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(m_wakeUpMutex);
+        m_stop = true;
+    }
+    m_wakeUp.notify_one();
+    if (m_formatter.joinable())
+    {
+        m_formatter.join();
+    }
+
+    processPendingLogMessages();
+
+    std::lock_guard<std::mutex> lock(m_processingMutex);
+    writeRepetitionSummary();
+    // report the suppressed log messages of the current rate limit window
+    startNewRateLimitWindowIfElapsed(m_rateLimitWindowStartNs + NANOSECONDS_PER_SECOND);
+}
+
+void AsyncLogger::run() noexcept
+{
+    std::unique_lock<std::mutex> lock(m_wakeUpMutex);
+    while (!m_stop)
+    {
+        m_wakeUp.wait_for(lock, std::chrono::milliseconds(m_options.formatIntervalMs), [this] { return m_stop; });
+        lock.unlock();
+        processPendingLogMessages();
+        lock.lock();
+    }
+}
+
+void AsyncLogger::processPendingLogMessages() noexcept
+{
+    std::lock_guard<std::mutex> lock(m_processingMutex);
+    auto* allRings = rings();
+
+    // merge the records of all threads in the order of their timestamps
+    while (true)
+    {
+        Ring* nextRing{nullptr};
+        uint64_t nextReadIndex{0U};
+        for (uint32_t i = 0U; i < MAX_NUMBER_OF_THREADS; ++i)
+        {
+            auto& ring = allRings[i];
+            const auto state = ring.state.load(std::memory_order_acquire);
+            if ((state != RingState::OWNED && state != RingState::ABANDONED)
+                || ring.ownerId.load(std::memory_order_relaxed) != m_id)
+            {
+                continue;
+            }
+            const auto readIndex = ring.readIndex.load(std::memory_order_relaxed);
+            if (readIndex == ring.writeIndex.load(std::memory_order_acquire))
+            {
+                continue;
+            }
+            if (nextRing == nullptr
+                || isEarlier(ring.records[readIndex % RING_BUFFER_CAPACITY].timestamp,
+                             nextRing->records[nextReadIndex % RING_BUFFER_CAPACITY].timestamp))
+            {
+                nextRing = &ring;
+                nextReadIndex = readIndex;
+            }
+        }
+
+        if (nextRing == nullptr)
+        {
+            break;
+        }
+        processRecord(nextRing->records[nextReadIndex % RING_BUFFER_CAPACITY]);
+        nextRing->readIndex.store(nextReadIndex + 1U, std::memory_order_release);
+    }
+
+    // the rings of terminated threads are free for other threads once they are drained
+    for (uint32_t i = 0U; i < MAX_NUMBER_OF_THREADS; ++i)
+    {
+        auto& ring = allRings[i];
+        if (ring.state.load(std::memory_order_acquire) == RingState::ABANDONED
+            && ring.ownerId.load(std::memory_order_relaxed) == m_id
+            && ring.readIndex.load(std::memory_order_relaxed) == ring.writeIndex.load(std::memory_order_acquire))
+        {
+            auto expected = RingState::ABANDONED;
+            ring.state.compare_exchange_strong(expected, RingState::FREE, std::memory_order_acq_rel);
+        }
+    }
+
+    const auto droppedLogMessages = m_droppedLogMessages.load(std::memory_order_relaxed);
+    if (droppedLogMessages != m_reportedDroppedLogMessages)
+    {
+        // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+        char message[MAX_LOG_MESSAGE_LENGTH];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+        snprintf(&message[0],
+                 MAX_LOG_MESSAGE_LENGTH,
+                 "Dropped %llu log messages since the log buffer of the logging thread was full",
+                 static_cast<unsigned long long>(droppedLogMessages - m_reportedDroppedLogMessages));
+        m_reportedDroppedLogMessages = droppedLogMessages;
+        writeSummary(LogLevel::WARN, &message[0]);
+    }
+
+    const auto nowNs = steadyTimeNs();
+    writeRepetitionSummaryIfOutdated(nowNs);
+    startNewRateLimitWindowIfElapsed(nowNs);
+}
+
+uint64_t AsyncLogger::getNumberOfDroppedLogMessages() const noexcept
+{
+    return m_droppedLogMessages.load(std::memory_order_relaxed);
+}
+
+void AsyncLogger::processRecord(const Record& record) noexcept
+{
+    const auto nowNs = steadyTimeNs();
+    if (m_options.deduplicateLogMessages && m_lastRecord.logLevel != LogLevel::OFF
+        && record.logLevel == m_lastRecord.logLevel && record.file == m_lastRecord.file
+        && record.line == m_lastRecord.line && record.length == m_lastRecord.length
+        && std::memcmp(&record.message[0], &m_lastRecord.message[0], record.length) == 0)
+    {
+        if (m_repetitions == 0U)
+        {
+            m_firstRepetitionNs = nowNs;
+        }
+        ++m_repetitions;
+        writeRepetitionSummaryIfOutdated(nowNs);
+        return;
+    }
+    writeRepetitionSummary();
+
+    if (isRateLimitExceeded(nowNs))
+    {
+        ++m_suppressedLogMessages;
+        return;
+    }
+
+    writeRecord(record);
+    if (m_options.deduplicateLogMessages)
+    {
+        m_lastRecord = record;
+    }
+}
+
+void AsyncLogger::writeRecord(const Record& record) noexcept
+{
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    char logMessage[MAX_LOG_MESSAGE_HEADER_LENGTH + MAX_LOG_MESSAGE_LENGTH + 1U];
+    const auto headerLength =
+        formatLogMessageHeader(&logMessage[0], MAX_LOG_MESSAGE_HEADER_LENGTH + 1U, record.timestamp, record.logLevel);
+    std::memcpy(&logMessage[headerLength], &record.message[0], record.length);
+    logMessage[headerLength + record.length] = '\0';
+    writeLogMessage(&logMessage[0]);
+}
+
+void AsyncLogger::writeSummary(const LogLevel logLevel, const char* message) noexcept
+{
+    Record summary;
+    summary.timestamp = realtimeNow();
+    summary.logLevel = logLevel;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+    const auto length = snprintf(&summary.message[0], MAX_LOG_MESSAGE_LENGTH + 1U, "%s", message);
+    summary.length = (length < 0) ? 0U
+                                  : ((static_cast<uint32_t>(length) < MAX_LOG_MESSAGE_LENGTH)
+                                         ? static_cast<uint32_t>(length)
+                                         : MAX_LOG_MESSAGE_LENGTH);
+    writeRecord(summary);
+}
+
+void AsyncLogger::writeRepetitionSummary() noexcept
+{
+    if (m_repetitions == 0U)
+    {
+        return;
+    }
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    char message[MAX_LOG_MESSAGE_LENGTH];
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+    snprintf(&message[0],
+             MAX_LOG_MESSAGE_LENGTH,
+             "The previous log message was repeated %llu times",
+             static_cast<unsigned long long>(m_repetitions));
+    m_repetitions = 0U;
+    writeSummary(m_lastRecord.logLevel, &message[0]);
+}
+
+void AsyncLogger::writeRepetitionSummaryIfOutdated(const uint64_t nowNs) noexcept
+{
+    if (m_repetitions > 0U && nowNs - m_firstRepetitionNs >= REPETITION_SUMMARY_INTERVAL_NS)
+    {
+        writeRepetitionSummary();
+    }
+}
+
+void AsyncLogger::startNewRateLimitWindowIfElapsed(const uint64_t nowNs) noexcept
+{
+    if (nowNs - m_rateLimitWindowStartNs < NANOSECONDS_PER_SECOND)
+    {
+        return;
+    }
+    m_rateLimitWindowStartNs = nowNs;
+    m_logMessagesInRateLimitWindow = 0U;
+
+    if (m_suppressedLogMessages > 0U)
+    {
+        // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+        char message[MAX_LOG_MESSAGE_LENGTH];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+        snprintf(&message[0],
+                 MAX_LOG_MESSAGE_LENGTH,
+                 "Suppressed %llu log messages due to the rate limit of %u log messages per second",
+                 static_cast<unsigned long long>(m_suppressedLogMessages),
+                 m_options.maxLogMessagesPerSecond);
+        m_suppressedLogMessages = 0U;
+        writeSummary(LogLevel::WARN, &message[0]);
+    }
+}
+
+bool AsyncLogger::isRateLimitExceeded(const uint64_t nowNs) noexcept
+{
+    if (m_options.maxLogMessagesPerSecond == 0U)
+    {
+        return false;
+    }
+    startNewRateLimitWindowIfElapsed(nowNs);
+    if (m_logMessagesInRateLimitWindow >= m_options.maxLogMessagesPerSecond)
+    {
+        return true;
+    }
+    ++m_logMessagesInRateLimitWindow;
+    return false;
+}
+
+uint64_t AsyncLogger::steadyTimeNs() noexcept
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+// AXIVION Next Construct AutosarC++19_03-A3.9.1 : See at declaration in header
+void AsyncLogger::writeLogMessage(const char* logMessage) noexcept
+{
+    if (m_options.logMessageSink != nullptr)
+    {
+        m_options.logMessageSink(logMessage, m_options.logMessageSinkContext);
+        return;
+    }
+
+    if (std::puts(logMessage) < 0)
+    {
+        /// @todo iox-#1755 printing to the console failed; call the error handler after the error handler refactoring
+        /// was merged
+    }
+}
+
+} // namespace log
+} // namespace iox
@@ -63,6 +63,29 @@ void ConsoleLogger::createLogMessageHeader(const char* file,
         // intentionally do nothing since a timestamp from 01.01.1970 already indicates  an issue with the clock
     }
 
+    /// @todo iox-#1755 do we also want to always log the iceoryx version and commit sha? Maybe do that only in
+    /// 'initLogger' with LogDebug
+
+    /// @todo iox-#1755 add an option to also print file, line and function
+    unused(file);
+    unused(line);
+    unused(function);
+
+    auto& data = getThreadLocalData();
+    const auto headerSize =
+        formatLogMessageHeader(&data.buffer[0], ThreadLocalData::NULL_TERMINATED_BUFFER_SIZE, timestamp, logLevel);
+    if (headerSize > 0U)
+    {
+        data.bufferWriteIndex = headerSize;
+    }
+}
+
+// AXIVION Next Construct AutosarC++19_03-A3.9.1 : See at declaration in header
+uint32_t ConsoleLogger::formatLogMessageHeader(char* buffer,
+                                               const uint32_t nullTerminatedBufferSize,
+                                               const timespec& timestamp,
+                                               const LogLevel logLevel) noexcept
+{
     const time_t time{timestamp.tv_sec};
 
 /// @todo iox-#1755 since this will be part of the platform at one point, we might not be able to handle this via the
@@ -113,14 +136,6 @@ void ConsoleLogger::createLogMessageHeader(const char* file,
     // convert nanoseconds to milliseconds and compute the remaining milliseconds in a second
     const auto milliseconds = static_cast<int32_t>((timestamp.tv_nsec / NANOSECS_PER_MILLISEC) % MILLISECS_PER_SEC);
 
-    /// @todo iox-#1755 do we also want to always log the iceoryx version and commit sha? Maybe do that only in
-    /// 'initLogger' with LogDebug
-
-    /// @todo iox-#1755 add an option to also print file, line and function
-    unused(file);
-    unused(line);
-    unused(function);
-
     // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but as string literal
     // AXIVION Next Construct AutosarC++19_03-M2.13.2 : Required for the color codes; only valid octal digits are used
     constexpr const char* COLOR_GRAY{"\033[0;90m"};
@@ -129,8 +144,8 @@ void ConsoleLogger::createLogMessageHeader(const char* file,
     constexpr const char* COLOR_RESET{"\033[m"};
     // NOLINTJUSTIFICATION snprintf required to populate char array so that it can be flushed in one piece
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
-    const auto retVal = snprintf(&getThreadLocalData().buffer[0],
-                                 ThreadLocalData::NULL_TERMINATED_BUFFER_SIZE,
+    const auto retVal = snprintf(buffer,
+                                 nullTerminatedBufferSize,
                                  "%s%s.%03d %s%s%s: ",
                                  COLOR_GRAY,
                                  &timestampString[0],
@@ -143,22 +158,18 @@ void ConsoleLogger::createLogMessageHeader(const char* file,
         /// @todo iox-#1755 this path should never be reached since we ensured the correct encoding of the character
         /// conversion specifier; nevertheless, we might want to call the error handler after the error handler
         /// refactoring was merged
+        return 0U;
     }
-    else
+
+    const auto stringSizeToLog = static_cast<uint32_t>(retVal);
+    if (stringSizeToLog < nullTerminatedBufferSize)
     {
-        const auto stringSizeToLog = static_cast<uint32_t>(retVal);
-        if (stringSizeToLog <= ThreadLocalData::BUFFER_SIZE)
-        {
-            getThreadLocalData().bufferWriteIndex = stringSizeToLog;
-        }
-        else
-        {
-            /// @todo iox-#1755 currently the buffer is large enough that this does not happen but once the file or
-            /// function will also be printed, they might be too long to fit into the buffer and will be truncated; once
-            /// that feature is implemented, we need to take care of it
-            getThreadLocalData().bufferWriteIndex = ThreadLocalData::BUFFER_SIZE;
-        }
+        return stringSizeToLog;
     }
+    /// @todo iox-#1755 currently the buffer is large enough that this does not happen but once the file or
+    /// function will also be printed, they might be too long to fit into the buffer and will be truncated; once
+    /// that feature is implemented, we need to take care of it
+    return nullTerminatedBufferSize - 1U;
 }
 
 void ConsoleLogger::flush() noexcept
@@ -63,15 +63,18 @@ bool LoFFLi::pop(Index_t& index) noexcept
         newHead.abaCounter += 1;
     } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
 
-    /// comes from outside, is not shared and therefore no synchronization is needed
-    index = oldHead.indexToNextFreeIndex;
+    const auto popedIndex = oldHead.indexToNextFreeIndex;
     /// What if interrupted here an another thread guesses the index and calls push?
     /// @brief murphy case: m_nextFreeIndex does not require any synchronization since it
     ///         either is used by the same thread in push or it is given to another
     ///         thread which performs the cleanup and during this process a synchronization
     ///         is required
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    m_nextFreeIndex.get()[index] = m_invalidIndex;
+    m_nextFreeIndex.get()[popedIndex] = m_invalidIndex;
+
+    /// comes from outside and is written only after the element is marked as poped; if 'index' is placed in shared
+    /// memory and the thread terminates in between, the element is lost but never pushed by someone else
+    index = popedIndex;
 
     /// we need to synchronize m_nextFreeIndex with push so that we can perform a validation
     /// check right before push to avoid double free's
@@ -80,6 +83,74 @@ bool LoFFLi::pop(Index_t& index) noexcept
     return true;
 }
 
+bool LoFFLi::pop(Index_t* const indices, const uint32_t count) noexcept
+{
+    if (count == 0U)
+    {
+        return true;
+    }
+
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+
+    while (true)
+    {
+        if (!m_nextFreeIndex)
+        {
+            return false;
+        }
+
+        // walk along the list to the element after the last one to pop; an element could be popped by another
+        // thread in the meantime, which is detected by the invalid index or by the changed head
+        newHead.indexToNextFreeIndex = oldHead.indexToNextFreeIndex;
+        uint32_t numberOfIndices{0U};
+        for (; numberOfIndices < count && newHead.indexToNextFreeIndex < m_size; ++numberOfIndices)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by m_size
+            newHead.indexToNextFreeIndex = m_nextFreeIndex.get()[newHead.indexToNextFreeIndex];
+        }
+
+        if (numberOfIndices < count)
+        {
+            // the walk is only reliable when the head did not change in the meantime; the aba counter is
+            // incremented with every push and pop
+            Node currentHead = m_head.load(std::memory_order_acquire);
+            if (currentHead.indexToNextFreeIndex == oldHead.indexToNextFreeIndex
+                && currentHead.abaCounter == oldHead.abaCounter)
+            {
+                return false;
+            }
+            oldHead = currentHead;
+            continue;
+        }
+
+        newHead.abaCounter = oldHead.abaCounter + 1;
+        if (m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            break;
+        }
+    }
+
+    /// the poped elements are owned exclusively now and their links cannot change anymore; like with a single value,
+    /// each index is written to 'indices' only after it is marked as poped. An array in shared memory which is
+    /// initialized with invalid indices therefore never contains an element which is still in the free-list
+    auto popedIndex = oldHead.indexToNextFreeIndex;
+    for (uint32_t i = 0U; i < count; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) indices were validated in the walk
+        const auto nextIndex = m_nextFreeIndex.get()[popedIndex];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) indices were validated in the walk
+        m_nextFreeIndex.get()[popedIndex] = m_invalidIndex;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) caller guarantees count elements
+        indices[i] = popedIndex;
+        popedIndex = nextIndex;
+    }
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return true;
+}
+
 bool LoFFLi::push(const Index_t index) noexcept
 {
     /// we synchronize with m_nextFreeIndex in pop to perform the validity check
@@ -107,5 +178,57 @@ bool LoFFLi::push(const Index_t index) noexcept
     return true;
 }
 
+bool LoFFLi::push(const Index_t* const indices, const uint32_t count) noexcept
+{
+    if (count == 0U)
+    {
+        return true;
+    }
+
+    /// see push for a single value
+    std::atomic_thread_fence(std::memory_order_release);
+
+    if (!m_nextFreeIndex)
+    {
+        return false;
+    }
+
+    // chain the indices in the given order; an index which was not poped or which occurs twice is detected since its
+    // entry does not contain the invalid index anymore. In this case the already chained entries are restored
+    for (uint32_t i = 0U; i < count; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) caller guarantees count elements
+        const auto index = indices[i];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+        if (index >= m_size || m_nextFreeIndex.get()[index] != m_invalidIndex)
+        {
+            for (uint32_t j = 0U; j < i; ++j)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) indices were validated above
+                m_nextFreeIndex.get()[indices[j]] = m_invalidIndex;
+            }
+            return false;
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+        m_nextFreeIndex.get()[index] = (i + 1U < count) ? indices[i + 1U] : m_size;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) caller guarantees count elements
+    const auto lastIndex = indices[count - 1U];
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+
+    do
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+        m_nextFreeIndex.get()[lastIndex] = oldHead.indexToNextFreeIndex;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) caller guarantees count elements
+        newHead.indexToNextFreeIndex = indices[0];
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    return true;
+}
+
 } // namespace concurrent
 } // namespace iox
@@ -51,6 +51,17 @@ ThreadName_t getThreadName(std::thread::native_handle_type thread) noexcept
     return ThreadName_t(TruncateToCapacity, &tempName[0]);
 }
 
+bool setThreadCpuAffinity(std::thread::native_handle_type thread, const uint32_t cpu) noexcept
+{
+    return posixCall(iox_pthread_setaffinity_np)(thread, cpu)
+        .returnValueMatchesErrno()
+        .evaluate()
+        .or_else([&cpu](auto& r) {
+            IOX_LOG(WARN) << "Unable to pin the thread to cpu " << cpu << ": " << r.getHumanReadableErrnum();
+        })
+        .has_value();
+}
+
 expected<void, ThreadError> ThreadBuilder::create(optional<Thread>& uninitializedThread,
                                                   const Thread::callable_t& callable) noexcept
 {
@@ -21,6 +21,7 @@
 #include "test.hpp"
 
 #include <algorithm>
+#include <limits>
 #include <random>
 #include <vector>
 
@@ -132,6 +133,144 @@ TYPED_TEST(LoFFLi_test, PopFromUninitializedLoFFLi)
     EXPECT_THAT(loFFLi.pop(index), Eq(false));
 }
 
+TYPED_TEST(LoFFLi_test, PopMultipleReturnsTheRequestedNumberOfIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0b3bd0c4-8e32-4a7b-9f55-0e1c6cf8a2d1");
+    constexpr uint32_t COUNT{Size - 1U};
+    uint32_t indices[COUNT]{};
+    EXPECT_THAT(this->m_loffli.pop(&indices[0], COUNT), Eq(true));
+    for (uint32_t i = 0; i < COUNT; i++)
+    {
+        EXPECT_THAT(indices[i], Eq(i));
+    }
+
+    uint32_t index{0U};
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+    EXPECT_THAT(index, Eq(Size - 1U));
+}
+
+TYPED_TEST(LoFFLi_test, PopMultipleWithMoreIndicesThanAvailablePopsNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a2b4b3e-3c47-4f0f-8f3e-7d5d8c1a9e64");
+    uint32_t index{0U};
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+
+    uint32_t indices[Size]{};
+    EXPECT_THAT(this->m_loffli.pop(&indices[0], Size), Eq(false));
+
+    for (uint32_t i = 1; i < Size; i++)
+    {
+        EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+        EXPECT_THAT(index, Eq(i));
+    }
+}
+
+TYPED_TEST(LoFFLi_test, PushIndicesFromPopMultiple)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e1c8f5a0-2d4b-4c61-b7a3-5f9e0d2c4b18");
+    uint32_t indices[Size]{};
+    ASSERT_THAT(this->m_loffli.pop(&indices[0], Size), Eq(true));
+
+    for (auto index : indices)
+    {
+        EXPECT_THAT(this->m_loffli.push(index), Eq(true));
+    }
+    for (auto index : indices)
+    {
+        EXPECT_THAT(this->m_loffli.push(index), Eq(false));
+    }
+}
+
+TYPED_TEST(LoFFLi_test, PopMultipleWithTooManyIndicesDoesNotWriteTheIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d5a8f2c1-7e39-4b06-a4c8-1f6e9b3d0a72");
+    constexpr uint32_t INVALID_INDEX{std::numeric_limits<uint32_t>::max()};
+    uint32_t indices[Size + 1U];
+    for (auto& index : indices)
+    {
+        index = INVALID_INDEX;
+    }
+
+    EXPECT_THAT(this->m_loffli.pop(&indices[0], Size + 1U), Eq(false));
+
+    for (const auto index : indices)
+    {
+        EXPECT_THAT(index, Eq(INVALID_INDEX));
+    }
+}
+
+TYPED_TEST(LoFFLi_test, PushMultipleMakesTheIndicesAvailableAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5c2e9a71-4d08-4b3f-9a6e-8f1d7c3b2a90");
+    uint32_t indices[Size]{};
+    ASSERT_THAT(this->m_loffli.pop(&indices[0], Size), Eq(true));
+
+    EXPECT_THAT(this->m_loffli.push(&indices[0], Size), Eq(true));
+
+    uint32_t popedIndices[Size]{};
+    ASSERT_THAT(this->m_loffli.pop(&popedIndices[0], Size), Eq(true));
+    for (uint32_t i = 0; i < Size; i++)
+    {
+        EXPECT_THAT(popedIndices[i], Eq(indices[i]));
+    }
+}
+
+TYPED_TEST(LoFFLi_test, PushMultipleInFrontOfTheRemainingIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a4d71f3c-6b2e-4e85-b90a-1c7e5f2d8b63");
+    constexpr uint32_t COUNT{Size - 1U};
+    uint32_t indices[COUNT]{};
+    ASSERT_THAT(this->m_loffli.pop(&indices[0], COUNT), Eq(true));
+
+    EXPECT_THAT(this->m_loffli.push(&indices[0], COUNT), Eq(true));
+
+    uint32_t index{0U};
+    for (uint32_t i = 0; i < COUNT; i++)
+    {
+        EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+        EXPECT_THAT(index, Eq(indices[i]));
+    }
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+    EXPECT_THAT(index, Eq(Size - 1U));
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+}
+
+TYPED_TEST(LoFFLi_test, PushMultipleWithAnIndexWhichWasNotPopedPushesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3e8b0c59-7f21-4a6d-8c34-d59a2e6f1b07");
+    uint32_t indices[Size]{};
+    ASSERT_THAT(this->m_loffli.pop(&indices[0], Size - 1U), Eq(true));
+    indices[Size - 1U] = Size - 1U;
+
+    EXPECT_THAT(this->m_loffli.push(&indices[0], Size), Eq(false));
+
+    uint32_t index{0U};
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+    EXPECT_THAT(index, Eq(Size - 1U));
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+    for (uint32_t i = 0; i < Size - 1U; i++)
+    {
+        EXPECT_THAT(this->m_loffli.push(indices[i]), Eq(true));
+    }
+}
+
+TYPED_TEST(LoFFLi_test, PushMultipleWithADuplicateIndexPushesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f06d3a28-91c4-4e7b-a5f2-6b8e0d4c9a15");
+    uint32_t indices[Size]{};
+    ASSERT_THAT(this->m_loffli.pop(&indices[0], Size), Eq(true));
+    indices[Size - 1U] = indices[0];
+
+    EXPECT_THAT(this->m_loffli.push(&indices[0], Size), Eq(false));
+
+    uint32_t index{0U};
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+    for (uint32_t i = 0; i < Size - 1U; i++)
+    {
+        EXPECT_THAT(this->m_loffli.push(indices[i]), Eq(true));
+    }
+}
+
 TYPED_TEST(LoFFLi_test, SinglePush)
 {
     ::testing::Test::RecordProperty("TEST_ID", "0b7bf346-056b-4b1c-a6e9-92b54233598e");
@@ -0,0 +1,161 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/detail/pointer_repository.hpp"
+#include "test.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+
+constexpr uint64_t SEGMENT_SIZE{64U};
+constexpr uint64_t NUMBER_OF_SEGMENTS{8U};
+
+class PointerRepository_test : public Test
+{
+  public:
+    using Repository_t = PointerRepository<uint16_t, void*, NUMBER_OF_SEGMENTS + 1U>;
+
+    void* segmentPtr(const uint64_t segment, const uint64_t offset = 0U)
+    {
+        // NOLINTJUSTIFICATION Used only for test purposes
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+        return &memory[(segment * SEGMENT_SIZE) + offset];
+    }
+
+    Repository_t sut;
+    // NOLINTJUSTIFICATION Used only for test purposes
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, hicpp-avoid-c-arrays)
+    uint8_t memory[(NUMBER_OF_SEGMENTS + 1U) * SEGMENT_SIZE]{0};
+};
+
+TEST_F(PointerRepository_test, SearchIdFindsDisjointSegmentsRegisteredInArbitraryOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "31962672-f783-4e79-a9e2-5b9846012562");
+    constexpr uint64_t REGISTRATION_ORDER[NUMBER_OF_SEGMENTS]{5U, 1U, 7U, 0U, 3U, 6U, 2U, 4U};
+    uint16_t ids[NUMBER_OF_SEGMENTS]{0U};
+    for (const auto segment : REGISTRATION_ORDER)
+    {
+        auto id = sut.registerPtr(segmentPtr(segment), SEGMENT_SIZE);
+        ASSERT_TRUE(id.has_value());
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) Used only for test purposes
+        ids[segment] = id.value();
+    }
+
+    for (uint64_t segment = 0U; segment < NUMBER_OF_SEGMENTS; ++segment)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) Used only for test purposes
+        const auto expectedId = ids[segment];
+        EXPECT_THAT(sut.searchId(segmentPtr(segment)), Eq(expectedId));
+        EXPECT_THAT(sut.searchId(segmentPtr(segment, SEGMENT_SIZE / 2U)), Eq(expectedId));
+        EXPECT_THAT(sut.searchId(segmentPtr(segment, SEGMENT_SIZE - 1U)), Eq(expectedId));
+    }
+    EXPECT_THAT(sut.searchId(segmentPtr(NUMBER_OF_SEGMENTS)), Eq(Repository_t::RAW_POINTER_BEHAVIOUR_ID));
+}
+
+TEST_F(PointerRepository_test, SearchIdDoesNotFindPointerBetweenSegments)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "10038814-dad0-45cc-8605-7d4903576ae4");
+    ASSERT_TRUE(sut.registerPtr(segmentPtr(0U), SEGMENT_SIZE / 2U).has_value());
+    ASSERT_TRUE(sut.registerPtr(segmentPtr(1U), SEGMENT_SIZE / 2U).has_value());
+
+    EXPECT_THAT(sut.searchId(segmentPtr(0U, SEGMENT_SIZE / 2U)), Eq(Repository_t::RAW_POINTER_BEHAVIOUR_ID));
+    EXPECT_THAT(sut.searchId(segmentPtr(1U, SEGMENT_SIZE / 2U)), Eq(Repository_t::RAW_POINTER_BEHAVIOUR_ID));
+}
+
+TEST_F(PointerRepository_test, SearchIdDoesNotFindUnregisteredSegment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e1b30050-131b-469d-b5ac-84f1b3ec00e1");
+    auto id0 = sut.registerPtr(segmentPtr(0U), SEGMENT_SIZE);
+    auto id1 = sut.registerPtr(segmentPtr(1U), SEGMENT_SIZE);
+    ASSERT_TRUE(id0.has_value());
+    ASSERT_TRUE(id1.has_value());
+
+    // fills the cache with the segment which is unregistered afterwards
+    EXPECT_THAT(sut.searchId(segmentPtr(1U)), Eq(id1.value()));
+    ASSERT_TRUE(sut.unregisterPtr(id1.value()));
+
+    EXPECT_THAT(sut.searchId(segmentPtr(1U)), Eq(Repository_t::RAW_POINTER_BEHAVIOUR_ID));
+    EXPECT_THAT(sut.searchId(segmentPtr(0U)), Eq(id0.value()));
+}
+
+TEST_F(PointerRepository_test, SearchIdFindsReregisteredSegmentAfterUnregisterAll)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5dbe1b46-885b-4fa2-a00f-4f51d33af1be");
+    ASSERT_TRUE(sut.registerPtr(segmentPtr(0U), SEGMENT_SIZE).has_value());
+    EXPECT_THAT(sut.searchId(segmentPtr(0U)), Ne(Repository_t::RAW_POINTER_BEHAVIOUR_ID));
+
+    sut.unregisterAll();
+    EXPECT_THAT(sut.searchId(segmentPtr(0U)), Eq(Repository_t::RAW_POINTER_BEHAVIOUR_ID));
+
+    constexpr uint16_t ID{3U};
+    ASSERT_TRUE(sut.registerPtrWithId(ID, segmentPtr(0U), SEGMENT_SIZE));
+    EXPECT_THAT(sut.searchId(segmentPtr(0U)), Eq(ID));
+}
+
+TEST_F(PointerRepository_test, SearchIdReturnsLowestIdForOverlappingSegments)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1c1d4236-45ad-49dd-859a-e6d94efc7bc6");
+    constexpr uint16_t INNER_ID{1U};
+    constexpr uint16_t OUTER_ID{2U};
+    ASSERT_TRUE(sut.registerPtrWithId(INNER_ID, segmentPtr(1U), SEGMENT_SIZE));
+    ASSERT_TRUE(sut.registerPtrWithId(OUTER_ID, segmentPtr(0U), 3U * SEGMENT_SIZE));
+
+    EXPECT_THAT(sut.searchId(segmentPtr(0U)), Eq(OUTER_ID));
+    EXPECT_THAT(sut.searchId(segmentPtr(1U)), Eq(INNER_ID));
+    EXPECT_THAT(sut.searchId(segmentPtr(2U)), Eq(OUTER_ID));
+
+    ASSERT_TRUE(sut.unregisterPtr(OUTER_ID));
+    EXPECT_THAT(sut.searchId(segmentPtr(0U)), Eq(Repository_t::RAW_POINTER_BEHAVIOUR_ID));
+    EXPECT_THAT(sut.searchId(segmentPtr(1U)), Eq(INNER_ID));
+}
+
+TEST_F(PointerRepository_test, SearchIdFindsPermanentSegmentWhileOtherSegmentsAreRegisteredConcurrently)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "27dd2595-6ef3-4c04-af59-b648b8295ad6");
+    constexpr uint64_t PERMANENT_SEGMENT{4U};
+    constexpr uint64_t NUMBER_OF_REGISTRATIONS{10000U};
+    auto permanentId = sut.registerPtr(segmentPtr(PERMANENT_SEGMENT), SEGMENT_SIZE);
+    ASSERT_TRUE(permanentId.has_value());
+
+    std::atomic_bool keepRunning{true};
+    std::thread registration([&] {
+        for (uint64_t i = 0U; i < NUMBER_OF_REGISTRATIONS; ++i)
+        {
+            const uint64_t segment = (i % 2U == 0U) ? (i % PERMANENT_SEGMENT) : (PERMANENT_SEGMENT + 1U + (i % 3U));
+            sut.registerPtr(segmentPtr(segment), SEGMENT_SIZE).and_then([&](auto id) { sut.unregisterPtr(id); });
+        }
+        keepRunning = false;
+    });
+
+    uint64_t numberOfMismatches{0U};
+    while (keepRunning)
+    {
+        if (sut.searchId(segmentPtr(PERMANENT_SEGMENT, SEGMENT_SIZE / 2U)) != permanentId.value())
+        {
+            ++numberOfMismatches;
+        }
+    }
+    registration.join();
+
+    EXPECT_THAT(numberOfMismatches, Eq(0U));
+}
+} // namespace
@@ -19,6 +19,7 @@
 #include "iox/duration.hpp"
 #include "test.hpp"
 
+#include <limits>
 #include <thread>
 
 namespace
@@ -112,4 +113,29 @@ TEST_F(Thread_test, SetAndGetSmallStringIsWorking)
 
     EXPECT_THAT(getResult.c_str(), StrEq(stringShorterThanThreadNameCapacitiy.c_str()));
 }
+
+TEST_F(Thread_test, SettingCpuAffinityToNonExistingCpuFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "36beb4c8-b446-4d71-939d-3524fa90256a");
+    constexpr uint32_t NON_EXISTING_CPU = std::numeric_limits<uint32_t>::max();
+    std::thread thread([] {});
+
+    EXPECT_FALSE(setThreadCpuAffinity(thread.native_handle(), NON_EXISTING_CPU));
+    thread.join();
+}
+
+#if defined(__linux__)
+TEST_F(Thread_test, SettingCpuAffinityToCurrentCpuWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "90de624b-c105-4d42-8b66-c11a7fbd0edd");
+    // the affinity is set in a separate thread to leave the cpus of the test thread untouched
+    std::thread thread([] {
+        const auto currentCpu = sched_getcpu();
+        ASSERT_THAT(currentCpu, Ge(0));
+
+        EXPECT_TRUE(setThreadCpuAffinity(iox_pthread_self(), static_cast<uint32_t>(currentCpu)));
+    });
+    thread.join();
+}
+#endif
 } // namespace
@@ -226,4 +226,27 @@ TYPED_TEST(algorithm_test_isPowerOfTwo, MaxValueForTypeIsNotPowerOfTwo)
     ::testing::Test::RecordProperty("TEST_ID", "2abdb27d-58de-4e3d-b8fb-8e5f1f3e6327");
     EXPECT_FALSE(isPowerOfTwo(static_cast<typename TestFixture::CurrentType>(TestFixture::MAX)));
 }
+
+TEST_F(algorithm_test, CountTrailingZerosReturnsIndexOfLeastSignificantSetBit)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "32464c36-306f-49f4-9d2e-f8f08a0840c9");
+    EXPECT_THAT(countTrailingZeros(1U), Eq(0U));
+    EXPECT_THAT(countTrailingZeros(0x28U), Eq(3U));
+    EXPECT_THAT(countTrailingZeros(std::numeric_limits<uint64_t>::max()), Eq(0U));
+}
+
+TEST_F(algorithm_test, CountTrailingZerosOfMostSignificantBitIs63)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f1e2d860-7680-48b5-b28a-8e2cb764d325");
+    EXPECT_THAT(countTrailingZeros(uint64_t(1U) << 63U), Eq(63U));
+}
+
+TEST_F(algorithm_test, IndexOfMostSignificantBitReturnsFloorOfLog2)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6b0d3e47-a9c2-4f15-8e73-2d5c1a9f0b68");
+    EXPECT_THAT(indexOfMostSignificantBit(1U), Eq(0U));
+    EXPECT_THAT(indexOfMostSignificantBit(0x28U), Eq(5U));
+    EXPECT_THAT(indexOfMostSignificantBit(0x3FFU), Eq(9U));
+    EXPECT_THAT(indexOfMostSignificantBit(std::numeric_limits<uint64_t>::max()), Eq(63U));
+}
 } // namespace
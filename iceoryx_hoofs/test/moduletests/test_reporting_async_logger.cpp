@@ -0,0 +1,238 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/log/async_logger.hpp"
+
+#include "test.hpp"
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using iox::log::AsyncLogger;
+using iox::log::AsyncLoggerOptions;
+using iox::log::LogLevel;
+
+/// a format interval which is long enough that the background thread does not interfere with the tests
+constexpr uint32_t FORMAT_INTERVAL_FOR_MANUAL_PROCESSING_MS{60U * 60U * 1000U};
+
+/// collects the log messages; it is created before and destroyed after the logger which writes into it
+class LogMessageCollector
+{
+  public:
+    AsyncLoggerOptions sinkInto(AsyncLoggerOptions options)
+    {
+        options.logMessageSink = [](const char* logMessage, void* context) {
+            static_cast<LogMessageCollector*>(context)->collect(logMessage);
+        };
+        options.logMessageSinkContext = this;
+        return options;
+    }
+
+    std::vector<std::string> logMessages()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_logMessages;
+    }
+
+  private:
+    void collect(const char* logMessage)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_logMessages.emplace_back(logMessage);
+    }
+
+    std::mutex m_mutex;
+    std::vector<std::string> m_logMessages;
+};
+
+class AsyncLoggerSut : public AsyncLogger
+{
+  public:
+    AsyncLoggerSut(LogMessageCollector& collector, const AsyncLoggerOptions& options)
+        : AsyncLogger(collector.sinkInto(options))
+        , m_collector(collector)
+    {
+    }
+
+    void log(const LogLevel logLevel, const char* message, const int line = __LINE__)
+    {
+        createLogMessageHeader(__FILE__, line, __FUNCTION__, logLevel);
+        logString(message);
+        flush();
+    }
+
+    std::vector<std::string> logMessages()
+    {
+        return m_collector.logMessages();
+    }
+
+  private:
+    LogMessageCollector& m_collector;
+};
+
+AsyncLoggerOptions manualProcessingOptions()
+{
+    AsyncLoggerOptions options;
+    options.formatIntervalMs = FORMAT_INTERVAL_FOR_MANUAL_PROCESSING_MS;
+    return options;
+}
+
+TEST(AsyncLogger_test, BackgroundThreadWritesTheLogMessagesWithHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cccf4778-42cf-4d43-b01f-7d7e62976c04");
+    AsyncLoggerOptions options;
+    options.formatIntervalMs = 1U;
+    LogMessageCollector collector;
+    AsyncLoggerSut sut{collector, options};
+
+    sut.log(LogLevel::WARN, "Hypnotoad is watching");
+
+    constexpr uint32_t MAX_NUMBER_OF_POLLS{5000U};
+    for (uint32_t i = 0U; i < MAX_NUMBER_OF_POLLS && sut.logMessages().empty(); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    const auto logMessages = sut.logMessages();
+    ASSERT_THAT(logMessages.size(), Eq(1U));
+    EXPECT_THAT(logMessages[0], HasSubstr("Hypnotoad is watching"));
+    EXPECT_THAT(logMessages[0], HasSubstr(iox::log::logLevelDisplayText(LogLevel::WARN)));
+}
+
+TEST(AsyncLogger_test, LogMessagesOfDifferentThreadsAreWrittenInTheOrderOfTheirTimestamps)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "98b37c3f-c9a0-4f68-9266-a357524e4fbc");
+    LogMessageCollector collector;
+    AsyncLoggerSut sut{collector, manualProcessingOptions()};
+
+    sut.log(LogLevel::INFO, "first");
+    std::thread([&] { sut.log(LogLevel::INFO, "second"); }).join();
+    sut.log(LogLevel::INFO, "third");
+    sut.processPendingLogMessages();
+
+    const auto logMessages = sut.logMessages();
+    ASSERT_THAT(logMessages.size(), Eq(3U));
+    EXPECT_THAT(logMessages[0], EndsWith("first"));
+    EXPECT_THAT(logMessages[1], EndsWith("second"));
+    EXPECT_THAT(logMessages[2], EndsWith("third"));
+}
+
+TEST(AsyncLogger_test, LogMessagesAreDroppedAndReportedWhenTheRingBufferIsFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "83040512-c6a3-42b4-8a47-fc9411e2a60a");
+    constexpr uint64_t NUMBER_OF_DROPPED_MESSAGES{5U};
+    LogMessageCollector collector;
+    AsyncLoggerSut sut{collector, manualProcessingOptions()};
+
+    for (uint64_t i = 0U; i < AsyncLogger::RING_BUFFER_CAPACITY + NUMBER_OF_DROPPED_MESSAGES; ++i)
+    {
+        sut.log(LogLevel::ERROR, "out of chunks");
+    }
+    EXPECT_THAT(sut.getNumberOfDroppedLogMessages(), Eq(NUMBER_OF_DROPPED_MESSAGES));
+
+    sut.processPendingLogMessages();
+
+    const auto logMessages = sut.logMessages();
+    ASSERT_THAT(logMessages.size(), Eq(AsyncLogger::RING_BUFFER_CAPACITY + 1U));
+    EXPECT_THAT(logMessages.back(), HasSubstr("Dropped 5 log messages"));
+}
+
+TEST(AsyncLogger_test, RepeatedLogMessagesAreCollapsedWhenDeduplicationIsEnabled)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3b6c450d-b534-4e50-af2a-cffa0ca20e57");
+    auto options = manualProcessingOptions();
+    options.deduplicateLogMessages = true;
+    LogMessageCollector collector;
+    AsyncLoggerSut sut{collector, options};
+
+    constexpr uint64_t NUMBER_OF_REPETITIONS{9U};
+    for (uint64_t i = 0U; i <= NUMBER_OF_REPETITIONS; ++i)
+    {
+        sut.log(LogLevel::WARN, "mempool exhausted", __LINE__);
+    }
+    sut.log(LogLevel::WARN, "mempool recovered");
+    sut.processPendingLogMessages();
+
+    const auto logMessages = sut.logMessages();
+    ASSERT_THAT(logMessages.size(), Eq(3U));
+    EXPECT_THAT(logMessages[0], EndsWith("mempool exhausted"));
+    EXPECT_THAT(logMessages[1], HasSubstr("repeated 9 times"));
+    EXPECT_THAT(logMessages[2], EndsWith("mempool recovered"));
+}
+
+TEST(AsyncLogger_test, RateLimitSuppressesTheSurplusLogMessagesAndReportsThem)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "28079c79-7fc7-4e42-a40b-f779913339ae");
+    constexpr uint32_t MAX_LOG_MESSAGES_PER_SECOND{3U};
+    constexpr uint32_t NUMBER_OF_LOG_MESSAGES{10U};
+    auto options = manualProcessingOptions();
+    options.maxLogMessagesPerSecond = MAX_LOG_MESSAGES_PER_SECOND;
+    LogMessageCollector collector;
+    {
+        AsyncLoggerSut sut{collector, options};
+        for (uint32_t i = 0U; i < NUMBER_OF_LOG_MESSAGES; ++i)
+        {
+            sut.log(LogLevel::INFO, std::to_string(i).c_str());
+        }
+        sut.processPendingLogMessages();
+        EXPECT_THAT(sut.logMessages().size(), Eq(MAX_LOG_MESSAGES_PER_SECOND));
+    }
+
+    const auto logMessages = collector.logMessages();
+    ASSERT_THAT(logMessages.size(), Eq(MAX_LOG_MESSAGES_PER_SECOND + 1U));
+    EXPECT_THAT(logMessages.back(), HasSubstr("Suppressed 7 log messages"));
+}
+
+TEST(AsyncLogger_test, TooLongLogMessagesAreTruncated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3edd3354-6a83-4d87-91b5-89df0f787558");
+    LogMessageCollector collector;
+    AsyncLoggerSut sut{collector, manualProcessingOptions()};
+    const std::string longMessage(AsyncLogger::MAX_LOG_MESSAGE_LENGTH + 10U, 'x');
+
+    sut.log(LogLevel::INFO, longMessage.c_str());
+    sut.processPendingLogMessages();
+
+    const auto logMessages = sut.logMessages();
+    ASSERT_THAT(logMessages.size(), Eq(1U));
+    EXPECT_THAT(logMessages[0], EndsWith(std::string(AsyncLogger::MAX_LOG_MESSAGE_LENGTH, 'x')));
+    EXPECT_THAT(logMessages[0], Not(HasSubstr(std::string(AsyncLogger::MAX_LOG_MESSAGE_LENGTH + 1U, 'x'))));
+}
+
+TEST(AsyncLogger_test, RingBuffersOfTerminatedThreadsAreReused)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f0ecd06b-1ac3-40c5-89fa-af70436c358d");
+    LogMessageCollector collector;
+    AsyncLoggerSut sut{collector, manualProcessingOptions()};
+
+    constexpr uint32_t NUMBER_OF_THREADS{2U * AsyncLogger::MAX_NUMBER_OF_THREADS};
+    for (uint32_t i = 0U; i < NUMBER_OF_THREADS; ++i)
+    {
+        std::thread([&] { sut.log(LogLevel::INFO, "short-lived thread"); }).join();
+        sut.processPendingLogMessages();
+    }
+
+    EXPECT_THAT(sut.getNumberOfDroppedLogMessages(), Eq(0U));
+    EXPECT_THAT(sut.logMessages().size(), Eq(NUMBER_OF_THREADS));
+}
+
+} // namespace
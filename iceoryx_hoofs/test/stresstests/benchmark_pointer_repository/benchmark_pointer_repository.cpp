@@ -0,0 +1,105 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/detail/pointer_repository.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+namespace
+{
+using Repository_t = iox::PointerRepository<uint16_t, void*>;
+
+constexpr uint64_t SEGMENT_SIZE{4096U};
+constexpr uint32_t MAX_NUMBER_OF_SEGMENTS{256U};
+constexpr uint64_t NUMBER_OF_ITERATIONS{10000000U};
+
+/// @brief measures the average latency of searchId in nanoseconds; the pointers are taken round robin from 'pointers'
+double measureSearchId(const Repository_t& repository, void* const* pointers, const uint32_t numberOfPointers)
+{
+    uint64_t idSum{0U};
+    const auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+    {
+        idSum += repository.searchId(pointers[i % numberOfPointers]);
+    }
+    const auto duration =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    // prevents the compiler from optimizing the lookup away
+    if (idSum == 0U)
+    {
+        std::cerr << "no pointer was found in the repository!" << std::endl;
+    }
+
+    return static_cast<double>(duration.count()) / static_cast<double>(NUMBER_OF_ITERATIONS);
+}
+
+/// @brief measures searchId with 'numberOfSegments' registered segments for pointers which always hit the same
+/// segment, pointers which hit alternating segments and for overlapping segments, which require a linear search
+void benchmarkSearchId(const uint32_t numberOfSegments, uint8_t* const memory)
+{
+    std::unique_ptr<Repository_t> repository{new Repository_t()};
+    std::unique_ptr<void*[]> pointers{new void*[numberOfSegments]};
+    for (uint32_t i = 0U; i < numberOfSegments; ++i)
+    {
+        uint8_t* const segment = memory + (static_cast<uint64_t>(i) * SEGMENT_SIZE);
+        if (!repository->registerPtr(segment, SEGMENT_SIZE).has_value())
+        {
+            std::cerr << "registerPtr failed!" << std::endl;
+            return;
+        }
+        pointers[i] = segment + (SEGMENT_SIZE / 2U);
+    }
+
+    std::cout << std::setw(10) << numberOfSegments << std::fixed << std::setprecision(2);
+    std::cout << std::setw(20) << measureSearchId(*repository, &pointers[numberOfSegments - 1U], 1U);
+    std::cout << std::setw(20) << measureSearchId(*repository, pointers.get(), numberOfSegments);
+
+    // the segment with the highest address gets the lowest id; since every segment overlaps with the next one, only the
+    // segment with the highest id contains a pointer to the first half of the segment with the lowest address
+    repository->unregisterAll();
+    for (uint32_t i = 0U; i < numberOfSegments; ++i)
+    {
+        uint8_t* const segment = memory + (static_cast<uint64_t>(numberOfSegments - 1U - i) * SEGMENT_SIZE);
+        if (!repository->registerPtr(segment, 2U * SEGMENT_SIZE).has_value())
+        {
+            std::cerr << "registerPtr failed!" << std::endl;
+            return;
+        }
+    }
+    std::cout << std::setw(20) << measureSearchId(*repository, &pointers[0], 1U) << std::endl;
+}
+} // namespace
+
+int main()
+{
+    std::unique_ptr<uint8_t[]> memory{new uint8_t[(MAX_NUMBER_OF_SEGMENTS + 1U) * SEGMENT_SIZE]};
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << "searchId latency [ns]" << std::endl;
+    std::cout << std::setw(10) << "segments" << std::setw(20) << "same segment" << std::setw(20)
+              << "alternating" << std::setw(20) << "linear search" << std::endl;
+    for (uint32_t numberOfSegments = 1U; numberOfSegments <= MAX_NUMBER_OF_SEGMENTS; numberOfSegments *= 2U)
+    {
+        benchmarkSearchId(numberOfSegments, memory.get());
+    }
+
+    return 0;
+}
@@ -41,10 +41,14 @@ if (BUILD_TEST)
         endif()
     endforeach()
 
+    ### Only posh has stress tests which run with the other tests
+    list(APPEND STRESSTEST_CMD COMMAND ./posh/test/posh_stresstests --gtest_filter=-*.TimingTest_* --gtest_output=xml:${CMAKE_BINARY_DIR}/testresults/posh_StressTestResults.xml)
+
     add_custom_target( all_tests
         ${MODULETEST_CMD}
         ${MOCKTEST_CMD}
         ${INTEGRATIONTEST_CMD}
+        ${STRESSTEST_CMD}
         WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}
         VERBATIM
     )
@@ -68,6 +72,12 @@ if (BUILD_TEST)
         VERBATIM
     )
 
+    add_custom_target( stress_tests
+        ${STRESSTEST_CMD}
+        WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}
+        VERBATIM
+    )
+
     ### create test target with Timing tests
     foreach(cmp IN ITEMS ${COMPONENTS})
         list(APPEND TIMING_MODULETEST_CMD COMMAND ./${cmp}/test/${cmp}_moduletests --gtest_filter=*.TimingTest_* --gtest_output=xml:${CMAKE_BINARY_DIR}/testresults/${cmp}_TimingModuleTestResults.xml)
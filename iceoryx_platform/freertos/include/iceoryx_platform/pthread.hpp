@@ -117,5 +117,11 @@ inline std::thread::native_handle_type iox_pthread_self()
     return {};
 }
 
+inline int iox_pthread_setaffinity_np(std::thread::native_handle_type, const uint32_t)
+{
+    // Not needed on FreeRTOS
+    return 0;
+}
+
 
 #endif // IOX_HOOFS_FREERTOS_PLATFORM_PTHREAD_HPP
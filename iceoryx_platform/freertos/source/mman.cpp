@@ -86,3 +86,26 @@ int munmap(void*, size_t)
 {
     return 0;
 }
+
+int iox_madvise_huge_pages(void*, size_t)
+{
+    FreeRTOS_errno = ENOSYS;
+    return -1;
+}
+
+int iox_mbind_numa_node(void*, size_t, unsigned int)
+{
+    FreeRTOS_errno = ENOSYS;
+    return -1;
+}
+
+int iox_mlock(const void*, size_t)
+{
+    // there is no paging, the memory is always resident
+    return 0;
+}
+
+size_t iox_mapping_page_size(const void*)
+{
+    return 0U;
+}
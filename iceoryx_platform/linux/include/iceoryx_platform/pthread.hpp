@@ -17,6 +17,8 @@
 #ifndef IOX_HOOFS_LINUX_PLATFORM_PTHREAD_HPP
 #define IOX_HOOFS_LINUX_PLATFORM_PTHREAD_HPP
 
+#include <cerrno>
+#include <cstdint>
 #include <pthread.h>
 
 using iox_pthread_t = pthread_t;
@@ -48,4 +50,18 @@ inline iox_pthread_t iox_pthread_self()
     return pthread_self();
 }
 
+/// @brief Restricts the execution of the thread to the provided cpu
+/// @return 0 on success, otherwise an errno value
+inline int iox_pthread_setaffinity_np(iox_pthread_t thread, const uint32_t cpu)
+{
+    if (cpu >= CPU_SETSIZE)
+    {
+        return EINVAL;
+    }
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpu, &cpuSet);
+    return pthread_setaffinity_np(thread, sizeof(cpu_set_t), &cpuSet);
+}
+
 #endif // IOX_HOOFS_LINUX_PLATFORM_PTHREAD_HPP
@@ -16,6 +16,10 @@
 
 #include "iceoryx_platform/mman.hpp"
 
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <sys/syscall.h>
 #include <unistd.h>
 
 // NOLINTNEXTLINE(readability-identifier-naming)
@@ -34,3 +38,99 @@ int iox_shm_close(int fd)
 {
     return close(fd);
 }
+
+int iox_madvise_huge_pages(void* addr, size_t length)
+{
+    return madvise(addr, length, MADV_HUGEPAGE);
+}
+
+int iox_mbind_numa_node(void* addr, size_t length, unsigned int node)
+{
+#if defined(SYS_mbind)
+    // MPOL_BIND of linux/mempolicy.h; the header is not required to be installed
+    constexpr int MPOL_BIND_POLICY{2};
+    constexpr unsigned long MAX_NODE{sizeof(unsigned long) * 8U};
+    if (node >= MAX_NODE)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+    const unsigned long nodeMask{1UL << node};
+    // the kernel only evaluates 'maxnode - 1' bits of the node mask, therefore it is one more than the mask bits
+    return static_cast<int>(syscall(SYS_mbind, addr, length, MPOL_BIND_POLICY, &nodeMask, MAX_NODE + 1U, 0U));
+#else
+    (void)addr;
+    (void)length;
+    (void)node;
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+
+int iox_mlock(const void* addr, size_t length)
+{
+    return mlock(addr, length);
+}
+
+size_t iox_mapping_page_size(const void* addr)
+{
+    FILE* smaps = fopen("/proc/self/smaps", "r");
+    if (smaps == nullptr)
+    {
+        return 0U;
+    }
+
+    const auto address = reinterpret_cast<uintptr_t>(addr);
+    bool isMappingFound{false};
+    size_t kernelPageSizeInKb{0U};
+    size_t residentInKb{0U};
+    size_t pmdMappedInKb{0U};
+    char line[256];
+    while (fgets(line, sizeof(line), smaps) != nullptr)
+    {
+        unsigned long start{0U};
+        unsigned long end{0U};
+        char separator{0};
+        // the header line of a mapping starts with its address range, e.g. '7f0000000000-7f0000200000 rw-s ...'
+        if (sscanf(line, "%lx%c%lx", &start, &separator, &end) == 3 && separator == '-')
+        {
+            if (isMappingFound)
+            {
+                break;
+            }
+            isMappingFound = (start <= address && address < end);
+            continue;
+        }
+
+        if (isMappingFound)
+        {
+            sscanf(line, "KernelPageSize: %zu kB", &kernelPageSizeInKb);
+            sscanf(line, "Rss: %zu kB", &residentInKb);
+            sscanf(line, "ShmemPmdMapped: %zu kB", &pmdMappedInKb);
+        }
+    }
+    fclose(smaps);
+
+    constexpr size_t BYTES_PER_KB{1024U};
+    // transparent huge pages do not change the KernelPageSize of the mapping; the mapping is mainly backed by huge
+    // pages when the majority of its resident memory is mapped by page middle directory entries
+    if (residentInKb > 0U && 2U * pmdMappedInKb >= residentInKb)
+    {
+        size_t hugePageSize{0U};
+        FILE* hugePageSizeFile = fopen("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", "r");
+        if (hugePageSizeFile != nullptr)
+        {
+            if (fscanf(hugePageSizeFile, "%zu", &hugePageSize) != 1)
+            {
+                hugePageSize = 0U;
+            }
+            fclose(hugePageSizeFile);
+        }
+        if (hugePageSize > 0U)
+        {
+            return hugePageSize;
+        }
+    }
+
+    return kernelPageSizeInKb * BYTES_PER_KB;
+}
@@ -23,4 +23,13 @@ int iox_shm_open(const char* name, int oflag, mode_t mode);
 int iox_shm_unlink(const char* name);
 int iox_shm_close(int fd);
 
+/// @brief Advises the system to back the mapping with huge pages; fails with ENOSYS if not supported
+int iox_madvise_huge_pages(void* addr, size_t length);
+/// @brief Binds the pages of the mapping to a NUMA node; fails with ENOSYS if not supported
+int iox_mbind_numa_node(void* addr, size_t length, unsigned int node);
+/// @brief Locks the pages of the mapping in RAM; fails with ENOSYS if not supported
+int iox_mlock(const void* addr, size_t length);
+/// @brief Returns the size of the pages which back the mapping at addr or 0 if it cannot be acquired
+size_t iox_mapping_page_size(const void* addr);
+
 #endif // IOX_HOOFS_MAC_PLATFORM_MMAN_HPP
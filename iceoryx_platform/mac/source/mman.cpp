@@ -43,3 +43,26 @@ int iox_shm_close(int fd)
 {
     return close(fd);
 }
+
+int iox_madvise_huge_pages(void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_mbind_numa_node(void*, size_t, unsigned int)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+int iox_mlock(const void* addr, size_t length)
+{
+    return mlock(addr, length);
+}
+
+size_t iox_mapping_page_size(const void*)
+{
+    const auto pageSize = sysconf(_SC_PAGESIZE);
+    return (pageSize > 0) ? static_cast<size_t>(pageSize) : 0U;
+}
@@ -17,6 +17,7 @@
 
 #include "iceoryx_platform/pthread.hpp"
 
+#include <cerrno>
 #include <map>
 #include <mutex>
 #include <string>
@@ -71,6 +72,11 @@ iox_pthread_t iox_pthread_self()
     return pthread_self();
 }
 
+int iox_pthread_setaffinity_np(iox_pthread_t, const uint32_t)
+{
+    return ENOSYS;
+}
+
 int pthread_mutexattr_setrobust(pthread_mutexattr_t*, int)
 {
     return 0;
@@ -17,6 +17,8 @@
 #ifndef IOX_HOOFS_QNX_PLATFORM_PTHREAD_HPP
 #define IOX_HOOFS_QNX_PLATFORM_PTHREAD_HPP
 
+#include <cerrno>
+#include <cstdint>
 #include <pthread.h>
 
 #define PTHREAD_MUTEX_RECURSIVE_NP PTHREAD_MUTEX_RECURSIVE
@@ -51,4 +53,11 @@ inline iox_pthread_t iox_pthread_self()
     return pthread_self();
 }
 
+/// @brief Restricts the execution of the thread to the provided cpu
+/// @note Not supported on this platform
+inline int iox_pthread_setaffinity_np(iox_pthread_t, const uint32_t)
+{
+    return ENOSYS;
+}
+
 #endif // IOX_HOOFS_QNX_PLATFORM_PTHREAD_HPP
@@ -92,6 +92,17 @@ iox_pthread_t iox_pthread_self()
     return GetCurrentThread();
 }
 
+int iox_pthread_setaffinity_np(iox_pthread_t thread, const uint32_t cpu)
+{
+    constexpr uint32_t MAX_NUMBER_OF_CPUS_IN_AFFINITY_MASK{64U};
+    if (cpu >= MAX_NUMBER_OF_CPUS_IN_AFFINITY_MASK)
+    {
+        return EINVAL;
+    }
+    auto result = Win32Call(SetThreadAffinityMask, thread, static_cast<DWORD_PTR>(1U) << cpu).value;
+    return (result == 0) ? EINVAL : 0;
+}
+
 int pthread_mutexattr_destroy(pthread_mutexattr_t* attr)
 {
     return 0;
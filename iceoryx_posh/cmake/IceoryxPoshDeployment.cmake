@@ -67,6 +67,10 @@ configure_option(
     NAME IOX_MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY
     DEFAULT_VALUE 8
 )
+configure_option(
+    NAME IOX_MAX_CHUNKS_PER_PUBLISHER_BATCH
+    DEFAULT_VALUE 256
+)
 configure_option(
     NAME IOX_MAX_PUBLISHER_HISTORY
     DEFAULT_VALUE 16
@@ -75,10 +79,22 @@ configure_option(
     NAME IOX_MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY
     DEFAULT_VALUE 256
 )
+configure_option(
+    NAME IOX_MAX_CHUNK_MAGAZINE_CAPACITY
+    DEFAULT_VALUE 16
+)
+configure_option(
+    NAME IOX_MAX_CHUNK_RINGS_PER_SUBSCRIBER
+    DEFAULT_VALUE 4
+)
 configure_option(
     NAME IOX_MAX_PROCESS_NUMBER
     DEFAULT_VALUE 300
 )
+configure_option(
+    NAME IOX_MAX_CONTROL_CHANNEL_REQUESTS
+    DEFAULT_VALUE 16
+)
 configure_option(
     NAME IOX_MAX_NODE_NUMBER
     DEFAULT_VALUE 1000
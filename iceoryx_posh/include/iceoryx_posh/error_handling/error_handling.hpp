@@ -78,7 +78,10 @@ namespace iox
     error(POPO__BASE_SERVER_OVERRIDING_WITH_EVENT_SINCE_HAS_REQUEST_OR_REQUEST_RECEIVED_ALREADY_ATTACHED) \
     error(POPO__BASE_SERVER_OVERRIDING_WITH_STATE_SINCE_HAS_REQUEST_OR_REQUEST_RECEIVED_ALREADY_ATTACHED) \
     error(POPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION) \
+    error(POPO__CHUNK_QUEUE_DATA_FAILED_TO_CREATE_SEMAPHORE) \
     error(POPO__CHUNK_DISTRIBUTOR_OVERFLOW_OF_QUEUE_CONTAINER) \
+    error(POPO__CHUNK_DISTRIBUTOR_NO_UNPINNED_QUEUE_CONTAINER) \
+    error(POPO__CHUNK_DISTRIBUTOR_OVERFLOW_OF_CHUNK_RING_ATTACHMENTS) \
     error(POPO__CHUNK_DISTRIBUTOR_CLEANUP_DEADLOCK_BECAUSE_BAD_APPLICATION_TERMINATION) \
     error(POPO__CHUNK_SENDER_INVALID_CHUNK_TO_FREE_FROM_USER) \
     error(POPO__CHUNK_SENDER_INVALID_CHUNK_TO_SEND_FROM_USER) \
@@ -127,6 +130,7 @@ namespace iox
     error(PORT_POOL__INTERFACELIST_OVERFLOW) \
     error(PORT_POOL__NODELIST_OVERFLOW) \
     error(PORT_POOL__CONDITION_VARIABLE_LIST_OVERFLOW) \
+    error(PORT_POOL__CONTROL_CHANNEL_LIST_OVERFLOW) \
     error(PORT_MANAGER__PORT_POOL_UNAVAILABLE) \
     error(PORT_MANAGER__INTROSPECTION_MEMORY_MANAGER_UNAVAILABLE) \
     error(PORT_MANAGER__HANDLE_PUBLISHER_PORTS_INVALID_CAPRO_MESSAGE) \
@@ -61,18 +61,20 @@ constexpr uint32_t MAX_PUBLISHERS = build::IOX_MAX_PUBLISHERS;
 constexpr uint32_t MAX_SUBSCRIBERS_PER_PUBLISHER = build::IOX_MAX_SUBSCRIBERS_PER_PUBLISHER;
 constexpr uint32_t MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY =
     build::IOX_MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY;
+constexpr uint32_t MAX_CHUNKS_PER_PUBLISHER_BATCH = build::IOX_MAX_CHUNKS_PER_PUBLISHER_BATCH;
 constexpr uint64_t MAX_PUBLISHER_HISTORY = build::IOX_MAX_PUBLISHER_HISTORY;
 // Subscriber
 constexpr uint32_t MAX_SUBSCRIBERS = build::IOX_MAX_SUBSCRIBERS;
 constexpr uint32_t MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY =
     build::IOX_MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY;
 constexpr uint32_t MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY;
+constexpr uint32_t MAX_CHUNK_RINGS_PER_SUBSCRIBER = build::IOX_MAX_CHUNK_RINGS_PER_SUBSCRIBER;
 // Introspection is using the following publisherPorts, which reduced the number of ports available for the user
 // 1x publisherPort mempool introspection
 // 1x publisherPort process introspection
 // 3x publisherPort port introspection
 constexpr uint32_t PUBLISHERS_RESERVED_FOR_INTROSPECTION = 5;
-constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 1;
+constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 2;
 constexpr uint32_t NUMBER_OF_INTERNAL_PUBLISHERS =
     PUBLISHERS_RESERVED_FOR_INTROSPECTION + PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY;
 /// With MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY we couple the maximum number of
@@ -108,11 +110,13 @@ constexpr uint32_t MAX_NUMBER_OF_NOTIFIERS = build::IOX_MAX_NUMBER_OF_NOTIFIERS;
 /// the variable above must be increased
 constexpr uint32_t MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET = MAX_NUMBER_OF_NOTIFIERS;
 constexpr uint32_t MAX_NUMBER_OF_EVENTS_PER_LISTENER = MAX_NUMBER_OF_NOTIFIERS;
+constexpr uint32_t MAX_NUMBER_OF_WORKERS_PER_LISTENER = 16U;
 //--------- Communication Resources End---------------------
 
 // Memory
 constexpr uint32_t MAX_NUMBER_OF_MEMPOOLS = build::IOX_MAX_NUMBER_OF_MEMPOOLS;
 constexpr uint32_t MAX_SHM_SEGMENTS = build::IOX_MAX_SHM_SEGMENTS;
+constexpr uint32_t MAX_CHUNK_MAGAZINE_CAPACITY = build::IOX_MAX_CHUNK_MAGAZINE_CAPACITY;
 
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_PROVIDER = 8U;
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_BLOCKS_PER_MEMORY_PROVIDER = 64U;
@@ -131,6 +135,15 @@ constexpr uint32_t APP_MESSAGE_SIZE = 512U;
 // Processes
 constexpr uint32_t MAX_PROCESS_NUMBER = build::IOX_MAX_PROCESS_NUMBER;
 
+// Control Channel
+/// every runtime gets at most one control channel for the binary port creation requests
+constexpr uint32_t MAX_NUMBER_OF_CONTROL_CHANNELS = MAX_PROCESS_NUMBER;
+/// the maximum number of requests which are processed by RouDi with one doorbell of the control channel
+constexpr uint32_t MAX_CONTROL_CHANNEL_REQUESTS = build::IOX_MAX_CONTROL_CHANNEL_REQUESTS;
+/// the default number of ports which can be prepared with one runtime::PortBatch; a full batch is committed with a
+/// single doorbell of the control channel
+constexpr uint32_t DEFAULT_PORT_BATCH_CAPACITY = MAX_CONTROL_CHANNEL_REQUESTS;
+
 // Service Discovery
 constexpr uint32_t SERVICE_REGISTRY_CAPACITY = MAX_PUBLISHERS + MAX_SERVERS;
 constexpr uint32_t MAX_FINDSERVICE_RESULT_SIZE = SERVICE_REGISTRY_CAPACITY;
@@ -138,6 +151,14 @@ constexpr uint32_t MAX_FINDSERVICE_RESULT_SIZE = SERVICE_REGISTRY_CAPACITY;
 constexpr const char SERVICE_DISCOVERY_SERVICE_NAME[] = "ServiceDiscovery";
 constexpr const char SERVICE_DISCOVERY_INSTANCE_NAME[] = "RouDi_ID";
 constexpr const char SERVICE_DISCOVERY_EVENT_NAME[] = "ServiceRegistry";
+constexpr const char SERVICE_DISCOVERY_CHANGES_EVENT_NAME[] = "ServiceRegistryChanges";
+
+/// RouDi publishes every change of the service registry but the full service registry only with every
+/// SERVICE_REGISTRY_SNAPSHOT_INTERVAL-th change. The history of the changes is larger than the snapshot interval,
+/// therefore a late joining ServiceDiscovery can always catch up from the last snapshot.
+constexpr uint64_t SERVICE_REGISTRY_CHANGES_HISTORY = (MAX_PUBLISHER_HISTORY < 16U) ? MAX_PUBLISHER_HISTORY : 16U;
+constexpr uint64_t SERVICE_REGISTRY_SNAPSHOT_INTERVAL =
+    (SERVICE_REGISTRY_CHANGES_HISTORY > 1U) ? SERVICE_REGISTRY_CHANGES_HISTORY / 2U : 1U;
 
 // Nodes
 constexpr uint32_t MAX_NODE_NUMBER = build::IOX_MAX_NODE_NUMBER;
@@ -230,6 +251,11 @@ constexpr units::Duration PROCESS_DEFAULT_KILL_DELAY = 45_s;
 constexpr units::Duration PROCESS_TERMINATED_CHECK_INTERVAL = 250_ms;
 constexpr units::Duration DISCOVERY_INTERVAL = 100_ms;
 
+// Runtime message processing
+constexpr uint32_t MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS = 16U;
+constexpr uint32_t DEFAULT_NUMBER_OF_RUNTIME_MESSAGE_WORKERS = 1U;
+constexpr uint32_t RUNTIME_MESSAGE_WORKER_QUEUE_CAPACITY = 64U;
+
 /// @brief Controls process alive monitoring. Upon timeout, a monitored process is removed
 /// and its resources are made available. The process can then start and register itself again.
 /// Contrarily, unmonitored processes can be restarted but registration will fail.
@@ -19,6 +19,9 @@
 
 #include "iceoryx_posh/capro/service_description.hpp"
 
+#include <cstdint>
+#include <limits>
+
 namespace iox
 {
 namespace log
@@ -91,11 +94,15 @@ class CaproMessage
                  CaproServiceType serviceType = CaproServiceType::NONE,
                  void* chunkQueueData = nullptr) noexcept;
 
+    static constexpr uint32_t INVALID_CHUNK_QUEUE_HANDLE{std::numeric_limits<uint32_t>::max()};
+
     CaproMessageType m_type{CaproMessageType::NOTYPE};
     CaproServiceType m_serviceType{CaproServiceType::NONE};
     ServiceDescription m_serviceDescription;
     void* m_chunkQueueData{nullptr};
     uint64_t m_historyCapacity{0u};
+    /// @brief handle of the queue in the ChunkDistributor of the acknowledging port; only set for an ACK to a CONNECT
+    uint32_t m_chunkQueueHandle{INVALID_CHUNK_QUEUE_HANDLE};
 };
 
 } // namespace capro
@@ -0,0 +1,131 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_MEPOO_CHUNK_MAGAZINE_HPP
+#define IOX_POSH_MEPOO_CHUNK_MAGAZINE_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/relative_pointer.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+namespace iox
+{
+namespace mepoo
+{
+class MemPool;
+class ChunkMagazineTestAccess;
+
+/// @brief A cache of chunks which are reserved in batches from a MemPool together with the same number of chunk
+/// management slots. As long as the magazine is not empty, chunks are handed out without touching the free lists of
+/// the shared MemPools. It is meant to be owned by a single port and must therefore only be used from one thread.
+/// The magazine is placed in the shared memory alongside the port data so that RouDi can return the reserved chunks
+/// with 'drain' when the owning process terminates.
+/// The chunks held by the magazine are counted as used by their MemPools.
+/// @note The magazine is refilled with one reservation per MemPool. The reserved indices are recorded in the magazine
+/// while they are taken from the free lists and the current stage of the refill is recorded as well, hence 'drain' can
+/// return the chunks of an interrupted refill. The size is decremented before a chunk is handed out or returned, hence
+/// the magazine never holds a chunk which is in use or already returned, even if the owning process crashes while it
+/// modifies the magazine. Only the chunk of an interrupted acquisition or release is lost in this case, like with
+/// every other allocation before the chunk is stored in the UsedChunkList. All other chunks are returned by RouDi.
+class ChunkMagazine
+{
+  public:
+    /// @brief Creates a ChunkMagazine
+    /// @param[in] capacity is the number of chunks which are reserved with one refill; it is limited to
+    /// MAX_CHUNK_MAGAZINE_CAPACITY and a capacity of 0 disables the magazine
+    explicit ChunkMagazine(const uint32_t capacity = 0U) noexcept;
+
+    ChunkMagazine(const ChunkMagazine&) = delete;
+    ChunkMagazine(ChunkMagazine&&) = delete;
+    ChunkMagazine& operator=(const ChunkMagazine&) = delete;
+    ChunkMagazine& operator=(ChunkMagazine&&) = delete;
+    ~ChunkMagazine() noexcept = default;
+
+    /// @brief Checks whether the magazine caches chunks at all
+    /// @return true if the capacity is larger than 0, false otherwise
+    bool isEnabled() const noexcept;
+
+    /// @brief Returns the number of chunks which are reserved with one refill
+    uint32_t capacity() const noexcept;
+
+    /// @brief Returns the number of chunks which are currently held by the magazine
+    uint32_t size() const noexcept;
+
+    /// @brief Checks whether the chunks for 'memPool' can be taken from the magazine
+    /// @param[in] memPool from which the chunk must originate
+    /// @return true if the magazine is empty or holds chunks of 'memPool', false otherwise; in this case the chunk must
+    /// be taken directly from 'memPool' since swapping the whole batch on every change of the MemPool would be more
+    /// expensive than not using the magazine at all
+    bool canServe(const MemPool& memPool) const noexcept;
+
+    /// @brief Takes a chunk and a chunk management slot out of the magazine and marks both as used. If the magazine is
+    /// empty, it is refilled with up to 'capacity' chunks from 'memPool'
+    /// @param[in] memPool from which the chunk must originate
+    /// @param[in] chunkManagementPool from which the chunk management slot must originate
+    /// @param[out] chunk is set to the acquired chunk
+    /// @param[out] chunkManagement is set to the acquired chunk management slot
+    /// @return true if a chunk could be acquired, false if 'memPool' or 'chunkManagementPool' ran out of chunks
+    /// @note only from runtime context and only if 'canServe' returns true for 'memPool'
+    bool acquireChunk(MemPool& memPool, MemPool& chunkManagementPool, void*& chunk, void*& chunkManagement) noexcept;
+
+    /// @brief Returns all chunks held by the magazine to their MemPools
+    /// @note from runtime context or from RouDi context once the application walked the plank. It is unsafe to call
+    /// this from RouDi if the application is still running.
+    void drain() noexcept;
+
+  private:
+    friend class ChunkMagazineTestAccess;
+
+    enum class RefillStage : uint32_t
+    {
+        IDLE,
+        RESERVING_CHUNKS,
+        RESERVING_CHUNK_MANAGEMENTS,
+        RESERVED
+    };
+
+    static constexpr uint32_t INVALID_INDEX{std::numeric_limits<uint32_t>::max()};
+
+    bool takeChunk(MemPool& memPool, MemPool& chunkManagementPool, void*& chunk, void*& chunkManagement) noexcept;
+    bool refill(MemPool& memPool, MemPool& chunkManagementPool) noexcept;
+    void prepareRefill(MemPool& memPool, MemPool& chunkManagementPool) noexcept;
+    void releaseInterruptedRefill() noexcept;
+    uint32_t numberOfRecordedIndices(const uint32_t* const indices) const noexcept;
+    void releaseChunks() noexcept;
+    void releaseLastChunk() noexcept;
+
+  private:
+    /// @note is set while the magazine is modified; if RouDi finds it set on 'drain', the owning process terminated
+    /// during a modification. It also orders the modifications of the process before the 'drain' of RouDi
+    std::atomic_flag m_isModified = ATOMIC_FLAG_INIT;
+    uint32_t m_capacity{0U};
+    /// @note atomic since 'size' may be called from RouDi while the owning process modifies the magazine
+    std::atomic<uint32_t> m_size{0U};
+    /// @note the recorded indices of the MemPool of the current 'RESERVING_*' stage are not yet counted as used, the
+    /// ones of the previous stages are
+    std::atomic<RefillStage> m_refillStage{RefillStage::IDLE};
+    RelativePointer<MemPool> m_memPool;
+    RelativePointer<MemPool> m_chunkManagementPool;
+    uint32_t m_chunkIndices[MAX_CHUNK_MAGAZINE_CAPACITY];
+    uint32_t m_chunkManagementIndices[MAX_CHUNK_MAGAZINE_CAPACITY];
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_CHUNK_MAGAZINE_HPP
@@ -36,12 +36,14 @@ struct MemPoolInfo
     MemPoolInfo(const uint32_t usedChunks,
                 const uint32_t minFreeChunks,
                 const uint32_t numChunks,
-                const uint32_t chunkSize) noexcept;
+                const uint32_t chunkSize,
+                const uint64_t failedAllocations) noexcept;
 
     uint32_t m_usedChunks{0};
     uint32_t m_minFreeChunks{0};
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
+    uint64_t m_failedAllocations{0};
 };
 
 class MemPool
@@ -61,15 +63,60 @@ class MemPool
     MemPool& operator=(MemPool&&) = delete;
 
     void* getChunk() noexcept;
+
+    /// @brief Obtains 'count' chunks with a single operation on the free list; either all or none of the chunks are
+    /// obtained
+    /// @param[out] chunks array with at least 'count' elements which receives the pointers to the chunks
+    /// @param[in] count is the number of chunks to obtain; must not exceed MAX_CHUNKS_PER_PUBLISHER_BATCH
+    /// @return true if all chunks were obtained, false otherwise; the failure is counted as failed allocation
+    bool getChunks(void** const chunks, const uint32_t count) noexcept;
     uint32_t getChunkSize() const noexcept;
     uint32_t getChunkCount() const noexcept;
     uint32_t getUsedChunks() const noexcept;
     uint32_t getMinFree() const noexcept;
+    /// @brief Returns the number of allocations which failed since the MemPool ran out of chunks
+    uint64_t getNumberOfFailedAllocations() const noexcept;
     MemPoolInfo getInfo() const noexcept;
 
     void freeChunk(const void* chunk) noexcept;
 
+    /// @brief Removes a chunk from the free list and counts it as used. The chunk stays reserved for the caller until it
+    /// is either acquired with 'acquireReservedChunk' or given back with 'releaseReservedChunks'
+    /// @param[out] index receives the index of the reserved chunk
+    /// @return true if a chunk was reserved, false otherwise; unlike with 'getChunk' the failure is not counted as
+    /// failed allocation
+    bool reserveChunk(uint32_t& index) noexcept;
+
+    /// @brief Removes up to 'count' chunks from the free list and counts them as used with a single counter update. The
+    /// chunks stay reserved for the caller until they are either acquired with 'acquireReservedChunk' or given back
+    /// with 'releaseReservedChunks'
+    /// @param[out] indices array with at least 'count' elements which receives the indices of the reserved chunks
+    /// @param[in] count is the maximum number of chunks to reserve
+    /// @return the number of chunks which were actually reserved; if no chunk could be reserved, this is counted as
+    /// failed allocation
+    /// @note the indices are written in order and each one only after its chunk is removed from the free list; the
+    /// chunks are counted as used after all indices are written
+    uint32_t reserveChunks(uint32_t* const indices, const uint32_t count) noexcept;
+
+    /// @brief Hands out a previously reserved chunk; it was already counted as used by the reservation
+    /// @param[in] index of the chunk obtained by 'reserveChunk' or 'reserveChunks'
+    /// @return pointer to the chunk
+    void* acquireReservedChunk(const uint32_t index) noexcept;
+
+    /// @brief Returns previously reserved but not acquired chunks to the free list with a single compare-and-swap and
+    /// a single counter update
+    /// @param[in] indices array with the indices of the reserved chunks
+    /// @param[in] count is the number of elements in 'indices'
+    void releaseReservedChunks(const uint32_t* const indices, const uint32_t count) noexcept;
+
+    /// @brief Returns chunks to the free list which were removed by a 'reserveChunks' call that was interrupted
+    /// before the chunks were counted as used, e.g. since the reserving process terminated
+    /// @param[in] indices array with the indices which were already written by the interrupted 'reserveChunks'
+    /// @param[in] count is the number of elements in 'indices'
+    void releaseUncountedChunks(const uint32_t* const indices, const uint32_t count) noexcept;
+
   private:
+    void pushFreeIndices(const uint32_t* const indices, const uint32_t count) noexcept;
     void adjustMinFree() noexcept;
     bool isMultipleOfAlignment(const uint32_t value) const noexcept;
 
@@ -82,6 +129,9 @@ class MemPool
 
     std::atomic<uint32_t> m_usedChunks{0U};
     std::atomic<uint32_t> m_minFree{0U};
+    /// @brief only incremented on the failure path so that running out of chunks does not require any logging;
+    /// RouDi reads it for the introspection
+    std::atomic<uint64_t> m_failedAllocations{0U};
 
     freeList_t m_freeIndices;
 };
@@ -18,15 +18,20 @@
 #define IOX_POSH_MEPOO_MEMORY_MANAGER_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_magazine.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/mepoo/token_bucket.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/algorithm.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/expected.hpp"
 #include "iox/memory.hpp"
+#include "iox/span.hpp"
 #include "iox/vector.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <limits>
 
@@ -42,8 +47,6 @@ class LogStream;
 }
 namespace mepoo
 {
-struct MePooConfig;
-
 class MemoryManager
 {
     using MaxChunkPayloadSize_t = range<uint32_t, 1, std::numeric_limits<uint32_t>::max() - sizeof(ChunkHeader)>;
@@ -56,6 +59,11 @@ class MemoryManager
         MEMPOOL_OUT_OF_CHUNKS,
     };
 
+    /// @brief the rate with which running out of chunks is reported via log and error handler; all further failures
+    /// are only counted and the number of suppressed reports is attached to the next report
+    static constexpr uint64_t ERROR_REPORTS_PER_SECOND{1U};
+    static constexpr uint64_t ERROR_REPORT_BURST_SIZE{5U};
+
     MemoryManager() noexcept = default;
     MemoryManager(const MemoryManager&) = delete;
     MemoryManager(MemoryManager&&) = delete;
@@ -72,16 +80,46 @@ class MemoryManager
     /// @return a SharedChunk if successful, otherwise a MemoryManager::Error
     expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings) noexcept;
 
+    /// @brief Obtains a chunk from the mempools via a ChunkMagazine which reserves the chunks in batches
+    /// @param[in] chunkSettings for the requested chunk
+    /// @param[in] chunkMagazine which is used to cache the reserved chunks; if it is disabled or holds the chunks of
+    /// another mempool, the chunk is directly obtained from the mempools
+    /// @return a SharedChunk if successful, otherwise a MemoryManager::Error
+    expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings, ChunkMagazine& chunkMagazine) noexcept;
+
+    /// @brief Obtains multiple chunks of the same size with a single operation on the free list of the mempool
+    /// @param[in] chunkSettings for the requested chunks
+    /// @param[out] chunks receives the SharedChunks; its size is the number of requested chunks which must not
+    /// exceed MAX_CHUNKS_PER_PUBLISHER_BATCH
+    /// @return success if all chunks were obtained, otherwise a MemoryManager::Error and none of the chunks is obtained
+    expected<void, Error> getChunks(const ChunkSettings& chunkSettings, const span<SharedChunk> chunks) noexcept;
+
     uint32_t getNumberOfMemPools() const noexcept;
 
     MemPoolInfo getMemPoolInfo(const uint32_t index) const noexcept;
 
+    /// @brief Returns how often 'getChunk' failed with the given error. The counters are placed in the shared memory
+    /// and are therefore accumulated over all processes which use this MemoryManager
+    /// @param[in] error for which the number of occurrences shall be returned
+    /// @return the number of occurrences of 'error'
+    uint64_t getNumberOfErrors(const Error error) const noexcept;
+
     static uint64_t requiredChunkMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredManagementMemorySize(const MePooConfig& mePooConfig) noexcept;
     static uint64_t requiredFullMemorySize(const MePooConfig& mePooConfig) noexcept;
 
   private:
+    /// @brief two-level size classes like in TLSF; the first level is the power of two of the chunk size and the
+    /// second level divides each power of two linearly into NUMBER_OF_SUB_CLASSES sub classes. Chunk sizes below
+    /// NUMBER_OF_SUB_CLASSES have a size class of their own
+    static constexpr uint32_t SUB_CLASS_BITS{5U};
+    static constexpr uint32_t NUMBER_OF_SUB_CLASSES{1U << SUB_CLASS_BITS};
+    static constexpr uint32_t NUMBER_OF_SIZE_CLASSES{(32U - SUB_CLASS_BITS + 1U) * NUMBER_OF_SUB_CLASSES};
+    static constexpr uint32_t NUMBER_OF_ERRORS{static_cast<uint32_t>(Error::MEMPOOL_OUT_OF_CHUNKS) + 1U};
+
     static uint32_t sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept;
+    static uint32_t sizeClass(const uint32_t chunkSize) noexcept;
+    static uint64_t smallestChunkSizeOfSizeClass(const uint32_t sizeClass) noexcept;
 
     void printMemPoolVector(log::LogStream& log) const noexcept;
     void addMemPool(BumpAllocator& managementAllocator,
@@ -89,6 +127,16 @@ class MemoryManager
                     const greater_or_equal<uint32_t, MemPool::CHUNK_MEMORY_ALIGNMENT> chunkPayloadSize,
                     const greater_or_equal<uint32_t, 1> numberOfChunks) noexcept;
     void generateChunkManagementPool(BumpAllocator& managementAllocator) noexcept;
+    void generateSizeClassIndex() noexcept;
+    void countError(const Error error) noexcept;
+    Error reportError(const Error error, const ChunkSettings& chunkSettings) noexcept;
+    /// @brief Returns the index of the first mempool with chunks of at least 'requiredChunkSize'. The lookup is one
+    /// read of the size class index and one compare with the chunk size of the found mempool, as long as no two
+    /// mempools share a size class, i.e. as long as their chunk sizes differ by at least 1/NUMBER_OF_SUB_CLASSES of
+    /// their power of two; 'generateSizeClassIndex' warns about mempools which share a size class
+    uint32_t firstFittingMemPoolIndex(const uint32_t requiredChunkSize) const noexcept;
+    expected<SharedChunk, Error> getChunkImpl(const ChunkSettings& chunkSettings,
+                                              ChunkMagazine* const chunkMagazine) noexcept;
 
   private:
     bool m_denyAddMemPool{false};
@@ -96,6 +144,14 @@ class MemoryManager
 
     vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
     vector<MemPool, 1> m_chunkManagementPool;
+    /// @brief index of the first mempool with chunks large enough for the smallest chunk size of a size class; only
+    /// the chunk size of a mempool within the size class itself can be too small for a chunk of this size class
+    uint16_t m_sizeClassIndex[NUMBER_OF_SIZE_CLASSES]{};
+    static_assert(MAX_NUMBER_OF_MEMPOOLS < std::numeric_limits<uint16_t>::max(),
+                  "The size class index requires the mempool indices to fit into 16 bit");
+    MemPoolExhaustedPolicy m_memPoolExhaustedPolicy{MemPoolExhaustedPolicy::RETURN_ERROR};
+    std::atomic<uint64_t> m_errorCounters[NUMBER_OF_ERRORS]{};
+    TokenBucket m_errorReportLimiter{ERROR_REPORTS_PER_SECOND, ERROR_REPORT_BURST_SIZE};
 };
 
 /// @brief Converts the MemoryManager::Error to a string literal
@@ -0,0 +1,38 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_MEPOO_MEMORY_PAGING_HPP
+#define IOX_POSH_MEPOO_MEMORY_PAGING_HPP
+
+#include "iceoryx_posh/mepoo/memory_paging_config.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief Applies a MemoryPagingConfig to a newly created and mapped shared memory. Options which cannot be applied,
+/// e.g. due to missing privileges or platform support, are reported as warning and the memory stays usable.
+/// @param[in] baseAddress of the mapped memory, must be page aligned
+/// @param[in] size of the mapped memory in bytes
+/// @param[in] config the options to apply
+/// @return the size of the pages which actually back the memory or 0 if it cannot be acquired on this platform
+uint64_t
+applyMemoryPagingConfig(void* const baseAddress, const uint64_t size, const MemoryPagingConfig& config) noexcept;
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_MEMORY_PAGING_HPP
@@ -22,6 +22,7 @@
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
+#include "iceoryx_posh/mepoo/memory_paging_config.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/filesystem.hpp"
@@ -38,7 +39,8 @@ class MePooSegment
                  BumpAllocator& managementAllocator,
                  const posix::PosixGroup& readerGroup,
                  const posix::PosixGroup& writerGroup,
-                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo()) noexcept;
+                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo(),
+                 const MemoryPagingConfig& memoryPagingConfig = MemoryPagingConfig()) noexcept;
 
     posix::PosixGroup getWriterGroup() const noexcept;
     posix::PosixGroup getReaderGroup() const noexcept;
@@ -47,6 +49,12 @@ class MePooSegment
 
     uint64_t getSegmentId() const noexcept;
 
+    /// @brief Returns the size of the pages which actually back the segment or 0 if it cannot be acquired
+    uint64_t getPageSize() const noexcept;
+
+    /// @brief Returns the paging options of the segment which the applications apply to their own mapping
+    const MemoryPagingConfig& getMemoryPagingConfig() const noexcept;
+
   protected:
     SharedMemoryObjectType createSharedMemoryObject(const MePooConfig& mempoolConfig,
                                                     const posix::PosixGroup& writerGroup) noexcept;
@@ -58,6 +66,8 @@ class MePooSegment
     posix::PosixGroup m_writerGroup;
     uint64_t m_segmentId;
     iox::mepoo::MemoryInfo m_memoryInfo;
+    MemoryPagingConfig m_memoryPagingConfig;
+    uint64_t m_pageSize{0U};
 
     static constexpr access_rights SEGMENT_PERMISSIONS =
         perms::owner_read | perms::owner_write | perms::group_read | perms::group_write;
@@ -18,6 +18,7 @@
 #define IOX_POSH_MEPOO_MEPOO_SEGMENT_INL
 
 #include "iceoryx_posh/error_handling/error_handling.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_paging.hpp"
 #include "iceoryx_posh/internal/mepoo/mepoo_segment.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
@@ -38,11 +39,13 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
     BumpAllocator& managementAllocator,
     const posix::PosixGroup& readerGroup,
     const posix::PosixGroup& writerGroup,
-    const iox::mepoo::MemoryInfo& memoryInfo) noexcept
+    const iox::mepoo::MemoryInfo& memoryInfo,
+    const MemoryPagingConfig& memoryPagingConfig) noexcept
     : m_sharedMemoryObject(std::move(createSharedMemoryObject(mempoolConfig, writerGroup)))
     , m_readerGroup(readerGroup)
     , m_writerGroup(writerGroup)
     , m_memoryInfo(memoryInfo)
+    , m_memoryPagingConfig(memoryPagingConfig)
 {
     using namespace posix;
     AccessController accessController;
@@ -60,8 +63,10 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
         errorHandler(PoshError::MEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY);
     }
 
-    BumpAllocator allocator(m_sharedMemoryObject.getBaseAddress(),
-                            m_sharedMemoryObject.get_size().expect("Failed to get SHM size."));
+    const auto segmentSize = m_sharedMemoryObject.get_size().expect("Failed to get SHM size.");
+    m_pageSize = applyMemoryPagingConfig(m_sharedMemoryObject.getBaseAddress(), segmentSize, memoryPagingConfig);
+
+    BumpAllocator allocator(m_sharedMemoryObject.getBaseAddress(), segmentSize);
     m_memoryManager.configureMemoryManager(mempoolConfig, managementAllocator, allocator);
 }
 
@@ -127,6 +132,19 @@ inline uint64_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSegm
     return m_segmentId;
 }
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline uint64_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getPageSize() const noexcept
+{
+    return m_pageSize;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline const MemoryPagingConfig&
+MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getMemoryPagingConfig() const noexcept
+{
+    return m_memoryPagingConfig;
+}
+
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline void MePooSegment<SharedMemoryObjectType, MemoryManagerType>::setSegmentId(const uint64_t segmentId) noexcept
 {
@@ -42,8 +42,12 @@ inline void SegmentManager<SegmentType>::createSegment(const SegmentConfig::Segm
 {
     auto readerGroup = iox::posix::PosixGroup(segmentEntry.m_readerGroup);
     auto writerGroup = iox::posix::PosixGroup(segmentEntry.m_writerGroup);
-    m_segmentContainer.emplace_back(
-        segmentEntry.m_mempoolConfig, *m_managementAllocator, readerGroup, writerGroup, segmentEntry.m_memoryInfo);
+    m_segmentContainer.emplace_back(segmentEntry.m_mempoolConfig,
+                                    *m_managementAllocator,
+                                    readerGroup,
+                                    writerGroup,
+                                    segmentEntry.m_memoryInfo,
+                                    segmentEntry.m_memoryPagingConfig);
 }
 
 template <typename SegmentType>
@@ -72,7 +76,9 @@ SegmentManager<SegmentType>::getSegmentMappings(const posix::PosixUser& user) no
                         segment.getSharedMemoryObject().getBaseAddress(),
                         segment.getSharedMemoryObject().get_size().expect("failed to get SHM size"),
                         true,
-                        segment.getSegmentId());
+                        segment.getSegmentId(),
+                        iox::mepoo::MemoryInfo(),
+                        segment.getMemoryPagingConfig());
                     foundInWriterGroup = true;
                 }
                 else
@@ -99,7 +105,9 @@ SegmentManager<SegmentType>::getSegmentMappings(const posix::PosixUser& user) no
                     segment.getSharedMemoryObject().getBaseAddress(),
                     segment.getSharedMemoryObject().get_size().expect("Failed to get SHM size."),
                     false,
-                    segment.getSegmentId());
+                    segment.getSegmentId(),
+                    iox::mepoo::MemoryInfo(),
+                    segment.getMemoryPagingConfig());
             }
         }
     }
@@ -41,6 +41,16 @@ class ShmSafeUnmanagedChunk
     /// @brief Creates a SharedChunk with incrementing the chunk reference counter and does not invalidate itself
     SharedChunk cloneToSharedChunk() noexcept;
 
+    /// @brief Creates a SharedChunk with incrementing the chunk reference counter if it is not zero and does not
+    /// invalidate itself; this is used to acquire a chunk which might be released concurrently by its owner
+    /// @return the SharedChunk or an empty SharedChunk if the reference counter was already zero
+    SharedChunk tryCloneToSharedChunk() const noexcept;
+
+    /// @brief Increments the chunk reference counter at once for additional copies of this ShmSafeUnmanagedChunk;
+    /// every copy owns one reference and must be released with releaseToSharedChunk
+    /// @param[in] numberOfCopies is the number of additional copies
+    void addReferencesForCopies(const uint64_t numberOfCopies) noexcept;
+
     /// @brief Checks if the underlying RelativePointerData to the chunk is logically a nullptr
     /// @return true if logically a nullptr otherwise false
     bool isLogicalNullptr() const noexcept;
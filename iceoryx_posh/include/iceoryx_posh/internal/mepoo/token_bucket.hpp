@@ -0,0 +1,68 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_MEPOO_TOKEN_BUCKET_HPP
+#define IOX_POSH_MEPOO_TOKEN_BUCKET_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief A lock-free token bucket which limits the rate of rarely needed but expensive actions like logging in hot
+/// paths. It is implemented as generic cell rate algorithm with a single atomic timestamp and can therefore be placed
+/// in the shared memory and be used concurrently by multiple processes. The bucket starts full.
+class TokenBucket
+{
+  public:
+    /// @brief Creates a TokenBucket
+    /// @param[in] tokensPerSecond is the rate with which the bucket is refilled; must be larger than 0
+    /// @param[in] burstSize is the maximum number of tokens the bucket can hold; must be larger than 0
+    TokenBucket(const uint64_t tokensPerSecond, const uint64_t burstSize) noexcept;
+
+    TokenBucket(const TokenBucket&) = delete;
+    TokenBucket(TokenBucket&&) = delete;
+    TokenBucket& operator=(const TokenBucket&) = delete;
+    TokenBucket& operator=(TokenBucket&&) = delete;
+    ~TokenBucket() noexcept = default;
+
+    /// @brief Takes a token from the bucket based on the monotonic clock
+    /// @return true if a token was available, false otherwise
+    bool tryAcquire() noexcept;
+
+    /// @brief Takes a token from the bucket
+    /// @param[in] nowNanoseconds is the current time of a monotonic clock in nanoseconds
+    /// @return true if a token was available, false otherwise
+    bool tryAcquire(const uint64_t nowNanoseconds) noexcept;
+
+    /// @brief Returns the number of failed 'tryAcquire' calls since the last call of this method and resets it
+    uint64_t takeNumberOfRejections() noexcept;
+
+  private:
+    uint64_t m_emissionIntervalNs{0U};
+    uint64_t m_burstToleranceNs{0U};
+    /// @brief the theoretical arrival time of the next token; the bucket is empty while it is more than the burst
+    /// tolerance ahead of the current time
+    std::atomic<uint64_t> m_theoreticalArrivalTimeNs{0U};
+    std::atomic<uint64_t> m_numberOfRejections{0U};
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_TOKEN_BUCKET_HPP
@@ -18,8 +18,11 @@
 #ifndef IOX_POSH_POPO_BASE_PUBLISHER_HPP
 #define IOX_POSH_POPO_BASE_PUBLISHER_HPP
 
+#include "iceoryx_posh/internal/popo/building_blocks/blocked_time_statistics.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/delivery_helper.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
 #include "iceoryx_posh/popo/sample.hpp"
+#include "iceoryx_posh/runtime/port_request.hpp"
 #include "iox/expected.hpp"
 #include "iox/optional.hpp"
 
@@ -80,9 +83,17 @@ class BasePublisher
     ///
     bool hasSubscribers() const noexcept;
 
+    ///
+    /// @brief getBlockedTimeStatistics
+    /// @return The statistics about the time the publisher was blocked by subscribers which are too slow. Only a
+    ///         publisher with ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER is blocked.
+    ///
+    BlockedTimeStatistics getBlockedTimeStatistics() const noexcept;
+
   protected:
     BasePublisher() = default; // Required for testing.
     BasePublisher(const capro::ServiceDescription& service, const PublisherOptions& publisherOptions);
+    explicit BasePublisher(const runtime::PreparedPublisher& preparedPublisher) noexcept;
 
     ///
     /// @brief port
@@ -97,6 +108,12 @@ class BasePublisher
     port_t& port() noexcept;
 
     port_t m_port{nullptr};
+
+  private:
+    void setupDeliveryHelper(const PublisherOptions& publisherOptions) noexcept;
+
+    /// @brief delivers broadcasted samples in parallel if PublisherOptions::parallelBroadcastDelivery is set
+    optional<DeliveryHelper> m_deliveryHelper;
 };
 
 } // namespace popo
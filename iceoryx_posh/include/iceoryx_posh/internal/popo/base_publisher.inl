@@ -29,6 +29,24 @@ inline BasePublisher<port_t>::BasePublisher(const capro::ServiceDescription& ser
                                             const PublisherOptions& publisherOptions)
     : m_port(iox::runtime::PoshRuntime::getInstance().getMiddlewarePublisher(service, publisherOptions))
 {
+    setupDeliveryHelper(publisherOptions);
+}
+
+template <typename port_t>
+inline BasePublisher<port_t>::BasePublisher(const runtime::PreparedPublisher& preparedPublisher) noexcept
+    : m_port(preparedPublisher.portData)
+{
+    setupDeliveryHelper(preparedPublisher.publisherOptions);
+}
+
+template <typename port_t>
+inline void BasePublisher<port_t>::setupDeliveryHelper(const PublisherOptions& publisherOptions) noexcept
+{
+    if (publisherOptions.parallelBroadcastDelivery && publisherOptions.broadcastDeliveryThreshold != 0U)
+    {
+        m_deliveryHelper.emplace();
+        m_port.setDeliveryHelper(&m_deliveryHelper.value());
+    }
 }
 
 template <typename port_t>
@@ -73,6 +91,12 @@ inline bool BasePublisher<port_t>::hasSubscribers() const noexcept
     return m_port.hasSubscribers();
 }
 
+template <typename port_t>
+inline BlockedTimeStatistics BasePublisher<port_t>::getBlockedTimeStatistics() const noexcept
+{
+    return m_port.getBlockedTimeStatistics();
+}
+
 template <typename port_t>
 const port_t& BasePublisher<port_t>::port() const noexcept
 {
@@ -114,6 +114,7 @@ class BaseSubscriber
 
     BaseSubscriber() noexcept; // Required for testing.
     BaseSubscriber(const capro::ServiceDescription& service, const SubscriberOptions& subscriberOptions) noexcept;
+    explicit BaseSubscriber(const runtime::PreparedSubscriber& preparedSubscriber) noexcept;
 
     BaseSubscriber(const BaseSubscriber& other) = delete;
     BaseSubscriber& operator=(const BaseSubscriber&) = delete;
@@ -38,6 +38,12 @@ inline BaseSubscriber<port_t>::BaseSubscriber(const capro::ServiceDescription& s
 {
 }
 
+template <typename port_t>
+inline BaseSubscriber<port_t>::BaseSubscriber(const runtime::PreparedSubscriber& preparedSubscriber) noexcept
+    : m_port(preparedSubscriber.portData)
+{
+}
+
 template <typename port_t>
 inline BaseSubscriber<port_t>::~BaseSubscriber() noexcept
 {
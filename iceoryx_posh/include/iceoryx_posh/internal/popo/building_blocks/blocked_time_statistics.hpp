@@ -0,0 +1,77 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_BLOCKED_TIME_STATISTICS_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_BLOCKED_TIME_STATISTICS_HPP
+
+#include "iox/duration.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Statistics about the time a sender was blocked by full queues with ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER
+struct BlockedTimeStatistics
+{
+    /// @brief The bucket i of the histogram counts the deliveries which were blocked for [2^i, 2^(i+1)) microseconds,
+    ///        the first bucket includes shorter and the last bucket includes longer blocked times
+    static constexpr uint64_t NUMBER_OF_BUCKETS{16U};
+
+    /// @brief The number of deliveries which had to wait for at least one consumer
+    uint64_t numberOfBlockedDeliveries{0U};
+    /// @brief The sum of the blocked times of all deliveries
+    units::Duration totalBlockedTime{units::Duration::zero()};
+    /// @brief The longest time a single delivery was blocked
+    units::Duration maxBlockedTime{units::Duration::zero()};
+    /// @brief The logarithmic histogram of the blocked times
+    uint64_t histogram[NUMBER_OF_BUCKETS]{};
+};
+
+/// @brief The shared memory part of the BlockedTimeStatistics. It is written only by the sender and can be read
+///        concurrently from any thread; the values are not read as one consistent snapshot.
+class BlockedTimeStatisticsData
+{
+  public:
+    BlockedTimeStatisticsData() noexcept = default;
+
+    /// @brief Adds a blocked delivery to the statistics; must only be called by the sender
+    /// @param[in] blockedTime is the time the delivery was blocked
+    void record(const units::Duration blockedTime) noexcept;
+
+    /// @brief Returns the current statistics
+    BlockedTimeStatistics load() const noexcept;
+
+    /// @brief Returns the current time of the monotonic clock the blocked times are measured with
+    static units::Duration currentTime() noexcept;
+
+    /// @brief Returns the bucket of the histogram which counts the provided blocked time
+    static uint64_t bucketOf(const units::Duration blockedTime) noexcept;
+
+  private:
+    std::atomic<uint64_t> m_numberOfBlockedDeliveries{0U};
+    std::atomic<uint64_t> m_totalBlockedTimeInNanoseconds{0U};
+    std::atomic<uint64_t> m_maxBlockedTimeInNanoseconds{0U};
+    std::atomic<uint64_t> m_histogram[BlockedTimeStatistics::NUMBER_OF_BUCKETS]{};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_BLOCKED_TIME_STATISTICS_HPP
@@ -20,10 +20,17 @@
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_ring_reader.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_ring_writer.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/delivery_helper.hpp"
+#include "iox/deadline_timer.hpp"
 #include "iox/detail/adaptive_wait.hpp"
 #include "iox/detail/unique_id.hpp"
 #include "iox/not_null.hpp"
+#include "iox/span.hpp"
 
+#include <functional>
+#include <limits>
 #include <thread>
 
 namespace iox
@@ -33,7 +40,9 @@ namespace popo
 enum class ChunkDistributorError
 {
     QUEUE_CONTAINER_OVERFLOW,
-    QUEUE_NOT_IN_CONTAINER
+    QUEUE_NOT_IN_CONTAINER,
+    NO_UNPINNED_QUEUE_CONTAINER,
+    CHUNK_RING_ATTACHMENT_OVERFLOW
 };
 
 /// @brief The ChunkDistributor is the low layer building block to send SharedChunks to a dynamic number of ChunkQueus.
@@ -48,17 +57,35 @@ enum class ChunkDistributorError
 /// This ChunkDistributor can be used with different LockingPolicies for different scenarios
 /// When different threads operate on it (e.g. application sends chunks and RouDi adds and removes queues),
 /// a locking policy must be used that ensures consistent data in the ChunkDistributorData.
-/// @todo iox-#1713 There are currently some challenges:
-/// For the stored queues and the history, containers are used which are not thread safe. Therefore we use an
-/// inter-process mutex. But this can lead to deadlocks if a user process gets terminated while one of its
-/// threads is in the ChunkDistributor and holds a lock. An easier setup would be if changing the queues
-/// by a middleware thread and sending chunks by the user process would not interleave. I.e. there is no concurrent
-/// access to the containers. Then a memory synchronization would be sufficient.
-/// The cleanup() call is the biggest challenge. This is used to free chunks that are still held by a not properly
-/// terminated user application. Even if access from middleware and user threads do not overlap, the history
-/// container to cleanup could be in an inconsistent state as the application was hard terminated while changing it.
-/// We would need a container like the UsedChunkList to have one that is robust against such inconsistencies....
-/// A perfect job for our future selves
+/// The stored queues are only modified by RouDi and are read by the sending application without taking the lock. A
+/// modification is done on a copy which is swapped in afterwards (read-copy-update), therefore an application which
+/// is terminated while sending does not block RouDi. Only one thread of the application may send at a time and the
+/// queue container versions are sized for this.
+/// The history is a ring buffer which is only written by the sender and read by RouDi without blocking the sender when
+/// a queue is added. Therefore, the sending application never takes the lock and the lock is only used to serialize
+/// the modifications done by RouDi. The sender stores the history write end together with the pin of the queues it
+/// delivers to and RouDi reads it together with the publication of the added queue, hence a queue which is added while
+/// a chunk is sent gets it exactly once, either from the history or from the delivery.
+///
+/// About Broadcasting:
+/// If the number of stored queues reaches the broadcast delivery threshold of the ChunkDistributorData, a chunk is
+/// delivered with a single increment of its reference counter for all queues and the wake ups of the queues which are
+/// attached to the same condition variable are coalesced. Optionally, a process local DeliveryHelper delivers half of
+/// the queues in parallel to the sending thread.
+///
+/// About the Chunk Ring:
+/// If the chunk ring of the ChunkDistributorData has a non-zero capacity, a chunk is written only once into the ring
+/// instead of being pushed into every queue. The stored queues are attached to the ring when they are added and read
+/// the latest chunks with their own cursor; a queue which is too slow loses the overwritten chunks. The sender only
+/// notifies the stored queues, hence its cost does not depend on the number of queues which are not attached to a
+/// condition variable. The ring replaces the history, the ConsumerTooSlowPolicy does not apply to it.
+///
+/// About Waiting for Consumers:
+/// With ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER, a full queue with QueueFullPolicy::BLOCK_PRODUCER is retried a few
+/// times and afterwards the sender blocks on the semaphore of the queue until the consumer pops a chunk or RouDi
+/// modifies the stored queues. The full queues are remembered by their handle, therefore a queue which was removed in
+/// the meantime is recognized by the generation of its slot. The blocked time is recorded in the
+/// BlockedTimeStatisticsData of the ChunkDistributorData.
 template <typename ChunkDistributorDataType>
 class ChunkDistributor
 {
@@ -67,6 +94,9 @@ class ChunkDistributor
     using ChunkQueueData_t = typename ChunkDistributorDataType::ChunkQueueData_t;
     using ChunkQueuePusher_t = typename ChunkDistributorDataType::ChunkQueuePusher_t;
 
+    /// @brief A queue handle which does not refer to any queue
+    static constexpr uint32_t INVALID_QUEUE_HANDLE{std::numeric_limits<uint32_t>::max()};
+
     explicit ChunkDistributor(not_null<MemberType_t* const> chunkDistrubutorDataPtr) noexcept;
 
     ChunkDistributor(const ChunkDistributor& other) = delete;
@@ -92,6 +122,18 @@ class ChunkDistributor
     /// @brief Delete all the stored chunk queues
     void removeAllQueues() noexcept;
 
+    /// @brief Checks whether a sender might still access the queue, i.e. whether the queue is stored in the active
+    /// queue container or in a previous version which is still pinned by a sender. A removed queue must not be
+    /// destroyed before this returns false.
+    /// @param[in] queue to check
+    /// @return true if the queue might still be accessed by a sender, false otherwise
+    /// @note a version pinned by a terminated sender is only released with cleanup()
+    bool isQueueReferenced(not_null<const ChunkQueueData_t* const> queue) const noexcept;
+
+    /// @brief Get the information whether chunks are delivered via the chunk ring
+    /// @return true if the chunk ring has a non-zero capacity, false if not
+    bool isChunkRingEnabled() const noexcept;
+
     /// @brief Get the information whether there are any stored chunk queues
     /// @return true if there are stored chunk queues, false if not
     bool hasStoredQueues() const noexcept;
@@ -102,6 +144,15 @@ class ChunkDistributor
     /// @return the number of queues the chunk was delivered to
     uint64_t deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Deliver a batch of shared chunks to all the stored chunk queues. The stored queues are read only once,
+    /// each queue gets all the chunks in one pass and is notified only once per batch. The chunks will be added to the
+    /// chunk history in the provided order
+    /// @param[in] chunks are the SharedChunks to be delivered
+    /// @return the number of queues the chunks were delivered to
+    /// @note with ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER a full blocking queue gets its remaining chunks one by one
+    /// after the stored queues were read, the other queues get the whole batch in one pass
+    uint64_t deliverToAllStoredQueues(const span<mepoo::SharedChunk> chunks) noexcept;
+
     /// @brief Deliver the provided shared chunk to the chunk queue with the provided ID. The chunk will NOT be added
     /// to the chunk history
     /// @param[in] uniqueQueueId is an unique ID which identifies the queue to which this chunk shall be delivered
@@ -118,6 +169,23 @@ class ChunkDistributor
     /// @return the index of the queue with uniqueQueueId or nullopt if the queue was not found
     optional<uint32_t> getQueueIndex(const UniqueId uniqueQueueId, const uint32_t lastKnownQueueIndex) const noexcept;
 
+    /// @brief Lookup for the handle of a queue with a specific iox::UniqueId. In contrast to the index, the handle of
+    /// a queue stays valid until the queue is removed and does not match any other queue afterwards.
+    /// @param[in] uniqueQueueId is the unique ID of the queue to query the handle
+    /// @return the handle of the queue with uniqueQueueId or nullopt if the queue was not found
+    optional<uint32_t> getQueueHandle(const UniqueId uniqueQueueId) const noexcept;
+
+    /// @brief Deliver the provided shared chunk to the chunk queue with the provided handle without searching the
+    /// stored queues. The chunk will NOT be added to the chunk history
+    /// @param[in] uniqueQueueId is an unique ID which identifies the queue to which this chunk shall be delivered
+    /// @param[in] queueHandle is the handle obtained with getQueueHandle; if it does not refer to the queue with
+    /// uniqueQueueId, e.g. INVALID_QUEUE_HANDLE, the queue is searched by iteration over all stored queues
+    /// @param[in] chunk is the SharedChunk to be delivered
+    /// @return ChunkDistributorError if the queue was not found
+    expected<void, ChunkDistributorError> deliverToQueueWithHandle(const UniqueId uniqueQueueId,
+                                                                   const uint32_t queueHandle,
+                                                                   mepoo::SharedChunk chunk) noexcept;
+
     /// @brief Update the chunk history but do not deliver the chunk to any chunk queue. E.g. use case is to to update a
     /// non offered field in ara
     /// @param[in] chunk to add to the chunk history
@@ -132,9 +200,20 @@ class ChunkDistributor
     uint64_t getHistoryCapacity() const noexcept;
 
     /// @brief Clears the chunk history
+    /// @note must not be called concurrently to a sender
     void clearHistory() noexcept;
 
-    /// @brief cleanup the used shrared memory chunks
+    /// @brief Returns the statistics about the time the sender was blocked by consumers which are too slow
+    /// @return the BlockedTimeStatistics; only deliveries with ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER are blocked
+    BlockedTimeStatistics getBlockedTimeStatistics() const noexcept;
+
+    /// @brief Sets a process local helper thread which delivers half of the queues when a chunk is broadcasted
+    /// @param[in] deliveryHelper is the helper or nullptr to deliver with the sending thread only; it must outlive
+    /// every delivery done by this ChunkDistributor
+    void setDeliveryHelper(DeliveryHelper* const deliveryHelper) noexcept;
+
+    /// @brief cleanup the used shrared memory chunks and release the stored queues pinned by the sender
+    /// @note must only be called when the sending application is gone
     void cleanup() noexcept;
 
   protected:
@@ -144,7 +223,175 @@ class ChunkDistributor
     bool pushToQueue(not_null<ChunkQueueData_t* const> queue, mepoo::SharedChunk chunk) noexcept;
 
   private:
+    using QueueContainer_t = typename MemberType_t::QueueContainer_t;
+    using QueueSlotContainer_t = typename MemberType_t::QueueSlotContainer_t;
+    using QueueHandleContainer_t = vector<uint32_t, MemberType_t::ChunkDistributorDataProperties_t::MAX_QUEUES>;
+
+    /// @brief Pins the active queue container for reading without taking the lock; as long as it is pinned, RouDi
+    /// does not reuse the container for a modification
+    class QueueContainerSnapshot
+    {
+      public:
+        explicit QueueContainerSnapshot(const MemberType_t& members) noexcept;
+        /// @brief Pins the active container for the delivery of the chunks up to the provided history write end; the
+        /// chunks before it are not replayed from the history to a queue which is added afterwards
+        QueueContainerSnapshot(MemberType_t& members, const uint64_t deliveredHistoryWriteEnd) noexcept;
+        QueueContainerSnapshot(const QueueContainerSnapshot&) = delete;
+        QueueContainerSnapshot(QueueContainerSnapshot&&) = delete;
+        QueueContainerSnapshot& operator=(const QueueContainerSnapshot&) = delete;
+        QueueContainerSnapshot& operator=(QueueContainerSnapshot&&) = delete;
+        ~QueueContainerSnapshot() noexcept;
+
+        const QueueContainer_t& queues() const noexcept;
+        const QueueSlotContainer_t& queueSlots() const noexcept;
+
+      private:
+        const MemberType_t& m_members;
+        uint32_t m_index{0U};
+    };
+
+    /// @brief Returns the active queue container; must only be called with the lock held since only the modifying
+    /// side may access it without a snapshot
+    const QueueContainer_t& activeQueues() const noexcept;
+
+    /// @brief Applies the modifier to a copy of the active queue container and makes the copy the active one. Waits
+    /// a grace period for the readers of the previous version to finish; the previous version is not reused as long
+    /// as it is pinned. Must be called with the lock held
+    /// @param[in] modifier callable with the signature void(QueueContainer_t&, QueueSlotContainer_t&)
+    /// @return the history write end of the chunks which were delivered with a previous version, i.e. the end of the
+    /// history a queue added by the modifier must get from the history; nullopt if no unpinned container version was
+    /// available in time and the modifier was not applied
+    template <typename Modifier>
+    optional<uint64_t> modifyQueues(const Modifier& modifier) noexcept;
+
+    static optional<uint32_t> findQueueIndex(const QueueContainer_t& queues,
+                                             const UniqueId uniqueQueueId,
+                                             const uint32_t lastKnownQueueIndex) noexcept;
+
+    /// @brief Delivers the chunk to the queue which is found with the lookup in the pinned queue container
+    /// @param[in] findQueue callable with the signature optional<uint32_t>(const QueueContainerSnapshot&)
+    /// @param[in] chunk is the SharedChunk to be delivered
+    template <typename QueueLookup>
+    expected<void, ChunkDistributorError> deliverToSingleQueue(const QueueLookup& findQueue,
+                                                               mepoo::SharedChunk chunk) noexcept;
+
+    static optional<uint32_t> findQueueIndexWithHandle(const QueueContainer_t& queues,
+                                                       const QueueSlotContainer_t& queueSlots,
+                                                       const UniqueId uniqueQueueId,
+                                                       const uint32_t queueHandle) noexcept;
+
+    /// @brief Returns the position of the queue with the provided handle without checking its ID
+    /// @return the position or nullopt if the queue of the handle was removed
+    static optional<uint32_t> findQueuePositionWithHandle(const QueueSlotContainer_t& queueSlots,
+                                                          const uint32_t queueHandle) noexcept;
+
+    /// @brief Returns the handle of the queue at the provided position; only used when a delivery must be retried
+    static uint32_t queueHandleAtPosition(const QueueSlotContainer_t& queueSlots, const uint32_t position) noexcept;
+
+    static void assignQueueSlot(QueueSlotContainer_t& queueSlots, const uint32_t position) noexcept;
+    static void releaseQueueSlot(QueueSlotContainer_t& queueSlots, const uint32_t position) noexcept;
+
+    /// @brief the lower bits of a handle are the slot of the queue, the upper bits the generation of the slot
+    static constexpr uint32_t QUEUE_HANDLE_SLOT_BITS{16U};
+    static uint32_t toQueueHandle(const uint32_t slot, const uint16_t generation) noexcept;
+
+    /// @brief The outcome of a broadcast for the queue at the same position in the queue container
+    struct BroadcastResult_t
+    {
+        const ConditionVariableData* m_conditionVariable{nullptr};
+        bool m_isRetryRequired{false};
+    };
+    using BroadcastResultContainer_t =
+        vector<BroadcastResult_t, MemberType_t::ChunkDistributorDataProperties_t::MAX_QUEUES>;
+
+    /// @brief Delivers the chunk to all provided queues with a single increment of the reference counter and wakes up
+    /// every attached condition variable only once
+    /// @param[in] queues are the pinned queues to deliver the chunk to
+    /// @param[in] queueSlots are the slots of the pinned queues
+    /// @param[in] chunk is the SharedChunk to be delivered
+    /// @param[out] remainingQueues are the handles of the blocking queues which were full and must be retried
+    /// @return the number of queues the chunk was delivered to
+    uint64_t broadcastToQueues(const QueueContainer_t& queues,
+                               const QueueSlotContainer_t& queueSlots,
+                               mepoo::SharedChunk chunk,
+                               QueueHandleContainer_t& remainingQueues) noexcept;
+
+    /// @brief Retries the delivery to the full blocking queues until every queue which is still stored has the chunk
+    /// and records the blocked time
+    /// @param[in] chunk is the SharedChunk to be delivered
+    /// @param[in] remainingQueues are the handles of the full blocking queues
+    /// @return the number of queues the chunk was delivered to
+    uint64_t deliverToRemainingQueues(mepoo::SharedChunk chunk, QueueHandleContainer_t& remainingQueues) noexcept;
+
+    /// @brief Retries to push the chunk into a full blocking queue. The first retries are done with a short wait in
+    /// between by the caller, afterwards the sender blocks until the consumer pops a chunk
+    /// @param[in] queue is the full queue which must be pinned by the caller
+    /// @param[in] chunk is the SharedChunk to be delivered
+    /// @param[in] numberOfRetries is the number of retries which were done before for this delivery
+    /// @return true if the chunk was pushed, false if not
+    bool retryPushToBlockingQueue(not_null<ChunkQueueData_t* const> queue,
+                                  mepoo::SharedChunk chunk,
+                                  const uint64_t numberOfRetries) noexcept;
+
+    /// @brief Notifies every stored queue about new chunks in the chunk ring
+    /// @return the number of stored queues
+    uint64_t notifyAllStoredQueues() noexcept;
+
+    /// @brief Hands over a copy of the unmanaged chunk to each queue in the range [begin, end) and activates the
+    /// notifications of the queues which got the chunk without waking up the waiting threads
+    void pushToQueueRange(const QueueContainer_t& queues,
+                          const uint64_t begin,
+                          const uint64_t end,
+                          const mepoo::ShmSafeUnmanagedChunk chunk,
+                          BroadcastResultContainer_t& results) const noexcept;
+
+    /// @brief Wakes up every condition variable of the broadcast once with the lock of a queue which is still attached
+    void wakeUpConditionVariables(const QueueContainer_t& queues, const BroadcastResultContainer_t& results) noexcept;
+
+    /// @brief Returns true if the wake up order of the last broadcast still groups the queues of the provided results
+    /// by their condition variable
+    bool isWakeUpOrderValid(const BroadcastResultContainer_t& results) const noexcept;
+
+    /// @brief Delivers the requested number of chunks from the history to the queue; chunks which were written to the
+    /// history after writeEnd are not delivered since the sender delivers them to the queue
+    /// @param[in] queue to which the history shall be delivered
+    /// @param[in] requestedHistory number of last chunks to deliver
+    /// @param[in] writeEnd is the history write end which was delivered with the versions before the queue was stored
+    void deliverHistory(not_null<ChunkQueueData_t* const> queue,
+                        const uint64_t requestedHistory,
+                        const uint64_t writeEnd) noexcept;
+
+    /// @brief Writes the chunk to the history without publishing the history write end
+    void writeToHistory(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief Stores the history write end together with the index of the active queue container
+    void storeDeliveredHistoryWriteEnd(const uint64_t historyWriteEnd) noexcept;
+
+    /// @brief Releases a chunk which was evicted from the history or retires it if a reader might still access it
+    void releaseOrRetireHistoryChunk(mepoo::ShmSafeUnmanagedChunk evictedChunk) noexcept;
+    void releaseRetiredHistoryChunks() noexcept;
+
+    /// @brief Waits until the queue container with the provided index is not pinned by a reader anymore
+    /// @param[in] index of the queue container
+    /// @return true if the queue container is not pinned, false if the reader did not finish in time; the reader
+    /// might just be preempted, therefore the container stays untouched until it is unpinned or released by cleanup()
+    bool waitForQueueContainerReaders(const uint32_t index) const noexcept;
+
+    static constexpr units::Duration QUEUE_CONTAINER_READER_TIMEOUT{units::Duration::fromMilliseconds(100U)};
+
+    /// @brief The number of retries for a full blocking queue before the sender blocks
+    static constexpr uint64_t CONSUMER_WAIT_SPIN_REPETITIONS{100U};
+    /// @brief The blocked sender wakes up after this time even if the semaphore of the queue is not posted, e.g. since
+    /// the consumer was terminated
+    static constexpr units::Duration CONSUMER_WAIT_TIMEOUT{units::Duration::fromMilliseconds(10U)};
+
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
+    DeliveryHelper* m_deliveryHelper{nullptr};
+
+    /// The positions of the queues sorted by their condition variable at the last broadcast. It is only sorted again
+    /// when the stored queues or their condition variables changed, i.e. when the order does not group the queues
+    /// anymore. The addresses of the condition variables are process local, hence the order is not shared.
+    vector<uint16_t, MemberType_t::ChunkDistributorDataProperties_t::MAX_QUEUES> m_wakeUpOrder;
 };
 
 } // namespace popo
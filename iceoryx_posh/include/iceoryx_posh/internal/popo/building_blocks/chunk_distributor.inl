@@ -44,6 +44,205 @@ ChunkDistributor<ChunkDistributorDataType>::getMembers() noexcept
     return m_chunkDistrubutorDataPtr;
 }
 
+template <typename ChunkDistributorDataType>
+constexpr units::Duration ChunkDistributor<ChunkDistributorDataType>::QUEUE_CONTAINER_READER_TIMEOUT;
+
+template <typename ChunkDistributorDataType>
+constexpr uint32_t ChunkDistributor<ChunkDistributorDataType>::INVALID_QUEUE_HANDLE;
+
+template <typename ChunkDistributorDataType>
+constexpr uint32_t ChunkDistributor<ChunkDistributorDataType>::QUEUE_HANDLE_SLOT_BITS;
+
+template <typename ChunkDistributorDataType>
+constexpr uint64_t ChunkDistributor<ChunkDistributorDataType>::CONSUMER_WAIT_SPIN_REPETITIONS;
+
+template <typename ChunkDistributorDataType>
+constexpr units::Duration ChunkDistributor<ChunkDistributorDataType>::CONSUMER_WAIT_TIMEOUT;
+
+template <typename ChunkDistributorDataType>
+inline ChunkDistributor<ChunkDistributorDataType>::QueueContainerSnapshot::QueueContainerSnapshot(
+    const MemberType_t& members) noexcept
+    : m_members(members)
+{
+    // pin the active container and check afterwards that it is still the active one; if it is not, the modifying side
+    // might already reuse it and it must not be read
+    do
+    {
+        m_index = m_members.activeQueueContainerIndex();
+        m_members.m_queueContainerReaders[m_index].fetch_add(1U, std::memory_order_seq_cst);
+        if (m_index == m_members.activeQueueContainerIndex())
+        {
+            break;
+        }
+        m_members.m_queueContainerReaders[m_index].fetch_sub(1U, std::memory_order_release);
+    } while (true);
+}
+
+template <typename ChunkDistributorDataType>
+inline ChunkDistributor<ChunkDistributorDataType>::QueueContainerSnapshot::QueueContainerSnapshot(
+    MemberType_t& members, const uint64_t deliveredHistoryWriteEnd) noexcept
+    : m_members(members)
+{
+    // like above, but the check that the pinned container is still the active one also stores the history write end;
+    // the modifying side reads it when it publishes another container, hence it knows exactly which chunks were
+    // delivered without the queues of that container
+    auto activeQueueContainer = members.m_activeQueueContainer.load(std::memory_order_seq_cst);
+    do
+    {
+        m_index = MemberType_t::queueContainerIndex(activeQueueContainer);
+        members.m_queueContainerReaders[m_index].fetch_add(1U, std::memory_order_seq_cst);
+        if (members.m_activeQueueContainer.compare_exchange_strong(
+                activeQueueContainer,
+                MemberType_t::toActiveQueueContainer(m_index, deliveredHistoryWriteEnd),
+                std::memory_order_seq_cst))
+        {
+            break;
+        }
+        members.m_queueContainerReaders[m_index].fetch_sub(1U, std::memory_order_release);
+    } while (true);
+}
+
+template <typename ChunkDistributorDataType>
+inline ChunkDistributor<ChunkDistributorDataType>::QueueContainerSnapshot::~QueueContainerSnapshot() noexcept
+{
+    m_members.m_queueContainerReaders[m_index].fetch_sub(1U, std::memory_order_release);
+}
+
+template <typename ChunkDistributorDataType>
+inline const typename ChunkDistributor<ChunkDistributorDataType>::QueueContainer_t&
+ChunkDistributor<ChunkDistributorDataType>::QueueContainerSnapshot::queues() const noexcept
+{
+    return m_members.m_queues[m_index];
+}
+
+template <typename ChunkDistributorDataType>
+inline const typename ChunkDistributor<ChunkDistributorDataType>::QueueSlotContainer_t&
+ChunkDistributor<ChunkDistributorDataType>::QueueContainerSnapshot::queueSlots() const noexcept
+{
+    return m_members.m_queueSlots[m_index];
+}
+
+template <typename ChunkDistributorDataType>
+inline const typename ChunkDistributor<ChunkDistributorDataType>::QueueContainer_t&
+ChunkDistributor<ChunkDistributorDataType>::activeQueues() const noexcept
+{
+    return getMembers()->m_queues[getMembers()->activeQueueContainerIndex()];
+}
+
+template <typename ChunkDistributorDataType>
+inline bool
+ChunkDistributor<ChunkDistributorDataType>::waitForQueueContainerReaders(const uint32_t index) const noexcept
+{
+    iox::detail::adaptive_wait adaptiveWait;
+    deadline_timer readerTimeout{QUEUE_CONTAINER_READER_TIMEOUT};
+    while (getMembers()->m_queueContainerReaders[index].load(std::memory_order_acquire) != 0U)
+    {
+        if (readerTimeout.hasExpired())
+        {
+            return false;
+        }
+        adaptiveWait.wait();
+    }
+    return true;
+}
+
+template <typename ChunkDistributorDataType>
+template <typename Modifier>
+inline optional<uint64_t> ChunkDistributor<ChunkDistributorDataType>::modifyQueues(const Modifier& modifier) noexcept
+{
+    auto members = getMembers();
+    const auto activeIndex = members->activeQueueContainerIndex();
+
+    // search for a container which is not pinned; usually there is one since the sender pins at most one container
+    // and a container which stays pinned by a terminated sender is released with cleanup()
+    uint32_t nextIndex{activeIndex};
+    iox::detail::adaptive_wait adaptiveWait;
+    deadline_timer searchTimeout{QUEUE_CONTAINER_READER_TIMEOUT};
+    while (nextIndex == activeIndex)
+    {
+        for (uint32_t i = 1U; i < MemberType_t::NUMBER_OF_QUEUE_CONTAINER_VERSIONS; ++i)
+        {
+            const auto candidate = (activeIndex + i) % MemberType_t::NUMBER_OF_QUEUE_CONTAINER_VERSIONS;
+            if (members->m_queueContainerReaders[candidate].load(std::memory_order_seq_cst) == 0U)
+            {
+                nextIndex = candidate;
+                break;
+            }
+        }
+        if (nextIndex == activeIndex)
+        {
+            if (searchTimeout.hasExpired())
+            {
+                IOX_LOG(ERROR) << "All previous versions of the chunk distributor queues are still pinned by senders! "
+                                  "The queues are not modified.";
+                errorHandler(PoshError::POPO__CHUNK_DISTRIBUTOR_NO_UNPINNED_QUEUE_CONTAINER, ErrorLevel::MODERATE);
+                return nullopt;
+            }
+            adaptiveWait.wait();
+        }
+    }
+
+    members->m_queues[nextIndex] = members->m_queues[activeIndex];
+    members->m_queueSlots[nextIndex] = members->m_queueSlots[activeIndex];
+    modifier(members->m_queues[nextIndex], members->m_queueSlots[nextIndex]);
+
+    // the sender might store a new history write end concurrently, it is kept for the published container
+    auto activeQueueContainer = members->m_activeQueueContainer.load(std::memory_order_seq_cst);
+    while (!members->m_activeQueueContainer.compare_exchange_weak(
+        activeQueueContainer,
+        MemberType_t::toActiveQueueContainer(nextIndex, MemberType_t::deliveredHistoryWriteEnd(activeQueueContainer)),
+        std::memory_order_seq_cst))
+    {
+    }
+
+    // a sender which waits for a consumer blocks with the previous version pinned; it is woken up to continue with the
+    // modified version
+    if (members->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER)
+    {
+        for (auto& queue : members->m_queues[activeIndex])
+        {
+            ChunkQueuePusher_t(queue.get()).wakeUpWaitingProducers();
+        }
+    }
+
+    // grace period; in the common case no reader accesses a queue which was removed with this modification afterwards.
+    // A reader which did not finish in time keeps the previous version pinned and the owner of a removed queue has
+    // to defer its destruction until isQueueReferenced returns false
+    if (!waitForQueueContainerReaders(activeIndex))
+    {
+        IOX_LOG(DEBUG) << "A reader of the chunk distributor queues did not finish in time; the previous queues are "
+                          "kept until the reader is done.";
+    }
+    return MemberType_t::deliveredHistoryWriteEnd(activeQueueContainer);
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::isQueueReferenced(
+    not_null<const ChunkQueueData_t* const> queue) const noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+
+    const auto activeIndex = getMembers()->activeQueueContainerIndex();
+    for (uint32_t index = 0U; index < MemberType_t::NUMBER_OF_QUEUE_CONTAINER_VERSIONS; ++index)
+    {
+        // a version which is neither active nor pinned cannot be read anymore; it is only pinned again after it was
+        // reused for a modification and became the active one
+        if (index != activeIndex
+            && getMembers()->m_queueContainerReaders[index].load(std::memory_order_seq_cst) == 0U)
+        {
+            continue;
+        }
+        for (const auto& storedQueue : getMembers()->m_queues[index])
+        {
+            if (storedQueue.get() == queue)
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 template <typename ChunkDistributorDataType>
 inline expected<void, ChunkDistributorError>
 ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(not_null<ChunkQueueData_t* const> queueToAdd,
@@ -51,21 +250,65 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(not_null<ChunkQueueData_
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
+    const auto& queues = activeQueues();
     const auto alreadyKnownReceiver =
-        std::find_if(getMembers()->m_queues.begin(),
-                     getMembers()->m_queues.end(),
-                     [&](const RelativePointer<ChunkQueueData_t> queue) { return queue.get() == queueToAdd; });
+        std::find_if(queues.begin(), queues.end(), [&](const RelativePointer<ChunkQueueData_t> queue) {
+            return queue.get() == queueToAdd;
+        });
 
     // check if the queue is not already in the list
-    if (alreadyKnownReceiver == getMembers()->m_queues.end())
+    if (alreadyKnownReceiver == queues.end())
     {
-        if (getMembers()->m_queues.size() < getMembers()->m_queues.capacity())
+        if (queues.size() < queues.capacity())
         {
-            // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we checked the capacity, so
-            // pushing will be fine
-            getMembers()->m_queues.push_back(RelativePointer<ChunkQueueData_t>(queueToAdd));
+            // the queue is attached to the chunk ring before it is stored, hence it can read every chunk which is
+            // written from now on
+            uint64_t chunkRingCursor{0U};
+            if (isChunkRingEnabled())
+            {
+                auto& chunkRing = getMembers()->m_chunkRing;
+                ChunkRingReader chunkRingReader(&chunkRing);
+                if (requestedHistory > chunkRingReader.getCapacity())
+                {
+                    IOX_LOG(WARN) << "Chunk history request exceeds chunk ring capacity! Request is "
+                                  << requestedHistory << ". Capacity is " << chunkRingReader.getCapacity() << ".";
+                }
+                chunkRingCursor = chunkRingReader.getCursorForHistory(requestedHistory);
+                if (!ChunkQueuePusher_t(queueToAdd).attachChunkRing(chunkRing, chunkRingCursor))
+                {
+                    IOX_LOG(WARN) << "The queue is already attached to the maximum number of chunk rings! Capacity is "
+                                  << MAX_CHUNK_RINGS_PER_SUBSCRIBER << ".";
+                    errorHandler(PoshError::POPO__CHUNK_DISTRIBUTOR_OVERFLOW_OF_CHUNK_RING_ATTACHMENTS,
+                                 ErrorLevel::MODERATE);
+                    return err(ChunkDistributorError::CHUNK_RING_ATTACHMENT_OVERFLOW);
+                }
+            }
 
-            const auto currChunkHistorySize = getMembers()->m_history.size();
+            const auto deliveredHistoryWriteEnd =
+                modifyQueues([&](QueueContainer_t& queuesToModify, QueueSlotContainer_t& queueSlotsToModify) {
+                    assignQueueSlot(queueSlotsToModify, static_cast<uint32_t>(queuesToModify.size()));
+                    // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we checked the
+                    // capacity, so pushing will be fine
+                    queuesToModify.push_back(RelativePointer<ChunkQueueData_t>(queueToAdd));
+                });
+            if (!deliveredHistoryWriteEnd.has_value())
+            {
+                if (isChunkRingEnabled())
+                {
+                    ChunkQueuePusher_t(queueToAdd).detachChunkRing(getMembers()->m_chunkRing);
+                }
+                return err(ChunkDistributorError::NO_UNPINNED_QUEUE_CONTAINER);
+            }
+
+            if (isChunkRingEnabled())
+            {
+                // the sender did not notify the queue about the chunks which were written before it was stored
+                if (ChunkRingReader(&getMembers()->m_chunkRing).getNumberOfUnreadChunks(chunkRingCursor) > 0U)
+                {
+                    ChunkQueuePusher_t(queueToAdd).notify();
+                }
+                return ok();
+            }
 
             if (requestedHistory > getMembers()->m_historyCapacity)
             {
@@ -73,14 +316,10 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(not_null<ChunkQueueData_
                               << ". Capacity is " << getMembers()->m_historyCapacity << ".";
             }
 
-            // if the current history is large enough we send the requested number of chunks, else we send the
-            // total history
-            const auto startIndex =
-                (requestedHistory <= currChunkHistorySize) ? currChunkHistorySize - requestedHistory : 0u;
-            for (auto i = startIndex; i < currChunkHistorySize; ++i)
-            {
-                pushToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
-            }
+            // the chunks before the delivered history write end were delivered with a container without the added queue,
+            // the sender delivers all later chunks with a container which contains it; hence the replay stops exactly
+            // where the delivery of the sender starts and no chunk is delivered twice
+            deliverHistory(queueToAdd, requestedHistory, deliveredHistoryWriteEnd.value());
 
             return ok();
         }
@@ -103,13 +342,28 @@ ChunkDistributor<ChunkDistributorDataType>::tryRemoveQueue(not_null<ChunkQueueDa
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    const auto iter = std::find(getMembers()->m_queues.begin(),
-                                getMembers()->m_queues.end(),
-                                static_cast<ChunkQueueData_t* const>(queueToRemove));
-    if (iter != getMembers()->m_queues.end())
+    const auto& queues = activeQueues();
+    const auto iter = std::find(queues.begin(), queues.end(), static_cast<ChunkQueueData_t* const>(queueToRemove));
+    if (iter != queues.end())
     {
-        // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we don't use iter any longer so return value can be ignored
-        getMembers()->m_queues.erase(iter);
+        const auto position = iter - queues.begin();
+        const bool isModified =
+            modifyQueues([&](QueueContainer_t& queuesToModify, QueueSlotContainer_t& queueSlotsToModify) {
+                releaseQueueSlot(queueSlotsToModify, static_cast<uint32_t>(position));
+                // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we don't use iter any longer so return value can be
+                // ignored
+                queuesToModify.erase(queuesToModify.begin() + position);
+            })
+                .has_value();
+        if (!isModified)
+        {
+            return err(ChunkDistributorError::NO_UNPINNED_QUEUE_CONTAINER);
+        }
+
+        if (isChunkRingEnabled())
+        {
+            ChunkQueuePusher_t(queueToRemove).detachChunkRing(getMembers()->m_chunkRing);
+        }
 
         return ok();
     }
@@ -124,97 +378,427 @@ inline void ChunkDistributor<ChunkDistributorDataType>::removeAllQueues() noexce
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    getMembers()->m_queues.clear();
+    const QueueContainer_t removedQueues(activeQueues());
+    const bool isModified = modifyQueues([](QueueContainer_t& queuesToModify,
+                                            QueueSlotContainer_t& queueSlotsToModify) {
+        // the slots are kept since their generations must survive the removal
+        for (auto& queueSlot : queueSlotsToModify)
+        {
+            if (queueSlot.m_position != MemberType_t::INVALID_QUEUE_POSITION)
+            {
+                queueSlot.m_position = MemberType_t::INVALID_QUEUE_POSITION;
+                ++queueSlot.m_generation;
+            }
+        }
+        queuesToModify.clear();
+    }).has_value();
+
+    if (isModified && isChunkRingEnabled())
+    {
+        for (auto& queue : removedQueues)
+        {
+            ChunkQueuePusher_t(queue.get()).detachChunkRing(getMembers()->m_chunkRing);
+        }
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::isChunkRingEnabled() const noexcept
+{
+    return getMembers()->m_chunkRing.m_capacity != 0U;
 }
 
 template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::hasStoredQueues() const noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    QueueContainerSnapshot snapshot(*getMembers());
 
-    return !getMembers()->m_queues.empty();
+    return !snapshot.queues().empty();
 }
 
 template <typename ChunkDistributorDataType>
 inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept
 {
+    if (isChunkRingEnabled())
+    {
+        ChunkRingWriter(&getMembers()->m_chunkRing).write(chunk);
+        return notifyAllStoredQueues();
+    }
+
+    // the history is written before the snapshot is taken and the snapshot stores the history write end; a queue
+    // which is stored meanwhile gets the chunk either from the history or from this delivery, see tryAddQueue
+    writeToHistory(chunk);
+
     uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
-    typename ChunkDistributorDataType::QueueContainer_t remainingQueues;
+    QueueHandleContainer_t remainingQueues;
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
+        QueueContainerSnapshot snapshot(*getMembers(), getMembers()->m_historyWriteEnd.load(std::memory_order_relaxed));
 
-        bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
-        // send to all the queues
-        for (auto& queue : getMembers()->m_queues)
+        const auto broadcastDeliveryThreshold = getMembers()->m_broadcastDeliveryThreshold;
+        if (broadcastDeliveryThreshold != 0U && snapshot.queues().size() >= broadcastDeliveryThreshold)
         {
-            bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
-
-            if (pushToQueue(queue.get(), chunk))
-            {
-                ++numberOfQueuesTheChunkWasDeliveredTo;
-            }
-            else
+            numberOfQueuesTheChunkWasDeliveredTo =
+                broadcastToQueues(snapshot.queues(), snapshot.queueSlots(), chunk, remainingQueues);
+        }
+        else
+        {
+            bool willWaitForConsumer =
+                getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+            // send to all the queues
+            uint32_t position{0U};
+            for (auto& queue : snapshot.queues())
             {
-                if (isBlockingQueue)
+                bool isBlockingQueue =
+                    (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
+
+                if (pushToQueue(queue.get(), chunk))
                 {
-                    remainingQueues.emplace_back(queue);
+                    ++numberOfQueuesTheChunkWasDeliveredTo;
                 }
                 else
                 {
-                    ++numberOfQueuesTheChunkWasDeliveredTo;
-                    ChunkQueuePusher_t(queue.get()).lostAChunk();
+                    if (isBlockingQueue)
+                    {
+                        // AXIVION Next Construct AutosarC++19_03-A0.1.2 : there are not more handles than queues
+                        remainingQueues.push_back(queueHandleAtPosition(snapshot.queueSlots(), position));
+                    }
+                    else
+                    {
+                        ++numberOfQueuesTheChunkWasDeliveredTo;
+                        ChunkQueuePusher_t(queue.get()).lostAChunk();
+                    }
                 }
+                ++position;
             }
         }
     }
 
-    // busy waiting until every queue is served
+    if (!remainingQueues.empty())
+    {
+        numberOfQueuesTheChunkWasDeliveredTo += deliverToRemainingQueues(chunk, remainingQueues);
+    }
+
+    return numberOfQueuesTheChunkWasDeliveredTo;
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t
+ChunkDistributor<ChunkDistributorDataType>::deliverToRemainingQueues(mepoo::SharedChunk chunk,
+                                                                     QueueHandleContainer_t& remainingQueues) noexcept
+{
+    const auto blockedSince = BlockedTimeStatisticsData::currentTime();
+    uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
+    uint64_t numberOfRetries{0U};
     iox::detail::adaptive_wait adaptiveWait;
     while (!remainingQueues.empty())
     {
-        adaptiveWait.wait();
+        if (numberOfRetries < CONSUMER_WAIT_SPIN_REPETITIONS)
+        {
+            adaptiveWait.wait();
+        }
+
+        QueueContainerSnapshot snapshot(*getMembers());
+        for (auto i = remainingQueues.size(); i > 0U; --i)
         {
-            // create intersection of current queues and remainingQueues
-            // reason: it is possible that since the last iteration some subscriber have already unsubscribed
-            //          and without this intersection we would deliver to dead queues
-            typename MemberType_t::LockGuard_t lock(*getMembers());
-            typename ChunkDistributorDataType::QueueContainer_t queueIntersection(remainingQueues.size());
-            auto greaterThan = [](RelativePointer<ChunkQueueData_t>& a, RelativePointer<ChunkQueueData_t>& b) -> bool {
-                return reinterpret_cast<uint64_t>(a.get()) > reinterpret_cast<uint64_t>(b.get());
-            };
-            std::sort(getMembers()->m_queues.begin(), getMembers()->m_queues.end(), greaterThan);
-            std::sort(remainingQueues.begin(), remainingQueues.end(), greaterThan);
-
-            auto iter = std::set_intersection(getMembers()->m_queues.begin(),
-                                              getMembers()->m_queues.end(),
-                                              remainingQueues.begin(),
-                                              remainingQueues.end(),
-                                              queueIntersection.begin(),
-                                              greaterThan);
-            queueIntersection.resize(static_cast<uint64_t>(iter - queueIntersection.begin()));
-            remainingQueues = queueIntersection;
-
-            // deliver to remaining queues
-            for (uint64_t i = remainingQueues.size() - 1U; !remainingQueues.empty(); --i)
+            // a queue which was removed since the last retry has a slot with another generation and is skipped, without
+            // this we would deliver to dead queues
+            auto position = findQueuePositionWithHandle(snapshot.queueSlots(), remainingQueues[i - 1U]);
+            if (!position.has_value())
+            {
+                remainingQueues.erase(remainingQueues.begin() + (i - 1U));
+                continue;
+            }
+
+            // the sender blocks only for the first remaining queue, the others are retried when it was served
+            const uint64_t retries = (i == 1U) ? numberOfRetries : 0U;
+            if (retryPushToBlockingQueue(snapshot.queues()[position.value()].get(), chunk, retries))
             {
-                if (pushToQueue(remainingQueues[i].get(), chunk))
+                remainingQueues.erase(remainingQueues.begin() + (i - 1U));
+                ++numberOfQueuesTheChunkWasDeliveredTo;
+            }
+        }
+        ++numberOfRetries;
+    }
+
+    getMembers()->m_blockedTimeStatistics.record(BlockedTimeStatisticsData::currentTime() - blockedSince);
+
+    return numberOfQueuesTheChunkWasDeliveredTo;
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::retryPushToBlockingQueue(
+    not_null<ChunkQueueData_t* const> queue, mepoo::SharedChunk chunk, const uint64_t numberOfRetries) noexcept
+{
+    if (numberOfRetries < CONSUMER_WAIT_SPIN_REPETITIONS)
+    {
+        return pushToQueue(queue, chunk);
+    }
+
+    // the queue stays pinned while the sender blocks; a modification of the stored queues wakes the sender up in
+    // order to let it unpin them
+    return ChunkQueuePusher_t(queue).pushOrWaitForSpace(chunk, CONSUMER_WAIT_TIMEOUT);
+}
+
+template <typename ChunkDistributorDataType>
+inline BlockedTimeStatistics ChunkDistributor<ChunkDistributorDataType>::getBlockedTimeStatistics() const noexcept
+{
+    return getMembers()->m_blockedTimeStatistics.load();
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t
+ChunkDistributor<ChunkDistributorDataType>::broadcastToQueues(const QueueContainer_t& queues,
+                                                              const QueueSlotContainer_t& queueSlots,
+                                                              mepoo::SharedChunk chunk,
+                                                              QueueHandleContainer_t& remainingQueues) noexcept
+{
+    const auto numberOfQueues = queues.size();
+    BroadcastResultContainer_t results(numberOfQueues);
+
+    // every queue gets a copy of the unmanaged chunk which owns one reference; a queue which drops the chunk releases
+    // its reference again
+    mepoo::ShmSafeUnmanagedChunk unmanagedChunk(chunk);
+    unmanagedChunk.addReferencesForCopies(numberOfQueues - 1U);
+
+    if (m_deliveryHelper != nullptr && numberOfQueues > 1U)
+    {
+        const auto middle = numberOfQueues / 2U;
+        // the callable must outlive the delivery of the helper, therefore it must not be a temporary
+        auto deliverSecondHalf = [&] { pushToQueueRange(queues, middle, numberOfQueues, unmanagedChunk, results); };
+        m_deliveryHelper->execute(deliverSecondHalf);
+        pushToQueueRange(queues, 0U, middle, unmanagedChunk, results);
+        m_deliveryHelper->waitForCompletion();
+    }
+    else
+    {
+        pushToQueueRange(queues, 0U, numberOfQueues, unmanagedChunk, results);
+    }
+
+    wakeUpConditionVariables(queues, results);
+
+    uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
+    for (uint64_t i = 0U; i < numberOfQueues; ++i)
+    {
+        if (results[i].m_isRetryRequired)
+        {
+            // AXIVION Next Construct AutosarC++19_03-A0.1.2 : there are not more handles than queues
+            remainingQueues.push_back(queueHandleAtPosition(queueSlots, static_cast<uint32_t>(i)));
+        }
+        else
+        {
+            ++numberOfQueuesTheChunkWasDeliveredTo;
+        }
+    }
+    return numberOfQueuesTheChunkWasDeliveredTo;
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::notifyAllStoredQueues() noexcept
+{
+    QueueContainerSnapshot snapshot(*getMembers());
+
+    for (auto& queue : snapshot.queues())
+    {
+        ChunkQueuePusher_t(queue.get()).notify();
+    }
+    return snapshot.queues().size();
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::pushToQueueRange(const QueueContainer_t& queues,
+                                                                         const uint64_t begin,
+                                                                         const uint64_t end,
+                                                                         const mepoo::ShmSafeUnmanagedChunk chunk,
+                                                                         BroadcastResultContainer_t& results) const
+    noexcept
+{
+    bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    for (auto i = begin; i < end; ++i)
+    {
+        auto& queue = queues[i];
+        ChunkQueuePusher_t pusher(queue.get());
+        const bool hasNoQueueOverflow = pusher.pushWithoutNotification(chunk);
+        if (!hasNoQueueOverflow)
+        {
+            if (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER)
+            {
+                results[i].m_isRetryRequired = true;
+            }
+            else
+            {
+                pusher.lostAChunk();
+            }
+        }
+
+        // on an overflow, only a queue which discards its oldest chunk holds the new one; the consumer of any other
+        // queue must not be notified about a chunk it never gets
+        if (hasNoQueueOverflow || queue->m_queueFullPolicy == QueueFullPolicy::DISCARD_OLDEST_DATA)
+        {
+            results[i].m_conditionVariable = pusher.activateNotification();
+        }
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::wakeUpConditionVariables(const QueueContainer_t& queues,
+                                                                     const BroadcastResultContainer_t& results) noexcept
+{
+    // group the queues by their condition variable; the order of the last broadcast is reused as long as the queues
+    // and their condition variables do not change
+    if (!isWakeUpOrderValid(results))
+    {
+        m_wakeUpOrder.clear();
+        for (uint64_t i = 0U; i < results.size(); ++i)
+        {
+            // AXIVION Next Construct AutosarC++19_03-A0.1.2 : there are not more results than queues
+            m_wakeUpOrder.push_back(static_cast<uint16_t>(i));
+        }
+        std::sort(m_wakeUpOrder.begin(), m_wakeUpOrder.end(), [&](const uint16_t lhs, const uint16_t rhs) {
+            return std::less<const ConditionVariableData*>()(results[lhs].m_conditionVariable,
+                                                              results[rhs].m_conditionVariable);
+        });
+    }
+
+    // a condition variable is only woken up with the lock of a queue which is still attached to it; if none is
+    // attached anymore, nobody waits for the notifications
+    uint64_t i{0U};
+    while (i < m_wakeUpOrder.size())
+    {
+        const auto conditionVariable = results[m_wakeUpOrder[i]].m_conditionVariable;
+        bool isWokenUp{conditionVariable == nullptr};
+        for (; i < m_wakeUpOrder.size() && results[m_wakeUpOrder[i]].m_conditionVariable == conditionVariable; ++i)
+        {
+            if (!isWokenUp)
+            {
+                isWokenUp = ChunkQueuePusher_t(queues[m_wakeUpOrder[i]].get()).wakeUp(conditionVariable);
+            }
+        }
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline bool
+ChunkDistributor<ChunkDistributorDataType>::isWakeUpOrderValid(const BroadcastResultContainer_t& results) const noexcept
+{
+    // the order is a permutation of all positions, hence it is still valid if the condition variables are sorted;
+    // the queues without a condition variable are skipped when waking up and can be anywhere
+    if (m_wakeUpOrder.size() != results.size())
+    {
+        return false;
+    }
+
+    const ConditionVariableData* previousConditionVariable{nullptr};
+    for (const auto position : m_wakeUpOrder)
+    {
+        const auto conditionVariable = results[position].m_conditionVariable;
+        if (conditionVariable == nullptr)
+        {
+            continue;
+        }
+        if (std::less<const ConditionVariableData*>()(conditionVariable, previousConditionVariable))
+        {
+            return false;
+        }
+        previousConditionVariable = conditionVariable;
+    }
+    return true;
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t
+ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(const span<mepoo::SharedChunk> chunks) noexcept
+{
+    uint64_t numberOfQueuesTheChunksWereDeliveredTo{0U};
+    if (chunks.empty())
+    {
+        return numberOfQueuesTheChunksWereDeliveredTo;
+    }
+
+    if (isChunkRingEnabled())
+    {
+        ChunkRingWriter chunkRingWriter(&getMembers()->m_chunkRing);
+        for (uint64_t i = 0U; i < chunks.size(); ++i)
+        {
+            chunkRingWriter.write(chunks[i]);
+        }
+        return notifyAllStoredQueues();
+    }
+
+    // the history is written before the snapshot is taken, see deliverToAllStoredQueues for a single chunk
+    for (uint64_t i = 0U; i < chunks.size(); ++i)
+    {
+        writeToHistory(chunks[i]);
+    }
+
+    bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    QueueHandleContainer_t remainingQueues;
+    vector<uint64_t, MemberType_t::ChunkDistributorDataProperties_t::MAX_QUEUES> firstUndeliveredChunks;
+    {
+        QueueContainerSnapshot snapshot(*getMembers(), getMembers()->m_historyWriteEnd.load(std::memory_order_relaxed));
+
+        uint32_t position{0U};
+        for (auto& queue : snapshot.queues())
+        {
+            ChunkQueuePusher_t pusher(queue.get());
+            bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
+            bool hasLostChunks{false};
+            bool isBlocked{false};
+            for (uint64_t i = 0U; i < chunks.size(); ++i)
+            {
+                if (!pusher.pushWithoutNotification(chunks[i]))
                 {
-                    remainingQueues.erase(remainingQueues.begin() + i);
-                    ++numberOfQueuesTheChunkWasDeliveredTo;
+                    if (isBlockingQueue)
+                    {
+                        // the remaining chunks are delivered in order once the snapshot is released, since waiting
+                        // for the consumer must not pin the stored queues
+                        // AXIVION Next Construct AutosarC++19_03-A0.1.2 : there are not more handles than queues
+                        remainingQueues.push_back(queueHandleAtPosition(snapshot.queueSlots(), position));
+                        firstUndeliveredChunks.push_back(i);
+                        isBlocked = true;
+                        break;
+                    }
+                    hasLostChunks = true;
                 }
+            }
+
+            if (hasLostChunks)
+            {
+                pusher.lostAChunk();
+            }
+            pusher.notify();
+            if (!isBlocked)
+            {
+                ++numberOfQueuesTheChunksWereDeliveredTo;
+            }
+            ++position;
+        }
+    }
 
-                // don't move this up since the for loop counts downwards and the algorithm would break
-                if (i == 0U)
+    if (!remainingQueues.empty())
+    {
+        // every blocked queue gets its remaining chunks in order; a queue joins the retries with the first chunk it
+        // did not get
+        const auto firstUndeliveredChunk =
+            *std::min_element(firstUndeliveredChunks.begin(), firstUndeliveredChunks.end());
+        uint64_t numberOfBlockedQueuesTheChunksWereDeliveredTo{0U};
+        QueueHandleContainer_t queuesForChunk;
+        for (uint64_t i = firstUndeliveredChunk; i < chunks.size(); ++i)
+        {
+            queuesForChunk.clear();
+            for (uint64_t j = 0U; j < remainingQueues.size(); ++j)
+            {
+                if (firstUndeliveredChunks[j] <= i)
                 {
-                    break;
+                    queuesForChunk.push_back(remainingQueues[j]);
                 }
             }
+            numberOfBlockedQueuesTheChunksWereDeliveredTo = deliverToRemainingQueues(chunks[i], queuesForChunk);
         }
+        numberOfQueuesTheChunksWereDeliveredTo += numberOfBlockedQueuesTheChunksWereDeliveredTo;
     }
 
-    addToHistoryWithoutDelivery(chunk);
-
-    return numberOfQueuesTheChunkWasDeliveredTo;
+    return numberOfQueuesTheChunksWereDeliveredTo;
 }
 
 template <typename ChunkDistributorDataType>
@@ -228,40 +812,97 @@ template <typename ChunkDistributorDataType>
 inline expected<void, ChunkDistributorError>
 ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const UniqueId uniqueQueueId,
                                                            const uint32_t lastKnownQueueIndex,
-                                                           mepoo::SharedChunk chunk IOX_MAYBE_UNUSED) noexcept
+                                                           mepoo::SharedChunk chunk) noexcept
 {
-    bool retry{false};
-    do
-    {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
+    return deliverToSingleQueue(
+        [&](const QueueContainerSnapshot& snapshot) {
+            return findQueueIndex(snapshot.queues(), uniqueQueueId, lastKnownQueueIndex);
+        },
+        chunk);
+}
 
-        auto queueIndex = getQueueIndex(uniqueQueueId, lastKnownQueueIndex);
+template <typename ChunkDistributorDataType>
+inline expected<void, ChunkDistributorError>
+ChunkDistributor<ChunkDistributorDataType>::deliverToQueueWithHandle(const UniqueId uniqueQueueId,
+                                                                     const uint32_t queueHandle,
+                                                                     mepoo::SharedChunk chunk) noexcept
+{
+    return deliverToSingleQueue(
+        [&](const QueueContainerSnapshot& snapshot) {
+            return findQueueIndexWithHandle(snapshot.queues(), snapshot.queueSlots(), uniqueQueueId, queueHandle);
+        },
+        chunk);
+}
 
-        if (!queueIndex.has_value())
+template <typename ChunkDistributorDataType>
+template <typename QueueLookup>
+inline expected<void, ChunkDistributorError>
+ChunkDistributor<ChunkDistributorDataType>::deliverToSingleQueue(const QueueLookup& findQueue,
+                                                                 mepoo::SharedChunk chunk) noexcept
+{
+    bool isQueueStored{true};
+    bool isBlocked{false};
+    units::Duration blockedSince{units::Duration::zero()};
+    uint64_t numberOfRetries{0U};
+    iox::detail::adaptive_wait adaptiveWait;
+    while (true)
+    {
         {
-            return err(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
-        }
+            QueueContainerSnapshot snapshot(*getMembers());
 
-        auto& queue = getMembers()->m_queues[queueIndex.value()];
+            auto queueIndex = findQueue(snapshot);
 
-        bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+            if (!queueIndex.has_value())
+            {
+                isQueueStored = false;
+                break;
+            }
 
-        bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
+            auto& queue = snapshot.queues()[queueIndex.value()];
 
-        retry = false;
-        if (!pushToQueue(queue.get(), chunk))
-        {
-            if (isBlockingQueue)
+            bool willWaitForConsumer =
+                getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+
+            bool isBlockingQueue =
+                (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
+
+            const bool hasPushed = isBlocked ? retryPushToBlockingQueue(queue.get(), chunk, numberOfRetries)
+                                             : pushToQueue(queue.get(), chunk);
+            if (hasPushed || !isBlockingQueue)
+            {
+                if (!hasPushed)
+                {
+                    ChunkQueuePusher_t(queue.get()).lostAChunk();
+                }
+                break;
+            }
+
+            if (isBlocked)
             {
-                retry = true;
+                ++numberOfRetries;
             }
             else
             {
-                ChunkQueuePusher_t(queue.get()).lostAChunk();
+                isBlocked = true;
+                blockedSince = BlockedTimeStatisticsData::currentTime();
             }
         }
-    } while (retry);
 
+        if (numberOfRetries < CONSUMER_WAIT_SPIN_REPETITIONS)
+        {
+            adaptiveWait.wait();
+        }
+    }
+
+    if (isBlocked)
+    {
+        getMembers()->m_blockedTimeStatistics.record(BlockedTimeStatisticsData::currentTime() - blockedSince);
+    }
+
+    if (!isQueueStored)
+    {
+        return err(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
+    }
     return ok();
 }
 
@@ -270,10 +911,17 @@ inline optional<uint32_t>
 ChunkDistributor<ChunkDistributorDataType>::getQueueIndex(const UniqueId uniqueQueueId,
                                                           const uint32_t lastKnownQueueIndex) const noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    QueueContainerSnapshot snapshot(*getMembers());
 
-    auto& queues = getMembers()->m_queues;
+    return findQueueIndex(snapshot.queues(), uniqueQueueId, lastKnownQueueIndex);
+}
 
+template <typename ChunkDistributorDataType>
+inline optional<uint32_t>
+ChunkDistributor<ChunkDistributorDataType>::findQueueIndex(const QueueContainer_t& queues,
+                                                           const UniqueId uniqueQueueId,
+                                                           const uint32_t lastKnownQueueIndex) noexcept
+{
     if (queues.size() > lastKnownQueueIndex && queues[lastKnownQueueIndex]->m_uniqueId == uniqueQueueId)
     {
         return lastKnownQueueIndex;
@@ -291,32 +939,255 @@ ChunkDistributor<ChunkDistributorDataType>::getQueueIndex(const UniqueId uniqueQ
     return nullopt;
 }
 
+template <typename ChunkDistributorDataType>
+inline optional<uint32_t>
+ChunkDistributor<ChunkDistributorDataType>::getQueueHandle(const UniqueId uniqueQueueId) const noexcept
+{
+    QueueContainerSnapshot snapshot(*getMembers());
+
+    const auto& queues = snapshot.queues();
+    const auto& queueSlots = snapshot.queueSlots();
+    for (uint32_t slot = 0U; slot < queueSlots.size(); ++slot)
+    {
+        const auto position = queueSlots[slot].m_position;
+        if (position != MemberType_t::INVALID_QUEUE_POSITION && queues[position]->m_uniqueId == uniqueQueueId)
+        {
+            return toQueueHandle(slot, queueSlots[slot].m_generation);
+        }
+    }
+    return nullopt;
+}
+
+template <typename ChunkDistributorDataType>
+inline optional<uint32_t>
+ChunkDistributor<ChunkDistributorDataType>::findQueueIndexWithHandle(const QueueContainer_t& queues,
+                                                                     const QueueSlotContainer_t& queueSlots,
+                                                                     const UniqueId uniqueQueueId,
+                                                                     const uint32_t queueHandle) noexcept
+{
+    const uint32_t slot = queueHandle & ((1U << QUEUE_HANDLE_SLOT_BITS) - 1U);
+    if (queueHandle != INVALID_QUEUE_HANDLE && slot < queueSlots.size()
+        && toQueueHandle(slot, queueSlots[slot].m_generation) == queueHandle)
+    {
+        const auto position = queueSlots[slot].m_position;
+        // the generation has only 16 bits; the ID check guards against a handle which survived a wrap around
+        if (position != MemberType_t::INVALID_QUEUE_POSITION && queues[position]->m_uniqueId == uniqueQueueId)
+        {
+            return position;
+        }
+    }
+
+    return findQueueIndex(queues, uniqueQueueId, 0U);
+}
+
+template <typename ChunkDistributorDataType>
+inline optional<uint32_t>
+ChunkDistributor<ChunkDistributorDataType>::findQueuePositionWithHandle(const QueueSlotContainer_t& queueSlots,
+                                                                        const uint32_t queueHandle) noexcept
+{
+    const uint32_t slot = queueHandle & ((1U << QUEUE_HANDLE_SLOT_BITS) - 1U);
+    if (slot < queueSlots.size() && toQueueHandle(slot, queueSlots[slot].m_generation) == queueHandle
+        && queueSlots[slot].m_position != MemberType_t::INVALID_QUEUE_POSITION)
+    {
+        return queueSlots[slot].m_position;
+    }
+    return nullopt;
+}
+
+template <typename ChunkDistributorDataType>
+inline uint32_t
+ChunkDistributor<ChunkDistributorDataType>::queueHandleAtPosition(const QueueSlotContainer_t& queueSlots,
+                                                                  const uint32_t position) noexcept
+{
+    for (uint32_t slot = 0U; slot < queueSlots.size(); ++slot)
+    {
+        if (queueSlots[slot].m_position == position)
+        {
+            return toQueueHandle(slot, queueSlots[slot].m_generation);
+        }
+    }
+    // every stored queue has a slot
+    return INVALID_QUEUE_HANDLE;
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::assignQueueSlot(QueueSlotContainer_t& queueSlots,
+                                                                        const uint32_t position) noexcept
+{
+    for (auto& queueSlot : queueSlots)
+    {
+        if (queueSlot.m_position == MemberType_t::INVALID_QUEUE_POSITION)
+        {
+            queueSlot.m_position = static_cast<uint16_t>(position);
+            return;
+        }
+    }
+
+    // there are never more slots than queues, therefore there is space for the slot of a queue which can be added
+    typename MemberType_t::QueueSlot_t queueSlot;
+    queueSlot.m_position = static_cast<uint16_t>(position);
+    IOX_DISCARD_RESULT(queueSlots.push_back(queueSlot));
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::releaseQueueSlot(QueueSlotContainer_t& queueSlots,
+                                                                         const uint32_t position) noexcept
+{
+    // the queues behind the removed one move one position to the front
+    for (auto& queueSlot : queueSlots)
+    {
+        if (queueSlot.m_position == MemberType_t::INVALID_QUEUE_POSITION || queueSlot.m_position < position)
+        {
+            continue;
+        }
+
+        if (queueSlot.m_position == position)
+        {
+            queueSlot.m_position = MemberType_t::INVALID_QUEUE_POSITION;
+            ++queueSlot.m_generation;
+        }
+        else
+        {
+            --queueSlot.m_position;
+        }
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline uint32_t ChunkDistributor<ChunkDistributorDataType>::toQueueHandle(const uint32_t slot,
+                                                                          const uint16_t generation) noexcept
+{
+    return (static_cast<uint32_t>(generation) << QUEUE_HANDLE_SLOT_BITS) | slot;
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::deliverHistory(not_null<ChunkQueueData_t* const> queue,
+                                                                       const uint64_t requestedHistory,
+                                                                       const uint64_t writeEnd) noexcept
+{
+    auto members = getMembers();
+    const auto historyCapacity = members->m_historyCapacity;
+
+    // if the current history is large enough we send the requested number of chunks, else we send the total history
+    const auto historySize = algorithm::minVal(writeEnd, historyCapacity);
+    const auto numberOfChunks = algorithm::minVal(requestedHistory, historySize);
+    if (numberOfChunks == 0U)
+    {
+        return;
+    }
+
+    vector<mepoo::SharedChunk, MemberType_t::ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY> historyChunks;
+    members->m_historyReaders.fetch_add(1U, std::memory_order_seq_cst);
+    for (auto i = writeEnd - numberOfChunks; i < writeEnd; ++i)
+    {
+        auto unmanagedChunk = members->m_history[i % historyCapacity].load(std::memory_order_seq_cst);
+        // AXIVION Next Construct AutosarC++19_03-A0.1.2 : at most MAX_HISTORY_CAPACITY chunks are cloned
+        historyChunks.push_back(unmanagedChunk.cloneToSharedChunk());
+    }
+    const auto writeBegin = members->m_historyWriteBegin.load(std::memory_order_seq_cst);
+    members->m_historyReaders.fetch_sub(1U, std::memory_order_release);
+
+    // the slots of the chunks before this index were overwritten by the sender while reading; the cloned chunks are not
+    // part of the history anymore and are released when going out of scope
+    const auto firstValidIndex = (writeBegin > historyCapacity) ? writeBegin - historyCapacity : 0U;
+    auto index = writeEnd - numberOfChunks;
+    for (auto& chunk : historyChunks)
+    {
+        if (index >= firstValidIndex)
+        {
+            pushToQueue(queue, chunk);
+        }
+        ++index;
+    }
+}
+
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDelivery(mepoo::SharedChunk chunk) noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    writeToHistory(chunk);
+    // the chunk is not delivered, hence a queue which is added later on gets it from the history
+    storeDeliveredHistoryWriteEnd(getMembers()->m_historyWriteEnd.load(std::memory_order_relaxed));
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::writeToHistory(mepoo::SharedChunk chunk) noexcept
+{
+    auto members = getMembers();
+    const auto historyCapacity = members->m_historyCapacity;
+    if (historyCapacity == 0U)
+    {
+        return;
+    }
+
+    // only the sender writes the history, see ChunkDistributorData
+    const auto writeIndex = members->m_historyWriteEnd.load(std::memory_order_relaxed);
+    members->m_historyWriteBegin.store(writeIndex + 1U, std::memory_order_seq_cst);
+    auto evictedChunk = members->m_history[writeIndex % historyCapacity].exchange(mepoo::ShmSafeUnmanagedChunk(chunk),
+                                                                                   std::memory_order_seq_cst);
+    members->m_historyWriteEnd.store(writeIndex + 1U, std::memory_order_seq_cst);
+
+    releaseOrRetireHistoryChunk(evictedChunk);
+}
+
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::storeDeliveredHistoryWriteEnd(const uint64_t historyWriteEnd) noexcept
+{
+    // the index of the active queue container is kept; it is only changed by the modifying side
+    auto& activeQueueContainer = getMembers()->m_activeQueueContainer;
+    auto expected = activeQueueContainer.load(std::memory_order_seq_cst);
+    while (!activeQueueContainer.compare_exchange_weak(
+        expected,
+        MemberType_t::toActiveQueueContainer(MemberType_t::queueContainerIndex(expected), historyWriteEnd),
+        std::memory_order_seq_cst))
+    {
+    }
+}
 
-    if (0u < getMembers()->m_historyCapacity)
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::releaseOrRetireHistoryChunk(
+    mepoo::ShmSafeUnmanagedChunk evictedChunk) noexcept
+{
+    auto members = getMembers();
+    iox::detail::adaptive_wait adaptiveWait;
+    while (true)
     {
-        if (getMembers()->m_history.size() >= getMembers()->m_historyCapacity)
+        // a reader which pins the history after this check cannot see the evicted chunk anymore
+        if (members->m_historyReaders.load(std::memory_order_seq_cst) == 0U)
+        {
+            releaseRetiredHistoryChunks();
+            if (!evictedChunk.isLogicalNullptr())
+            {
+                evictedChunk.releaseToSharedChunk();
+            }
+            return;
+        }
+
+        if (evictedChunk.isLogicalNullptr() || members->m_retiredHistory.push_back(evictedChunk))
         {
-            auto chunkToRemove = getMembers()->m_history.begin();
-            chunkToRemove->releaseToSharedChunk();
-            // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we are not iterating here, so return value can be ignored
-            getMembers()->m_history.erase(chunkToRemove);
+            return;
         }
-        // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we ensured that there is space in the
-        // history, so return value can be ignored
-        getMembers()->m_history.push_back(chunk);
+
+        // all retired slots are in use; a reader only clones the history chunks and unpins it right afterwards
+        adaptiveWait.wait();
     }
 }
 
 template <typename ChunkDistributorDataType>
-inline uint64_t ChunkDistributor<ChunkDistributorDataType>::getHistorySize() noexcept
+inline void ChunkDistributor<ChunkDistributorDataType>::releaseRetiredHistoryChunks() noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    for (auto& retiredChunk : getMembers()->m_retiredHistory)
+    {
+        retiredChunk.releaseToSharedChunk();
+    }
+    getMembers()->m_retiredHistory.clear();
+}
 
-    return getMembers()->m_history.size();
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::getHistorySize() noexcept
+{
+    return algorithm::minVal(getMembers()->m_historyWriteEnd.load(std::memory_order_relaxed),
+                             getMembers()->m_historyCapacity);
 }
 
 template <typename ChunkDistributorDataType>
@@ -330,31 +1201,40 @@ inline void ChunkDistributor<ChunkDistributorDataType>::clearHistory() noexcept
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    for (auto& unmanagedChunk : getMembers()->m_history)
+    for (auto& slot : getMembers()->m_history)
     {
-        unmanagedChunk.releaseToSharedChunk();
+        auto unmanagedChunk = slot.exchange(mepoo::ShmSafeUnmanagedChunk(), std::memory_order_relaxed);
+        if (!unmanagedChunk.isLogicalNullptr())
+        {
+            unmanagedChunk.releaseToSharedChunk();
+        }
     }
+    releaseRetiredHistoryChunks();
+
+    getMembers()->m_historyWriteBegin.store(0U, std::memory_order_relaxed);
+    getMembers()->m_historyWriteEnd.store(0U, std::memory_order_relaxed);
+    storeDeliveredHistoryWriteEnd(0U);
+}
 
-    getMembers()->m_history.clear();
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::setDeliveryHelper(DeliveryHelper* const deliveryHelper) noexcept
+{
+    m_deliveryHelper = deliveryHelper;
 }
 
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::cleanup() noexcept
 {
-    if (getMembers()->tryLock())
+    // the sending application is gone; a queue container which it pinned when it was terminated while sending stays
+    // pinned forever and must be released in order to be reused for modifications
+    for (auto& readers : getMembers()->m_queueContainerReaders)
     {
-        clearHistory();
-        getMembers()->unlock();
-    }
-    else
-    {
-        /// @todo iox-#1711 currently we have a deadlock / mutex destroy vulnerability if the ThreadSafePolicy is used
-        /// and a sending application dies when having the lock for sending. If the RouDi daemon wants to
-        /// cleanup or does discovery changes we have a deadlock or an exception when destroying the mutex
-        /// As long as we don't have a multi-threaded lock-free ChunkDistributor or another concept we die here
-        errorHandler(PoshError::POPO__CHUNK_DISTRIBUTOR_CLEANUP_DEADLOCK_BECAUSE_BAD_APPLICATION_TERMINATION,
-                     ErrorLevel::FATAL);
+        readers.store(0U, std::memory_order_release);
     }
+
+    // the sending application never takes the lock, hence a terminated sender cannot block the cleanup
+    clearHistory();
+    ChunkRingWriter(&getMembers()->m_chunkRing).clear();
 }
 
 } // namespace popo
@@ -20,15 +20,20 @@
 #include "iceoryx_hoofs/internal/posix_wrapper/mutex.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/blocked_time_statistics.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_ring_data.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 #include "iox/algorithm.hpp"
 #include "iox/logging.hpp"
 #include "iox/relative_pointer.hpp"
 #include "iox/vector.hpp"
 
+#include <atomic>
 #include <cstdint>
+#include <limits>
 #include <mutex>
+#include <type_traits>
 
 namespace iox
 {
@@ -43,21 +48,91 @@ struct ChunkDistributorData : public LockingPolicy
     using ChunkQueueData_t = typename ChunkQueuePusherType::MemberType_t;
     using ChunkDistributorDataProperties_t = ChunkDistributorDataProperties;
 
-    ChunkDistributorData(const ConsumerTooSlowPolicy policy, const uint64_t historyCapacity = 0u) noexcept;
+    ChunkDistributorData(const ConsumerTooSlowPolicy policy,
+                         const uint64_t historyCapacity = 0u,
+                         const uint64_t broadcastDeliveryThreshold = 0U,
+                         const uint64_t chunkRingCapacity = 0U) noexcept;
 
     const uint64_t m_historyCapacity;
+    /// The number of stored queues from which on a chunk is broadcasted, i.e. the reference counter of the chunk is
+    /// incremented once for all queues and the wake ups of queues which share a condition variable are coalesced; 0
+    /// disables the broadcast
+    const uint64_t m_broadcastDeliveryThreshold;
 
     using QueueContainer_t = vector<RelativePointer<ChunkQueueData_t>, ChunkDistributorDataProperties_t::MAX_QUEUES>;
-    QueueContainer_t m_queues;
 
-    /// @todo iox-#1710 If we would make the ChunkDistributor lock-free, can we than extend the UsedChunkList to
-    /// be like a ring buffer and use this for the history? This would be needed to be able to safely cleanup.
-    /// Using ShmSafeUnmanagedChunk since RouDi must access this list to cleanup the chunks in case of an application
-    /// crash.
-    using HistoryContainer_t =
+    /// The queues are stored read-copy-update style. A sender reads the active container without taking the lock and
+    /// pins it with the corresponding reader counter. A modification is done on a copy in a container which is neither
+    /// active nor pinned, afterwards it becomes the active one. With three versions, one version can stay pinned by a
+    /// sender which was terminated while reading and modifications are still possible.
+    static constexpr uint32_t NUMBER_OF_QUEUE_CONTAINER_VERSIONS{3U};
+    QueueContainer_t m_queues[NUMBER_OF_QUEUE_CONTAINER_VERSIONS];
+
+    /// The index of the active container is stored in the lower QUEUE_CONTAINER_INDEX_BITS and the history write end
+    /// of the last chunk which the sender delivered with it in the upper bits. The sender stores the history write end
+    /// with the same compare and swap which confirms the pinned container and RouDi reads it with the one which
+    /// publishes a modified container. Hence a chunk in the history either was delivered with a previous container
+    /// and is replayed to a queue which is added with the publication, or it is delivered by the sender with the
+    /// published container.
+    static constexpr uint64_t QUEUE_CONTAINER_INDEX_BITS{2U};
+    static_assert(NUMBER_OF_QUEUE_CONTAINER_VERSIONS <= (1U << QUEUE_CONTAINER_INDEX_BITS),
+                  "the index of the active queue container must fit into its bits");
+    std::atomic<uint64_t> m_activeQueueContainer{0U};
+
+    /// @brief the index of the active queue container
+    uint32_t activeQueueContainerIndex() const noexcept;
+
+    static uint32_t queueContainerIndex(const uint64_t activeQueueContainer) noexcept;
+    static uint64_t deliveredHistoryWriteEnd(const uint64_t activeQueueContainer) noexcept;
+    static uint64_t toActiveQueueContainer(const uint32_t index, const uint64_t deliveredHistoryWriteEnd) noexcept;
+    mutable std::atomic<uint32_t> m_queueContainerReaders[NUMBER_OF_QUEUE_CONTAINER_VERSIONS];
+
+    /// The position of a queue in the queue container changes when a queue in front of it is removed, but its slot
+    /// stays the same as long as the queue is stored. The slot table of a container version maps a slot to the
+    /// position of its queue in the same version and is modified together with it. The generation of a slot is
+    /// incremented when its queue is removed, hence the handle of a removed queue does not match a queue which reuses
+    /// the slot later on.
+    static constexpr uint16_t INVALID_QUEUE_POSITION{std::numeric_limits<uint16_t>::max()};
+    static_assert(ChunkDistributorDataProperties_t::MAX_QUEUES < INVALID_QUEUE_POSITION,
+                  "the position of a queue must fit into a slot");
+    struct QueueSlot_t
+    {
+        uint16_t m_position{INVALID_QUEUE_POSITION};
+        uint16_t m_generation{0U};
+    };
+    using QueueSlotContainer_t = vector<QueueSlot_t, ChunkDistributorDataProperties_t::MAX_QUEUES>;
+    QueueSlotContainer_t m_queueSlots[NUMBER_OF_QUEUE_CONTAINER_VERSIONS];
+
+    /// The history is a ring buffer which is only written by the sender and therefore does not need the lock. RouDi
+    /// reads it when a queue is added and pins it with the reader counter meanwhile. The sender increments the begin
+    /// counter before it overwrites a slot and the end counter afterwards, a reader drops the chunks of slots which
+    /// were overwritten while reading. A chunk which is evicted from a pinned history is retired and released by the
+    /// sender as soon as no reader is active anymore. Using ShmSafeUnmanagedChunk since RouDi must access the history
+    /// to cleanup the chunks in case of an application crash.
+    using HistorySlot_t = std::atomic<mepoo::ShmSafeUnmanagedChunk>;
+    // std::atomic<T>::is_always_lock_free is C++17; a trivially copyable 64 bit type is always lock-free when the 64
+    // bit integer atomics are, which makes a torn history slot impossible when a sender dies while writing it
+    static_assert(sizeof(mepoo::ShmSafeUnmanagedChunk) == sizeof(uint64_t),
+                  "The history slots must fit into a lock-free 64 bit atomic");
+    static_assert(std::is_trivially_copyable<mepoo::ShmSafeUnmanagedChunk>::value,
+                  "The history slots must be trivially copyable to be stored in an atomic");
+    static_assert(2 <= ATOMIC_LLONG_LOCK_FREE, "The history slots are not lock-free on this platform");
+    HistorySlot_t m_history[ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY];
+    std::atomic<uint64_t> m_historyWriteBegin{0U};
+    std::atomic<uint64_t> m_historyWriteEnd{0U};
+    mutable std::atomic<uint64_t> m_historyReaders{0U};
+    using RetiredHistoryContainer_t =
         vector<mepoo::ShmSafeUnmanagedChunk, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY>;
-    HistoryContainer_t m_history;
+    RetiredHistoryContainer_t m_retiredHistory;
     const ConsumerTooSlowPolicy m_consumerTooSlowPolicy;
+    /// The time the sender waited for full queues with ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER
+    BlockedTimeStatisticsData m_blockedTimeStatistics;
+
+    /// If the chunk ring has a non-zero capacity, the sender writes a chunk only once into the ring and the stored
+    /// queues are attached to it; they read the latest chunks with their own cursor and are only notified by the
+    /// sender. The ring replaces the history and is limited by the same maximum capacity.
+    ChunkRingSlot m_chunkRingSlots[ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY];
+    ChunkRingData m_chunkRing;
 };
 
 } // namespace popo
@@ -33,17 +33,81 @@ constexpr T min(const T left, const T right) noexcept
 }
 } // namespace internal
 
+template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
+constexpr uint32_t ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::
+    NUMBER_OF_QUEUE_CONTAINER_VERSIONS;
+
+template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
+constexpr uint16_t
+    ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::INVALID_QUEUE_POSITION;
+
+template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
+constexpr uint64_t ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::
+    QUEUE_CONTAINER_INDEX_BITS;
+
 template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
 inline ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::ChunkDistributorData(
-    const ConsumerTooSlowPolicy policy, const uint64_t historyCapacity) noexcept
+    const ConsumerTooSlowPolicy policy,
+    const uint64_t historyCapacity,
+    const uint64_t broadcastDeliveryThreshold,
+    const uint64_t chunkRingCapacity) noexcept
     : LockingPolicy()
     , m_historyCapacity(internal::min(historyCapacity, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY))
+    , m_broadcastDeliveryThreshold(broadcastDeliveryThreshold)
     , m_consumerTooSlowPolicy(policy)
+    , m_chunkRing(m_chunkRingSlots,
+                  internal::min(chunkRingCapacity, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY))
 {
+    for (auto& readers : m_queueContainerReaders)
+    {
+        readers.store(0U, std::memory_order_relaxed);
+    }
+    for (auto& slot : m_history)
+    {
+        slot.store(mepoo::ShmSafeUnmanagedChunk(), std::memory_order_relaxed);
+    }
+
     if (m_historyCapacity != historyCapacity)
     {
         IOX_LOG(WARN) << "Chunk history too large, reducing from " << historyCapacity << " to " << m_historyCapacity;
     }
+
+    if (m_chunkRing.m_capacity != chunkRingCapacity)
+    {
+        IOX_LOG(WARN) << "Chunk ring too large, reducing from " << chunkRingCapacity << " to "
+                      << m_chunkRing.m_capacity;
+    }
+}
+
+template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
+inline uint32_t ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::
+    activeQueueContainerIndex() const noexcept
+{
+    return queueContainerIndex(m_activeQueueContainer.load(std::memory_order_seq_cst));
+}
+
+template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
+inline uint32_t
+ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::queueContainerIndex(
+    const uint64_t activeQueueContainer) noexcept
+{
+    return static_cast<uint32_t>(activeQueueContainer & ((1U << QUEUE_CONTAINER_INDEX_BITS) - 1U));
+}
+
+template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
+inline uint64_t
+ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::deliveredHistoryWriteEnd(
+    const uint64_t activeQueueContainer) noexcept
+{
+    return activeQueueContainer >> QUEUE_CONTAINER_INDEX_BITS;
+}
+
+template <typename ChunkDistributorDataProperties, typename LockingPolicy, typename ChunkQueuePusherType>
+inline uint64_t
+ChunkDistributorData<ChunkDistributorDataProperties, LockingPolicy, ChunkQueuePusherType>::toActiveQueueContainer(
+    const uint32_t index, const uint64_t deliveredHistoryWriteEnd) noexcept
+{
+    return (deliveredHistoryWriteEnd << QUEUE_CONTAINER_INDEX_BITS) | index;
 }
 
 } // namespace popo
@@ -18,7 +18,10 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_DATA_HPP
 
 #include "iceoryx_hoofs/cxx/variant_queue.hpp"
+#include "iceoryx_hoofs/posix_wrapper/unnamed_semaphore.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_ring_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
@@ -46,9 +49,23 @@ struct ChunkQueueData : public LockingPolicy
     cxx::VariantQueue<mepoo::ShmSafeUnmanagedChunk, MAX_CAPACITY> m_queue;
     std::atomic_bool m_queueHasLostChunks{false};
 
+    /// A queue which is attached to the chunk ring of a sender reads the chunks of this sender from the ring instead
+    /// of its own queue; the chunks of the other senders are still pushed into the queue. Every sender with a chunk
+    /// ring uses an own attachment. The attachments are changed under the lock and read without it, the counter allows
+    /// to skip them if no ring is attached.
+    mutable ChunkRingAttachment m_chunkRings[MAX_CHUNK_RINGS_PER_SUBSCRIBER];
+    std::atomic<uint32_t> m_numberOfAttachedChunkRings{0U};
+    std::atomic<uint32_t> m_nextChunkRingToRead{0U};
+
     RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
     optional<uint64_t> m_conditionVariableNotificationIndex;
     const QueueFullPolicy m_queueFullPolicy;
+
+    /// A sender which waits for a full queue with QueueFullPolicy::BLOCK_PRODUCER registers in the counter and blocks
+    /// on the semaphore; the consumer posts it when it pops a chunk while a sender is registered. The semaphore is
+    /// only created for BLOCK_PRODUCER queues.
+    std::atomic<uint64_t> m_numberOfWaitingProducers{0U};
+    optional<posix::UnnamedSemaphore> m_waitingProducerSemaphore;
 };
 
 } // namespace popo
@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_ring_reader.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
@@ -46,7 +47,7 @@ class ChunkQueuePopper
     ChunkQueuePopper& operator=(ChunkQueuePopper&& rhs) noexcept = default;
     virtual ~ChunkQueuePopper() noexcept = default;
 
-    /// @brief pop a chunk from the chunk queue
+    /// @brief pop a chunk from the chunk queue or read it from the chunk ring the queue is attached to
     /// @return optional for a shared chunk that is set if the queue is not empty
     optional<mepoo::SharedChunk> tryPop() noexcept;
 
@@ -92,11 +93,30 @@ class ChunkQueuePopper
     /// @return true if condition variable is set, false if not
     bool isConditionVariableSet() const noexcept;
 
+    /// @brief Checks whether the queue is attached to a chunk ring or might still read from it
+    /// @param[in] chunkRing to check
+    /// @return true if the chunk ring must not be destroyed yet, false otherwise
+    bool isChunkRingReferenced(const ChunkRingData& chunkRing) const noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
   private:
+    /// @brief calls the reader for every attached chunk ring while the attachment is pinned, until the reader returns
+    /// true
+    /// @param[in] startIndex is the index of the first attachment to visit
+    /// @param[in] reader callable with the signature bool(uint32_t, const ChunkRingData&, std::atomic<uint64_t>&)
+    template <typename Reader>
+    void forEachAttachedChunkRing(const uint32_t startIndex, const Reader& reader) const noexcept;
+
+    mepoo::SharedChunk readFromChunkRings() noexcept;
+
+    uint64_t getNumberOfUnreadChunksInChunkRings() const noexcept;
+
+    /// @brief wakes up a sender which waits for space in the queue, if there is one
+    void wakeUpWaitingProducer() noexcept;
+
     MemberType_t* m_chunkQueueDataPtr;
 };
 
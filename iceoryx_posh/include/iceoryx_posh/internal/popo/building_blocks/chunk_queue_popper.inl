@@ -47,13 +47,22 @@ ChunkQueuePopper<ChunkQueueDataType>::getMembers() noexcept
 template <typename ChunkQueueDataType>
 inline optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPop() noexcept
 {
+    // the chunks of senders without a chunk ring are still pushed into the queue, hence both are drained
+    mepoo::SharedChunk chunk;
     auto retVal = getMembers()->m_queue.pop();
-
-    // check if queue had an element that was poped and return if so
     if (retVal.has_value())
     {
-        auto chunk = retVal.value().releaseToSharedChunk();
+        chunk = retVal.value().releaseToSharedChunk();
+        wakeUpWaitingProducer();
+    }
+    else
+    {
+        chunk = readFromChunkRings();
+    }
 
+    // check if queue had an element that was poped and return if so
+    if (chunk)
+    {
         auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
         if (receivedChunkHeaderVersion != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
         {
@@ -71,6 +80,119 @@ inline optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPop
     }
 }
 
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::wakeUpWaitingProducer() noexcept
+{
+    // only a BLOCK_PRODUCER queue pays for the fence; it pairs with the fence of the sender which registers itself
+    // before it retries the push
+    if (getMembers()->m_queueFullPolicy != QueueFullPolicy::BLOCK_PRODUCER)
+    {
+        return;
+    }
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (getMembers()->m_numberOfWaitingProducers.load(std::memory_order_relaxed) > 0U)
+    {
+        IOX_DISCARD_RESULT(getMembers()->m_waitingProducerSemaphore->post());
+    }
+}
+
+template <typename ChunkQueueDataType>
+template <typename Reader>
+inline void ChunkQueuePopper<ChunkQueueDataType>::forEachAttachedChunkRing(const uint32_t startIndex,
+                                                                           const Reader& reader) const noexcept
+{
+    if (getMembers()->m_numberOfAttachedChunkRings.load(std::memory_order_acquire) == 0U)
+    {
+        return;
+    }
+
+    constexpr uint32_t NUMBER_OF_ATTACHMENTS{MAX_CHUNK_RINGS_PER_SUBSCRIBER};
+    for (uint32_t i = 0U; i < NUMBER_OF_ATTACHMENTS; ++i)
+    {
+        const auto index = (startIndex + i) % NUMBER_OF_ATTACHMENTS;
+        auto& attachment = getMembers()->m_chunkRings[index];
+        if (!attachment.m_isAttached.load(std::memory_order_acquire))
+        {
+            continue;
+        }
+
+        // the pinned attachment is not reused and its ring is not destroyed; if it was detached before it was pinned,
+        // it is skipped
+        attachment.m_readers.fetch_add(1U, std::memory_order_seq_cst);
+        bool isDone{false};
+        if (attachment.m_isAttached.load(std::memory_order_seq_cst))
+        {
+            isDone = reader(index, *attachment.m_chunkRing.get(), attachment.m_cursor);
+        }
+        attachment.m_readers.fetch_sub(1U, std::memory_order_release);
+
+        if (isDone)
+        {
+            return;
+        }
+    }
+}
+
+template <typename ChunkQueueDataType>
+inline mepoo::SharedChunk ChunkQueuePopper<ChunkQueueDataType>::readFromChunkRings() noexcept
+{
+    mepoo::SharedChunk chunk;
+    bool hasLostChunks{false};
+    // the search starts behind the ring which was read last, hence a fast sender does not starve the others
+    const auto startIndex = getMembers()->m_nextChunkRingToRead.load(std::memory_order_relaxed);
+    forEachAttachedChunkRing(
+        startIndex, [&](const uint32_t index, const ChunkRingData& chunkRing, std::atomic<uint64_t>& cursor) {
+            auto currentCursor = cursor.load(std::memory_order_relaxed);
+            auto maybeChunk = ChunkRingReader(&chunkRing).tryRead(currentCursor, hasLostChunks);
+            cursor.store(currentCursor, std::memory_order_relaxed);
+            if (!maybeChunk.has_value())
+            {
+                return false;
+            }
+            chunk = std::move(maybeChunk.value());
+            getMembers()->m_nextChunkRingToRead.store((index + 1U) % MAX_CHUNK_RINGS_PER_SUBSCRIBER,
+                                                      std::memory_order_relaxed);
+            return true;
+        });
+
+    if (hasLostChunks)
+    {
+        getMembers()->m_queueHasLostChunks.store(true, std::memory_order_relaxed);
+    }
+    return chunk;
+}
+
+template <typename ChunkQueueDataType>
+inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::getNumberOfUnreadChunksInChunkRings() const noexcept
+{
+    uint64_t numberOfUnreadChunks{0U};
+    forEachAttachedChunkRing(
+        0U, [&](const uint32_t, const ChunkRingData& chunkRing, const std::atomic<uint64_t>& cursor) {
+            numberOfUnreadChunks +=
+                ChunkRingReader(&chunkRing).getNumberOfUnreadChunks(cursor.load(std::memory_order_relaxed));
+            return false;
+        });
+    return numberOfUnreadChunks;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePopper<ChunkQueueDataType>::isChunkRingReferenced(const ChunkRingData& chunkRing) const noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+
+    for (const auto& attachment : getMembers()->m_chunkRings)
+    {
+        if (attachment.m_chunkRing.get() == &chunkRing
+            && (attachment.m_isAttached.load(std::memory_order_seq_cst)
+                || attachment.m_readers.load(std::memory_order_seq_cst) != 0U))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::hasLostChunks() noexcept
 {
@@ -85,13 +207,13 @@ inline bool ChunkQueuePopper<ChunkQueueDataType>::hasLostChunks() noexcept
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::empty() const noexcept
 {
-    return getMembers()->m_queue.empty();
+    return getMembers()->m_queue.empty() && getNumberOfUnreadChunksInChunkRings() == 0U;
 }
 
 template <typename ChunkQueueDataType>
 inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::size() noexcept
 {
-    return getMembers()->m_queue.size();
+    return getMembers()->m_queue.size() + getNumberOfUnreadChunksInChunkRings();
 }
 
 template <typename ChunkQueueDataType>
@@ -120,7 +242,15 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::clear() noexcept
         // AXIVION Next Construct AutosarC++19_03-A0.1.2 : d'tor of SharedChunk will release the memory, so RAII has the
         // side effect here and return value does not need to be evaluated
         maybeUnmanagedChunk.value().releaseToSharedChunk();
+        wakeUpWaitingProducer();
     }
+
+    forEachAttachedChunkRing(0U,
+                             [](const uint32_t, const ChunkRingData& chunkRing, std::atomic<uint64_t>& cursor) {
+                                 cursor.store(chunkRing.m_writeCounter.load(std::memory_order_acquire),
+                                              std::memory_order_relaxed);
+                                 return false;
+                             });
 }
 
 template <typename ChunkQueueDataType>
@@ -18,6 +18,7 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_PUSHER_HPP
 
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iox/expected.hpp"
@@ -50,9 +51,61 @@ class ChunkQueuePusher
     /// @return false if a queue overflow occurred, otherwise true
     bool push(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief push a new chunk to the chunk queue without notifying an attached condition variable; this is intended
+    /// for pushing a batch of chunks with a single notify call afterwards
+    /// @param[in] shared chunk object
+    /// @return false if a queue overflow occurred, otherwise true
+    bool pushWithoutNotification(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief push a chunk which already owns a reference without notifying an attached condition variable; this is
+    /// intended for delivering one chunk to many queues with a single increment of the reference counter
+    /// @param[in] chunk is the unmanaged chunk whose reference is handed over to the chunk queue; the reference is
+    /// released if the chunk is dropped due to a queue overflow
+    /// @return false if a queue overflow occurred, otherwise true
+    bool pushWithoutNotification(mepoo::ShmSafeUnmanagedChunk chunk) noexcept;
+
+    /// @brief notify the condition variable which is attached to the chunk queue, if there is one
+    void notify() noexcept;
+
+    /// @brief mark the notification of the attached condition variable as active without waking up a waiting thread;
+    /// this is intended for coalescing the wake ups of chunk queues which are attached to the same condition variable
+    /// @return the attached condition variable which must be passed to wakeUp afterwards or nullptr if no condition
+    /// variable is attached
+    const ConditionVariableData* activateNotification() noexcept;
+
+    /// @brief wake up a thread which waits on the provided condition variable if it is still attached to the chunk
+    /// queue
+    /// @param[in] conditionVariable is the condition variable which was returned by activateNotification
+    /// @return true if the condition variable is still attached, otherwise false
+    bool wakeUp(const ConditionVariableData* const conditionVariable) noexcept;
+
+    /// @brief push a new chunk to the chunk queue and wait for space if the queue is full; the waiting is ended when
+    /// the consumer pops a chunk, when wakeUpWaitingProducers is called or when the timeout expires
+    /// @param[in] shared chunk object
+    /// @param[in] timeout is the maximum time to wait
+    /// @return true if the chunk was pushed, false if it was not pushed and the push must be retried
+    /// @note waiting requires a queue with QueueFullPolicy::BLOCK_PRODUCER, for other queues this is a push
+    bool pushOrWaitForSpace(mepoo::SharedChunk chunk, const units::Duration timeout) noexcept;
+
+    /// @brief wake up all senders which wait in pushOrWaitForSpace, e.g. since the chunk queue is removed from them
+    void wakeUpWaitingProducers() noexcept;
+
     /// @brief tell the queue that it lost a chunk (e.g. because push failed and there will be no retry)
     void lostAChunk() noexcept;
 
+    /// @brief let the chunk queue read the chunks of a sender from its chunk ring instead of its own queue
+    /// @param[in] chunkRing is the ring which must stay valid until the chunk queue is detached from it and
+    /// isChunkRingReferenced returns false
+    /// @param[in] cursor is the sequence number of the first chunk to read
+    /// @return true if the ring was attached, false if the queue is already attached to MAX_CHUNK_RINGS_PER_SUBSCRIBER
+    /// rings
+    bool attachChunkRing(ChunkRingData& chunkRing, const uint64_t cursor) noexcept;
+
+    /// @brief detach the chunk queue from a chunk ring, if it is attached to it; the unread chunks of the ring are not
+    /// accessible anymore
+    /// @param[in] chunkRing to detach from
+    void detachChunkRing(const ChunkRingData& chunkRing) noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
@@ -44,6 +44,20 @@ ChunkQueuePusher<ChunkQueueDataType>::getMembers() noexcept
 
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk) noexcept
+{
+    const bool hasNoQueueOverflow = pushWithoutNotification(chunk);
+    notify();
+    return hasNoQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::pushWithoutNotification(mepoo::SharedChunk chunk) noexcept
+{
+    return pushWithoutNotification(mepoo::ShmSafeUnmanagedChunk(chunk));
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::pushWithoutNotification(mepoo::ShmSafeUnmanagedChunk chunk) noexcept
 {
     auto pushRet = getMembers()->m_queue.push(chunk);
     bool hasQueueOverflow = false;
@@ -56,17 +70,94 @@ inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk)
         hasQueueOverflow = true;
     }
 
+    return !hasQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::notify() noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+    if (getMembers()->m_conditionVariableDataPtr)
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
-        if (getMembers()->m_conditionVariableDataPtr)
-        {
-            ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
-                              *getMembers()->m_conditionVariableNotificationIndex)
-                .notify();
-        }
+        ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
+                          *getMembers()->m_conditionVariableNotificationIndex)
+            .notify();
     }
+}
 
-    return !hasQueueOverflow;
+template <typename ChunkQueueDataType>
+inline const ConditionVariableData* ChunkQueuePusher<ChunkQueueDataType>::activateNotification() noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+    if (!getMembers()->m_conditionVariableDataPtr)
+    {
+        return nullptr;
+    }
+
+    ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
+                      *getMembers()->m_conditionVariableNotificationIndex)
+        .activate();
+    return getMembers()->m_conditionVariableDataPtr.get();
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::wakeUp(const ConditionVariableData* const conditionVariable) noexcept
+{
+    // the lock guarantees that the condition variable is not destroyed meanwhile since it is only released after it
+    // was detached from all chunk queues
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+    if (!getMembers()->m_conditionVariableDataPtr
+        || getMembers()->m_conditionVariableDataPtr.get() != conditionVariable)
+    {
+        return false;
+    }
+
+    ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
+                      *getMembers()->m_conditionVariableNotificationIndex)
+        .wakeUp();
+    return true;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::pushOrWaitForSpace(mepoo::SharedChunk chunk,
+                                                                     const units::Duration timeout) noexcept
+{
+    auto& semaphore = getMembers()->m_waitingProducerSemaphore;
+    if (!semaphore.has_value())
+    {
+        return push(chunk);
+    }
+
+    // either the retry after the registration finds the space or the consumer sees the registration after its pop
+    // and posts the semaphore
+    getMembers()->m_numberOfWaitingProducers.fetch_add(1U, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const bool hasPushed = push(chunk);
+    if (!hasPushed)
+    {
+        // one post is consumed per wake-up; the posts for the other waiting producers remain. A post which was meant
+        // for a previous wait ends the wait early and the push is retried
+        IOX_DISCARD_RESULT(semaphore->timedWait(timeout));
+    }
+    getMembers()->m_numberOfWaitingProducers.fetch_sub(1U, std::memory_order_relaxed);
+
+    return hasPushed;
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::wakeUpWaitingProducers() noexcept
+{
+    auto& semaphore = getMembers()->m_waitingProducerSemaphore;
+    if (!semaphore.has_value())
+    {
+        return;
+    }
+
+    auto numberOfWaitingProducers = getMembers()->m_numberOfWaitingProducers.load(std::memory_order_seq_cst);
+    for (; numberOfWaitingProducers > 0U; --numberOfWaitingProducers)
+    {
+        IOX_DISCARD_RESULT(semaphore->post());
+    }
 }
 
 template <typename ChunkQueueDataType>
@@ -75,6 +166,45 @@ inline void ChunkQueuePusher<ChunkQueueDataType>::lostAChunk() noexcept
     getMembers()->m_queueHasLostChunks.store(true, std::memory_order_relaxed);
 }
 
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::attachChunkRing(ChunkRingData& chunkRing,
+                                                                  const uint64_t cursor) noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+
+    for (auto& attachment : getMembers()->m_chunkRings)
+    {
+        // an attachment which is still pinned by the reader is not reused since the reader might still access it
+        if (!attachment.m_isAttached.load(std::memory_order_relaxed)
+            && attachment.m_readers.load(std::memory_order_seq_cst) == 0U)
+        {
+            attachment.m_chunkRing = &chunkRing;
+            attachment.m_cursor.store(cursor, std::memory_order_relaxed);
+            attachment.m_isAttached.store(true, std::memory_order_seq_cst);
+            getMembers()->m_numberOfAttachedChunkRings.fetch_add(1U, std::memory_order_release);
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::detachChunkRing(const ChunkRingData& chunkRing) noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+
+    for (auto& attachment : getMembers()->m_chunkRings)
+    {
+        if (attachment.m_isAttached.load(std::memory_order_relaxed) && attachment.m_chunkRing.get() == &chunkRing)
+        {
+            // a reader which pinned the attachment before finishes its read; the ring stays valid until it unpinned
+            attachment.m_isAttached.store(false, std::memory_order_seq_cst);
+            getMembers()->m_numberOfAttachedChunkRings.fetch_sub(1U, std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
 } // namespace popo
 } // namespace iox
 
@@ -0,0 +1,76 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_RING_DATA_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_RING_DATA_HPP
+
+#include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
+#include "iox/relative_pointer.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief A slot of the chunk ring. The sequence number is the number of the write which stored the chunk; it is
+/// invalidated before the chunk is replaced, hence a reader which sees the same sequence number before and after it
+/// acquired the chunk has acquired the chunk of this write.
+struct ChunkRingSlot
+{
+    static constexpr uint64_t INVALID_SEQUENCE_NUMBER{std::numeric_limits<uint64_t>::max()};
+
+    ChunkRingSlot() noexcept;
+
+    std::atomic<uint64_t> m_sequenceNumber{INVALID_SEQUENCE_NUMBER};
+    std::atomic<mepoo::ShmSafeUnmanagedChunk> m_chunk;
+};
+
+/// @brief The chunk ring stores the last chunks of a single writer for an arbitrary number of readers. Each slot owns
+/// one reference of its chunk, a reader only needs its own cursor and acquires a chunk with an own reference. The
+/// slots are provided by the owner of the ring, so the ring can be referenced independently of its capacity.
+struct ChunkRingData
+{
+    /// @brief creates the ring
+    /// @param[in] slots is the array of slots which must outlive the ring
+    /// @param[in] capacity is the number of slots, 0 disables the ring
+    ChunkRingData(ChunkRingSlot* const slots, const uint64_t capacity) noexcept;
+
+    RelativePointer<ChunkRingSlot> m_slots;
+    const uint64_t m_capacity;
+    /// the number of chunks which were written to the ring so far; it is never reset since the cursors of the readers
+    /// are based on it
+    std::atomic<uint64_t> m_writeCounter{0U};
+};
+
+/// @brief The attachment of a reader to a chunk ring with the cursor of the reader, i.e. the sequence number of the
+/// next chunk to read. The reader pins the attachment without a lock and accesses the ring and the cursor only if it is
+/// still attached afterwards. The attachment is only changed while it is neither attached nor pinned and the ring must
+/// not be destroyed while the attachment is pinned.
+struct ChunkRingAttachment
+{
+    RelativePointer<ChunkRingData> m_chunkRing;
+    std::atomic<uint64_t> m_cursor{0U};
+    std::atomic_bool m_isAttached{false};
+    std::atomic<uint32_t> m_readers{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_RING_DATA_HPP
@@ -0,0 +1,75 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_RING_READER_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_RING_READER_HPP
+
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_ring_data.hpp"
+#include "iox/not_null.hpp"
+#include "iox/optional.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The ChunkRingReader is the building block to read SharedChunks from a ChunkRingData. The reader does not
+/// modify the ring, its state is only the cursor, i.e. the sequence number of the next chunk to read, which is owned
+/// by the caller. Chunks which were overwritten by the writer before they could be read are skipped and reported as
+/// lost.
+class ChunkRingReader
+{
+  public:
+    using MemberType_t = ChunkRingData;
+
+    explicit ChunkRingReader(not_null<const MemberType_t* const> chunkRingDataPtr) noexcept;
+
+    ChunkRingReader(const ChunkRingReader& other) = delete;
+    ChunkRingReader& operator=(const ChunkRingReader&) = delete;
+    ChunkRingReader(ChunkRingReader&& rhs) noexcept = default;
+    ChunkRingReader& operator=(ChunkRingReader&& rhs) noexcept = default;
+    ~ChunkRingReader() noexcept = default;
+
+    /// @brief reads the chunk at the cursor and advances the cursor behind it
+    /// @param[in,out] cursor is the sequence number of the next chunk to read
+    /// @param[out] hasLostChunks is set to true if chunks were overwritten before they could be read, otherwise it is
+    /// not modified
+    /// @return optional for a shared chunk that is set if there was an unread chunk
+    optional<mepoo::SharedChunk> tryRead(uint64_t& cursor, bool& hasLostChunks) const noexcept;
+
+    /// @brief get the number of chunks which can be read from the cursor on. Caution, the writer can have written
+    /// further chunks just after reading it
+    /// @param[in] cursor is the sequence number of the next chunk to read
+    /// @return the number of unread chunks which are still in the ring
+    uint64_t getNumberOfUnreadChunks(const uint64_t cursor) const noexcept;
+
+    /// @brief get the cursor for a reader which starts reading now
+    /// @param[in] requestedHistory is the number of already written chunks the reader wants to read
+    /// @return the cursor of the oldest requested chunk which is still in the ring
+    uint64_t getCursorForHistory(const uint64_t requestedHistory) const noexcept;
+
+    /// @brief get the capacity of the ring
+    /// @return the maximum number of chunks the ring holds
+    uint64_t getCapacity() const noexcept;
+
+  private:
+    const MemberType_t* m_chunkRingDataPtr;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_RING_READER_HPP
@@ -0,0 +1,63 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_RING_WRITER_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_RING_WRITER_HPP
+
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_ring_data.hpp"
+#include "iox/not_null.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The ChunkRingWriter is the building block to write SharedChunks into a ChunkRingData. The cost of a write
+/// does not depend on the number of readers. Together with the ChunkRingReader it is used by the ChunkDistributor for
+/// topics where the readers want the latest chunks instead of an own queue.
+/// @note there must be only one writer at a time
+class ChunkRingWriter
+{
+  public:
+    using MemberType_t = ChunkRingData;
+
+    explicit ChunkRingWriter(not_null<MemberType_t* const> chunkRingDataPtr) noexcept;
+
+    ChunkRingWriter(const ChunkRingWriter& other) = delete;
+    ChunkRingWriter& operator=(const ChunkRingWriter&) = delete;
+    ChunkRingWriter(ChunkRingWriter&& rhs) noexcept = default;
+    ChunkRingWriter& operator=(ChunkRingWriter&& rhs) noexcept = default;
+    ~ChunkRingWriter() noexcept = default;
+
+    /// @brief writes a chunk into the ring; if the ring is full, the oldest chunk is overwritten and released
+    /// @param[in] chunk to write
+    void write(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief releases all chunks of the ring; the write counter is kept, hence the readers skip the released chunks
+    void clear() noexcept;
+
+  private:
+    void replaceChunk(ChunkRingSlot& slot,
+                      const mepoo::ShmSafeUnmanagedChunk chunk,
+                      const uint64_t sequenceNumber) noexcept;
+
+    MemberType_t* m_chunkRingDataPtr;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_RING_WRITER_HPP
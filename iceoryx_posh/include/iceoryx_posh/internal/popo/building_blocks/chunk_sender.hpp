@@ -28,6 +28,8 @@
 #include "iox/into.hpp"
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
+#include "iox/span.hpp"
+#include "iox/vector.hpp"
 
 namespace iox
 {
@@ -104,6 +106,26 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
                                                                const uint32_t userHeaderSize,
                                                                const uint32_t userHeaderAlignment) noexcept;
 
+    /// @brief allocate multiple chunks of the same size with a single operation on the mempool; the chunks are
+    /// allocated in addition to the ones allocated with tryAllocate, the ownership of the SharedChunks remains in the
+    /// ChunkSender
+    /// @param[in] originId, the unique id of the entity which requested this allocate
+    /// @param[out] chunkHeaders, receives the pointers to the ChunkHeaders; its size is the number of chunks to
+    /// allocate which must not exceed MAX_CHUNKS_PER_BATCH of the ChunkSenderData
+    /// @param[in] userPayloadSize, size of the user-payload without additional headers
+    /// @param[in] userPayloadAlignment, alignment of the user-payload
+    /// @param[in] userHeaderSize, size of the user-header; use iox::CHUNK_NO_USER_HEADER_SIZE to omit a
+    /// user-header
+    /// @param[in] userHeaderAlignment, alignment of the user-header; use iox::CHUNK_NO_USER_HEADER_ALIGNMENT
+    /// to omit a user-header
+    /// @return success if all chunks were allocated, error if not; in case of an error no chunk is allocated
+    expected<void, AllocationError> tryAllocateBatch(const UniquePortId originId,
+                                                     const span<mepoo::ChunkHeader*> chunkHeaders,
+                                                     const uint32_t userPayloadSize,
+                                                     const uint32_t userPayloadAlignment,
+                                                     const uint32_t userHeaderSize,
+                                                     const uint32_t userHeaderAlignment) noexcept;
+
     /// @brief Release an allocated chunk without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -114,6 +136,13 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @return the number of receiver the chunk was send to
     uint64_t send(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send a batch of allocated chunks to all connected ChunkQueuePopper. Compared to sending the chunks one
+    /// by one, the distributor lock is acquired only once and every receiver is notified only once per batch
+    /// @param[in] chunkHeaders, pointers to the ChunkHeaders to send; the ownership of the pointers is transferred to
+    /// this method
+    /// @return the number of receiver the chunks were send to
+    uint64_t send(const span<mepoo::ChunkHeader* const> chunkHeaders) noexcept;
+
     /// @brief Send an allocated chunk to a specific ChunkQueuePopper
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send; the ownership of the pointer is transferred to this
     /// method
@@ -125,6 +154,17 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
                      const UniqueId uniqueQueueId,
                      const uint32_t lastKnownQueueIndex) noexcept;
 
+    /// @brief Send an allocated chunk to a specific ChunkQueuePopper which is addressed by its queue handle
+    /// @param[in] chunkHeader, pointer to the ChunkHeader to send; the ownership of the pointer is transferred to this
+    /// method
+    /// @param[in] uniqueQueueId is an unique ID which identifies the queue to which this chunk shall be delivered
+    /// @param[in] queueHandle is the handle of the queue with uniqueQueueId, obtained with getQueueHandle
+    /// @return true when successful, false otherwise; the chunk is released to the mempool if it could not be delivered
+    /// @note This method does not add the chunk to the history
+    bool sendToQueueWithHandle(mepoo::ChunkHeader* const chunkHeader,
+                               const UniqueId uniqueQueueId,
+                               const uint32_t queueHandle) noexcept;
+
     /// @brief Push an allocated chunk to the history without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to push to the history
     void pushToHistory(mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -135,7 +175,7 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
 
     /// @brief Release all the chunks that are currently held. Caution: Only call this if the user process is no more
     /// running E.g. This cleans up chunks that were held by a user process that died unexpectetly, for avoiding lost
-    /// chunks in the system
+    /// chunks in the system. This includes the chunks which are reserved by the chunk magazine
     void releaseAll() noexcept;
 
   private:
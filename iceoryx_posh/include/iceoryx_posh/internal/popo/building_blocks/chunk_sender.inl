@@ -112,6 +112,12 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
         return err(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
     }
 
+    // the used chunk list has additional space for the chunks of a batch which must not be used by single chunks
+    if (getMembers()->m_chunksInUse.size() >= MemberType_t::MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY)
+    {
+        return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+    }
+
     const auto& chunkSettings = chunkSettingsResult.value();
     const uint32_t requiredChunkSize = chunkSettings.requiredChunkSize();
 
@@ -139,7 +145,7 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     {
         // BEGIN of critical section, chunk will be lost if the process terminates in this section
         // get a new chunk
-        auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings);
+        auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings, getMembers()->m_chunkMagazine);
 
         if (getChunkResult.has_error())
         {
@@ -165,6 +171,53 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     }
 }
 
+template <typename ChunkSenderDataType>
+inline expected<void, AllocationError>
+ChunkSender<ChunkSenderDataType>::tryAllocateBatch(const UniquePortId originId,
+                                                   const span<mepoo::ChunkHeader*> chunkHeaders,
+                                                   const uint32_t userPayloadSize,
+                                                   const uint32_t userPayloadAlignment,
+                                                   const uint32_t userHeaderSize,
+                                                   const uint32_t userHeaderAlignment) noexcept
+{
+    const auto chunkSettingsResult =
+        mepoo::ChunkSettings::create(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
+    if (chunkSettingsResult.has_error())
+    {
+        return err(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+
+    const auto numberOfChunks = chunkHeaders.size();
+    auto& chunksInUse = getMembers()->m_chunksInUse;
+    if (numberOfChunks > MemberType_t::MAX_CHUNKS_PER_BATCH
+        || chunksInUse.size() + numberOfChunks > MemberType_t::MAX_CHUNKS_IN_USE)
+    {
+        return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+    }
+
+    vector<mepoo::SharedChunk, MemberType_t::MAX_CHUNKS_PER_BATCH> chunks(numberOfChunks);
+
+    // BEGIN of critical section, chunks will be lost if the process terminates in this section
+    auto getChunksResult = getMembers()->m_memoryMgr->getChunks(
+        chunkSettingsResult.value(), span<mepoo::SharedChunk>(chunks.data(), chunks.size()));
+    if (getChunksResult.has_error())
+    {
+        /// @todo iox-#1012 use error<E2>::from(E1); once available
+        return err(into<AllocationError>(getChunksResult.error()));
+    }
+
+    for (uint64_t i = 0U; i < numberOfChunks; ++i)
+    {
+        // cannot fail since the free space of the used chunk list was checked in advance
+        chunksInUse.insert(chunks[i]);
+        chunks[i].getChunkHeader()->setOriginId(originId);
+        chunkHeaders[i] = chunks[i].getChunkHeader();
+    }
+    // END of critical section
+
+    return ok();
+}
+
 template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
@@ -194,6 +247,35 @@ inline uint64_t ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const
     return numberOfReceiverTheChunkWasDelivered;
 }
 
+template <typename ChunkSenderDataType>
+inline uint64_t ChunkSender<ChunkSenderDataType>::send(const span<mepoo::ChunkHeader* const> chunkHeaders) noexcept
+{
+    // every chunk to send must be in the used chunk list, therefore the batch cannot be larger than its capacity
+    vector<mepoo::SharedChunk, ChunkSenderDataType::MAX_CHUNKS_IN_USE> chunks;
+    uint64_t numberOfReceiverTheChunksWereDelivered{0};
+    // BEGIN of critical section, chunks will be lost if the process terminates in this section
+    for (uint64_t i = 0U; i < chunkHeaders.size(); ++i)
+    {
+        mepoo::SharedChunk chunk(nullptr);
+        if (getChunkReadyForSend(chunkHeaders[i], chunk))
+        {
+            chunks.push_back(chunk);
+        }
+    }
+
+    if (!chunks.empty())
+    {
+        numberOfReceiverTheChunksWereDelivered =
+            this->deliverToAllStoredQueues(span<mepoo::SharedChunk>(chunks.data(), chunks.size()));
+
+        getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+        getMembers()->m_lastChunkUnmanaged = chunks.back();
+    }
+    // END of critical section
+
+    return numberOfReceiverTheChunksWereDelivered;
+}
+
 template <typename ChunkSenderDataType>
 inline bool ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* const chunkHeader,
                                                           const UniqueId uniqueQueueId,
@@ -215,6 +297,31 @@ inline bool ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* co
     return false;
 }
 
+template <typename ChunkSenderDataType>
+inline bool ChunkSender<ChunkSenderDataType>::sendToQueueWithHandle(mepoo::ChunkHeader* const chunkHeader,
+                                                                    const UniqueId uniqueQueueId,
+                                                                    const uint32_t queueHandle) noexcept
+{
+    mepoo::SharedChunk chunk(nullptr);
+    // BEGIN of critical section, chunk will be lost if the process terminates in this section
+    if (getChunkReadyForSend(chunkHeader, chunk))
+    {
+        if (this->deliverToQueueWithHandle(uniqueQueueId, queueHandle, chunk).has_error())
+        {
+            // the chunk is released to the mempool when it goes out of scope
+            return false;
+        }
+
+        getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+        getMembers()->m_lastChunkUnmanaged = chunk;
+
+        return true;
+    }
+    // END of critical section
+
+    return false;
+}
+
 template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::pushToHistory(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
@@ -249,6 +356,7 @@ inline void ChunkSender<ChunkSenderDataType>::releaseAll() noexcept
     getMembers()->m_chunksInUse.cleanup();
     this->cleanup();
     getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+    getMembers()->m_chunkMagazine.drain();
 }
 
 template <typename ChunkSenderDataType>
@@ -18,6 +18,7 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_SENDER_DATA_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_magazine.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
@@ -30,21 +31,32 @@ namespace iox
 {
 namespace popo
 {
-template <uint32_t MaxChunksAllocatedSimultaneously, typename ChunkDistributorDataType>
+/// @tparam MaxChunksAllocatedSimultaneously is the number of chunks which can be allocated one by one in parallel
+/// @tparam MaxChunksPerBatch is the number of chunks which can be allocated with one batch in addition to them
+template <uint32_t MaxChunksAllocatedSimultaneously,
+          typename ChunkDistributorDataType,
+          uint32_t MaxChunksPerBatch = 0U>
 struct ChunkSenderData : public ChunkDistributorDataType
 {
     explicit ChunkSenderData(not_null<mepoo::MemoryManager* const> memoryManager,
                              const ConsumerTooSlowPolicy consumerTooSlowPolicy,
                              const uint64_t historyCapacity = 0U,
-                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo(),
+                             const uint32_t chunkMagazineCapacity = 0U,
+                             const uint64_t broadcastDeliveryThreshold = 0U,
+                             const uint64_t chunkRingCapacity = 0U) noexcept;
 
     using ChunkDistributorData_t = ChunkDistributorDataType;
+    static constexpr uint32_t MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY{MaxChunksAllocatedSimultaneously};
+    static constexpr uint32_t MAX_CHUNKS_PER_BATCH{MaxChunksPerBatch};
+    static constexpr uint32_t MAX_CHUNKS_IN_USE{MaxChunksAllocatedSimultaneously + MaxChunksPerBatch};
 
     const RelativePointer<mepoo::MemoryManager> m_memoryMgr;
     mepoo::MemoryInfo m_memoryInfo;
-    UsedChunkList<MaxChunksAllocatedSimultaneously> m_chunksInUse;
+    UsedChunkList<MAX_CHUNKS_IN_USE> m_chunksInUse;
     mepoo::SequenceNumber_t m_sequenceNumber{0U};
     mepoo::ShmSafeUnmanagedChunk m_lastChunkUnmanaged;
+    mepoo::ChunkMagazine m_chunkMagazine;
 };
 
 } // namespace popo
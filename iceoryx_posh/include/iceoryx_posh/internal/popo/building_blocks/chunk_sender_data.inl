@@ -21,15 +21,19 @@ namespace iox
 {
 namespace popo
 {
-template <uint32_t MaxChunksAllocatedSimultaneously, typename ChunkDistributorDataType>
-inline ChunkSenderData<MaxChunksAllocatedSimultaneously, ChunkDistributorDataType>::ChunkSenderData(
+template <uint32_t MaxChunksAllocatedSimultaneously, typename ChunkDistributorDataType, uint32_t MaxChunksPerBatch>
+inline ChunkSenderData<MaxChunksAllocatedSimultaneously, ChunkDistributorDataType, MaxChunksPerBatch>::ChunkSenderData(
     not_null<mepoo::MemoryManager* const> memoryManager,
     const ConsumerTooSlowPolicy consumerTooSlowPolicy,
     const uint64_t historyCapacity,
-    const mepoo::MemoryInfo& memoryInfo) noexcept
-    : ChunkDistributorDataType(consumerTooSlowPolicy, historyCapacity)
+    const mepoo::MemoryInfo& memoryInfo,
+    const uint32_t chunkMagazineCapacity,
+    const uint64_t broadcastDeliveryThreshold,
+    const uint64_t chunkRingCapacity) noexcept
+    : ChunkDistributorDataType(consumerTooSlowPolicy, historyCapacity, broadcastDeliveryThreshold, chunkRingCapacity)
     , m_memoryMgr(memoryManager)
     , m_memoryInfo(memoryInfo)
+    , m_chunkMagazine(chunkMagazineCapacity)
 {
 }
 
@@ -18,6 +18,7 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CONDITION_LISTENER_HPP
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/timer_wheel.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iox/algorithm.hpp"
 
@@ -25,7 +26,9 @@ namespace iox
 {
 namespace popo
 {
-/// @brief ConditionListener allows one to wait using a shared memory condition variable
+/// @brief ConditionListener allows one to wait using a shared memory condition variable. It owns the TimerWheel of
+///        the timers which are attached to the waiting entity; wait() and timedWait() block at most until the next
+///        timer expires and report an expired timer like any other active notification.
 class ConditionListener
 {
   public:
@@ -49,7 +52,7 @@ class ConditionListener
     void destroy() noexcept;
 
     /// @brief returns a sorted vector of indices of active notifications; blocking if ConditionVariableData was
-    /// not notified unless destroy() was called before. The indices of active notifications are
+    /// not notified and no timer expired unless destroy() was called before. The indices of active notifications are
     /// never empty unless destroy() was called, then it's always empty.
     ///
     /// @return a sorted vector of active notifications
@@ -64,19 +67,39 @@ class ConditionListener
     /// @return a sorted vector of active notifications
     NotificationVector_t timedWait(const units::Duration& timeToWait) noexcept;
 
+    /// @brief Sets the duration wait() and timedWait() busy wait for a notification before the thread is blocked.
+    /// This reduces the wakeup latency at the cost of CPU time. The default is zero, i.e. the thread is blocked
+    /// right away.
+    /// @param[in] spinDuration the maximum duration to busy wait before blocking
+    void setSpinDuration(const units::Duration spinDuration) noexcept;
+
+    /// @brief Returns the TimerWheel whose expired timers are reported by wait() and timedWait()
+    TimerWheel& getTimerWheel() noexcept;
+
   protected:
     const ConditionVariableData* getMembers() const noexcept;
     ConditionVariableData* getMembers() noexcept;
 
   private:
-    void resetUnchecked(const uint64_t index) noexcept;
     void resetSemaphore() noexcept;
 
-    NotificationVector_t waitImpl(const function_ref<bool()>& waitCall) noexcept;
+    NotificationVector_t waitImpl(const function_ref<bool(const optional<units::Duration>&)>& waitCall,
+                                  const units::Duration spinDuration,
+                                  const function_ref<bool()>& hasTimedOut) noexcept;
+    void activateExpiredTimers() noexcept;
+    void collectActiveNotifications(NotificationVector_t& activeNotifications) noexcept;
+    bool hasActiveNotifications() const noexcept;
+    /// @brief busy waits until a notification is active
+    /// @param[in] spinDuration the maximum duration to busy wait
+    /// @param[in] hasTimedOut stops the busy waiting once the deadline of a timed wait has expired
+    /// @return true if a notification is active, false otherwise
+    bool spinUntilNotified(const units::Duration spinDuration, const function_ref<bool()>& hasTimedOut) const noexcept;
 
   private:
     ConditionVariableData* m_condVarDataPtr{nullptr};
     std::atomic_bool m_toBeDestroyed{false};
+    units::Duration m_spinDuration{units::Duration::zero()};
+    TimerWheel m_timerWheel;
 };
 
 } // namespace popo
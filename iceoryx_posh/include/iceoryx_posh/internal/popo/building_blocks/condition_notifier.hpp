@@ -40,6 +40,14 @@ class ConditionNotifier
     /// @brief If threads are waiting on the condition variable, this call unblocks one of the waiting threads
     void notify() noexcept;
 
+    /// @brief Marks the notification as active without unblocking a waiting thread; this is intended for activating
+    /// multiple notifications of the same condition variable with a single wakeUp call afterwards
+    void activate() noexcept;
+
+    /// @brief If threads are waiting on the condition variable, this call unblocks one of the waiting threads. The
+    /// waiting thread sees all notifications which were activated before.
+    void wakeUp() noexcept;
+
   protected:
     const ConditionVariableData* getMembers() const noexcept;
     ConditionVariableData* getMembers() noexcept;
@@ -20,6 +20,7 @@
 #include "iceoryx_hoofs/posix_wrapper/unnamed_semaphore.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
 
 #include <atomic>
 
@@ -38,11 +39,31 @@ struct ConditionVariableData
     ConditionVariableData& operator=(ConditionVariableData&& rhs) = delete;
     ~ConditionVariableData() noexcept = default;
 
+    /// @brief Marks the notification with the provided index as active
+    /// @param[in] index of the notification, must be smaller than MAX_NUMBER_OF_NOTIFIERS
+    void activateNotification(const uint64_t index) noexcept;
+
+    /// @brief Checks if the notification with the provided index is active
+    /// @param[in] index of the notification, must be smaller than MAX_NUMBER_OF_NOTIFIERS
+    /// @return true if the notification is active, otherwise false
+    bool isNotificationActive(const uint64_t index) const noexcept;
+
+    static constexpr uint64_t NOTIFICATIONS_PER_WORD{64U};
+    static constexpr uint64_t NUMBER_OF_NOTIFICATION_WORDS{(MAX_NUMBER_OF_NOTIFIERS + NOTIFICATIONS_PER_WORD - 1U)
+                                                           / NOTIFICATIONS_PER_WORD};
+
     optional<posix::UnnamedSemaphore> m_semaphore;
     RuntimeName_t m_runtimeName;
     std::atomic_bool m_toBeDestroyed{false};
-    std::atomic_bool m_activeNotifications[MAX_NUMBER_OF_NOTIFIERS];
+    /// The active notifications as bit set; the notification with index i is the bit i % NOTIFICATIONS_PER_WORD of
+    /// the word i / NOTIFICATIONS_PER_WORD. The listener collects a whole word at once.
+    std::atomic<uint64_t> m_activeNotifications[NUMBER_OF_NOTIFICATION_WORDS];
     std::atomic_bool m_wasNotified{false};
+    /// The number of listeners which are about to block on the semaphore. The notifiers post the semaphore only if
+    /// there is a waiting listener, therefore a notification to a listener which is busy does not cost a syscall.
+    std::atomic<uint64_t> m_numberOfWaiters{0U};
+    /// Requests the discovery of RouDi after the condition variable was marked to be destroyed; set by the PortPool
+    DiscoveryNotifier m_discoveryNotifier;
 };
 
 } // namespace popo
@@ -0,0 +1,74 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DELIVERY_HELPER_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DELIVERY_HELPER_HPP
+
+#include "iox/function_ref.hpp"
+#include "iox/optional.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The DeliveryHelper is a process local thread which takes over a part of the delivery of a chunk to the
+/// queues of a high fan-out topic. The sending thread hands over the task with execute, delivers its own part
+/// meanwhile and waits for the helper with waitForCompletion afterwards. The helper spins shortly after a task since a
+/// sender usually sends in bursts and blocks afterwards.
+/// @note Only one thread may hand over tasks at a time
+class DeliveryHelper
+{
+  public:
+    DeliveryHelper() noexcept;
+    ~DeliveryHelper() noexcept;
+
+    DeliveryHelper(const DeliveryHelper&) = delete;
+    DeliveryHelper(DeliveryHelper&&) = delete;
+    DeliveryHelper& operator=(const DeliveryHelper&) = delete;
+    DeliveryHelper& operator=(DeliveryHelper&&) = delete;
+
+    /// @brief Executes the task on the helper thread and returns immediately
+    /// @param[in] task to execute; the callable must stay valid until waitForCompletion returns
+    /// @note must not be called again before waitForCompletion returned
+    void execute(const function_ref<void()> task) noexcept;
+
+    /// @brief Waits until the task which was handed over with execute is done
+    void waitForCompletion() noexcept;
+
+  private:
+    void threadLoop() noexcept;
+
+    static constexpr uint64_t SPIN_ITERATIONS_BEFORE_BLOCKING{10000U};
+
+    optional<function_ref<void()>> m_task;
+    std::atomic<uint64_t> m_numberOfExecutedTasks{0U};
+    std::atomic<uint64_t> m_numberOfCompletedTasks{0U};
+    std::atomic_bool m_keepRunning{true};
+    std::mutex m_mutex;
+    std::condition_variable m_wakeUpCondition;
+    std::thread m_thread;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DELIVERY_HELPER_HPP
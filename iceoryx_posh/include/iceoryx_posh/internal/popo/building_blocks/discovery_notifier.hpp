@@ -0,0 +1,63 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_HPP
+
+#include "iox/relative_pointer.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+struct ConditionVariableData;
+
+/// @brief DiscoveryNotifier lets a port, node or condition variable request the discovery of RouDi. It marks its owner
+/// as pending in the PortPool and wakes up RouDi, which then processes only the pending requests.
+class DiscoveryNotifier
+{
+  public:
+    /// @brief Creates a notifier which does nothing, e.g. for an owner which was not created by the PortPool
+    DiscoveryNotifier() noexcept = default;
+
+    /// @brief Creates a notifier for an owner of the PortPool
+    /// @param[in] pendingFlags the word of the pending flags of the PortPool which contains the flag of the owner
+    /// @param[in] pendingMask the mask of the flag of the owner
+    /// @param[in] conditionVariableData the condition variable RouDi is waiting on
+    DiscoveryNotifier(std::atomic<uint64_t>& pendingFlags,
+                      const uint64_t pendingMask,
+                      ConditionVariableData& conditionVariableData) noexcept;
+
+    /// @brief Marks the owner as pending and wakes up RouDi. Must be called after the request was stored in the data of
+    /// the owner.
+    void notify() const noexcept;
+
+    /// @brief Marks the owner as pending without waking up RouDi; the request is processed with the next discovery run,
+    /// e.g. to retry a deferred destruction in the next monitoring cycle
+    void markPending() const noexcept;
+
+  private:
+    RelativePointer<std::atomic<uint64_t>> m_pendingFlags;
+    uint64_t m_pendingMask{0U};
+    RelativePointer<ConditionVariableData> m_conditionVariableData;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_HPP
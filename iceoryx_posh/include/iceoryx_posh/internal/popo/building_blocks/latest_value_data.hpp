@@ -0,0 +1,65 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_LATEST_VALUE_DATA_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_LATEST_VALUE_DATA_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief A buffer of the latest value cell. The sequence number is odd while the writer modifies the buffer, hence a
+/// reader which sees the same even sequence number before and after it copied the value has read a consistent value.
+struct LatestValueBuffer
+{
+    static constexpr uint64_t MAX_VALUE_SIZE{256U};
+    static constexpr uint64_t WORD_SIZE{sizeof(uint64_t)};
+    static constexpr uint64_t NUMBER_OF_WORDS{MAX_VALUE_SIZE / WORD_SIZE};
+
+    std::atomic<uint64_t> m_sequenceNumber{0U};
+    /// the version of the value in the buffer, i.e. the number of the write which stored it
+    std::atomic<uint64_t> m_version{0U};
+    /// the value is stored in atomic words, hence a reader which races with the writer does not cause undefined
+    /// behavior but only reads a torn value which is discarded
+    std::atomic<uint64_t> m_words[NUMBER_OF_WORDS];
+};
+
+/// @brief The latest value cell holds the newest value of a single writer for an arbitrary number of readers. The
+/// writer alternates between two buffers, therefore a reader only has to retry if the writer wrote twice while the
+/// value was copied. Writing and reading needs neither a lock nor an allocation.
+struct LatestValueData
+{
+    static constexpr uint64_t CACHE_LINE_SIZE{64U};
+    static constexpr uint64_t NUMBER_OF_BUFFERS{2U};
+
+    /// @brief creates an empty cell
+    /// @param[in] valueSize is the size of the values, at most LatestValueBuffer::MAX_VALUE_SIZE
+    explicit LatestValueData(const uint64_t valueSize) noexcept;
+
+    const uint64_t m_valueSize;
+    /// the number of values which were written so far; the newest one is in the buffer with the index
+    /// m_version % NUMBER_OF_BUFFERS
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> m_version{0U};
+    alignas(CACHE_LINE_SIZE) LatestValueBuffer m_buffers[NUMBER_OF_BUFFERS];
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_LATEST_VALUE_DATA_HPP
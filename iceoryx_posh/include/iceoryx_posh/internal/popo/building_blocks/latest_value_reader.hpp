@@ -0,0 +1,63 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_LATEST_VALUE_READER_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_LATEST_VALUE_READER_HPP
+
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_data.hpp"
+#include "iox/not_null.hpp"
+#include "iox/optional.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The LatestValueReader reads the newest value of a latest value cell. Any number of readers can read the
+/// cell concurrently to the writer.
+class LatestValueReader
+{
+  public:
+    using MemberType_t = LatestValueData;
+
+    explicit LatestValueReader(not_null<const MemberType_t* const> latestValueDataPtr) noexcept;
+
+    LatestValueReader(const LatestValueReader& other) = delete;
+    LatestValueReader& operator=(const LatestValueReader&) = delete;
+    LatestValueReader(LatestValueReader&& rhs) noexcept = default;
+    LatestValueReader& operator=(LatestValueReader&& rhs) noexcept = default;
+    ~LatestValueReader() noexcept = default;
+
+    /// @brief copies the newest value out of the cell
+    /// @param[out] value points to the memory for a value with the size the cell was created with
+    /// @return the version of the read value or nullopt if no value was written yet
+    optional<uint64_t> read(void* const value) const noexcept;
+
+    /// @brief get the version of the newest value
+    /// @return the number of values which were written so far
+    uint64_t getVersion() const noexcept;
+
+    /// @brief get the size of the values
+    /// @return the size the cell was created with
+    uint64_t getValueSize() const noexcept;
+
+  private:
+    const MemberType_t* m_latestValueDataPtr;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_LATEST_VALUE_READER_HPP
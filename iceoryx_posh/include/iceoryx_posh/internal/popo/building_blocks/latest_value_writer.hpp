@@ -0,0 +1,52 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_LATEST_VALUE_WRITER_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_LATEST_VALUE_WRITER_HPP
+
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_data.hpp"
+#include "iox/not_null.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The LatestValueWriter writes values into a latest value cell. There must be only one writer per cell.
+class LatestValueWriter
+{
+  public:
+    using MemberType_t = LatestValueData;
+
+    explicit LatestValueWriter(not_null<MemberType_t* const> latestValueDataPtr) noexcept;
+
+    LatestValueWriter(const LatestValueWriter& other) = delete;
+    LatestValueWriter& operator=(const LatestValueWriter&) = delete;
+    LatestValueWriter(LatestValueWriter&& rhs) noexcept = default;
+    LatestValueWriter& operator=(LatestValueWriter&& rhs) noexcept = default;
+    ~LatestValueWriter() noexcept = default;
+
+    /// @brief writes a new value into the cell; the writer never waits for the readers
+    /// @param[in] value points to the value with the size the cell was created with
+    void write(const void* const value) noexcept;
+
+  private:
+    MemberType_t* m_latestValueDataPtr;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_LATEST_VALUE_WRITER_HPP
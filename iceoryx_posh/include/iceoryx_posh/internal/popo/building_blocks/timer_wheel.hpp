@@ -0,0 +1,147 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_TIMER_WHEEL_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_TIMER_WHEEL_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iox/duration.hpp"
+#include "iox/function_ref.hpp"
+#include "iox/optional.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The deviation of the expirations of a periodic timer from their scheduled time
+struct TimerJitterStatistics
+{
+    /// @brief The number of expirations which were delivered to the waiting thread
+    uint64_t numberOfExpirations{0U};
+    /// @brief The number of expirations which were skipped since the waiting thread was woken up more than one period
+    ///        too late
+    uint64_t numberOfMissedExpirations{0U};
+    /// @brief The smallest delay between the scheduled expiry and the wake up of the waiting thread
+    units::Duration minJitter{units::Duration::zero()};
+    /// @brief The largest delay between the scheduled expiry and the wake up of the waiting thread
+    units::Duration maxJitter{units::Duration::zero()};
+    /// @brief The average delay between the scheduled expiry and the wake up of the waiting thread
+    units::Duration meanJitter{units::Duration::zero()};
+};
+
+/// @brief Hierarchical timer wheel for the periodic timers of one ConditionVariableData. The timers are identified by
+///        the notification index of their trigger. Inserting and removing a timer is O(1) and does not allocate; the
+///        wheel has NUMBER_OF_LEVELS levels with SLOTS_PER_LEVEL slots and every level covers SLOTS_PER_LEVEL times the
+///        range of the level below. The timers are cascaded to the lower levels while the wheel advances and every
+///        level keeps a bit set of its occupied slots, therefore empty stretches of time are skipped at once.
+///        The thread which waits on the ConditionVariableData advances the wheel and blocks at most until the next
+///        expiry, which is exact and not rounded to the tick of the wheel. No thread and no operating system timer is
+///        required for the timers.
+/// @note The timers can be scheduled and canceled from any thread, advancing the wheel is done by the waiting thread
+class TimerWheel
+{
+  public:
+    static constexpr uint64_t LEVEL_BITS{6U};
+    static constexpr uint64_t SLOTS_PER_LEVEL{1U << LEVEL_BITS};
+    static constexpr uint64_t NUMBER_OF_LEVELS{4U};
+    static constexpr uint64_t TICK_IN_NANOSECONDS{100000U};
+
+    explicit TimerWheel(ConditionVariableData& condVarData) noexcept;
+    ~TimerWheel() noexcept = default;
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel(TimerWheel&&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+    TimerWheel& operator=(TimerWheel&&) = delete;
+
+    /// @brief Schedules a periodic timer and wakes up the waiting thread to take the timer into account. A timer
+    ///        which is already scheduled for this index is replaced and its statistics are reset.
+    /// @param[in] index the notification index of the timer, must be smaller than MAX_NUMBER_OF_NOTIFIERS
+    /// @param[in] firstExpiry the monotonic time of the first expiry
+    /// @param[in] period the time between two expiries, must be greater than zero
+    void schedule(const uint64_t index, const units::Duration firstExpiry, const units::Duration period) noexcept;
+
+    /// @brief Cancels the timer with the provided index, does nothing if it is not scheduled
+    /// @param[in] index the notification index of the timer
+    void cancel(const uint64_t index) noexcept;
+
+    /// @brief Calls onExpiry for every timer which expired until now and schedules it for its next period. Periods
+    ///        which were missed completely are skipped and counted.
+    /// @param[in] now the current monotonic time
+    /// @param[in] onExpiry callback with the notification index of the expired timer
+    void advance(const units::Duration now, const function_ref<void(uint64_t)> onExpiry) noexcept;
+
+    /// @brief Returns the time until the next timer expires
+    /// @param[in] now the current monotonic time
+    /// @return the time until the next expiry, zero if it is overdue, nullopt if no timer is scheduled
+    optional<units::Duration> timeUntilNextExpiry(const units::Duration now) const noexcept;
+
+    /// @brief Returns the jitter statistics of the timer with the provided index
+    /// @param[in] index the notification index of the timer
+    TimerJitterStatistics getJitterStatistics(const uint64_t index) const noexcept;
+
+    /// @brief Returns the current time of the monotonic clock the wheel operates on
+    static units::Duration currentTime() noexcept;
+
+  private:
+    static constexpr uint32_t INVALID_INDEX{std::numeric_limits<uint32_t>::max()};
+
+    struct Timer_t
+    {
+        uint64_t m_expiry{0U};
+        uint64_t m_period{0U};
+        uint32_t m_next{INVALID_INDEX};
+        uint32_t m_previous{INVALID_INDEX};
+        uint8_t m_level{0U};
+        uint8_t m_slot{0U};
+        bool m_isScheduled{false};
+
+        uint64_t m_numberOfExpirations{0U};
+        uint64_t m_numberOfMissedExpirations{0U};
+        uint64_t m_minJitter{0U};
+        uint64_t m_maxJitter{0U};
+        uint64_t m_jitterSum{0U};
+    };
+
+    void insert(const uint32_t index) noexcept;
+    void unlink(const uint32_t index) noexcept;
+    void expireSlot(const uint64_t slot, const uint64_t now, const function_ref<void(uint64_t)> onExpiry) noexcept;
+    void cascade(const uint64_t level) noexcept;
+    optional<uint64_t> nextTickWithWork() const noexcept;
+    optional<uint64_t> firstOccupiedSlot(const uint64_t level, const uint64_t startSlot) const noexcept;
+    uint64_t slotOfCurrentTick(const uint64_t level) const noexcept;
+    void wakeUpWaiter() noexcept;
+
+  private:
+    ConditionVariableData* m_condVarDataPtr{nullptr};
+    mutable std::mutex m_mutex;
+    std::atomic<uint64_t> m_numberOfScheduledTimers{0U};
+    uint64_t m_currentTick{0U};
+    Timer_t m_timers[MAX_NUMBER_OF_NOTIFIERS];
+    uint32_t m_slots[NUMBER_OF_LEVELS][SLOTS_PER_LEVEL];
+    uint64_t m_occupiedSlots[NUMBER_OF_LEVELS]{};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_TIMER_WHEEL_HPP
@@ -0,0 +1,74 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_LATEST_VALUE_PUBLISHER_IMPL_HPP
+#define IOX_POSH_POPO_LATEST_VALUE_PUBLISHER_IMPL_HPP
+
+#include "iceoryx_posh/internal/popo/base_publisher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_data.hpp"
+#include "iceoryx_posh/internal/popo/typed_port_api_trait.hpp"
+#include "iox/expected.hpp"
+
+#include <type_traits>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The LatestValuePublisherImpl class implements the latest value publisher API
+/// @note Not intended for public usage! Use the 'LatestValuePublisher' instead!
+template <typename T, typename BasePublisherType = BasePublisher<>>
+class LatestValuePublisherImpl : public BasePublisherType
+{
+    using DataTypeAssert = typename TypedPortApiTrait<T>::Assert;
+    static_assert(std::is_trivially_copyable<T>::value, "The type of a latest value must be trivially copyable");
+    static_assert(sizeof(T) <= LatestValueBuffer::MAX_VALUE_SIZE, "The type of a latest value is too large");
+
+  public:
+    /// @brief Creates the publisher; the history capacity of the publisher options is always 1 since the history
+    /// holds the latest value cell for the late joining subscribers
+    explicit LatestValuePublisherImpl(const capro::ServiceDescription& service,
+                                      const PublisherOptions& publisherOptions = PublisherOptions());
+    LatestValuePublisherImpl(const LatestValuePublisherImpl& other) = delete;
+    LatestValuePublisherImpl& operator=(const LatestValuePublisherImpl&) = delete;
+    LatestValuePublisherImpl(LatestValuePublisherImpl&& rhs) = delete;
+    LatestValuePublisherImpl& operator=(LatestValuePublisherImpl&& rhs) = delete;
+    virtual ~LatestValuePublisherImpl() = default;
+
+    ///
+    /// @brief Publishes a value by copying it into the latest value cell of the publisher.
+    /// @param value The value to publish.
+    /// @return An AllocationError if the cell could not be loaned.
+    /// @details The first call loans a chunk for the cell and publishes it, every further call only writes the value
+    ///          into the cell without an allocation, a queue push or a notification of the subscribers.
+    ///
+    expected<void, AllocationError> publish(const T& value) noexcept;
+
+  protected:
+    using BasePublisherType::port;
+
+  private:
+    static PublisherOptions toLatestValuePublisherOptions(PublisherOptions publisherOptions) noexcept;
+
+    LatestValueData* m_latestValue{nullptr};
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/latest_value_publisher_impl.inl"
+
+#endif // IOX_POSH_POPO_LATEST_VALUE_PUBLISHER_IMPL_HPP
@@ -0,0 +1,71 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_LATEST_VALUE_PUBLISHER_IMPL_INL
+#define IOX_POSH_POPO_LATEST_VALUE_PUBLISHER_IMPL_INL
+
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_writer.hpp"
+#include "iceoryx_posh/internal/popo/latest_value_publisher_impl.hpp"
+
+namespace iox
+{
+namespace popo
+{
+template <typename T, typename BasePublisherType>
+inline LatestValuePublisherImpl<T, BasePublisherType>::LatestValuePublisherImpl(
+    const capro::ServiceDescription& service, const PublisherOptions& publisherOptions)
+    : BasePublisherType(service, toLatestValuePublisherOptions(publisherOptions))
+{
+}
+
+template <typename T, typename BasePublisherType>
+inline PublisherOptions
+LatestValuePublisherImpl<T, BasePublisherType>::toLatestValuePublisherOptions(PublisherOptions publisherOptions) noexcept
+{
+    // the cell is published only once and stays in the history as long as the publisher exists
+    publisherOptions.historyCapacity = 1U;
+    publisherOptions.chunkRingCapacity = 0U;
+    return publisherOptions;
+}
+
+template <typename T, typename BasePublisherType>
+inline expected<void, AllocationError>
+LatestValuePublisherImpl<T, BasePublisherType>::publish(const T& value) noexcept
+{
+    if (m_latestValue != nullptr)
+    {
+        LatestValueWriter(m_latestValue).write(&value);
+        return ok();
+    }
+
+    auto result = port().tryAllocateChunk(
+        sizeof(LatestValueData), alignof(LatestValueData), CHUNK_NO_USER_HEADER_SIZE, CHUNK_NO_USER_HEADER_ALIGNMENT);
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+
+    auto chunkHeader = result.value();
+    m_latestValue = new (chunkHeader->userPayload()) LatestValueData(sizeof(T));
+    LatestValueWriter(m_latestValue).write(&value);
+    port().sendChunk(chunkHeader);
+    return ok();
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_LATEST_VALUE_PUBLISHER_IMPL_INL
@@ -0,0 +1,84 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_LATEST_VALUE_SUBSCRIBER_IMPL_HPP
+#define IOX_POSH_POPO_LATEST_VALUE_SUBSCRIBER_IMPL_HPP
+
+#include "iceoryx_posh/internal/popo/base_subscriber.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_data.hpp"
+#include "iceoryx_posh/internal/popo/typed_port_api_trait.hpp"
+#include "iox/optional.hpp"
+
+#include <type_traits>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The LatestValueSubscriberImpl class implements the latest value subscriber API
+/// @note Not intended for public usage! Use the 'LatestValueSubscriber' instead!
+template <typename T, typename BaseSubscriberType = BaseSubscriber<>>
+class LatestValueSubscriberImpl : public BaseSubscriberType
+{
+    using DataTypeAssert = typename TypedPortApiTrait<T>::Assert;
+    static_assert(std::is_trivially_copyable<T>::value, "The type of a latest value must be trivially copyable");
+    static_assert(std::is_default_constructible<T>::value, "The type of a latest value must be default constructible");
+    static_assert(sizeof(T) <= LatestValueBuffer::MAX_VALUE_SIZE, "The type of a latest value is too large");
+
+  public:
+    /// @brief Creates the subscriber; the history request of the subscriber options is always 1 since the latest
+    /// value cell of the publisher is delivered via the history
+    explicit LatestValueSubscriberImpl(const capro::ServiceDescription& service,
+                                       const SubscriberOptions& subscriberOptions = SubscriberOptions());
+    LatestValueSubscriberImpl(const LatestValueSubscriberImpl& other) = delete;
+    LatestValueSubscriberImpl& operator=(const LatestValueSubscriberImpl&) = delete;
+    LatestValueSubscriberImpl(LatestValueSubscriberImpl&& rhs) = delete;
+    LatestValueSubscriberImpl& operator=(LatestValueSubscriberImpl&& rhs) = delete;
+    virtual ~LatestValueSubscriberImpl() noexcept;
+
+    ///
+    /// @brief Reads the newest value of the publisher.
+    /// @return The newest value or nullopt if there is no publisher or the publisher did not publish a value yet.
+    /// @details The value is copied out of the latest value cell of the publisher; the subscriber keeps the last
+    ///          value of a publisher which went away until a new publisher publishes a value.
+    ///
+    optional<T> read() noexcept;
+
+    ///
+    /// @brief Checks whether the publisher published a value which was not read yet.
+    /// @return true if read() would return a value which was not returned before
+    ///
+    bool hasNewValue() noexcept;
+
+  protected:
+    using BaseSubscriberType::port;
+
+  private:
+    static SubscriberOptions toLatestValueSubscriberOptions(SubscriberOptions subscriberOptions) noexcept;
+
+    /// @brief takes the latest value cell of a new publisher from the receive queue and releases the previous one
+    void takeLatestValueCell() noexcept;
+
+    const mepoo::ChunkHeader* m_latestValueChunk{nullptr};
+    uint64_t m_readVersion{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/latest_value_subscriber_impl.inl"
+
+#endif // IOX_POSH_POPO_LATEST_VALUE_SUBSCRIBER_IMPL_HPP
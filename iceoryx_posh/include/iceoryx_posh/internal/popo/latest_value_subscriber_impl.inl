@@ -0,0 +1,119 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_LATEST_VALUE_SUBSCRIBER_IMPL_INL
+#define IOX_POSH_POPO_LATEST_VALUE_SUBSCRIBER_IMPL_INL
+
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_reader.hpp"
+#include "iceoryx_posh/internal/popo/latest_value_subscriber_impl.hpp"
+#include "iox/logging.hpp"
+
+namespace iox
+{
+namespace popo
+{
+template <typename T, typename BaseSubscriberType>
+inline LatestValueSubscriberImpl<T, BaseSubscriberType>::LatestValueSubscriberImpl(
+    const capro::ServiceDescription& service, const SubscriberOptions& subscriberOptions)
+    : BaseSubscriberType(service, toLatestValueSubscriberOptions(subscriberOptions))
+{
+}
+
+template <typename T, typename BaseSubscriberType>
+inline LatestValueSubscriberImpl<T, BaseSubscriberType>::~LatestValueSubscriberImpl() noexcept
+{
+    if (m_latestValueChunk != nullptr)
+    {
+        port().releaseChunk(m_latestValueChunk);
+    }
+}
+
+template <typename T, typename BaseSubscriberType>
+inline SubscriberOptions LatestValueSubscriberImpl<T, BaseSubscriberType>::toLatestValueSubscriberOptions(
+    SubscriberOptions subscriberOptions) noexcept
+{
+    subscriberOptions.historyRequest = 1U;
+    subscriberOptions.requiresPublisherHistorySupport = true;
+    return subscriberOptions;
+}
+
+template <typename T, typename BaseSubscriberType>
+inline void LatestValueSubscriberImpl<T, BaseSubscriberType>::takeLatestValueCell() noexcept
+{
+    // the queue is only filled when a publisher publishes its cell, hence it is empty in the common case
+    while (true)
+    {
+        auto result = BaseSubscriberType::takeChunk();
+        if (result.has_error())
+        {
+            return;
+        }
+
+        auto chunkHeader = result.value();
+        const auto* latestValue = static_cast<const LatestValueData*>(chunkHeader->userPayload());
+        if (chunkHeader->userPayloadSize() != sizeof(LatestValueData)
+            || LatestValueReader(latestValue).getValueSize() != sizeof(T))
+        {
+            IOX_LOG(WARN) << "Discarding a sample which is not a latest value of the expected type";
+            port().releaseChunk(chunkHeader);
+            continue;
+        }
+
+        if (m_latestValueChunk != nullptr)
+        {
+            port().releaseChunk(m_latestValueChunk);
+        }
+        m_latestValueChunk = chunkHeader;
+        m_readVersion = 0U;
+    }
+}
+
+template <typename T, typename BaseSubscriberType>
+inline optional<T> LatestValueSubscriberImpl<T, BaseSubscriberType>::read() noexcept
+{
+    takeLatestValueCell();
+    if (m_latestValueChunk == nullptr)
+    {
+        return nullopt;
+    }
+
+    T value;
+    auto version =
+        LatestValueReader(static_cast<const LatestValueData*>(m_latestValueChunk->userPayload())).read(&value);
+    if (!version.has_value())
+    {
+        return nullopt;
+    }
+    m_readVersion = version.value();
+    return value;
+}
+
+template <typename T, typename BaseSubscriberType>
+inline bool LatestValueSubscriberImpl<T, BaseSubscriberType>::hasNewValue() noexcept
+{
+    takeLatestValueCell();
+    if (m_latestValueChunk == nullptr)
+    {
+        return false;
+    }
+    return LatestValueReader(static_cast<const LatestValueData*>(m_latestValueChunk->userPayload())).getVersion()
+           != m_readVersion;
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_LATEST_VALUE_SUBSCRIBER_IMPL_INL
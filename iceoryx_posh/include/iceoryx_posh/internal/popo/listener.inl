@@ -22,11 +22,15 @@ namespace iox
 {
 namespace popo
 {
+template <uint64_t Capacity>
+constexpr uint32_t ListenerImpl<Capacity>::NO_WORKER;
+
 template <uint64_t Capacity>
 template <typename T, typename ContextDataType>
 inline expected<void, ListenerError>
 ListenerImpl<Capacity>::attachEvent(T& eventOrigin,
-                                    const NotificationCallback<T, ContextDataType>& eventCallback) noexcept
+                                    const NotificationCallback<T, ContextDataType>& eventCallback,
+                                    const optional<uint32_t> workerIndex) noexcept
 {
     if (eventCallback.m_callback == nullptr)
     {
@@ -39,18 +43,25 @@ ListenerImpl<Capacity>::attachEvent(T& eventOrigin,
                     typeid(NoEnumUsed).hash_code(),
                     reinterpret_cast<internal::GenericCallbackRef_t>(*eventCallback.m_callback),
                     internal::TranslateAndCallTypelessCallback<T, ContextDataType>::call,
-                    NotificationAttorney::getInvalidateTriggerMethod(eventOrigin))
+                    NotificationAttorney::getInvalidateTriggerMethod(eventOrigin),
+                    workerIndex)
         .and_then([&](auto& eventId) {
             NotificationAttorney::enableEvent(
                 eventOrigin,
-                TriggerHandle(*m_conditionVariableData, {*this, &ListenerImpl<Capacity>::removeTrigger}, eventId));
+                TriggerHandle(*m_conditionVariableData,
+                              {*this, &ListenerImpl<Capacity>::removeTrigger},
+                              eventId,
+                              &m_conditionListener.getTimerWheel()));
         });
 }
 
 template <uint64_t Capacity>
 template <typename T, typename EventType, typename ContextDataType, typename>
-inline expected<void, ListenerError> ListenerImpl<Capacity>::attachEvent(
-    T& eventOrigin, const EventType eventType, const NotificationCallback<T, ContextDataType>& eventCallback) noexcept
+inline expected<void, ListenerError>
+ListenerImpl<Capacity>::attachEvent(T& eventOrigin,
+                                    const EventType eventType,
+                                    const NotificationCallback<T, ContextDataType>& eventCallback,
+                                    const optional<uint32_t> workerIndex) noexcept
 {
     if (eventCallback.m_callback == nullptr)
     {
@@ -63,11 +74,15 @@ inline expected<void, ListenerError> ListenerImpl<Capacity>::attachEvent(
                     typeid(EventType).hash_code(),
                     reinterpret_cast<internal::GenericCallbackRef_t>(*eventCallback.m_callback),
                     internal::TranslateAndCallTypelessCallback<T, ContextDataType>::call,
-                    NotificationAttorney::getInvalidateTriggerMethod(eventOrigin))
+                    NotificationAttorney::getInvalidateTriggerMethod(eventOrigin),
+                    workerIndex)
         .and_then([&](auto& eventId) {
             NotificationAttorney::enableEvent(
                 eventOrigin,
-                TriggerHandle(*m_conditionVariableData, {*this, &ListenerImpl<Capacity>::removeTrigger}, eventId),
+                TriggerHandle(*m_conditionVariableData,
+                              {*this, &ListenerImpl<Capacity>::removeTrigger},
+                              eventId,
+                              &m_conditionListener.getTimerWheel()),
                 eventType);
         });
 }
@@ -101,10 +116,42 @@ inline ListenerImpl<Capacity>::ListenerImpl() noexcept
 }
 
 template <uint64_t Capacity>
-inline ListenerImpl<Capacity>::ListenerImpl(ConditionVariableData& conditionVariable) noexcept
-    : m_conditionVariableData(&conditionVariable)
+inline ListenerImpl<Capacity>::ListenerImpl(const ListenerOptions& options) noexcept
+    : ListenerImpl(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable(), options)
+{
+}
+
+template <uint64_t Capacity>
+inline ListenerImpl<Capacity>::ListenerImpl(ConditionVariableData& conditionVariable,
+                                            const ListenerOptions& options) noexcept
+    : m_numberOfWorkers(options.numberOfWorkers)
+    , m_conditionVariableData(&conditionVariable)
     , m_conditionListener(conditionVariable)
 {
+    if (m_numberOfWorkers > MAX_NUMBER_OF_WORKERS_PER_LISTENER)
+    {
+        IOX_LOG(WARN) << "The Listener supports at most " << MAX_NUMBER_OF_WORKERS_PER_LISTENER
+                      << " workers but " << m_numberOfWorkers << " were requested. Limiting to "
+                      << MAX_NUMBER_OF_WORKERS_PER_LISTENER << " workers.";
+        m_numberOfWorkers = MAX_NUMBER_OF_WORKERS_PER_LISTENER;
+    }
+
+    for (uint64_t i = 0U; i < Capacity; ++i)
+    {
+        m_eventStates[i].store(EventState::IDLE, std::memory_order_relaxed);
+        m_eventWorkers[i].store(NO_WORKER, std::memory_order_relaxed);
+    }
+
+    for (uint32_t i = 0U; i < m_numberOfWorkers; ++i)
+    {
+        m_workers[i].m_thread = std::thread(&ListenerImpl<Capacity>::workerLoop, this, i);
+        if (i < options.workerCpus.size())
+        {
+            IOX_DISCARD_RESULT(
+                posix::setThreadCpuAffinity(m_workers[i].m_thread.native_handle(), options.workerCpus[i]));
+        }
+    }
+
     m_thread = std::thread(&ListenerImpl<Capacity>::threadLoop, this);
 }
 
@@ -115,7 +162,15 @@ inline ListenerImpl<Capacity>::~ListenerImpl() noexcept
     m_conditionListener.destroy();
 
     m_thread.join();
+
+    m_stopWorkers.store(true, std::memory_order_relaxed);
+    for (uint32_t i = 0U; i < m_numberOfWorkers; ++i)
+    {
+        wakeUpWorker(i);
+        m_workers[i].m_thread.join();
+    }
     m_conditionVariableData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+    m_conditionVariableData->m_discoveryNotifier.notify();
 }
 
 template <uint64_t Capacity>
@@ -126,8 +181,14 @@ ListenerImpl<Capacity>::addEvent(void* const origin,
                                  const uint64_t eventTypeHash,
                                  internal::GenericCallbackRef_t callback,
                                  internal::TranslationCallbackRef_t translationCallback,
-                                 const function<void(uint64_t)> invalidationCallback) noexcept
+                                 const function<void(uint64_t)> invalidationCallback,
+                                 const optional<uint32_t> workerIndex) noexcept
 {
+    if (workerIndex.has_value() && workerIndex.value() >= m_numberOfWorkers)
+    {
+        return err(ListenerError::INVALID_WORKER_INDEX);
+    }
+
     std::lock_guard<std::mutex> lock(m_addEventMutex);
 
     for (uint32_t i = 0U; i < MAX_NUMBER_OF_EVENTS_PER_LISTENER; ++i)
@@ -144,6 +205,7 @@ ListenerImpl<Capacity>::addEvent(void* const origin,
         return err(ListenerError::LISTENER_FULL);
     }
 
+    m_eventWorkers[index].store(workerIndex.value_or(NO_WORKER), std::memory_order_relaxed);
     m_events[index]->init(
         index, origin, userType, eventType, eventTypeHash, callback, translationCallback, invalidationCallback);
     return ok(index);
@@ -155,6 +217,12 @@ inline uint64_t ListenerImpl<Capacity>::size() const noexcept
     return m_indexManager.indicesInUse();
 }
 
+template <uint64_t Capacity>
+inline uint32_t ListenerImpl<Capacity>::numberOfWorkers() const noexcept
+{
+    return m_numberOfWorkers;
+}
+
 template <uint64_t Capacity>
 inline void ListenerImpl<Capacity>::threadLoop() noexcept
 {
@@ -164,9 +232,206 @@ inline void ListenerImpl<Capacity>::threadLoop() noexcept
 
         for (auto& id : activateNotificationIds)
         {
-            m_events[id]->executeCallback();
+            if (m_numberOfWorkers == 0U)
+            {
+                m_events[id]->executeCallback();
+            }
+            else
+            {
+                scheduleEvent(static_cast<uint32_t>(id));
+            }
+        }
+    }
+}
+
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::scheduleEvent(const uint32_t eventId) noexcept
+{
+    auto& eventState = m_eventStates[eventId];
+    auto state = EventState::IDLE;
+    while (true)
+    {
+        if (state == EventState::IDLE)
+        {
+            if (eventState.compare_exchange_weak(state, EventState::QUEUED, std::memory_order_acq_rel))
+            {
+                enqueueEvent(eventId);
+                return;
+            }
+        }
+        else if (state == EventState::RUNNING)
+        {
+            // the worker which runs the callback queues the event again when it is done
+            if (eventState.compare_exchange_weak(
+                    state, EventState::RUNNING_AND_NOTIFIED, std::memory_order_acq_rel))
+            {
+                return;
+            }
+        }
+        else
+        {
+            // the already pending execution of the callback covers this notification
+            return;
+        }
+    }
+}
+
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::enqueueEvent(const uint32_t eventId) noexcept
+{
+    const auto pinnedWorker = m_eventWorkers[eventId].load(std::memory_order_relaxed);
+    const bool isPinned = pinnedWorker != NO_WORKER;
+    // events which are not pinned have a fixed home worker to keep their data in the cache of one cpu as long as
+    // the worker keeps up with its events
+    const uint32_t homeWorker = isPinned ? pinnedWorker : eventId % m_numberOfWorkers;
+
+    auto& worker = m_workers[homeWorker];
+    {
+        std::lock_guard<std::mutex> lock(worker.m_mutex);
+        if (isPinned)
+        {
+            worker.m_pinnedEvents.push(eventId);
+        }
+        else
+        {
+            worker.m_stealableEvents.push(eventId);
+        }
+        worker.m_wakeUp = true;
+    }
+    worker.m_wakeUpCondition.notify_one();
+
+    if (!isPinned)
+    {
+        // when the home worker is busy an idle worker is woken up to steal the event
+        const uint64_t homeWorkerMask = static_cast<uint64_t>(1U) << homeWorker;
+        const uint64_t idleWorkers = m_idleWorkers.load(std::memory_order_seq_cst);
+        if ((idleWorkers & homeWorkerMask) == 0U && idleWorkers != 0U)
+        {
+            for (uint32_t i = 0U; i < m_numberOfWorkers; ++i)
+            {
+                if ((idleWorkers & (static_cast<uint64_t>(1U) << i)) != 0U)
+                {
+                    wakeUpWorker(i);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+template <uint64_t Capacity>
+inline bool ListenerImpl<Capacity>::popEvent(const uint32_t workerIndex, uint32_t& eventId) noexcept
+{
+    auto& worker = m_workers[workerIndex];
+    std::lock_guard<std::mutex> lock(worker.m_mutex);
+    return worker.m_pinnedEvents.pop(eventId) || worker.m_stealableEvents.pop(eventId);
+}
+
+template <uint64_t Capacity>
+inline bool ListenerImpl<Capacity>::stealEvent(const uint32_t workerIndex, uint32_t& eventId) noexcept
+{
+    for (uint32_t i = 1U; i < m_numberOfWorkers; ++i)
+    {
+        auto& victim = m_workers[(workerIndex + i) % m_numberOfWorkers];
+        std::lock_guard<std::mutex> lock(victim.m_mutex);
+        if (victim.m_stealableEvents.pop(eventId))
+        {
+            return true;
         }
     }
+    return false;
+}
+
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::executeScheduledEvent(const uint32_t eventId) noexcept
+{
+    auto& eventState = m_eventStates[eventId];
+    eventState.exchange(EventState::RUNNING, std::memory_order_acq_rel);
+
+    m_events[eventId]->executeCallback();
+
+    auto state = EventState::RUNNING;
+    if (!eventState.compare_exchange_strong(state, EventState::IDLE, std::memory_order_acq_rel))
+    {
+        // the event was notified while the callback was running; it is queued again instead of executed right away
+        // to not starve the other events of this worker
+        eventState.store(EventState::QUEUED, std::memory_order_relaxed);
+        enqueueEvent(eventId);
+    }
+}
+
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::resetEventState(const uint32_t eventId) noexcept
+{
+    // a pending execution of the detached event would otherwise call the callback of the next event which is attached
+    // with the same index
+    bool wasQueued{false};
+    for (uint32_t i = 0U; i < m_numberOfWorkers; ++i)
+    {
+        auto& worker = m_workers[i];
+        std::lock_guard<std::mutex> lock(worker.m_mutex);
+        wasQueued = worker.m_pinnedEvents.remove(eventId) || wasQueued;
+        wasQueued = worker.m_stealableEvents.remove(eventId) || wasQueued;
+    }
+
+    auto& eventState = m_eventStates[eventId];
+    if (wasQueued)
+    {
+        // the event is queued at most once and no worker can take it anymore
+        eventState.store(EventState::IDLE, std::memory_order_release);
+    }
+    else
+    {
+        // a running execution sets the state to IDLE when it is done
+        auto state = EventState::RUNNING_AND_NOTIFIED;
+        IOX_DISCARD_RESULT(
+            eventState.compare_exchange_strong(state, EventState::RUNNING, std::memory_order_acq_rel));
+    }
+    m_eventWorkers[eventId].store(NO_WORKER, std::memory_order_relaxed);
+}
+
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::wakeUpWorker(const uint32_t workerIndex) noexcept
+{
+    auto& worker = m_workers[workerIndex];
+    {
+        std::lock_guard<std::mutex> lock(worker.m_mutex);
+        worker.m_wakeUp = true;
+    }
+    worker.m_wakeUpCondition.notify_one();
+}
+
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::workerLoop(const uint32_t workerIndex) noexcept
+{
+    auto& worker = m_workers[workerIndex];
+    const uint64_t workerMask = static_cast<uint64_t>(1U) << workerIndex;
+    uint32_t eventId{0U};
+    while (!m_stopWorkers.load(std::memory_order_relaxed))
+    {
+        if (popEvent(workerIndex, eventId) || stealEvent(workerIndex, eventId))
+        {
+            executeScheduledEvent(eventId);
+            continue;
+        }
+
+        // announce the idle worker before the queues are checked a last time; pairs with the load in enqueueEvent
+        m_idleWorkers.fetch_or(workerMask, std::memory_order_seq_cst);
+        if (popEvent(workerIndex, eventId) || stealEvent(workerIndex, eventId))
+        {
+            m_idleWorkers.fetch_and(~workerMask, std::memory_order_relaxed);
+            executeScheduledEvent(eventId);
+            continue;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(worker.m_mutex);
+            worker.m_wakeUpCondition.wait(
+                lock, [&] { return worker.m_wakeUp || m_stopWorkers.load(std::memory_order_relaxed); });
+            worker.m_wakeUp = false;
+        }
+        m_idleWorkers.fetch_and(~workerMask, std::memory_order_relaxed);
+    }
 }
 
 template <uint64_t Capacity>
@@ -179,6 +444,10 @@ inline void ListenerImpl<Capacity>::removeTrigger(const uint64_t index) noexcept
 
     if (m_events[index]->reset())
     {
+        if (m_numberOfWorkers > 0U)
+        {
+            resetEventState(static_cast<uint32_t>(index));
+        }
         m_indexManager.push(static_cast<uint32_t>(index));
     }
 }
@@ -218,6 +487,51 @@ uint64_t ListenerImpl<Capacity>::IndexManager_t::indicesInUse() const noexcept
 /////////////////////
 // END IndexManager_t
 /////////////////////
+
+///////////////////////
+// BEGIN EventQueue_t
+///////////////////////
+template <uint64_t Capacity>
+inline void ListenerImpl<Capacity>::EventQueue_t::push(const uint32_t eventId) noexcept
+{
+    cxx::Expects(m_size < Capacity);
+    m_eventIds[(m_readPosition + m_size) % Capacity] = static_cast<Index_t>(eventId);
+    ++m_size;
+}
+
+template <uint64_t Capacity>
+inline bool ListenerImpl<Capacity>::EventQueue_t::pop(uint32_t& eventId) noexcept
+{
+    if (m_size == 0U)
+    {
+        return false;
+    }
+    eventId = m_eventIds[m_readPosition];
+    m_readPosition = (m_readPosition + 1U) % Capacity;
+    --m_size;
+    return true;
+}
+
+template <uint64_t Capacity>
+inline bool ListenerImpl<Capacity>::EventQueue_t::remove(const uint32_t eventId) noexcept
+{
+    for (uint64_t i = 0U; i < m_size; ++i)
+    {
+        if (m_eventIds[(m_readPosition + i) % Capacity] == static_cast<Index_t>(eventId))
+        {
+            for (uint64_t k = i + 1U; k < m_size; ++k)
+            {
+                m_eventIds[(m_readPosition + k - 1U) % Capacity] = m_eventIds[(m_readPosition + k) % Capacity];
+            }
+            --m_size;
+            return true;
+        }
+    }
+    return false;
+}
+/////////////////////
+// END EventQueue_t
+/////////////////////
 } // namespace popo
 } // namespace iox
 #endif
@@ -46,6 +46,8 @@ struct ClientPortData : public BasePortData
     ClientChunkReceiverData_t m_chunkReceiverData;
     std::atomic_bool m_connectRequested{false};
     std::atomic<ConnectionState> m_connectionState{ConnectionState::NOT_CONNECTED};
+    /// @brief handle of the response queue in the ChunkDistributor of the server, propagated with the connect ACK
+    std::atomic<uint32_t> m_responseQueueHandle{RpcBaseHeader::UNKNOWN_CLIENT_QUEUE_HANDLE};
 };
 
 } // namespace popo
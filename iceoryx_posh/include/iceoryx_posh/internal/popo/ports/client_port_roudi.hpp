@@ -70,6 +70,11 @@ class ClientPortRouDi : public BasePort
     /// @attention Contract is that user process is no more running when cleanup is called
     void releaseAllChunks() noexcept;
 
+    /// @brief checks whether the client might still deliver to the queue of a server
+    /// @param[in] queue of the server
+    /// @return true if the queue must not be destroyed yet, false otherwise
+    bool isChunkQueueReferenced(not_null<const ServerChunkQueueData_t* const> queue) const noexcept;
+
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
@@ -64,6 +64,16 @@ class PublisherPortRouDi : public BasePort
     /// Caution: Contract is that user process is no more running when cleanup is called
     void releaseAllChunks() noexcept;
 
+    /// @brief checks whether the publisher might still deliver to the queue of a subscriber
+    /// @param[in] queue of the subscriber
+    /// @return true if the queue must not be destroyed yet, false otherwise
+    bool isChunkQueueReferenced(not_null<const PublisherPortData::ChunkQueueData_t* const> queue) const noexcept;
+
+    /// @brief removes the queue of a subscriber without an UNSUB, e.g. when the UNSUB of a subscriber which is
+    /// destroyed could not be processed since all queue containers were pinned by senders
+    /// @param[in] queue of the subscriber
+    void removeChunkQueue(not_null<PublisherPortData::ChunkQueueData_t* const> queue) noexcept;
+
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
@@ -25,6 +25,7 @@
 #include "iox/expected.hpp"
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
+#include "iox/span.hpp"
 
 namespace iox
 {
@@ -61,6 +62,22 @@ class PublisherPortUser : public BasePort
                                                                     const uint32_t userHeaderSize = 0U,
                                                                     const uint32_t userHeaderAlignment = 1U) noexcept;
 
+    /// @brief Allocate a batch of chunks with a single mempool operation, the ownership of the SharedChunks remains in
+    /// the PublisherPortUser for being able to cleanup if the user process disappears
+    /// @param[out] chunkHeaders, receives the pointers to the ChunkHeaders; its size is the number of chunks to
+    /// allocate which must not exceed MAX_CHUNKS_PER_PUBLISHER_BATCH
+    /// @param[in] userPayloadSize, size of the user-payload without additional headers
+    /// @param[in] userPayloadAlignment, alignment of the user-payload
+    /// @param[in] userHeaderSize, size of the user-header; use iox::CHUNK_NO_USER_HEADER_SIZE to omit a user-header
+    /// @param[in] userHeaderAlignment, alignment of the user-header; use iox::CHUNK_NO_USER_HEADER_ALIGNMENT
+    /// to omit a user-header
+    /// @return success if all chunks were allocated, error if not; in case of an error no chunk is allocated
+    expected<void, AllocationError> tryAllocateChunks(const span<mepoo::ChunkHeader*> chunkHeaders,
+                                                      const uint32_t userPayloadSize,
+                                                      const uint32_t userPayloadAlignment,
+                                                      const uint32_t userHeaderSize = 0U,
+                                                      const uint32_t userHeaderAlignment = 1U) noexcept;
+
     /// @brief Free an allocated chunk without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to free
     void releaseChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -69,6 +86,10 @@ class PublisherPortUser : public BasePort
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send
     void sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send a batch of allocated chunks to all connected subscriber ports with a single delivery pass
+    /// @param[in] chunkHeaders, pointers to the ChunkHeaders to send
+    void sendChunks(const span<mepoo::ChunkHeader* const> chunkHeaders) noexcept;
+
     /// @brief Returns the last sent chunk if there is one
     /// @return pointer to the ChunkHeader of the last sent Chunk if there is one, empty optional if not
     optional<const mepoo::ChunkHeader*> tryGetPreviousChunk() const noexcept;
@@ -87,6 +108,15 @@ class PublisherPortUser : public BasePort
     /// @return true if there are subscribers otherwise false
     bool hasSubscribers() const noexcept;
 
+    /// @brief Returns the statistics about the time the publisher was blocked by subscribers which are too slow
+    /// @return the BlockedTimeStatistics; only a publisher with ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER is blocked
+    BlockedTimeStatistics getBlockedTimeStatistics() const noexcept;
+
+    /// @brief Sets a process local helper thread which delivers broadcasted chunks in parallel to the sending thread
+    /// @param[in] deliveryHelper is the helper or nullptr to deliver with the sending thread only; it must outlive
+    /// every send call
+    void setDeliveryHelper(DeliveryHelper* const deliveryHelper) noexcept;
+
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
@@ -67,6 +67,11 @@ class ServerPortRouDi : public BasePort
     /// Caution: Contract is that user process is no more running when cleanup is called
     void releaseAllChunks() noexcept;
 
+    /// @brief checks whether the server might still deliver to the queue of a client
+    /// @param[in] queue of the client
+    /// @return true if the queue must not be destroyed yet, false otherwise
+    bool isChunkQueueReferenced(not_null<const ClientChunkQueueData_t* const> queue) const noexcept;
+
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
@@ -64,6 +64,11 @@ class SubscriberPortRouDi : public BasePort
     /// Caution: Contract is that user process is no more running when cleanup is called
     void releaseAllChunks() noexcept;
 
+    /// @brief checks whether the subscriber might still read from the chunk ring of a publisher
+    /// @param[in] chunkRing of the publisher
+    /// @return true if the chunk ring must not be destroyed yet, false otherwise
+    bool isChunkRingReferenced(const ChunkRingData& chunkRing) const noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
@@ -22,7 +22,9 @@
 #include "iceoryx_posh/internal/popo/publisher_interface.hpp"
 #include "iceoryx_posh/internal/popo/typed_port_api_trait.hpp"
 #include "iceoryx_posh/popo/sample.hpp"
+#include "iox/span.hpp"
 #include "iox/type_traits.hpp"
+#include "iox/vector.hpp"
 
 namespace iox
 {
@@ -37,8 +39,12 @@ class PublisherImpl : public BasePublisherType, private PublisherInterface<T, H>
     using HeaderTypeAssert = typename TypedPortApiTrait<H>::Assert;
 
   public:
+    using SampleBatch_t = vector<Sample<T, H>, MAX_CHUNKS_PER_PUBLISHER_BATCH>;
+
     explicit PublisherImpl(const capro::ServiceDescription& service,
                            const PublisherOptions& publisherOptions = PublisherOptions());
+    /// @brief creates the publisher with a port which was created in advance, e.g. by a runtime::PortBatch
+    explicit PublisherImpl(const runtime::PreparedPublisher& preparedPublisher) noexcept;
     PublisherImpl(const PublisherImpl& other) = delete;
     PublisherImpl& operator=(const PublisherImpl&) = delete;
     PublisherImpl(PublisherImpl&& rhs) = delete;
@@ -61,6 +67,25 @@ class PublisherImpl : public BasePublisherType, private PublisherInterface<T, H>
     ///
     void publish(Sample<T, H>&& sample) noexcept override;
 
+    ///
+    /// @brief loanBatch Get multiple samples from loaned shared memory and default construct their data.
+    /// @param numberOfSamples The number of samples to loan; at most MAX_CHUNKS_PER_PUBLISHER_BATCH. The samples of a
+    /// batch are loaned in addition to the MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY samples of loan.
+    /// @return The loaned samples or an error if not all of them could be loaned. In case of an error no sample is
+    /// loaned.
+    /// @note The chunks of all samples are taken from the mempool with a single operation, see
+    /// UntypedPublisherImpl::loanBatch.
+    ///
+    expected<SampleBatch_t, AllocationError> loanBatch(const uint32_t numberOfSamples) noexcept;
+
+    ///
+    /// @brief publishBatch Publishes the given samples and then releases their loans. The samples are delivered to the
+    /// subscribers in a single pass and each subscriber is notified only once. More than
+    /// MAX_CHUNKS_PER_PUBLISHER_BATCH samples are delivered in several passes.
+    /// @param samples The samples to publish; they are empty afterwards.
+    ///
+    void publishBatch(span<Sample<T, H>> samples) noexcept;
+
     ///
     /// @brief publishCopyOf Copy the provided value into a loaned shared memory chunk and publish it.
     /// @param val Value to copy.
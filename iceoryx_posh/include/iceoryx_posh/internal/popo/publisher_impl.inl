@@ -34,6 +34,13 @@ inline PublisherImpl<T, H, BasePublisherType>::PublisherImpl(const capro::Servic
 {
 }
 
+template <typename T, typename H, typename BasePublisherType>
+inline PublisherImpl<T, H, BasePublisherType>::PublisherImpl(
+    const runtime::PreparedPublisher& preparedPublisher) noexcept
+    : BasePublisherType(preparedPublisher)
+{
+}
+
 template <typename T, typename H, typename BasePublisherType>
 template <typename... Args>
 inline expected<Sample<T, H>, AllocationError> PublisherImpl<T, H, BasePublisherType>::loan(Args&&... args) noexcept
@@ -92,6 +99,62 @@ inline void PublisherImpl<T, H, BasePublisherType>::publish(Sample<T, H>&& sampl
     port().sendChunk(chunkHeader);
 }
 
+template <typename T, typename H, typename BasePublisherType>
+inline expected<typename PublisherImpl<T, H, BasePublisherType>::SampleBatch_t, AllocationError>
+PublisherImpl<T, H, BasePublisherType>::loanBatch(const uint32_t numberOfSamples) noexcept
+{
+    static constexpr uint32_t USER_HEADER_SIZE{std::is_same<H, mepoo::NoUserHeader>::value ? 0U : sizeof(H)};
+
+    SampleBatch_t samples;
+    if (numberOfSamples > samples.capacity())
+    {
+        return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+    }
+
+    vector<mepoo::ChunkHeader*, MAX_CHUNKS_PER_PUBLISHER_BATCH> chunkHeaders(numberOfSamples);
+    auto result = port().tryAllocateChunks(span<mepoo::ChunkHeader*>(chunkHeaders.data(), chunkHeaders.size()),
+                                           sizeof(T),
+                                           alignof(T),
+                                           USER_HEADER_SIZE,
+                                           alignof(H));
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+
+    for (auto chunkHeader : chunkHeaders)
+    {
+        new (chunkHeader->userPayload()) T();
+        samples.emplace_back(convertChunkHeaderToSample(chunkHeader));
+    }
+
+    return ok(std::move(samples));
+}
+
+template <typename T, typename H, typename BasePublisherType>
+inline void PublisherImpl<T, H, BasePublisherType>::publishBatch(span<Sample<T, H>> samples) noexcept
+{
+    vector<mepoo::ChunkHeader*, MAX_CHUNKS_PER_PUBLISHER_BATCH> chunkHeaders;
+    for (uint64_t i = 0U; i < samples.size(); ++i)
+    {
+        if (samples[i])
+        {
+            // a batch which exceeds the capacity is sent in several parts, otherwise the remaining chunks would be lost
+            if (chunkHeaders.size() == chunkHeaders.capacity())
+            {
+                port().sendChunks(span<mepoo::ChunkHeader* const>(chunkHeaders.data(), chunkHeaders.size()));
+                chunkHeaders.clear();
+            }
+            auto userPayload = samples[i].release(); // release the Samples ownership of the chunk before publishing
+            chunkHeaders.push_back(mepoo::ChunkHeader::fromUserPayload(userPayload));
+        }
+    }
+    if (!chunkHeaders.empty())
+    {
+        port().sendChunks(span<mepoo::ChunkHeader* const>(chunkHeaders.data(), chunkHeaders.size()));
+    }
+}
+
 template <typename T, typename H, typename BasePublisherType>
 inline Sample<T, H>
 PublisherImpl<T, H, BasePublisherType>::convertChunkHeaderToSample(mepoo::ChunkHeader* const header) noexcept
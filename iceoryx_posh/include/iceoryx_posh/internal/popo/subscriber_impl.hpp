@@ -38,6 +38,8 @@ class SubscriberImpl : public BaseSubscriberType
   public:
     explicit SubscriberImpl(const capro::ServiceDescription& service,
                             const SubscriberOptions& subscriberOptions = SubscriberOptions()) noexcept;
+    /// @brief creates the subscriber with a port which was created in advance, e.g. by a runtime::PortBatch
+    explicit SubscriberImpl(const runtime::PreparedSubscriber& preparedSubscriber) noexcept;
     SubscriberImpl(const SubscriberImpl& other) = delete;
     SubscriberImpl& operator=(const SubscriberImpl&) = delete;
     SubscriberImpl(SubscriberImpl&& rhs) = delete;
@@ -31,6 +31,13 @@ inline SubscriberImpl<T, H, BaseSubscriberType>::SubscriberImpl(const capro::Ser
 {
 }
 
+template <typename T, typename H, typename BaseSubscriberType>
+inline SubscriberImpl<T, H, BaseSubscriberType>::SubscriberImpl(
+    const runtime::PreparedSubscriber& preparedSubscriber) noexcept
+    : BaseSubscriberType(preparedSubscriber)
+{
+}
+
 template <typename T, typename H, typename BaseSubscriberType>
 inline expected<Sample<const T, const H>, ChunkReceiveResult> SubscriberImpl<T, H, BaseSubscriberType>::take() noexcept
 {
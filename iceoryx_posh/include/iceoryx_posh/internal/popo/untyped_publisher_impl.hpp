@@ -18,8 +18,12 @@
 #ifndef IOX_POSH_POPO_UNTYPED_PUBLISHER_IMPL_HPP
 #define IOX_POSH_POPO_UNTYPED_PUBLISHER_IMPL_HPP
 
+#include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/internal/popo/base_publisher.hpp"
 #include "iceoryx_posh/popo/sample.hpp"
+#include "iox/logging.hpp"
+#include "iox/span.hpp"
+#include "iox/vector.hpp"
 
 namespace iox
 {
@@ -31,8 +35,12 @@ template <typename BasePublisherType = BasePublisher<>>
 class UntypedPublisherImpl : public BasePublisherType
 {
   public:
+    using UserPayloadBatch_t = vector<void*, MAX_CHUNKS_PER_PUBLISHER_BATCH>;
+
     explicit UntypedPublisherImpl(const capro::ServiceDescription& service,
                                   const PublisherOptions& publisherOptions = PublisherOptions());
+    /// @brief creates the publisher with a port which was created in advance, e.g. by a runtime::PortBatch
+    explicit UntypedPublisherImpl(const runtime::PreparedPublisher& preparedPublisher) noexcept;
     UntypedPublisherImpl(const UntypedPublisherImpl& other) = delete;
     UntypedPublisherImpl& operator=(const UntypedPublisherImpl&) = delete;
     UntypedPublisherImpl(UntypedPublisherImpl&& rhs) = delete;
@@ -60,6 +68,35 @@ class UntypedPublisherImpl : public BasePublisherType
     ///
     void publish(void* const userPayload) noexcept;
 
+    ///
+    /// @brief Get multiple chunks with the same layout from loaned shared memory. The chunks are taken from the
+    ///        mempool with a single operation.
+    /// @param numberOfChunks The number of chunks to loan; at most MAX_CHUNKS_PER_PUBLISHER_BATCH. The chunks of a
+    ///        batch are loaned in addition to the MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY chunks of loan.
+    /// @param usePayloadSize The expected user-payload size of the chunks.
+    /// @param userPayloadAlignment The expected user-payload alignment of the chunks.
+    /// @return The pointers to the user-payloads of the loaned chunks or an AllocationError if not all of them could
+    ///         be loaned. In case of an error no chunk is loaned.
+    /// @note MAX_CHUNKS_PER_PUBLISHER_BATCH is 256 by default and can be changed with the
+    ///       IOX_MAX_CHUNKS_PER_PUBLISHER_BATCH build option. A batch fails if the already loaned chunks together with
+    ///       the batch exceed the sum of both limits.
+    ///
+    expected<UserPayloadBatch_t, AllocationError>
+    loanBatch(const uint32_t numberOfChunks,
+              const uint32_t userPayloadSize,
+              const uint32_t userPayloadAlignment = iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+              const uint32_t userHeaderSize = iox::CHUNK_NO_USER_HEADER_SIZE,
+              const uint32_t userHeaderAlignment = iox::CHUNK_NO_USER_HEADER_ALIGNMENT) noexcept;
+
+    ///
+    /// @brief Publish the provided memory chunks. The chunks are delivered to the subscribers in a single pass and each
+    ///        subscriber is notified only once. More than MAX_CHUNKS_PER_PUBLISHER_BATCH chunks are
+    ///        delivered in several passes.
+    /// @param userPayloads Pointers to the user-payloads of the allocated shared memory chunks; a nullptr is reported
+    ///        to the error handler and skipped.
+    ///
+    void publishBatch(const span<void* const> userPayloads) noexcept;
+
     ///
     /// @brief Releases the ownership of the chunk provided by the user-payload pointer.
     /// @param userPayload pointer to the user-payload of the chunk to be released
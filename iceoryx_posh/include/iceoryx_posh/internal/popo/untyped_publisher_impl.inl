@@ -31,6 +31,13 @@ inline UntypedPublisherImpl<BasePublisherType>::UntypedPublisherImpl(const capro
 {
 }
 
+template <typename BasePublisherType>
+inline UntypedPublisherImpl<BasePublisherType>::UntypedPublisherImpl(
+    const runtime::PreparedPublisher& preparedPublisher) noexcept
+    : BasePublisherType(preparedPublisher)
+{
+}
+
 template <typename BasePublisherType>
 inline void UntypedPublisherImpl<BasePublisherType>::publish(void* const userPayload) noexcept
 {
@@ -56,6 +63,66 @@ UntypedPublisherImpl<BasePublisherType>::loan(const uint32_t userPayloadSize,
     }
 }
 
+template <typename BasePublisherType>
+inline expected<typename UntypedPublisherImpl<BasePublisherType>::UserPayloadBatch_t, AllocationError>
+UntypedPublisherImpl<BasePublisherType>::loanBatch(const uint32_t numberOfChunks,
+                                                   const uint32_t userPayloadSize,
+                                                   const uint32_t userPayloadAlignment,
+                                                   const uint32_t userHeaderSize,
+                                                   const uint32_t userHeaderAlignment) noexcept
+{
+    UserPayloadBatch_t userPayloads;
+    if (numberOfChunks > userPayloads.capacity())
+    {
+        return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+    }
+
+    vector<mepoo::ChunkHeader*, MAX_CHUNKS_PER_PUBLISHER_BATCH> chunkHeaders(numberOfChunks);
+    auto result = port().tryAllocateChunks(span<mepoo::ChunkHeader*>(chunkHeaders.data(), chunkHeaders.size()),
+                                           userPayloadSize,
+                                           userPayloadAlignment,
+                                           userHeaderSize,
+                                           userHeaderAlignment);
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+
+    for (auto chunkHeader : chunkHeaders)
+    {
+        userPayloads.push_back(chunkHeader->userPayload());
+    }
+
+    return ok(userPayloads);
+}
+
+template <typename BasePublisherType>
+inline void UntypedPublisherImpl<BasePublisherType>::publishBatch(const span<void* const> userPayloads) noexcept
+{
+    vector<mepoo::ChunkHeader*, MAX_CHUNKS_PER_PUBLISHER_BATCH> chunkHeaders;
+    for (uint64_t i = 0U; i < userPayloads.size(); ++i)
+    {
+        if (userPayloads[i] == nullptr)
+        {
+            IOX_LOG(ERROR) << "Trying to publish a nullptr in a batch of " << userPayloads.size() << " chunks";
+            errorHandler(PoshError::POPO__CHUNK_SENDER_INVALID_CHUNK_TO_SEND_FROM_USER, ErrorLevel::SEVERE);
+            continue;
+        }
+
+        // a batch which exceeds the capacity is sent in several parts, otherwise the remaining chunks would be lost
+        if (chunkHeaders.size() == chunkHeaders.capacity())
+        {
+            port().sendChunks(span<mepoo::ChunkHeader* const>(chunkHeaders.data(), chunkHeaders.size()));
+            chunkHeaders.clear();
+        }
+        chunkHeaders.push_back(mepoo::ChunkHeader::fromUserPayload(userPayloads[i]));
+    }
+    if (!chunkHeaders.empty())
+    {
+        port().sendChunks(span<mepoo::ChunkHeader* const>(chunkHeaders.data(), chunkHeaders.size()));
+    }
+}
+
 template <typename BasePublisherType>
 inline void UntypedPublisherImpl<BasePublisherType>::release(void* const userPayload) noexcept
 {
@@ -43,6 +43,8 @@ class UntypedSubscriberImpl : public BaseSubscriberType
 
     explicit UntypedSubscriberImpl(const capro::ServiceDescription& service,
                                    const SubscriberOptions& subscriberOptions = SubscriberOptions());
+    /// @brief creates the subscriber with a port which was created in advance, e.g. by a runtime::PortBatch
+    explicit UntypedSubscriberImpl(const runtime::PreparedSubscriber& preparedSubscriber) noexcept;
     UntypedSubscriberImpl(const UntypedSubscriberImpl& other) = delete;
     UntypedSubscriberImpl& operator=(const UntypedSubscriberImpl&) = delete;
     UntypedSubscriberImpl(UntypedSubscriberImpl&& rhs) = delete;
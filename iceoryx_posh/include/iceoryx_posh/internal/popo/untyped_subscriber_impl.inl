@@ -31,6 +31,13 @@ inline UntypedSubscriberImpl<BaseSubscriberType>::UntypedSubscriberImpl(const ca
 {
 }
 
+template <typename BaseSubscriberType>
+inline UntypedSubscriberImpl<BaseSubscriberType>::UntypedSubscriberImpl(
+    const runtime::PreparedSubscriber& preparedSubscriber) noexcept
+    : BaseSubscriber(preparedSubscriber)
+{
+}
+
 template <typename BaseSubscriberType>
 inline expected<const void*, ChunkReceiveResult> UntypedSubscriberImpl<BaseSubscriberType>::take() noexcept
 {
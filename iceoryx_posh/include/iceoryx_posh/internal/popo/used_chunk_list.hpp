@@ -28,6 +28,20 @@ namespace iox
 {
 namespace popo
 {
+namespace internal
+{
+/// @brief Returns the smallest power of two which keeps the load factor of the hash index at or below 0.75
+constexpr uint32_t usedChunkListHashIndexCapacity(const uint32_t capacity) noexcept
+{
+    uint32_t hashIndexCapacity{1U};
+    while (hashIndexCapacity < capacity + capacity / 3U + 1U)
+    {
+        hashIndexCapacity <<= 1U;
+    }
+    return hashIndexCapacity;
+}
+} // namespace internal
+
 /// @brief This class is used to keep track of the chunks currently in use by the application.
 ///        In case the application terminates while holding chunks, this list is used by RouDi to retain ownership of
 ///        the chunks and prevent a chunk leak.
@@ -38,6 +52,9 @@ namespace popo
 ///        accessed. Additionally, the type stored is this array must be less or equal to 64 bit in order to write it
 ///        within one clock cycle to prevent torn writes, which would corrupt the list and could potentially crash
 ///        RouDi.
+///        The slot of a chunk is found with a hash index over the ChunkHeader pointer which makes the removal
+///        independent of the number of used chunks. The hash index is only used by the application and not needed for
+///        the cleanup, therefore it does not matter if it is inconsistent after the application died.
 template <uint32_t Capacity>
 class UsedChunkList
 {
@@ -65,21 +82,38 @@ class UsedChunkList
     /// still running.
     void cleanup() noexcept;
 
+    /// @brief Returns the number of chunks in the list
+    /// @return the number of chunks which are currently stored
+    /// @note only from runtime context
+    uint32_t size() const noexcept;
+
   private:
     void init() noexcept;
 
+    uint32_t hashIndexPosition(const mepoo::ChunkHeader* chunkHeader) const noexcept;
+    void insertIntoHashIndex(const uint32_t slot, const mepoo::ChunkHeader* chunkHeader) noexcept;
+    void removeFromHashIndex(uint32_t position) noexcept;
+
   private:
     static constexpr uint32_t INVALID_INDEX{Capacity};
+    static constexpr uint32_t HASH_INDEX_CAPACITY{internal::usedChunkListHashIndexCapacity(Capacity)};
 
     using DataElement_t = mepoo::ShmSafeUnmanagedChunk;
     static constexpr DataElement_t DATA_ELEMENT_LOGICAL_NULLPTR{};
 
   private:
+    /// @note every insert and remove ends with a release on the synchronizer which pairs with the acquire in
+    ///       cleanup(). A fence in cleanup() alone cannot replace it (iox-#623): a fence only synchronizes with a
+    ///       release operation of the application, and without one the compiler and the CPU of the application
+    ///       may keep or reorder the stores to the list. Neither can it be assumed that all stores of the
+    ///       application were issued when RouDi cleans up, since RouDi also cleans up after a monitoring timeout
+    ///       where the application may still be running.
     std::atomic_flag m_synchronizer = ATOMIC_FLAG_INIT;
-    uint32_t m_usedListHead{INVALID_INDEX};
     uint32_t m_freeListHead{0u};
+    uint32_t m_size{0U};
     uint32_t m_listIndices[Capacity];
     DataElement_t m_listData[Capacity];
+    uint32_t m_hashIndex[HASH_INDEX_CAPACITY];
 };
 
 } // namespace popo
@@ -35,25 +35,31 @@ UsedChunkList<Capacity>::UsedChunkList() noexcept
     init();
 }
 
+template <uint32_t Capacity>
+constexpr uint32_t UsedChunkList<Capacity>::INVALID_INDEX;
+
+template <uint32_t Capacity>
+constexpr uint32_t UsedChunkList<Capacity>::HASH_INDEX_CAPACITY;
+
 template <uint32_t Capacity>
 bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
 {
     auto hasFreeSpace = m_freeListHead != INVALID_INDEX;
     if (hasFreeSpace)
     {
-        // get next free entry after freelistHead
-        auto nextFree = m_listIndices[m_freeListHead];
+        const auto slot = m_freeListHead;
+        const auto chunkHeader = chunk.getChunkHeader();
 
-        // freeListHead is getting new usedListHead, next of this entry is updated to next in usedList
-        m_listIndices[m_freeListHead] = m_usedListHead;
-        m_usedListHead = m_freeListHead;
+        // set freeListHead to the next free entry
+        m_freeListHead = m_listIndices[slot];
+        m_listIndices[slot] = INVALID_INDEX;
 
-        m_listData[m_usedListHead] = DataElement_t(chunk);
+        m_listData[slot] = DataElement_t(chunk);
 
-        // set freeListHead to the next free entry
-        m_freeListHead = nextFree;
+        insertIntoHashIndex(slot, chunkHeader);
+        ++m_size;
 
-        /// @todo iox-#623 can we do this cheaper with a global fence in cleanup?
+        // pairs with the acquire in cleanup(); the release cannot be replaced by a fence, see m_synchronizer
         m_synchronizer.clear(std::memory_order_release);
         return true;
     }
@@ -66,38 +72,26 @@ bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
 template <uint32_t Capacity>
 bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk) noexcept
 {
-    auto previous = INVALID_INDEX;
-
-    // go through usedList with stored chunks
-    for (auto current = m_usedListHead; current != INVALID_INDEX; current = m_listIndices[current])
+    for (auto position = hashIndexPosition(chunkHeader); m_hashIndex[position] != INVALID_INDEX;
+         position = (position + 1U) & (HASH_INDEX_CAPACITY - 1U))
     {
-        if (!m_listData[current].isLogicalNullptr())
+        const auto slot = m_hashIndex[position];
+        // does the entry match the one we want to remove?
+        if (m_listData[slot].getChunkHeader() == chunkHeader)
         {
-            // does the entry match the one we want to remove?
-            if (m_listData[current].getChunkHeader() == chunkHeader)
-            {
-                chunk = m_listData[current].releaseToSharedChunk();
-
-                // remove index from used list
-                if (current == m_usedListHead)
-                {
-                    m_usedListHead = m_listIndices[current];
-                }
-                else
-                {
-                    m_listIndices[previous] = m_listIndices[current];
-                }
-
-                // insert index to free list
-                m_listIndices[current] = m_freeListHead;
-                m_freeListHead = current;
-
-                /// @todo iox-#623 can we do this cheaper with a global fence in cleanup?
-                m_synchronizer.clear(std::memory_order_release);
-                return true;
-            }
+            chunk = m_listData[slot].releaseToSharedChunk();
+
+            removeFromHashIndex(position);
+
+            // insert index to free list
+            m_listIndices[slot] = m_freeListHead;
+            m_freeListHead = slot;
+            --m_size;
+
+            // pairs with the acquire in cleanup(); the release cannot be replaced by a fence, see m_synchronizer
+            m_synchronizer.clear(std::memory_order_release);
+            return true;
         }
-        previous = current;
     }
     return false;
 }
@@ -119,6 +113,12 @@ void UsedChunkList<Capacity>::cleanup() noexcept
     init(); // just to save us from the future self
 }
 
+template <uint32_t Capacity>
+uint32_t UsedChunkList<Capacity>::size() const noexcept
+{
+    return m_size;
+}
+
 template <uint32_t Capacity>
 void UsedChunkList<Capacity>::init() noexcept
 {
@@ -137,9 +137,13 @@ void UsedChunkList<Capacity>::init() noexcept
         m_listIndices[0U] = INVALID_INDEX;
     }
 
-
-    m_usedListHead = INVALID_INDEX;
     m_freeListHead = 0U;
+    m_size = 0U;
+
+    for (auto& slot : m_hashIndex)
+    {
+        slot = INVALID_INDEX;
+    }
 
     // clear data
     for (auto& data : m_listData)
@@ -150,6 +154,51 @@ void UsedChunkList<Capacity>::init() noexcept
     m_synchronizer.clear(std::memory_order_release);
 }
 
+template <uint32_t Capacity>
+uint32_t UsedChunkList<Capacity>::hashIndexPosition(const mepoo::ChunkHeader* chunkHeader) const noexcept
+{
+    // Fibonacci hashing; the chunk headers are at least 8 byte aligned and the lower bits do not carry information
+    constexpr uint64_t FIBONACCI_MULTIPLIER{11400714819323198485ULL};
+    constexpr uint64_t ALIGNMENT_BITS{3U};
+    // AXIVION Next Construct AutosarC++19_03-M5.2.9 : the address is only used to compute the hash
+    const auto address = reinterpret_cast<uint64_t>(chunkHeader);
+    return static_cast<uint32_t>(((address >> ALIGNMENT_BITS) * FIBONACCI_MULTIPLIER) >> 32U)
+           & (HASH_INDEX_CAPACITY - 1U);
+}
+
+template <uint32_t Capacity>
+void UsedChunkList<Capacity>::insertIntoHashIndex(const uint32_t slot, const mepoo::ChunkHeader* chunkHeader) noexcept
+{
+    // the hash index has more positions than the list has slots, hence there is always a free position
+    auto position = hashIndexPosition(chunkHeader);
+    while (m_hashIndex[position] != INVALID_INDEX)
+    {
+        position = (position + 1U) & (HASH_INDEX_CAPACITY - 1U);
+    }
+    m_hashIndex[position] = slot;
+}
+
+template <uint32_t Capacity>
+void UsedChunkList<Capacity>::removeFromHashIndex(uint32_t position) noexcept
+{
+    // backward shift deletion; entries which were displaced beyond the removed position are moved back so that the
+    // probing of the remaining entries does not end at the new gap
+    auto next = (position + 1U) & (HASH_INDEX_CAPACITY - 1U);
+    while (m_hashIndex[next] != INVALID_INDEX)
+    {
+        const auto home = hashIndexPosition(m_listData[m_hashIndex[next]].getChunkHeader());
+        const auto distanceToNext = (next - home) & (HASH_INDEX_CAPACITY - 1U);
+        const auto distanceToGap = (position - home) & (HASH_INDEX_CAPACITY - 1U);
+        if (distanceToGap < distanceToNext)
+        {
+            m_hashIndex[position] = m_hashIndex[next];
+            position = next;
+        }
+        next = (next + 1U) & (HASH_INDEX_CAPACITY - 1U);
+    }
+    m_hashIndex[position] = INVALID_INDEX;
+}
+
 } // namespace popo
 } // namespace iox
 
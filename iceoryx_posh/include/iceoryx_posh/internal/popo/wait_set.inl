@@ -93,6 +93,7 @@ inline WaitSet<Capacity>::~WaitSet() noexcept
 {
     removeAllTriggers();
     m_conditionVariableDataPtr->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+    m_conditionVariableDataPtr->m_discoveryNotifier.notify();
 }
 
 template <uint64_t Capacity>
@@ -173,7 +174,10 @@ WaitSet<Capacity>::attachEvent(T& eventOrigin,
         .and_then([&](auto& uniqueId) {
             NotificationAttorney::enableEvent(
                 eventOrigin,
-                TriggerHandle(*m_conditionVariableDataPtr, {*this, &WaitSet::removeTrigger}, uniqueId),
+                TriggerHandle(*m_conditionVariableDataPtr,
+                              {*this, &WaitSet::removeTrigger},
+                              uniqueId,
+                              &m_conditionListener.getTimerWheel()),
                 eventType);
         });
 }
@@ -199,7 +203,11 @@ inline expected<void, WaitSetError> WaitSet<Capacity>::attachEvent(
                       typeid(NoEventEnumUsed).hash_code())
         .and_then([&](auto& uniqueId) {
             NotificationAttorney::enableEvent(
-                eventOrigin, TriggerHandle(*m_conditionVariableDataPtr, {*this, &WaitSet::removeTrigger}, uniqueId));
+                eventOrigin,
+                TriggerHandle(*m_conditionVariableDataPtr,
+                              {*this, &WaitSet::removeTrigger},
+                              uniqueId,
+                              &m_conditionListener.getTimerWheel()));
         });
 }
 
@@ -231,7 +239,10 @@ WaitSet<Capacity>::attachState(T& stateOrigin,
         .and_then([&](auto& uniqueId) {
             NotificationAttorney::enableState(
                 stateOrigin,
-                TriggerHandle(*m_conditionVariableDataPtr, {*this, &WaitSet::removeTrigger}, uniqueId),
+                TriggerHandle(*m_conditionVariableDataPtr,
+                              {*this, &WaitSet::removeTrigger},
+                              uniqueId,
+                              &m_conditionListener.getTimerWheel()),
                 stateType);
 
             auto& trigger = m_triggerArray[uniqueId];
@@ -264,7 +275,11 @@ inline expected<void, WaitSetError> WaitSet<Capacity>::attachState(
                       typeid(NoStateEnumUsed).hash_code())
         .and_then([&](auto& uniqueId) {
             NotificationAttorney::enableState(
-                stateOrigin, TriggerHandle(*m_conditionVariableDataPtr, {*this, &WaitSet::removeTrigger}, uniqueId));
+                stateOrigin,
+                TriggerHandle(*m_conditionVariableDataPtr,
+                              {*this, &WaitSet::removeTrigger},
+                              uniqueId,
+                              &m_conditionListener.getTimerWheel()));
 
             auto& trigger = m_triggerArray[uniqueId];
             if (trigger->isStateConditionSatisfied())
@@ -333,6 +348,12 @@ inline typename WaitSet<Capacity>::NotificationInfoVector WaitSet<Capacity>::wai
     return waitAndReturnTriggeredTriggers([this] { return this->m_conditionListener.wait(); });
 }
 
+template <uint64_t Capacity>
+inline void WaitSet<Capacity>::setSpinDuration(const units::Duration spinDuration) noexcept
+{
+    m_conditionListener.setSpinDuration(spinDuration);
+}
+
 template <uint64_t Capacity>
 inline typename WaitSet<Capacity>::NotificationInfoVector
 WaitSet<Capacity>::createVectorWithTriggeredTriggers() noexcept
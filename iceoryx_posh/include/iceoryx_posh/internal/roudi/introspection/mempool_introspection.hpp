@@ -82,8 +82,9 @@ class MemPoolIntrospection
                                            const posix::PosixGroup& writerGroup,
                                            uint32_t id) noexcept;
 
-    /// @brief copy data fro internal struct into interface struct
-    void copyMemPoolInfo(const MemoryManager& memoryManager, MemPoolInfoContainer& dest) noexcept;
+    /// @brief copy data fro internal struct into interface struct; the error counters of the memory manager are
+    /// aggregated over all processes since they reside in the shared memory
+    void copyMemPoolInfo(const MemoryManager& memoryManager, MemPoolIntrospectionInfo& dest) noexcept;
 
   private:
     units::Duration m_sendInterval{units::Duration::fromSeconds(1U)};
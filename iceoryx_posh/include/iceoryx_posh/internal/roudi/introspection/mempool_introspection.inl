@@ -108,7 +108,7 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
                                        posix::PosixGroup::getGroupOfCurrentProcess(),
                                        posix::PosixGroup::getGroupOfCurrentProcess(),
                                        id);
-            copyMemPoolInfo(*m_rouDiInternalMemoryManager, memPoolIntrospectionInfo.m_mempoolInfo);
+            copyMemPoolInfo(*m_rouDiInternalMemoryManager, memPoolIntrospectionInfo);
             ++id;
 
             // User shm segments
@@ -119,7 +119,7 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
                     auto& memPoolIntrospectionInfo = sample->back();
                     prepareIntrospectionSample(
                         memPoolIntrospectionInfo, segment.getReaderGroup(), segment.getWriterGroup(), id);
-                    copyMemPoolInfo(segment.getMemoryManager(), memPoolIntrospectionInfo.m_mempoolInfo);
+                    copyMemPoolInfo(segment.getMemoryManager(), memPoolIntrospectionInfo);
                 }
                 else
                 {
@@ -149,19 +149,25 @@ inline void MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::
 template <typename MemoryManager, typename SegmentManager, typename PublisherPort>
 inline void
 MemPoolIntrospection<MemoryManager, SegmentManager, PublisherPort>::copyMemPoolInfo(const MemoryManager& memoryManager,
-                                                                                    MemPoolInfoContainer& dest) noexcept
+                                                                                    MemPoolIntrospectionInfo& dest) noexcept
 {
+    dest.m_numberOfChunkTooLargeErrors =
+        memoryManager.getNumberOfErrors(mepoo::MemoryManager::Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE);
+    dest.m_numberOfOutOfChunksErrors =
+        memoryManager.getNumberOfErrors(mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS);
+
     auto numOfMemPools = memoryManager.getNumberOfMemPools();
-    dest = MemPoolInfoContainer(numOfMemPools, MemPoolInfo());
+    dest.m_mempoolInfo = MemPoolInfoContainer(numOfMemPools, MemPoolInfo());
     for (uint32_t i = 0U; i < numOfMemPools; ++i)
     {
         auto src = memoryManager.getMemPoolInfo(i);
-        auto& dst = dest[i];
+        auto& dst = dest.m_mempoolInfo[i];
         dst.m_usedChunks = src.m_usedChunks;
         dst.m_minFreeChunks = src.m_minFreeChunks;
         dst.m_numChunks = src.m_numChunks;
         dst.m_chunkSize = src.m_chunkSize;
         dst.m_chunkPayloadSize = src.m_chunkSize - static_cast<uint32_t>(sizeof(mepoo::ChunkHeader));
+        dst.m_failedAllocations = src.m_failedAllocations;
     }
 }
 
@@ -35,6 +35,7 @@
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
 #include "iceoryx_posh/internal/roudi/introspection/port_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iceoryx_posh/internal/runtime/control_channel_data.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
@@ -52,6 +53,10 @@ namespace roudi
 {
 capro::Interfaces StringToCaProInterface(const capro::IdString_t& str) noexcept;
 
+/// @brief Creates the ports, nodes and condition variables in the port pool and connects the ports
+/// @note The acquire methods can be called concurrently; the construction in the port pool is done without a lock and
+/// only the bookkeeping and the discovery of the new ports are serialized. All other methods must not be called
+/// concurrently with any other method.
 class PortManager
 {
   public:
@@ -63,8 +68,17 @@ class PortManager
     /// @todo iox-#518 Remove this later
     void stopPortIntrospection() noexcept;
 
+    /// @brief Processes the requests of all ports, nodes and condition variables
     void doDiscovery() noexcept;
 
+    /// @brief Processes only the requests of the ports, nodes and condition variables which notified the discovery
+    /// condition variable since the last call
+    void doDiscoveryForPendingRequests() noexcept;
+
+    /// @brief Returns the condition variable which is notified whenever a port, node or condition variable has a
+    /// request for the discovery
+    popo::ConditionVariableData& getDiscoveryConditionVariableData() noexcept;
+
     expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     acquirePublisherPortData(const capro::ServiceDescription& service,
                              const popo::PublisherOptions& publisherOptions,
@@ -121,6 +135,9 @@ class PortManager
     expected<popo::ConditionVariableData*, PortPoolError>
     acquireConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
+    expected<runtime::ControlChannelData*, PortPoolError>
+    acquireControlChannelData(const RuntimeName_t& runtimeName) noexcept;
+
     /// @brief Used to unblock potential locks in the shutdown phase of a process
     /// @param [in] name of the process runtime which is about to shut down
     void unblockProcessShutdown(const RuntimeName_t& runtimeName) noexcept;
@@ -137,17 +154,19 @@ class PortManager
 
     void destroySubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept;
 
-    void handlePublisherPorts() noexcept;
+    void handlePublisherPorts(
+        const vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS>& publisherPorts) noexcept;
 
     void doDiscoveryForPublisherPort(PublisherPortRouDiType& publisherPort) noexcept;
 
-    void handleSubscriberPorts() noexcept;
+    void handleSubscriberPorts(
+        const vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS>& subscriberPorts) noexcept;
 
     void doDiscoveryForSubscriberPort(SubscriberPortType& subscriberPort) noexcept;
 
     void destroyClientPort(popo::ClientPortData* const clientPortData) noexcept;
 
-    void handleClientPorts() noexcept;
+    void handleClientPorts(const vector<popo::ClientPortData*, MAX_CLIENTS>& clientPorts) noexcept;
 
     void doDiscoveryForClientPort(popo::ClientPortRouDi& clientPort) noexcept;
 
@@ -155,15 +174,30 @@ class PortManager
 
     void destroyServerPort(popo::ServerPortData* const clientPortData) noexcept;
 
-    void handleServerPorts() noexcept;
+    void handleServerPorts(const vector<popo::ServerPortData*, MAX_SERVERS>& serverPorts) noexcept;
 
     void doDiscoveryForServerPort(popo::ServerPortRouDi& serverPort) noexcept;
 
-    void handleInterfaces() noexcept;
+    /// @brief checks whether a sender might still deliver to the queue of a port which shall be destroyed; such a port
+    /// is kept until the sender unpinned the queue container or the sender was cleaned up
+    bool isChunkQueueReferencedByPublisher(
+        const PublisherPortRouDiType::MemberType_t::ChunkQueueData_t* const queue) noexcept;
+    bool isChunkQueueReferencedByServer(const popo::ClientChunkQueueData_t* const queue) noexcept;
+    bool isChunkQueueReferencedByClient(const popo::ServerChunkQueueData_t* const queue) noexcept;
+
+    /// @brief removes the queue of a port which shall be destroyed from all publishers; the UNSUB is processed only once
+    /// and leaves the queue in place when all queue containers of a publisher were pinned at that time
+    void removeChunkQueueFromPublishers(PublisherPortRouDiType::MemberType_t::ChunkQueueData_t* const queue) noexcept;
 
-    void handleNodes() noexcept;
+    /// @brief checks whether a subscriber might still read from the chunk ring of a publisher which shall be destroyed
+    bool isChunkRingReferencedBySubscriber(const popo::ChunkRingData& chunkRing) noexcept;
 
-    void handleConditionVariables() noexcept;
+    void handleInterfaces(const vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER>& interfacePorts) noexcept;
+
+    void handleNodes(const vector<runtime::NodeData*, MAX_NODE_NUMBER>& nodes) noexcept;
+
+    void handleConditionVariables(
+        const vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES>& conditionVariables) noexcept;
 
     bool isCompatiblePubSub(const PublisherPortRouDiType& publisher,
                             const SubscriberPortType& subscriber) const noexcept;
@@ -198,6 +232,11 @@ class PortManager
 
     bool isInternal(const capro::ServiceDescription& service) const noexcept;
 
+    expected<void, ServiceRegistry::Error> changeServiceRegistry(const ServiceRegistryChange::Operation operation,
+                                                                 const capro::ServiceDescription& service) noexcept;
+
+    void publishServiceRegistryChange(const ServiceRegistryChange& change) const noexcept;
+
     void publishServiceRegistry() const noexcept;
 
     const ServiceRegistry& serviceRegistry() const noexcept;
@@ -209,6 +248,9 @@ class PortManager
     PortIntrospectionType m_portIntrospection;
     vector<capro::ServiceDescription, NUMBER_OF_INTERNAL_PUBLISHERS> m_internalServices;
     optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryPublisherPortData;
+    optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryChangesPublisherPortData;
+    /// @brief serializes the bookkeeping of concurrent acquire calls, e.g. the port introspection and the discovery
+    std::mutex m_portCreationMutex;
 
     // some ports for the service registry requires special handling
     // as we cannot send registry information if it was not created yet
@@ -19,12 +19,15 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/interface_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/server_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
+#include "iceoryx_posh/internal/runtime/control_channel_data.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/optional.hpp"
 #include "iox/vector.hpp"
 
@@ -33,14 +36,16 @@ namespace iox
 namespace roudi
 {
 /// @brief workaround container until we have a fixed list with the needed functionality
+/// @note insert can be called concurrently from multiple threads, each slot is reserved with a compare-and-swap before
+/// the element is constructed; all other methods must not be called concurrently with erase
 template <typename T, uint64_t Capacity>
 class FixedPositionContainer
 {
   public:
     static constexpr uint64_t FIRST_ELEMENT = std::numeric_limits<uint64_t>::max();
 
-    bool hasFreeSpace() noexcept;
-
+    /// @brief Constructs an element in a free slot
+    /// @return pointer to the new element or a nullptr if the container is full
     template <typename... Targs>
     T* insert(Targs&&... args) noexcept;
 
@@ -48,8 +53,37 @@ class FixedPositionContainer
 
     vector<T*, Capacity> content() noexcept;
 
+    /// @brief Creates the notifier with which the element marks itself as pending for the discovery
+    /// @param[in] element the element of the container which gets the notifier
+    /// @param[in] conditionVariableData the condition variable which is notified along with marking the element
+    /// @return the notifier of the element, a notifier which does nothing if the element is not in the container
+    popo::DiscoveryNotifier discoveryNotifier(const T* const element,
+                                              popo::ConditionVariableData& conditionVariableData) noexcept;
+
+    /// @brief Returns the elements which were marked as pending since the last call and resets their marks
+    vector<T*, Capacity> takePending() noexcept;
+
+    static constexpr uint64_t FLAGS_PER_WORD{64U};
+    static constexpr uint64_t NUMBER_OF_PENDING_WORDS{(Capacity + FLAGS_PER_WORD - 1U) / FLAGS_PER_WORD};
+
   private:
-    vector<optional<T>, Capacity> m_data;
+    enum class SlotState : uint8_t
+    {
+        FREE,
+        RESERVED,
+        USED
+    };
+
+    /// @brief Returns the index of the element or Capacity if the element is not in the container
+    uint64_t indexOf(const T* const element) noexcept;
+
+    bool isUsed(const uint64_t index) const noexcept;
+
+    optional<T> m_data[Capacity];
+    std::atomic<SlotState> m_slotStates[Capacity]{};
+    /// @brief one past the highest slot which was ever used; limits the iteration over the slots
+    std::atomic<uint64_t> m_endIndex{0U};
+    std::atomic<uint64_t> m_pendingFlags[NUMBER_OF_PENDING_WORDS]{};
 };
 
 struct PortPoolData
@@ -57,12 +91,16 @@ struct PortPoolData
     FixedPositionContainer<popo::InterfacePortData, MAX_INTERFACE_NUMBER> m_interfacePortMembers;
     FixedPositionContainer<runtime::NodeData, MAX_NODE_NUMBER> m_nodeMembers;
     FixedPositionContainer<popo::ConditionVariableData, MAX_NUMBER_OF_CONDITION_VARIABLES> m_conditionVariableMembers;
+    FixedPositionContainer<runtime::ControlChannelData, MAX_NUMBER_OF_CONTROL_CHANNELS> m_controlChannelMembers;
 
     FixedPositionContainer<iox::popo::PublisherPortData, MAX_PUBLISHERS> m_publisherPortMembers;
     FixedPositionContainer<iox::popo::SubscriberPortData, MAX_SUBSCRIBERS> m_subscriberPortMembers;
 
     FixedPositionContainer<iox::popo::ServerPortData, MAX_SERVERS> m_serverPortMembers;
     FixedPositionContainer<iox::popo::ClientPortData, MAX_CLIENTS> m_clientPortMembers;
+
+    /// @brief RouDi waits on this condition variable for the discovery requests of the members
+    popo::ConditionVariableData m_discoveryConditionVariable;
 };
 
 } // namespace roudi
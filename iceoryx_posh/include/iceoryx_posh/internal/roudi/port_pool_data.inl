@@ -23,64 +23,123 @@ namespace iox
 namespace roudi
 {
 template <typename T, uint64_t Capacity>
-bool FixedPositionContainer<T, Capacity>::hasFreeSpace() noexcept
+constexpr uint64_t FixedPositionContainer<T, Capacity>::FLAGS_PER_WORD;
+template <typename T, uint64_t Capacity>
+constexpr uint64_t FixedPositionContainer<T, Capacity>::NUMBER_OF_PENDING_WORDS;
+
+template <typename T, uint64_t Capacity>
+template <typename... Targs>
+T* FixedPositionContainer<T, Capacity>::insert(Targs&&... args) noexcept
 {
-    if (m_data.capacity() > m_data.size())
+    for (uint64_t index = 0U; index < Capacity; ++index)
     {
-        return true;
-    }
+        auto& slotState = m_slotStates[index];
+        auto expectedState = SlotState::FREE;
+        // acquire pairs with the release of erase; the destruction of the previous element is complete
+        if (slotState.load(std::memory_order_relaxed) != SlotState::FREE
+            || !slotState.compare_exchange_strong(expectedState, SlotState::RESERVED, std::memory_order_acquire))
+        {
+            continue;
+        }
 
-    for (auto& e : m_data)
-    {
-        if (!e.has_value())
+        m_data[index].emplace(std::forward<Targs>(args)...);
+
+        const uint64_t endIndex = index + 1U;
+        auto currentEndIndex = m_endIndex.load(std::memory_order_relaxed);
+        while (currentEndIndex < endIndex
+               && !m_endIndex.compare_exchange_weak(currentEndIndex, endIndex, std::memory_order_relaxed))
         {
-            return true;
         }
+
+        // release pairs with the acquire of isUsed; the element is fully constructed when it is seen as used
+        slotState.store(SlotState::USED, std::memory_order_release);
+        return &m_data[index].value();
     }
 
-    return false;
+    return nullptr;
 }
 
 template <typename T, uint64_t Capacity>
-template <typename... Targs>
-T* FixedPositionContainer<T, Capacity>::insert(Targs&&... args) noexcept
+void FixedPositionContainer<T, Capacity>::erase(const T* const element) noexcept
 {
-    for (auto& e : m_data)
+    const auto index = indexOf(element);
+    if (index < Capacity)
     {
-        if (!e.has_value())
+        m_data[index].reset();
+        m_slotStates[index].store(SlotState::FREE, std::memory_order_release);
+    }
+}
+
+template <typename T, uint64_t Capacity>
+vector<T*, Capacity> FixedPositionContainer<T, Capacity>::content() noexcept
+{
+    vector<T*, Capacity> returnValue;
+    const auto endIndex = m_endIndex.load(std::memory_order_relaxed);
+    for (uint64_t index = 0U; index < endIndex; ++index)
+    {
+        if (isUsed(index))
         {
-            e.emplace(std::forward<Targs>(args)...);
-            return &e.value();
+            returnValue.emplace_back(&m_data[index].value());
         }
     }
-
-    m_data.emplace_back();
-    m_data.back().emplace(std::forward<Targs>(args)...);
-    return &m_data.back().value();
+    return returnValue;
 }
 
 template <typename T, uint64_t Capacity>
-void FixedPositionContainer<T, Capacity>::erase(const T* const element) noexcept
+uint64_t FixedPositionContainer<T, Capacity>::indexOf(const T* const element) noexcept
 {
-    for (auto& e : m_data)
+    const auto endIndex = m_endIndex.load(std::memory_order_relaxed);
+    for (uint64_t index = 0U; index < endIndex; ++index)
     {
-        if (e.has_value() && &e.value() == element)
+        if (isUsed(index) && &m_data[index].value() == element)
         {
-            e.reset();
-            return;
+            return index;
         }
     }
+    return Capacity;
 }
 
 template <typename T, uint64_t Capacity>
-vector<T*, Capacity> FixedPositionContainer<T, Capacity>::content() noexcept
+bool FixedPositionContainer<T, Capacity>::isUsed(const uint64_t index) const noexcept
+{
+    return m_slotStates[index].load(std::memory_order_acquire) == SlotState::USED;
+}
+
+template <typename T, uint64_t Capacity>
+popo::DiscoveryNotifier
+FixedPositionContainer<T, Capacity>::discoveryNotifier(const T* const element,
+                                                       popo::ConditionVariableData& conditionVariableData) noexcept
+{
+    const auto index = indexOf(element);
+    if (index < Capacity)
+    {
+        return popo::DiscoveryNotifier(
+            m_pendingFlags[index / FLAGS_PER_WORD], uint64_t(1U) << (index % FLAGS_PER_WORD), conditionVariableData);
+    }
+    return popo::DiscoveryNotifier();
+}
+
+template <typename T, uint64_t Capacity>
+vector<T*, Capacity> FixedPositionContainer<T, Capacity>::takePending() noexcept
 {
     vector<T*, Capacity> returnValue;
-    for (auto& e : m_data)
+    for (uint64_t wordIndex = 0U; wordIndex < NUMBER_OF_PENDING_WORDS; ++wordIndex)
     {
-        if (e.has_value())
+        auto& word = m_pendingFlags[wordIndex];
+        if (word.load(std::memory_order_relaxed) == 0U)
+        {
+            continue;
+        }
+
+        // acquire pairs with the release of the DiscoveryNotifier; the requests of the taken elements are visible
+        for (auto pendingBits = word.exchange(0U, std::memory_order_acquire); pendingBits != 0U;
+             pendingBits &= pendingBits - 1U)
         {
-            returnValue.emplace_back(&e.value());
+            const uint64_t index = wordIndex * FLAGS_PER_WORD + countTrailingZeros(pendingBits);
+            if (index < Capacity && isUsed(index))
+            {
+                returnValue.emplace_back(&m_data[index].value());
+            }
         }
     }
     return returnValue;
@@ -72,6 +72,14 @@ class Process
 
     bool isMonitored() const noexcept;
 
+    /// @brief Sets the control channel with which the process requests its ports in a binary format
+    /// @param[in] controlChannel the control channel of the process in the management segment
+    void setControlChannel(runtime::ControlChannelData* const controlChannel) noexcept;
+
+    /// @brief The control channel of the process
+    /// @return the control channel or a nullptr if the process did not request one
+    runtime::ControlChannelData* getControlChannel() const noexcept;
+
   private:
     const uint32_t m_pid{0U};
     runtime::IpcInterfaceUser m_ipcChannel;
@@ -79,6 +87,7 @@ class Process
     posix::PosixUser m_user;
     bool m_isMonitored{true};
     std::atomic<uint64_t> m_sessionId{0U};
+    runtime::ControlChannelData* m_controlChannel{nullptr};
 };
 
 } // namespace roudi
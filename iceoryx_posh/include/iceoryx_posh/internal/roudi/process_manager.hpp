@@ -30,6 +30,7 @@
 
 #include <cstdint>
 #include <ctime>
+#include <shared_mutex>
 
 namespace iox
 {
@@ -43,6 +44,11 @@ class ProcessManagerInterface
     virtual ~ProcessManagerInterface() noexcept = default;
 };
 
+/// @brief Manages the registered processes and creates the ports for them
+/// @note The methods can be called concurrently. Requests of a registered process, like the creation of ports, only
+/// share the process list and are processed in parallel as long as they come from different processes; the requests of
+/// one process must be serialized by the caller. Everything which modifies the process list or affects the ports of
+/// other processes, like the registration or the monitoring and discovery, is processed exclusively.
 class ProcessManager : public ProcessManagerInterface
 {
   public:
@@ -146,10 +152,25 @@ class ProcessManager : public ProcessManagerInterface
 
     void addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept;
 
+    /// @brief Adds a control channel for the binary port requests to the process and sends it to the OS process
+    /// @param[in] runtimeName is the name of the runtime requesting the control channel
+    void addControlChannelForProcess(const RuntimeName_t& runtimeName) noexcept;
+
+    /// @brief Processes the batch of requests in the control channel of the process, writes the responses into the
+    /// control channel and acknowledges the doorbell to the OS process
+    /// @param[in] runtimeName is the name of the runtime which rang the doorbell
+    void processControlChannelRequests(const RuntimeName_t& runtimeName) noexcept;
+
     void initIntrospection(ProcessIntrospectionType* processIntrospection) noexcept;
 
+    /// @brief Monitors the processes and processes the pending discovery requests; there is no full discovery sweep
+    /// since every request marks itself as pending, see DiscoveryNotifier
     void run() noexcept;
 
+    /// @brief Processes only the pending discovery requests, i.e. the ones which notified the discovery condition
+    /// variable of the PortManager
+    void discoveryUpdate() noexcept override;
+
     popo::PublisherPortData* addIntrospectionPublisherPort(const capro::ServiceDescription& service) noexcept;
 
     /// @brief Notify the application that it sent an unsupported message
@@ -159,8 +180,29 @@ class ProcessManager : public ProcessManagerInterface
   private:
     optional<Process*> findProcess(const RuntimeName_t& name) noexcept;
 
+    expected<PublisherPortRouDiType::MemberType_t*, runtime::IpcMessageErrorType>
+    acquirePublisherForProcess(Process& process,
+                               const capro::ServiceDescription& service,
+                               const popo::PublisherOptions& publisherOptions,
+                               const PortConfigInfo& portConfigInfo) noexcept;
+
+    expected<SubscriberPortType::MemberType_t*, runtime::IpcMessageErrorType>
+    acquireSubscriberForProcess(Process& process,
+                                const capro::ServiceDescription& service,
+                                const popo::SubscriberOptions& subscriberOptions,
+                                const PortConfigInfo& portConfigInfo) noexcept;
+
+    /// @brief Creates the port of a request which was copied out of the control channel and validated before
+    void processControlRequest(Process& process,
+                               const runtime::ControlRequest& request,
+                               runtime::ControlResponse& response) noexcept;
+
+    /// @brief Checks the strings, enums, booleans and capacities of a request which was copied out of the control
+    /// channel; since the control channel is writable by the application, nothing of a request is trusted
+    /// @return true if RouDi can act on the request, false otherwise
+    static bool isValidControlRequest(const runtime::ControlRequest& request) noexcept;
+
     void monitorProcesses() noexcept;
-    void discoveryUpdate() noexcept override;
 
     /// @param [in] name of the process; this is equal to the IPC channel name, which is used for communication
     /// @param [in] pid is the host system process id
@@ -229,6 +271,9 @@ class ProcessManager : public ProcessManagerInterface
     ProcessList_t m_processList;
     ProcessIntrospectionType* m_processIntrospection{nullptr};
     version::CompatibilityCheckLevel m_compatibilityCheckLevel;
+    /// @brief shared by the requests of registered processes, exclusively held when the process list is modified or
+    /// when the ports of all processes are processed
+    std::shared_timed_mutex m_processListMutex;
 };
 
 } // namespace roudi
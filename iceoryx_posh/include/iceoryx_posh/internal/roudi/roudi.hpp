@@ -17,7 +17,7 @@
 #ifndef IOX_POSH_ROUDI_ROUDI_MULTI_PROCESS_HPP
 #define IOX_POSH_ROUDI_ROUDI_MULTI_PROCESS_HPP
 
-#include "iceoryx_hoofs/internal/concurrent/smart_lock.hpp"
+#include "iceoryx_hoofs/cxx/list.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_platform/file.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
@@ -30,7 +30,9 @@
 #include "iox/relative_pointer.hpp"
 #include "iox/scope_guard.hpp"
 
+#include <condition_variable>
 #include <cstdint>
+#include <mutex>
 #include <thread>
 
 namespace iox
@@ -57,12 +59,14 @@ class RouDi
             const bool killProcessesInDestructor = true,
             const RuntimeMessagesThreadStart RuntimeMessagesThreadStart = RuntimeMessagesThreadStart::IMMEDIATE,
             const version::CompatibilityCheckLevel compatibilityCheckLevel = version::CompatibilityCheckLevel::PATCH,
-            const units::Duration processKillDelay = roudi::PROCESS_DEFAULT_KILL_DELAY) noexcept
+            const units::Duration processKillDelay = roudi::PROCESS_DEFAULT_KILL_DELAY,
+            const uint32_t numberOfRuntimeMessageWorkers = roudi::DEFAULT_NUMBER_OF_RUNTIME_MESSAGE_WORKERS) noexcept
             : m_monitoringMode(monitoringMode)
             , m_killProcessesInDestructor(killProcessesInDestructor)
             , m_runtimesMessagesThreadStart(RuntimeMessagesThreadStart)
             , m_compatibilityCheckLevel(compatibilityCheckLevel)
             , m_processKillDelay(processKillDelay)
+            , m_numberOfRuntimeMessageWorkers(numberOfRuntimeMessageWorkers)
         {
         }
 
@@ -71,6 +75,10 @@ class RouDi
         const RuntimeMessagesThreadStart m_runtimesMessagesThreadStart;
         const version::CompatibilityCheckLevel m_compatibilityCheckLevel;
         const units::Duration m_processKillDelay;
+        /// @brief the number of threads which process the messages of the runtimes; the messages of one runtime are
+        /// always processed by the same thread and therefore in order, with one worker the messages are processed by
+        /// the thread which receives them
+        const uint32_t m_numberOfRuntimeMessageWorkers;
     };
 
     RouDi& operator=(const RouDi& other) = delete;
@@ -92,6 +100,10 @@ class RouDi
     ///
     /// @note Intentionally not virtual to be able to call it in derived class
     void shutdown() noexcept;
+
+    /// @brief Processes a message of a runtime
+    /// @note With more than one runtime message worker, this is called concurrently for messages of different
+    /// runtimes; the messages of one runtime are never processed concurrently
     virtual void processMessage(const runtime::IpcMessage& message,
                                 const iox::runtime::IpcMessageType& cmd,
                                 const RuntimeName_t& runtimeName) noexcept;
@@ -121,9 +133,40 @@ class RouDi
     /// @return a unique, monotonic and consecutive increasing number
     static uint64_t getUniqueSessionIdForProcess() noexcept;
 
+    /// @brief Returns the number of runtime message workers after clamping the requested number to the supported range
+    uint32_t numberOfRuntimeMessageWorkers() const noexcept;
+
+    /// @brief Starts the runtime message workers; does nothing with a single worker
+    void startRuntimeMessageWorkers() noexcept;
+
+    /// @brief Stops the runtime message workers after they processed all queued messages
+    void stopRuntimeMessageWorkers() noexcept;
+
+    /// @brief Hands the message over to the worker of the sending runtime; blocks while the queue of the worker is
+    /// full since a runtime request must never be dropped, the runtime would otherwise wait forever for the response
+    void dispatchRuntimeMessage(runtime::IpcMessage&& message) noexcept;
+
   private:
+    /// @brief Queues the messages of the runtimes which are assigned to a worker and processes them on its thread
+    struct RuntimeMessageWorker_t
+    {
+        std::mutex m_mutex;
+        std::condition_variable m_messageAvailable;
+        std::condition_variable m_spaceAvailable;
+        cxx::list<runtime::IpcMessage, RUNTIME_MESSAGE_WORKER_QUEUE_CAPACITY> m_messages;
+        bool m_stop{false};
+        std::thread m_thread;
+    };
+
     void processRuntimeMessages() noexcept;
 
+    void processRuntimeMessage(const runtime::IpcMessage& message) noexcept;
+
+    void runtimeMessageWorkerLoop(const uint32_t workerIndex) noexcept;
+
+    /// @brief Returns the index of the worker which processes all messages of the runtime
+    uint32_t runtimeMessageWorkerIndex(const RuntimeName_t& runtimeName) const noexcept;
+
     void monitorAndDiscoveryUpdate() noexcept;
 
     ScopeGuard m_unregisterRelativePtr{[] { UntypedRelativePointer::unregisterAll(); }};
@@ -145,7 +188,7 @@ class RouDi
         };
     }};
     PortManager* m_portManager{nullptr};
-    concurrent::smart_lock<ProcessManager> m_prcMgr;
+    ProcessManager m_prcMgr;
 
   private:
     std::thread m_monitoringAndDiscoveryThread;
@@ -158,6 +201,8 @@ class RouDi
   private:
     roudi::MonitoringMode m_monitoringMode{roudi::MonitoringMode::ON};
     units::Duration m_processKillDelay;
+    uint32_t m_numberOfRuntimeMessageWorkers{1U};
+    RuntimeMessageWorker_t m_runtimeMessageWorkers[MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS];
 };
 
 } // namespace roudi
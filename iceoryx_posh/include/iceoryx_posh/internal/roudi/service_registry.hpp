@@ -26,12 +26,50 @@
 
 
 #include <cstdint>
+#include <limits>
+#include <type_traits>
 #include <utility>
 
 namespace iox
 {
 namespace roudi
 {
+namespace detail
+{
+constexpr uint32_t nextPowerOfTwo(const uint32_t value, const uint32_t powerOfTwo = 1U) noexcept
+{
+    return (powerOfTwo >= value) ? powerOfTwo : nextPowerOfTwo(value, powerOfTwo * 2U);
+}
+
+/// @brief the smallest unsigned type which can hold all values up to and including MaxValue
+template <uint32_t MaxValue>
+using IndexType_t =
+    typename std::conditional<(MaxValue <= std::numeric_limits<uint16_t>::max()), uint16_t, uint32_t>::type;
+} // namespace detail
+
+/// @brief A single change of the ServiceRegistry. RouDi publishes the changes with consecutive sequence numbers, which
+/// allows the ServiceDiscovery to apply them to its copy of the ServiceRegistry and to detect missed changes.
+struct ServiceRegistryChange
+{
+    enum class Operation : uint8_t
+    {
+        ADD_PUBLISHER,
+        REMOVE_PUBLISHER,
+        ADD_SERVER,
+        REMOVE_SERVER
+    };
+
+    uint64_t sequenceNumber{0U};
+    Operation operation{Operation::ADD_PUBLISHER};
+    capro::ServiceDescription serviceDescription;
+};
+
+/// @brief The ServiceRegistry stores the offered services. A hash index on the full ServiceDescription and secondary
+/// hash indices on the service, instance and event strings make add, remove and find independent of the number of
+/// stored services. The indices are made of plain indices into the storage, therefore the ServiceRegistry can be
+/// copied, e.g. into a sample which is published to the ServiceDiscovery.
+/// @note The indices are sized from CAPACITY and use the smallest index type which can address it; with the default
+/// capacity of 1024 entries they add about 40 kB to the about 384 kB of the entries.
 class ServiceRegistry
 {
   public:
@@ -56,6 +94,8 @@ class ServiceRegistry
         ReferenceCounter_t serverCount{0U};
     };
 
+    ServiceRegistry() noexcept;
+
     /// @brief Adds a given publisher service description to registry
     /// @param[in] serviceDescription, service to be added
     /// @return ServiceRegistryError, error wrapped in expected
@@ -81,6 +121,15 @@ class ServiceRegistry
     /// @param[in] serviceDescription, service to be removed
     void purge(const capro::ServiceDescription& serviceDescription) noexcept;
 
+    /// @brief Applies a change to the registry and takes over the sequence number of the change
+    /// @param[in] change, the change to be applied
+    /// @return ServiceRegistryError, error wrapped in expected
+    expected<void, Error> apply(const ServiceRegistryChange& change) noexcept;
+
+    /// @brief Returns the sequence number of the last applied change
+    /// @return the sequence number, 0 if no change was applied yet
+    uint64_t sequenceNumber() const noexcept;
+
     /// @brief Searches for given service description in registry
     /// @param[in] service, string or wildcard (= iox::nullopt) to search for
     /// @param[in] instance, string or wildcard (= iox::nullopt) to search for
@@ -101,20 +150,69 @@ class ServiceRegistry
     using ServiceDescriptionContainer_t = vector<Entry_t, CAPACITY>;
 
     static constexpr uint32_t NO_INDEX = CAPACITY;
+    using Index_t = detail::IndexType_t<NO_INDEX>;
+
+    /// @brief the secondary indices, one for each string of the ServiceDescription
+    enum class IdField : uint32_t
+    {
+        SERVICE,
+        INSTANCE,
+        EVENT
+    };
+    static constexpr uint32_t NUMBER_OF_ID_FIELDS{3U};
+
+    /// the hash index uses open addressing with linear probing; with a load factor of at most 0.5 the probe sequences
+    /// stay short
+    static constexpr uint32_t HASH_INDEX_CAPACITY{detail::nextPowerOfTwo(2U * CAPACITY)};
+    static constexpr uint32_t NUMBER_OF_BUCKETS{detail::nextPowerOfTwo(CAPACITY)};
+
+    /// @brief a bucket of a secondary index is a doubly linked list of the entries whose string hashes to the bucket
+    struct Bucket
+    {
+        Index_t head{NO_INDEX};
+        Index_t tail{NO_INDEX};
+        Index_t size{0U};
+    };
+
+    /// @brief the index data of an entry which is stored in the same slot as the entry; the bucket of an entry is
+    /// not stored but computed from its strings when it is removed
+    struct EntryIndex
+    {
+        /// the lower half of the hash of the ServiceDescription, enough for the position in the hash index and to
+        /// skip most of the non-matching entries without comparing the strings
+        uint32_t hash{0U};
+        Index_t next[NUMBER_OF_ID_FIELDS]{};
+        Index_t previous[NUMBER_OF_ID_FIELDS]{};
+    };
 
     ServiceDescriptionContainer_t m_serviceDescriptions;
 
-    // store the last known free Index (if any is known)
-    // we could use a queue (or stack) here since they are not optimal
-    // for the filling pattern of a vector (prefer entries close to the front)
-    uint32_t m_freeIndex{NO_INDEX};
+    EntryIndex m_entryIndices[CAPACITY];
+    Index_t m_hashIndex[HASH_INDEX_CAPACITY];
+    Bucket m_buckets[NUMBER_OF_ID_FIELDS][NUMBER_OF_BUCKETS];
+
+    // the slots of removed entries; they are reused before the container grows
+    Index_t m_freeIndices[CAPACITY];
+    uint32_t m_numberOfFreeIndices{0U};
+
+    uint64_t m_sequenceNumber{0U};
 
   private:
     uint32_t findIndex(const capro::ServiceDescription& serviceDescription) const noexcept;
 
-
     expected<void, Error> add(const capro::ServiceDescription& serviceDescription,
                               ReferenceCounter_t ServiceDescriptionEntry::*count);
+
+    void remove(const uint32_t index) noexcept;
+
+    void insertIntoIndices(const uint32_t index, const uint64_t hash) noexcept;
+    void removeFromIndices(const uint32_t index) noexcept;
+
+    static uint64_t hash(const capro::IdString_t& id) noexcept;
+    static uint64_t hash(const capro::ServiceDescription& serviceDescription) noexcept;
+    static uint32_t bucketIndex(const capro::ServiceDescription& serviceDescription, const IdField field) noexcept;
+    static const capro::IdString_t& idString(const capro::ServiceDescription& serviceDescription,
+                                             const IdField field) noexcept;
 };
 
 } // namespace roudi
@@ -0,0 +1,95 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_RUNTIME_CONTROL_CHANNEL_DATA_HPP
+#define IOX_POSH_RUNTIME_CONTROL_CHANNEL_DATA_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iox/relative_pointer.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace runtime
+{
+enum class ControlRequestType : uint8_t
+{
+    NONE,
+    CREATE_PUBLISHER,
+    CREATE_SUBSCRIBER,
+};
+
+/// @brief Fixed layout request which is written by the runtime into its control channel; depending on the type only
+/// the publisher or the subscriber options are evaluated
+struct ControlRequest
+{
+    ControlRequestType m_type{ControlRequestType::NONE};
+    capro::ServiceDescription m_service;
+    popo::PublisherOptions m_publisherOptions;
+    popo::SubscriberOptions m_subscriberOptions;
+    PortConfigInfo m_portConfigInfo;
+};
+
+/// @brief Fixed layout response which is written by RouDi for each request of a batch; on success the created port is
+/// given as relative pointer into the management segment, otherwise m_error contains the reason of the failure
+struct ControlResponse
+{
+    bool m_isSuccessful{false};
+    IpcMessageErrorType m_error{IpcMessageErrorType::NOTYPE};
+    UntypedRelativePointer::offset_t m_offset{0U};
+    segment_id_underlying_t m_segmentId{0U};
+};
+
+/// @brief Per runtime request/response area in the management segment. The runtime writes a batch of binary requests,
+/// rings the doorbell over the IPC channel and RouDi writes the responses in place before it acknowledges the
+/// doorbell. This replaces the string serialization of the port creation requests and lets a runtime create a whole
+/// batch of ports with one round trip. Only the creation of publishers and subscribers uses the channel, the doorbell
+/// and all other requests are still string messages on the IPC channel.
+/// The doorbell stays on the IPC channel since RouDi dispatches all messages of a runtime to the same runtime message
+/// worker, which keeps the requests of a runtime in order with its other messages, e.g. the termination, while the
+/// workers of different runtimes run concurrently and rely on the locks of the ProcessManager and PortManager. Also a
+/// terminated RouDi is detected by the timeouts of the IPC channel.
+/// @note the runtime and RouDi never access the data concurrently since the runtime only touches it before ringing and
+/// after the acknowledgement of the doorbell
+struct ControlChannelData
+{
+    explicit ControlChannelData(const RuntimeName_t& runtimeName) noexcept;
+
+    ControlChannelData(const ControlChannelData&) = delete;
+    ControlChannelData(ControlChannelData&&) = delete;
+    ControlChannelData& operator=(const ControlChannelData&) = delete;
+    ControlChannelData& operator=(ControlChannelData&&) = delete;
+    ~ControlChannelData() noexcept = default;
+
+    static constexpr uint64_t CAPACITY{MAX_CONTROL_CHANNEL_REQUESTS};
+
+    RuntimeName_t m_runtimeName;
+    /// The number of valid requests of the current batch; RouDi processes at most CAPACITY requests
+    uint64_t m_numberOfRequests{0U};
+    ControlRequest m_requests[CAPACITY];
+    ControlResponse m_responses[CAPACITY];
+};
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_CONTROL_CHANNEL_DATA_HPP
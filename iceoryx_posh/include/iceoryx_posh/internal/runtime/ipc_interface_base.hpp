@@ -78,6 +78,10 @@ enum class IpcMessageType : int32_t
     CREATE_CONDITION_VARIABLE_ACK,
     CREATE_NODE,
     CREATE_NODE_ACK,
+    CREATE_CONTROL_CHANNEL,
+    CREATE_CONTROL_CHANNEL_ACK,
+    CONTROL_CHANNEL_DOORBELL, // RouDi shall process the requests in the control channel
+    CONTROL_CHANNEL_DOORBELL_ACK,
     KEEPALIVE,
     TERMINATION,
     TERMINATION_ACK,
@@ -113,6 +117,8 @@ enum class IpcMessageErrorType : int32_t
     REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT,
     REQUEST_CONDITION_VARIABLE_INVALID_RESPONSE,
     REQUEST_CONDITION_VARIABLE_WRONG_IPC_MESSAGE_RESPONSE,
+    REQUEST_CONTROL_CHANNEL_INVALID_RESPONSE,
+    REQUEST_CONTROL_CHANNEL_WRONG_IPC_MESSAGE_RESPONSE,
     PUBLISHER_LIST_FULL,
     SUBSCRIBER_LIST_FULL,
     CLIENT_LIST_FULL,
@@ -120,6 +126,8 @@ enum class IpcMessageErrorType : int32_t
     CONDITION_VARIABLE_LIST_FULL,
     EVENT_VARIABLE_LIST_FULL,
     NODE_DATA_LIST_FULL,
+    CONTROL_CHANNEL_LIST_FULL,
+    CONTROL_CHANNEL_INVALID_REQUEST,
     END,
 };
 
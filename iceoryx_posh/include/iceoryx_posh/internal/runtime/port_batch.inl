@@ -0,0 +1,136 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_RUNTIME_PORT_BATCH_INL
+#define IOX_POSH_RUNTIME_PORT_BATCH_INL
+
+#include "iceoryx_posh/runtime/port_batch.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iox/logging.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+template <uint64_t Capacity>
+inline PortBatch<Capacity>::~PortBatch() noexcept
+{
+    releasePorts();
+}
+
+template <uint64_t Capacity>
+inline expected<uint64_t, PortBatchError>
+PortBatch<Capacity>::preparePublisher(const capro::ServiceDescription& service,
+                                      const popo::PublisherOptions& publisherOptions,
+                                      const PortConfigInfo& portConfigInfo) noexcept
+{
+    return prepare(PortRequest::publisher(service, publisherOptions, portConfigInfo));
+}
+
+template <uint64_t Capacity>
+inline expected<uint64_t, PortBatchError>
+PortBatch<Capacity>::prepareSubscriber(const capro::ServiceDescription& service,
+                                       const popo::SubscriberOptions& subscriberOptions,
+                                       const PortConfigInfo& portConfigInfo) noexcept
+{
+    return prepare(PortRequest::subscriber(service, subscriberOptions, portConfigInfo));
+}
+
+template <uint64_t Capacity>
+inline expected<uint64_t, PortBatchError> PortBatch<Capacity>::prepare(const PortRequest& request) noexcept
+{
+    if (m_isCommitted)
+    {
+        return err(PortBatchError::ALREADY_COMMITTED);
+    }
+    if (!m_requests.push_back(request))
+    {
+        return err(PortBatchError::BATCH_FULL);
+    }
+    return ok<uint64_t>(m_requests.size() - 1U);
+}
+
+template <uint64_t Capacity>
+inline uint64_t PortBatch<Capacity>::commit() noexcept
+{
+    if (m_isCommitted)
+    {
+        return 0U;
+    }
+    m_isCommitted = true;
+    const auto numberOfCreatedPorts =
+        PoshRuntime::getInstance().createPorts(span<PortRequest>(m_requests.data(), m_requests.size()));
+    if (numberOfCreatedPorts < m_requests.size())
+    {
+        IOX_LOG(WARN) << "The " << m_requests.size() << " ports of the batch could not be created";
+    }
+    return numberOfCreatedPorts;
+}
+
+template <uint64_t Capacity>
+inline void PortBatch<Capacity>::releasePorts() noexcept
+{
+    for (auto& request : m_requests)
+    {
+        request.releasePort();
+    }
+}
+
+template <uint64_t Capacity>
+inline bool PortBatch<Capacity>::isCommitted() const noexcept
+{
+    return m_isCommitted;
+}
+
+template <uint64_t Capacity>
+inline optional<PreparedPublisher> PortBatch<Capacity>::takePublisher(const uint64_t index) noexcept
+{
+    commit();
+    if (index >= m_requests.size() || m_requests[index].type != PortRequestType::PUBLISHER
+        || m_requests[index].publisherPortData == nullptr)
+    {
+        return nullopt;
+    }
+
+    auto& request = m_requests[index];
+    PreparedPublisher prepared;
+    prepared.portData = request.publisherPortData;
+    prepared.publisherOptions = request.publisherOptions;
+    request.publisherPortData = nullptr;
+    return prepared;
+}
+
+template <uint64_t Capacity>
+inline optional<PreparedSubscriber> PortBatch<Capacity>::takeSubscriber(const uint64_t index) noexcept
+{
+    commit();
+    if (index >= m_requests.size() || m_requests[index].type != PortRequestType::SUBSCRIBER
+        || m_requests[index].subscriberPortData == nullptr)
+    {
+        return nullopt;
+    }
+
+    auto& request = m_requests[index];
+    PreparedSubscriber prepared;
+    prepared.portData = request.subscriberPortData;
+    request.subscriberPortData = nullptr;
+    return prepared;
+}
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_PORT_BATCH_INL
@@ -19,9 +19,11 @@
 
 #include "iceoryx_hoofs/internal/concurrent/periodic_task.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/mutex.hpp"
+#include "iceoryx_posh/internal/runtime/control_channel_data.hpp"
 #include "iceoryx_posh/internal/runtime/shared_memory_user.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iox/function.hpp"
+#include "iox/function_ref.hpp"
 
 namespace iox
 {
@@ -55,6 +57,12 @@ class PoshRuntimeImpl : public PoshRuntime
                             const popo::SubscriberOptions& subscriberOptions = popo::SubscriberOptions(),
                             const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept override;
 
+    /// @copydoc PoshRuntime::createPorts
+    /// @note the requests are written in batches of ControlChannelData::CAPACITY directly into the control channel, i.e.
+    /// every ControlChannelData::CAPACITY ports require one round trip to RouDi; a full runtime::PortBatch with the
+    /// default capacity takes a single round trip
+    uint64_t createPorts(const span<PortRequest> requests) noexcept override;
+
     /// @copydoc PoshRuntime::getMiddlewareClient
     popo::ClientPortUser::MemberType_t*
     getMiddlewareClient(const capro::ServiceDescription& service,
@@ -89,11 +97,49 @@ class PoshRuntimeImpl : public PoshRuntime
                     const RuntimeLocation location = RuntimeLocation::SEPARATE_PROCESS_FROM_ROUDI) noexcept;
 
   private:
-    expected<PublisherPortUserType::MemberType_t*, IpcMessageErrorType>
-    requestPublisherFromRoudi(const IpcMessage& sendBuffer) noexcept;
-
-    expected<SubscriberPortUserType::MemberType_t*, IpcMessageErrorType>
-    requestSubscriberFromRoudi(const IpcMessage& sendBuffer) noexcept;
+    /// @brief Requests the ports from RouDi with the binary requests of the control channel; if there is no control
+    /// channel, the requests are serialized one by one into IPC messages
+    /// @param[in] numberOfRequests the number of requests; RouDi gets them in batches of ControlChannelData::CAPACITY
+    /// @param[in] writeRequest writes the request with the given index in place into the given request of the control
+    /// channel, this avoids a copy of the large requests
+    /// @param[out] responses one response of RouDi for each request
+    void requestPortsFromRoudi(const uint64_t numberOfRequests,
+                               const function_ref<void(const uint64_t, ControlRequest&)> writeRequest,
+                               ControlResponse* const responses) noexcept;
+
+    /// @brief Limits the publisher options to the capabilities of a publisher port and fills in the defaults
+    /// @param[out] request the request which is written, the subscriber options are left untouched
+    void makePublisherRequest(const capro::ServiceDescription& service,
+                              const popo::PublisherOptions& publisherOptions,
+                              const PortConfigInfo& portConfigInfo,
+                              ControlRequest& request) const noexcept;
+
+    /// @brief Limits the subscriber options to the capabilities of a subscriber port and fills in the defaults
+    /// @param[out] request the request which is written, the publisher options are left untouched
+    void makeSubscriberRequest(const capro::ServiceDescription& service,
+                               const popo::SubscriberOptions& subscriberOptions,
+                               const PortConfigInfo& portConfigInfo,
+                               ControlRequest& request) const noexcept;
+
+    /// @brief Extracts the publisher port of a response of RouDi or reports the error of RouDi
+    /// @return the publisher port or a nullptr if RouDi could not create it
+    static PublisherPortUserType::MemberType_t* publisherFromResponse(const capro::ServiceDescription& service,
+                                                                      const ControlResponse& response) noexcept;
+
+    /// @brief Extracts the subscriber port of a response of RouDi or reports the error of RouDi
+    /// @return the subscriber port or a nullptr if RouDi could not create it
+    static SubscriberPortUserType::MemberType_t* subscriberFromResponse(const capro::ServiceDescription& service,
+                                                                        const ControlResponse& response) noexcept;
+
+    /// @brief Requests the control channel from RouDi on the first call
+    /// @return the control channel or a nullptr if RouDi could not provide one
+    /// @note must be called with a locked m_appIpcRequestMutex
+    ControlChannelData* getControlChannel() noexcept;
+
+    ControlResponse requestPortViaIpcMessage(const ControlRequest& request) noexcept;
+
+    static IpcMessageErrorType invalidResponseError(const ControlRequestType type) noexcept;
+    static IpcMessageErrorType wrongIpcMessageResponseError(const ControlRequestType type) noexcept;
 
     expected<popo::ClientPortUser::MemberType_t*, IpcMessageErrorType>
     requestClientFromRoudi(const IpcMessage& sendBuffer) noexcept;
@@ -109,6 +155,10 @@ class PoshRuntimeImpl : public PoshRuntime
     IpcRuntimeInterface m_ipcChannelInterface;
     optional<SharedMemoryUser> m_ShmInterface;
 
+    bool m_isControlChannelRequested{false};
+    ControlChannelData* m_controlChannel{nullptr};
+    IpcMessage m_controlChannelDoorbell;
+
     void sendKeepAliveAndHandleShutdownPreparation() noexcept;
     static_assert(PROCESS_KEEP_ALIVE_INTERVAL > roudi::DISCOVERY_INTERVAL, "Keep alive interval too small");
 
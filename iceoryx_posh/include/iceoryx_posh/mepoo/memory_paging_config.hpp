@@ -0,0 +1,44 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_MEPOO_MEMORY_PAGING_CONFIG_HPP
+#define IOX_POSH_MEPOO_MEMORY_PAGING_CONFIG_HPP
+
+#include "iox/optional.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief Defines how the pages of a shared memory created by RouDi are backed. The defaults keep the behavior of the
+/// operating system, i.e. default sized pages which are faulted in on first access.
+struct MemoryPagingConfig
+{
+    /// @brief Advises the operating system to back the memory with huge pages. On Linux this requires transparent huge
+    /// pages for shared memory, i.e. '/sys/kernel/mm/transparent_hugepage/shmem_enabled' set to 'advise' or 'always'
+    bool m_useHugePages{false};
+    /// @brief Faults in all pages when the memory is created instead of on the first access
+    bool m_prefault{false};
+    /// @brief Locks the memory in RAM; this also faults in all pages and might require to raise RLIMIT_MEMLOCK
+    bool m_lockInMemory{false};
+    /// @brief Binds the memory to this NUMA node
+    optional<uint32_t> m_numaNode;
+};
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_MEMORY_PAGING_CONFIG_HPP
@@ -29,6 +29,15 @@ class PortManager;
 }
 namespace mepoo
 {
+/// @brief Defines the behavior of the MemoryManager when the best fitting mempool for a chunk is exhausted
+enum class MemPoolExhaustedPolicy : uint8_t
+{
+    /// @brief the request fails with MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS
+    RETURN_ERROR,
+    /// @brief the chunk is taken from the next larger mempool which has free chunks left
+    FALL_THROUGH_TO_LARGER_MEMPOOL
+};
+
 struct MePooConfig
 {
   public:
@@ -46,6 +55,7 @@ struct MePooConfig
 
     using MePooConfigContainerType = vector<Entry, MAX_NUMBER_OF_MEMPOOLS>;
     MePooConfigContainerType m_mempoolConfig;
+    MemPoolExhaustedPolicy m_memPoolExhaustedPolicy{MemPoolExhaustedPolicy::RETURN_ERROR};
 
     /// @brief Default constructor to set the configuration for memory pools
     MePooConfig() noexcept = default;
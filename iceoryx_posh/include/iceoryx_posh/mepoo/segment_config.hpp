@@ -17,6 +17,7 @@
 #define IOX_POSH_MEPOO_SEGMENT_CONFIG_HPP
 
 #include "iceoryx_posh/mepoo/memory_info.hpp"
+#include "iceoryx_posh/mepoo/memory_paging_config.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
@@ -34,11 +35,13 @@ struct SegmentConfig
         SegmentEntry(const posix::PosixGroup::groupName_t& readerGroup,
                      const posix::PosixGroup::groupName_t& writerGroup,
                      const MePooConfig& memPoolConfig,
-                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo()) noexcept
+                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo(),
+                     const MemoryPagingConfig& memoryPagingConfig = MemoryPagingConfig()) noexcept
             : m_readerGroup(readerGroup)
             , m_writerGroup(writerGroup)
             , m_mempoolConfig(memPoolConfig)
             , m_memoryInfo(memoryInfo)
+            , m_memoryPagingConfig(memoryPagingConfig)
 
         {
         }
@@ -47,6 +50,7 @@ struct SegmentConfig
         posix::PosixGroup::groupName_t m_writerGroup;
         MePooConfig m_mempoolConfig;
         iox::mepoo::MemoryInfo m_memoryInfo;
+        MemoryPagingConfig m_memoryPagingConfig;
     };
 
     vector<SegmentEntry, MAX_SHM_SEGMENTS> m_sharedMemorySegments;
@@ -0,0 +1,41 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_LATEST_VALUE_PUBLISHER_HPP
+#define IOX_POSH_POPO_LATEST_VALUE_PUBLISHER_HPP
+
+#include "iceoryx_posh/internal/popo/latest_value_publisher_impl.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The LatestValuePublisher class publishes small state values of which the subscribers only need the newest
+/// one. The value is written into a double buffered seqlock cell in the shared memory which every subscriber reads
+/// directly, hence publishing and reading a value needs no allocation. There must be only one LatestValuePublisher per
+/// service and the topic must only be subscribed with the LatestValueSubscriber.
+/// @param[in] T trivially copyable value type with a size of at most LatestValueBuffer::MAX_VALUE_SIZE
+template <typename T>
+class LatestValuePublisher : public LatestValuePublisherImpl<T>
+{
+  public:
+    using LatestValuePublisherImpl<T>::LatestValuePublisherImpl;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_LATEST_VALUE_PUBLISHER_HPP
@@ -19,15 +19,21 @@
 
 #include "iceoryx_hoofs/internal/concurrent/loffli.hpp"
 #include "iceoryx_hoofs/internal/concurrent/smart_lock.hpp"
+#include "iceoryx_hoofs/posix_wrapper/thread.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/popo/enum_trigger_type.hpp"
+#include "iceoryx_posh/popo/listener_options.hpp"
 #include "iceoryx_posh/popo/notification_attorney.hpp"
 #include "iceoryx_posh/popo/notification_callback.hpp"
 #include "iceoryx_posh/popo/trigger_handle.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/expected.hpp"
 #include "iox/function.hpp"
+#include "iox/logging.hpp"
+#include "iox/optional.hpp"
 
+#include <condition_variable>
 #include <thread>
 
 namespace iox
@@ -75,6 +81,7 @@ enum class ListenerError
     LISTENER_FULL,
     EVENT_ALREADY_ATTACHED,
     EMPTY_EVENT_CALLBACK,
+    INVALID_WORKER_INDEX,
 };
 
 /// @brief The Listener is a class which reacts to registered events by
@@ -98,11 +105,19 @@ enum class ListenerError
 ///
 ///            Best practice: Detach a specific event only from one specific thread and not
 ///                           from multiple contexts.
+/// @attention When the Listener is created with a worker pool, the callbacks of different events run concurrently.
+///            A callback which detaches another event blocks until the callback of the other event has finished,
+///            therefore two callbacks must not detach each other.
 template <uint64_t Capacity>
 class ListenerImpl
 {
   public:
     ListenerImpl() noexcept;
+
+    /// @brief Creates a Listener which executes the callbacks as configured by the options
+    /// @param[in] options the number of worker threads which execute the callbacks and their cpus
+    explicit ListenerImpl(const ListenerOptions& options) noexcept;
+
     ListenerImpl(const ListenerImpl&) = delete;
     ListenerImpl(ListenerImpl&&) = delete;
     ~ListenerImpl() noexcept;
@@ -121,6 +136,8 @@ class ListenerImpl
     /// @param[in] eventType enum required to specify the type of event inside of eventOrigin
     /// @param[in] eventCallback callback which will be executed concurrently when the event occurs. has to be created
     /// with iox::popo::createNotificationCallback
+    /// @param[in] workerIndex optional index of the worker which exclusively executes the callback, requires a
+    /// Listener with a worker pool
     /// @return If an error occurs the enum packed inside an expected which describes the error.
     template <typename T,
               typename EventType,
@@ -128,7 +145,8 @@ class ListenerImpl
               typename = std::enable_if_t<std::is_enum<EventType>::value>>
     expected<void, ListenerError> attachEvent(T& eventOrigin,
                                               const EventType eventType,
-                                              const NotificationCallback<T, ContextDataType>& eventCallback) noexcept;
+                                              const NotificationCallback<T, ContextDataType>& eventCallback,
+                                              const optional<uint32_t> workerIndex = nullopt) noexcept;
 
     /// @brief Attaches an event. Hereby the event is defined as a class T, the eventOrigin and
     ///        the corresponding callback which will be called when the event occurs.
@@ -139,10 +157,13 @@ class ListenerImpl
     /// @param[in] eventOrigin the object which will signal the event (the origin)
     /// @param[in] eventCallback callback which will be executed concurrently when the event occurs. Has to be created
     /// with iox::popo::createNotificationCallback
+    /// @param[in] workerIndex optional index of the worker which exclusively executes the callback, requires a
+    /// Listener with a worker pool
     /// @return If an error occurs the enum packed inside an expected which describes the error.
     template <typename T, typename ContextDataType>
     expected<void, ListenerError> attachEvent(T& eventOrigin,
-                                              const NotificationCallback<T, ContextDataType>& eventCallback) noexcept;
+                                              const NotificationCallback<T, ContextDataType>& eventCallback,
+                                              const optional<uint32_t> workerIndex = nullopt) noexcept;
 
     /// @brief Detaches an event. Hereby, the event is defined as a class T, the eventOrigin and
     ///        the eventType with further specifies the event inside of eventOrigin
@@ -167,20 +188,33 @@ class ListenerImpl
     /// @return size of the Listener
     uint64_t size() const noexcept;
 
+    /// @brief Returns the number of worker threads which execute the callbacks
+    /// @return zero if the callbacks are executed by the thread which waits for the events
+    uint32_t numberOfWorkers() const noexcept;
+
   protected:
-    ListenerImpl(ConditionVariableData& conditionVariableData) noexcept;
+    ListenerImpl(ConditionVariableData& conditionVariableData, const ListenerOptions& options = {}) noexcept;
 
   private:
     class Event_t;
 
     void threadLoop() noexcept;
+    void workerLoop(const uint32_t workerIndex) noexcept;
+    void scheduleEvent(const uint32_t eventId) noexcept;
+    void enqueueEvent(const uint32_t eventId) noexcept;
+    bool popEvent(const uint32_t workerIndex, uint32_t& eventId) noexcept;
+    bool stealEvent(const uint32_t workerIndex, uint32_t& eventId) noexcept;
+    void executeScheduledEvent(const uint32_t eventId) noexcept;
+    void resetEventState(const uint32_t eventId) noexcept;
+    void wakeUpWorker(const uint32_t workerIndex) noexcept;
     expected<uint32_t, ListenerError> addEvent(void* const origin,
                                                void* const userType,
                                                const uint64_t eventType,
                                                const uint64_t eventTypeHash,
                                                internal::GenericCallbackRef_t callback,
                                                internal::TranslationCallbackRef_t translationCallback,
-                                               const function<void(uint64_t)> invalidationCallback) noexcept;
+                                               const function<void(uint64_t)> invalidationCallback,
+                                               const optional<uint32_t> workerIndex) noexcept;
 
     void removeTrigger(const uint64_t index) noexcept;
 
@@ -205,6 +239,50 @@ class ListenerImpl
         std::atomic<uint64_t> m_indicesInUse{0U};
     } m_indexManager;
 
+    /// @brief A scheduled event is queued at most once, hence a queue never holds more than Capacity events
+    class EventQueue_t
+    {
+      public:
+        void push(const uint32_t eventId) noexcept;
+        bool pop(uint32_t& eventId) noexcept;
+        bool remove(const uint32_t eventId) noexcept;
+
+      private:
+        using Index_t = BestFittingType_t<Capacity>;
+        Index_t m_eventIds[Capacity];
+        uint64_t m_readPosition{0U};
+        uint64_t m_size{0U};
+    };
+
+    /// @brief The scheduling state of an event, guarantees that the callback of an event is queued at most once and
+    ///        never executed concurrently to itself
+    enum class EventState : uint8_t
+    {
+        IDLE,
+        QUEUED,
+        RUNNING,
+        RUNNING_AND_NOTIFIED
+    };
+
+    struct Worker_t
+    {
+        std::mutex m_mutex;
+        std::condition_variable m_wakeUpCondition;
+        bool m_wakeUp{false};
+        EventQueue_t m_pinnedEvents;
+        EventQueue_t m_stealableEvents;
+        std::thread m_thread;
+    };
+
+    static_assert(MAX_NUMBER_OF_WORKERS_PER_LISTENER <= 64U, "the idle workers are tracked in a 64 bit mask");
+    static constexpr uint32_t NO_WORKER = std::numeric_limits<uint32_t>::max();
+
+    uint32_t m_numberOfWorkers{0U};
+    Worker_t m_workers[MAX_NUMBER_OF_WORKERS_PER_LISTENER];
+    std::atomic<EventState> m_eventStates[Capacity];
+    std::atomic<uint32_t> m_eventWorkers[Capacity];
+    std::atomic<uint64_t> m_idleWorkers{0U};
+    std::atomic_bool m_stopWorkers{false};
 
     std::thread m_thread;
     concurrent::smart_lock<internal::Event_t, std::recursive_mutex> m_events[Capacity];
@@ -220,9 +298,10 @@ class Listener : public ListenerImpl<MAX_NUMBER_OF_EVENTS_PER_LISTENER>
   public:
     using Parent = ListenerImpl<MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     Listener() noexcept;
+    explicit Listener(const ListenerOptions& options) noexcept;
 
   protected:
-    Listener(ConditionVariableData& conditionVariableData) noexcept;
+    Listener(ConditionVariableData& conditionVariableData, const ListenerOptions& options = {}) noexcept;
 };
 
 } // namespace popo
@@ -0,0 +1,45 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_LISTENER_OPTIONS_HPP
+#define IOX_POSH_POPO_LISTENER_OPTIONS_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/vector.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief This struct is used to configure the threads which execute the callbacks of the Listener
+struct ListenerOptions
+{
+    /// @brief The number of worker threads which execute the callbacks. With zero workers the callbacks are executed
+    ///        one after another by the thread which waits for the events. With one or more workers the callbacks of
+    ///        different events are executed concurrently, but the callback of one event never runs concurrently to
+    ///        itself. Idle workers steal the pending callbacks of busy workers unless the event is pinned to a worker.
+    uint32_t numberOfWorkers{0U};
+
+    /// @brief The cpus the workers are pinned to. The worker with index i runs on workerCpus[i], workers without a
+    ///        corresponding entry are not pinned
+    vector<uint32_t, MAX_NUMBER_OF_WORKERS_PER_LISTENER> workerCpus;
+};
+
+} // namespace popo
+} // namespace iox
+#endif // IOX_POSH_POPO_LISTENER_OPTIONS_HPP
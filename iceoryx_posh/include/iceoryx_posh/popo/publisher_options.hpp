@@ -44,6 +44,29 @@ struct PublisherOptions
     /// @brief The option whether the publisher should block when the subscriber queue is full
     ConsumerTooSlowPolicy subscriberTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The number of chunks the publisher reserves in advance from the mempool with one refill; this reduces
+    /// the contention on the shared mempools when many publishers loan concurrently. It is limited to
+    /// MAX_CHUNK_MAGAZINE_CAPACITY and 0 disables the reservation
+    uint32_t chunkMagazineCapacity{0U};
+
+    /// @brief The number of subscribers from which on a sample is broadcasted; the reference counter of the sample is
+    /// incremented once for all subscribers and subscribers which are attached to the same WaitSet or Listener are
+    /// woken up only once. 0 disables the broadcast
+    uint64_t broadcastDeliveryThreshold{0U};
+
+    /// @brief The option whether a broadcasted sample is delivered to half of the subscribers by a helper thread of
+    /// the publisher in parallel to the publishing thread; only has an effect in combination with
+    /// broadcastDeliveryThreshold
+    bool parallelBroadcastDelivery{false};
+
+    /// @brief The number of latest samples the publisher keeps in a ring which is shared by all subscribers. If it is
+    /// not 0, a sample is written only once into the ring and the subscribers read it from there with their own
+    /// cursor instead of getting it into their queue; a subscriber which is too slow loses the overwritten samples.
+    /// The ring replaces the history and is limited to MAX_PUBLISHER_HISTORY; the subscriberTooSlowPolicy does not
+    /// apply to it. A subscriber can read from the rings of up to MAX_CHUNK_RINGS_PER_SUBSCRIBER publishers and gets
+    /// the samples of publishers without a ring into its queue
+    uint64_t chunkRingCapacity{0U};
+
     /// @brief serialization of the PublisherOptions
     cxx::Serialization serialize() const noexcept;
     /// @brief deserialization of the PublisherOptions
@@ -32,12 +32,12 @@ class RpcBaseHeader
   public:
     /// @brief Constructs and initializes a RpcBaseHeader
     /// @param[in] uniqueClientQueueId is the iox::UniqueId of the client queue where the response shall be delivered
-    /// @param[in] lastKnownClientQueueIndex is the last know index of the client queue in the ChunkDistributor for fast
-    /// lookup
+    /// @param[in] clientQueueHandle is the handle of the client queue in the ChunkDistributor of the server which
+    /// delivers the response without a lookup
     /// @param[in] sequenceId is a custom ID to map a response to a request
     /// @param[in] rpcHeaderVersion is set by RequestHeader/ResponseHeader and should be RPC_HEADER_VERSION
     explicit RpcBaseHeader(const UniqueId& uniqueClientQueueId,
-                           const uint32_t lastKnownClientQueueIndex,
+                           const uint32_t clientQueueHandle,
                            const int64_t sequenceId,
                            const uint8_t rpcHeaderVersion) noexcept;
 
@@ -52,9 +52,9 @@ class RpcBaseHeader
     ///            - members are rearranged
     ///            - semantic meaning of a member changes
     ///        in any of RpcBaseHeader, RequestHeader or ResponseHeader!
-    static constexpr uint8_t RPC_HEADER_VERSION{1U};
+    static constexpr uint8_t RPC_HEADER_VERSION{2U};
 
-    static constexpr uint32_t UNKNOWN_CLIENT_QUEUE_INDEX{std::numeric_limits<uint32_t>::max()};
+    static constexpr uint32_t UNKNOWN_CLIENT_QUEUE_HANDLE{std::numeric_limits<uint32_t>::max()};
     static constexpr int64_t START_SEQUENCE_ID{0};
 
     /// @brief The RpcBaseHeader version is used to detect incompatibilities for record&replay functionality
@@ -85,7 +85,7 @@ class RpcBaseHeader
 
   protected:
     uint8_t m_rpcHeaderVersion{RPC_HEADER_VERSION};
-    uint32_t m_lastKnownClientQueueIndex{UNKNOWN_CLIENT_QUEUE_INDEX};
+    uint32_t m_clientQueueHandle{UNKNOWN_CLIENT_QUEUE_HANDLE};
     UniqueId m_uniqueClientQueueId;
     int64_t m_sequenceId{0};
 };
@@ -95,9 +95,9 @@ class RequestHeader : public RpcBaseHeader
   public:
     /// @brief Constructs and initializes a RpcBaseHeader
     /// @param[in] uniqueClientQueueId is the iox::UniqueId of the client queue to which the response shall be delivered
-    /// @param[in] lastKnownClientQueueIndex is the last know index of the client queue in the ChunkDistributor for fast
-    /// lookup
-    explicit RequestHeader(const UniqueId& uniqueClientQueueId, const uint32_t lastKnownClientQueueIndex) noexcept;
+    /// @param[in] clientQueueHandle is the handle of the client queue in the ChunkDistributor of the server which
+    /// delivers the response without a lookup
+    explicit RequestHeader(const UniqueId& uniqueClientQueueId, const uint32_t clientQueueHandle) noexcept;
 
     RequestHeader(const RequestHeader& other) = delete;
     RequestHeader& operator=(const RequestHeader&) = delete;
@@ -121,11 +121,11 @@ class ResponseHeader : public RpcBaseHeader
   public:
     /// @brief Constructs and initializes a RpcBaseHeader
     /// @param[in] uniqueClientQueueId is the iox::UniqueId of the client queue to which the response shall be delivered
-    /// @param[in] lastKnownClientQueueIndex is the last know index of the client queue in the ChunkDistributor for fast
-    /// lookup
+    /// @param[in] clientQueueHandle is the handle of the client queue in the ChunkDistributor of the server which
+    /// delivers the response without a lookup
     /// @param[in] sequenceId is a custom ID to map a response to a request
     explicit ResponseHeader(const UniqueId& uniqueClientQueueId,
-                            const uint32_t lastKnownClientQueueIndex,
+                            const uint32_t clientQueueHandle,
                             const int64_t sequenceId) noexcept;
 
     ResponseHeader(const ResponseHeader& other) = delete;
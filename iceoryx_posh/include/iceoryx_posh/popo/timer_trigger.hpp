@@ -0,0 +1,105 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_TIMER_TRIGGER_HPP
+#define IOX_POSH_POPO_TIMER_TRIGGER_HPP
+
+#include "iceoryx_posh/internal/popo/building_blocks/timer_wheel.hpp"
+#include "iceoryx_posh/popo/trigger.hpp"
+#include "iceoryx_posh/popo/trigger_handle.hpp"
+#include "iox/duration.hpp"
+
+#include <mutex>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief A periodic trigger which can be attached as event to a WaitSet or Listener. The timers are kept in the
+///        TimerWheel of the WaitSet/Listener and the waiting thread is woken up when one of them expires, hence a
+///        TimerTrigger requires no thread, no operating system timer and no syscall per expiry.
+/// @code
+///     TimerTrigger timer(100_ms);
+///     waitset.attachEvent(timer).or_else([](auto){/*error handling*/});
+///     timer.start();
+/// @endcode
+class TimerTrigger
+{
+  public:
+    /// @brief Creates a stopped TimerTrigger
+    /// @param[in] period the time between two expiries, must be greater than zero
+    explicit TimerTrigger(const units::Duration period) noexcept;
+    ~TimerTrigger() noexcept;
+
+    TimerTrigger(const TimerTrigger& rhs) = delete;
+    TimerTrigger(TimerTrigger&& rhs) = delete;
+    TimerTrigger& operator=(const TimerTrigger& rhs) = delete;
+    TimerTrigger& operator=(TimerTrigger&& rhs) = delete;
+
+    /// @brief Starts the timer, the first expiry is one period from now. When the TimerTrigger is not attached the
+    ///        timer starts when it is attached. Restarting a running timer resets its period and its statistics.
+    void start() noexcept;
+
+    /// @brief Stops the timer, an expiry which was already reported stays active until it is handled
+    void stop() noexcept;
+
+    /// @brief Checks if the timer was started
+    /// @return true if the timer is running, otherwise false
+    bool isRunning() const noexcept;
+
+    /// @brief Returns the period of the timer
+    units::Duration getPeriod() const noexcept;
+
+    /// @brief Checks if the TimerTrigger expired
+    /// @return true if the TimerTrigger expired, otherwise false.
+    /// @note The hasTriggered state will be reset after it was handled by a WaitSet/Listener
+    bool hasTriggered() const noexcept;
+
+    /// @brief Returns how much later than scheduled the expiries were reported to the waiting thread since the last
+    ///        start
+    /// @return the jitter statistics, all zero when the TimerTrigger is not attached
+    TimerJitterStatistics getJitterStatistics() const noexcept;
+
+    friend class NotificationAttorney;
+
+  private:
+    /// @brief Only usable by the WaitSet/Listener, not for public use. Invalidates the internal triggerHandle.
+    /// @param[in] uniqueTriggerId the id of the corresponding trigger
+    void invalidateTrigger(const uint64_t uniqueTriggerId) noexcept;
+
+    /// @brief Only usable by the WaitSet/Listener, not for public use. Attaches the triggerHandle to the internal
+    ///        trigger.
+    /// @param[in] triggerHandle rvalue reference to the triggerHandle. This class takes the ownership of that handle.
+    void enableEvent(iox::popo::TriggerHandle&& triggerHandle) noexcept;
+
+    /// @brief Only usable by the WaitSet/Listener, not for public use. Resets the internal triggerHandle
+    void disableEvent() noexcept;
+
+    void scheduleTimer() noexcept;
+    void cancelTimer() noexcept;
+
+  private:
+    units::Duration m_period;
+    bool m_isRunning{false};
+    TriggerHandle m_trigger;
+    // recursive since resetting the trigger handle invalidates the trigger via the WaitSet/Listener
+    mutable std::recursive_mutex m_mutex;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_TIMER_TRIGGER_HPP
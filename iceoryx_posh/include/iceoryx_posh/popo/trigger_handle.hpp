@@ -27,6 +27,8 @@ namespace iox
 {
 namespace popo
 {
+class TimerWheel;
+
 /// @brief TriggerHandle is threadsafe without restrictions in a single process.
 ///        Not qualified for inter process usage. The TriggerHandle is generated
 ///        by a Notifyable like the WaitSet and handed out to the user when they
@@ -44,9 +46,11 @@ class TriggerHandle
     /// @param[in] resetCallback callback which will be called it goes out of scope or reset is called
     /// @param[in] uniqueTriggerId the unique trigger id of the Trigger which corresponds to the TriggerHandle. Usually
     /// stored in a Notifyable. It is required for the resetCallback
+    /// @param[in] timerWheel the TimerWheel of the Notifyable which schedules the timers of the TimerTrigger, optional
     TriggerHandle(ConditionVariableData& conditionVariableData,
                   const function<void(uint64_t)>& resetCallback,
-                  const uint64_t uniqueTriggerId) noexcept;
+                  const uint64_t uniqueTriggerId,
+                  TimerWheel* const timerWheel = nullptr) noexcept;
     TriggerHandle(const TriggerHandle&) = delete;
     TriggerHandle& operator=(const TriggerHandle&) = delete;
 
@@ -83,8 +87,12 @@ class TriggerHandle
     /// @brief returns the pointer to the ConditionVariableData
     ConditionVariableData* getConditionVariableData() noexcept;
 
+    /// @brief returns the pointer to the TimerWheel of the Notifyable, nullptr if it does not provide one
+    TimerWheel* getTimerWheel() const noexcept;
+
   private:
     ConditionVariableData* m_conditionVariableDataPtr = nullptr;
+    TimerWheel* m_timerWheelPtr = nullptr;
     function<void(uint64_t)> m_resetCallback = [](auto) {};
     uint64_t m_uniqueTriggerId = Trigger::INVALID_TRIGGER_ID;
     mutable std::recursive_mutex m_mutex;
@@ -200,6 +200,12 @@ class WaitSet
     /// @return NotificationInfoVector of NotificationInfos that have been triggered
     NotificationInfoVector wait() noexcept;
 
+    /// @brief Sets the duration wait() and timedWait() busy wait for a trigger before the thread is blocked. Useful
+    ///        for latency critical applications which can afford to spend the CPU time. The default is zero, i.e. the
+    ///        thread is blocked right away.
+    /// @param[in] spinDuration the maximum duration to busy wait before blocking
+    void setSpinDuration(const units::Duration spinDuration) noexcept;
+
     /// @brief Returns the amount of stored Trigger inside of the WaitSet
     uint64_t size() const noexcept;
 
@@ -41,6 +41,8 @@ struct MemPoolInfo
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
     uint32_t m_chunkPayloadSize{0};
+    /// @brief number of allocations which failed since the mempool ran out of chunks
+    uint64_t m_failedAllocations{0};
 };
 
 /// @brief container for MemPoolInfo structs of all available mempools.
@@ -54,6 +56,11 @@ struct MemPoolIntrospectionInfo
     GroupName_t m_writerGroupName;
     GroupName_t m_readerGroupName;
     MemPoolInfoContainer m_mempoolInfo;
+    /// @brief number of failed chunk allocations of the segment which were caused by a request which did not fit into
+    /// any mempool
+    uint64_t m_numberOfChunkTooLargeErrors{0};
+    /// @brief number of failed chunk allocations of the segment which were caused by exhausted mempools
+    uint64_t m_numberOfOutOfChunksErrors{0};
 };
 
 /// @brief container for MemPoolInfo structs of all available mempools.
@@ -21,6 +21,7 @@
 
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/mepoo/memory_paging_config.hpp"
 #include "iox/expected.hpp"
 #include "iox/filesystem.hpp"
 #include "iox/optional.hpp"
@@ -40,9 +41,11 @@ class PosixShmMemoryProvider : public MemoryProvider
     /// @param [in] shmName is the name of the posix share memory
     /// @param [in] accessMode defines the read and write access to the memory
     /// @param [in] openMode defines the creation/open mode of the shared memory.
+    /// @param [in] memoryPagingConfig defines how the pages of the shared memory are backed
     PosixShmMemoryProvider(const ShmName_t& shmName,
                            const posix::AccessMode accessMode,
-                           const posix::OpenMode openMode) noexcept;
+                           const posix::OpenMode openMode,
+                           const mepoo::MemoryPagingConfig& memoryPagingConfig = mepoo::MemoryPagingConfig()) noexcept;
     ~PosixShmMemoryProvider() noexcept;
 
     PosixShmMemoryProvider(PosixShmMemoryProvider&&) = delete;
@@ -51,6 +54,10 @@ class PosixShmMemoryProvider : public MemoryProvider
     PosixShmMemoryProvider(const PosixShmMemoryProvider&) = delete;
     PosixShmMemoryProvider& operator=(const PosixShmMemoryProvider&) = delete;
 
+    /// @brief Returns the size of the pages which actually back the shared memory
+    /// @return the page size or nullopt if the memory is not yet created or the page size cannot be acquired
+    optional<uint64_t> pageSize() const noexcept;
+
   protected:
     /// @copydoc MemoryProvider::createMemory
     /// @note This creates and maps a POSIX shared memory to the address space of the application
@@ -65,6 +72,8 @@ class PosixShmMemoryProvider : public MemoryProvider
     posix::AccessMode m_accessMode{posix::AccessMode::READ_ONLY};
     posix::OpenMode m_openMode{posix::OpenMode::OPEN_EXISTING};
     optional<posix::SharedMemoryObject> m_shmObject;
+    mepoo::MemoryPagingConfig m_memoryPagingConfig;
+    optional<uint64_t> m_pageSize;
 
     static constexpr access_rights SHM_MEMORY_PERMISSIONS =
         perms::owner_read | perms::owner_write | perms::group_read | perms::group_write;
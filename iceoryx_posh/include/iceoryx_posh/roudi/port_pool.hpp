@@ -28,6 +28,7 @@
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_multi_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_single_producer.hpp"
 #include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
+#include "iceoryx_posh/internal/runtime/control_channel_data.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
 #include "iceoryx_posh/popo/client_options.hpp"
 #include "iceoryx_posh/popo/publisher_options.hpp"
@@ -54,6 +55,7 @@ enum class PortPoolError : uint8_t
     NODE_DATA_LIST_FULL,
     CONDITION_VARIABLE_LIST_FULL,
     EVENT_VARIABLE_LIST_FULL,
+    CONTROL_CHANNEL_LIST_FULL,
 };
 
 class PortPool
@@ -70,6 +72,21 @@ class PortPool
     vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER> getInterfacePortDataList() noexcept;
     vector<runtime::NodeData*, MAX_NODE_NUMBER> getNodeDataList() noexcept;
     vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES> getConditionVariableDataList() noexcept;
+    vector<runtime::ControlChannelData*, MAX_NUMBER_OF_CONTROL_CHANNELS> getControlChannelDataList() noexcept;
+
+    /// @brief The getPending*DataList methods return the members which requested the discovery since the last call
+    /// and reset their requests
+    vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS> getPendingPublisherPortDataList() noexcept;
+    vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS> getPendingSubscriberPortDataList() noexcept;
+    vector<popo::ClientPortData*, MAX_CLIENTS> getPendingClientPortDataList() noexcept;
+    vector<popo::ServerPortData*, MAX_SERVERS> getPendingServerPortDataList() noexcept;
+    vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER> getPendingInterfacePortDataList() noexcept;
+    vector<runtime::NodeData*, MAX_NODE_NUMBER> getPendingNodeDataList() noexcept;
+    vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES>
+    getPendingConditionVariableDataList() noexcept;
+
+    /// @brief Returns the condition variable which is notified whenever a member requests the discovery
+    popo::ConditionVariableData& getDiscoveryConditionVariableData() noexcept;
 
     expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     addPublisherPort(const capro::ServiceDescription& serviceDescription,
@@ -134,6 +151,12 @@ class PortPool
     expected<popo::ConditionVariableData*, PortPoolError>
     addConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
+    /// @brief Adds a ControlChannelData to the internal pool and returns a pointer for further usage
+    /// @param[in] runtimeName of the runtime the new control channel belongs to
+    /// @return on success a pointer to a ControlChannelData; on error a PortPoolError
+    expected<runtime::ControlChannelData*, PortPoolError>
+    addControlChannelData(const RuntimeName_t& runtimeName) noexcept;
+
     /// @brief Removes a PublisherPortData from the internal pool
     /// @param[in] portData is a  pointer to the PublisherPortData to be removed
     /// @note after this call the provided PublisherPortData is no longer available for usage
@@ -169,7 +192,17 @@ class PortPool
     /// @note after this call the provided ConditionVariableData is no longer available for usage
     void removeConditionVariableData(const popo::ConditionVariableData* const conditionVariableData) noexcept;
 
+    /// @brief Removes a ControlChannelData from the internal pool
+    /// @param[in] controlChannelData is a pointer to the ControlChannelData to be removed
+    /// @note after this call the provided ControlChannelData is no longer available for usage
+    void removeControlChannelData(const runtime::ControlChannelData* const controlChannelData) noexcept;
+
   private:
+    /// @brief Equips a newly added member with its DiscoveryNotifier and requests the discovery once, to process the
+    /// initial requests of the member like the subscribe on create
+    template <typename T, uint64_t Capacity>
+    T* setupDiscoveryNotifier(FixedPositionContainer<T, Capacity>& container, T* const member) noexcept;
+
     PortPoolData* m_portPoolData;
 };
 
@@ -52,6 +52,15 @@ inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro:
         subscriberOptions,
         memoryInfo);
 }
+
+template <typename T, uint64_t Capacity>
+inline T* PortPool::setupDiscoveryNotifier(FixedPositionContainer<T, Capacity>& container, T* const member) noexcept
+{
+    member->m_discoveryNotifier =
+        container.discoveryNotifier(member, m_portPoolData->m_discoveryConditionVariable);
+    member->m_discoveryNotifier.notify();
+    return member;
+}
 } // namespace roudi
 } // namespace iox
 
@@ -58,6 +58,7 @@ class RouDiApp
 
     version::CompatibilityCheckLevel m_compatibilityCheckLevel{version::CompatibilityCheckLevel::PATCH};
     units::Duration m_processKillDelay{roudi::PROCESS_DEFAULT_KILL_DELAY};
+    uint32_t m_numberOfRuntimeMessageWorkers{roudi::DEFAULT_NUMBER_OF_RUNTIME_MESSAGE_WORKERS};
 
   private:
     bool checkAndOptimizeConfig(const RouDiConfig_t& config) noexcept;
@@ -17,6 +17,7 @@
 #define IOX_POSH_ROUDI_ROUDI_CONFIG_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/mepoo/memory_paging_config.hpp"
 
 #include <cstdint>
 
@@ -28,6 +29,10 @@ struct RouDiConfig
 {
     RouDiConfig& setDefaults() noexcept;
     RouDiConfig& optimize() noexcept;
+
+    /// @brief Defines how the pages of the management shared memory are backed; the pages of the payload segments are
+    /// configured with the SegmentConfig
+    mepoo::MemoryPagingConfig m_managementMemoryPagingConfig;
 };
 } // namespace config
 } // namespace iox
@@ -0,0 +1,121 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_RUNTIME_PORT_BATCH_HPP
+#define IOX_POSH_RUNTIME_PORT_BATCH_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/runtime/port_request.hpp"
+#include "iox/expected.hpp"
+#include "iox/optional.hpp"
+#include "iox/vector.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace runtime
+{
+enum class PortBatchError : uint8_t
+{
+    BATCH_FULL,
+    ALREADY_COMMITTED,
+};
+
+/// @brief Collects publisher and subscriber ports which are created together with a single call of
+/// PoshRuntime::createPorts. The ports are prepared first, then the batch is committed and finally each port is
+/// handed over to the constructor of its publisher or subscriber.
+/// @code
+///     iox::runtime::PortBatch<> batch;
+///     auto radarIndex = batch.preparePublisher({"Radar", "FrontLeft", "Object"}).value();
+///     auto lidarIndex = batch.prepareSubscriber({"Lidar", "Roof", "PointCloud"}).value();
+///     batch.commit();
+///
+///     iox::popo::Publisher<RadarObject> publisher(batch.takePublisher(radarIndex).value());
+///     iox::popo::Subscriber<PointCloud> subscriber(batch.takeSubscriber(lidarIndex).value());
+/// @endcode
+/// @note Ports which were created but not taken are released with the destruction of the batch
+/// @note A batch is created as a whole or not at all; if a port cannot be created, the other ports of the batch are
+/// released again
+/// @note RouDi receives the requests of a commit in groups of MAX_CONTROL_CHANNEL_REQUESTS with one round trip each,
+/// i.e. a full batch with the default capacity takes a single round trip
+/// @tparam Capacity the maximum number of ports of the batch
+template <uint64_t Capacity = DEFAULT_PORT_BATCH_CAPACITY>
+class PortBatch
+{
+  public:
+    PortBatch() noexcept = default;
+    PortBatch(const PortBatch&) = delete;
+    PortBatch(PortBatch&&) = delete;
+    PortBatch& operator=(const PortBatch&) = delete;
+    PortBatch& operator=(PortBatch&&) = delete;
+    ~PortBatch() noexcept;
+
+    /// @brief adds a publisher port to the batch
+    /// @param[in] service service description for the new publisher port
+    /// @param[in] publisherOptions like the history capacity of a publisher
+    /// @param[in] portConfigInfo configuration information for the port
+    /// @return the index of the port in the batch which is used to take the port after the commit, or an error if
+    /// the batch is full or was already committed
+    expected<uint64_t, PortBatchError> preparePublisher(const capro::ServiceDescription& service,
+                                                        const popo::PublisherOptions& publisherOptions = {},
+                                                        const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief adds a subscriber port to the batch
+    /// @param[in] service service description for the new subscriber port
+    /// @param[in] subscriberOptions like the queue capacity and history requested by a subscriber
+    /// @param[in] portConfigInfo configuration information for the port
+    /// @return the index of the port in the batch which is used to take the port after the commit, or an error if
+    /// the batch is full or was already committed
+    expected<uint64_t, PortBatchError> prepareSubscriber(const capro::ServiceDescription& service,
+                                                         const popo::SubscriberOptions& subscriberOptions = {},
+                                                         const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief creates all prepared ports with one call of PoshRuntime::createPorts; further calls have no effect
+    /// @return the number of prepared ports if all of them were created, otherwise 0 since the ports which were
+    /// already created are released again
+    uint64_t commit() noexcept;
+
+    /// @brief checks if the batch was already committed
+    /// @return true if commit was called, otherwise false
+    bool isCommitted() const noexcept;
+
+    /// @brief takes a created publisher port out of the batch, commits the batch if this was not yet done
+    /// @param[in] index the index returned by preparePublisher
+    /// @return the prepared publisher for the constructor of a publisher, or nullopt if the index does not belong to
+    /// a publisher, the port could not be created or was already taken
+    optional<PreparedPublisher> takePublisher(const uint64_t index) noexcept;
+
+    /// @brief takes a created subscriber port out of the batch, commits the batch if this was not yet done
+    /// @param[in] index the index returned by prepareSubscriber
+    /// @return the prepared subscriber for the constructor of a subscriber, or nullopt if the index does not belong
+    /// to a subscriber, the port could not be created or was already taken
+    optional<PreparedSubscriber> takeSubscriber(const uint64_t index) noexcept;
+
+  private:
+    expected<uint64_t, PortBatchError> prepare(const PortRequest& request) noexcept;
+    void releasePorts() noexcept;
+
+    vector<PortRequest, Capacity> m_requests;
+    bool m_isCommitted{false};
+};
+
+} // namespace runtime
+} // namespace iox
+
+#include "iceoryx_posh/internal/runtime/port_batch.inl"
+
+#endif // IOX_POSH_RUNTIME_PORT_BATCH_HPP
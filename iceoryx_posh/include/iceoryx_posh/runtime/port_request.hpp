@@ -0,0 +1,94 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_RUNTIME_PORT_REQUEST_HPP
+#define IOX_POSH_RUNTIME_PORT_REQUEST_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
+#include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace runtime
+{
+enum class PortRequestType : uint8_t
+{
+    PUBLISHER,
+    SUBSCRIBER,
+};
+
+/// @brief Describes one port for the bulk port creation with PoshRuntime::createPorts. Depending on the type only the
+/// publisher or the subscriber options are evaluated. The created port is written back into the request.
+struct PortRequest
+{
+    /// @brief creates a request for a publisher port
+    /// @param[in] service service description for the new publisher port
+    /// @param[in] publisherOptions like the history capacity of a publisher
+    /// @param[in] portConfigInfo configuration information for the port
+    /// @return the publisher port request
+    static PortRequest publisher(const capro::ServiceDescription& service,
+                                 const popo::PublisherOptions& publisherOptions = {},
+                                 const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief creates a request for a subscriber port
+    /// @param[in] service service description for the new subscriber port
+    /// @param[in] subscriberOptions like the queue capacity and history requested by a subscriber
+    /// @param[in] portConfigInfo configuration information for the port
+    /// @return the subscriber port request
+    static PortRequest subscriber(const capro::ServiceDescription& service,
+                                  const popo::SubscriberOptions& subscriberOptions = {},
+                                  const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief releases the port which was created for this request, if any
+    void releasePort() noexcept;
+
+    PortRequestType type{PortRequestType::PUBLISHER};
+    capro::ServiceDescription service;
+    popo::PublisherOptions publisherOptions;
+    popo::SubscriberOptions subscriberOptions;
+    PortConfigInfo portConfigInfo;
+
+    /// set by PoshRuntime::createPorts for a successfully created publisher port, otherwise a nullptr
+    PublisherPortUserType::MemberType_t* publisherPortData{nullptr};
+    /// set by PoshRuntime::createPorts for a successfully created subscriber port, otherwise a nullptr
+    SubscriberPortUserType::MemberType_t* subscriberPortData{nullptr};
+};
+
+/// @brief A publisher port which was created in advance, e.g. by a PortBatch, and which is handed over to the
+/// constructor of a publisher. The publisher takes the ownership of the port.
+struct PreparedPublisher
+{
+    PublisherPortUserType::MemberType_t* portData{nullptr};
+    popo::PublisherOptions publisherOptions;
+};
+
+/// @brief A subscriber port which was created in advance, e.g. by a PortBatch, and which is handed over to the
+/// constructor of a subscriber. The subscriber takes the ownership of the port.
+struct PreparedSubscriber
+{
+    SubscriberPortUserType::MemberType_t* portData{nullptr};
+};
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_PORT_REQUEST_HPP
@@ -31,8 +31,10 @@
 #include "iceoryx_posh/popo/server_options.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iceoryx_posh/runtime/port_request.hpp"
 #include "iox/optional.hpp"
 #include "iox/scope_guard.hpp"
+#include "iox/span.hpp"
 
 #include <atomic>
 
@@ -113,6 +115,15 @@ class PoshRuntime
                             const popo::SubscriberOptions& subscriberOptions = {},
                             const PortConfigInfo& portConfigInfo = {}) noexcept = 0;
 
+    /// @brief request the RouDi daemon to create the publisher and subscriber ports of all requests at once
+    /// @param[in,out] requests the port requests; the created ports are written back into the requests
+    /// @return the number of created ports, i.e. either the number of requests or 0
+    /// @note the ports are created as a whole or not at all; if one port cannot be created, the remaining requests are
+    /// not sent to RouDi and the ports which were already created are released again
+    /// @note the default implementation creates the ports one by one with getMiddlewarePublisher and
+    /// getMiddlewareSubscriber, runtimes with a faster path to RouDi override it
+    virtual uint64_t createPorts(const span<PortRequest> requests) noexcept;
+
     /// @brief request the RouDi daemon to create a client port
     /// @param[in] serviceDescription service description for the new client port
     /// @param[in] clientOptions like the queue capacity and queue full policy by a client
@@ -178,6 +189,11 @@ class PoshRuntime
     /// @param[in] factory function pointer to which the runtime factory should be set
     static void setRuntimeFactory(const factory_t& factory) noexcept;
 
+    /// @brief releases the ports which were created for the given requests; used by createPorts to roll back a
+    /// partially created set of ports
+    /// @param[in] requests the requests whose created ports shall be released
+    static void releasePorts(const span<PortRequest> requests) noexcept;
+
     /// @brief creates the runtime or returns the already existing one -> Singleton
     ///
     /// @param[in] name optional containing the name used for registering with the RouDi daemon
@@ -41,6 +41,21 @@ enum class ServiceDiscoveryEvent : popo::EventEnumIdentifier
 {
     SERVICE_REGISTRY_CHANGED
 };
+
+/// @brief Describes a service which became available or unavailable for a messaging pattern
+struct ServiceDiscoveryChange
+{
+    enum class Availability
+    {
+        AVAILABLE,
+        UNAVAILABLE
+    };
+
+    capro::ServiceDescription serviceDescription;
+    popo::MessagingPattern pattern{popo::MessagingPattern::PUB_SUB};
+    Availability availability{Availability::AVAILABLE};
+};
+
 class ServiceDiscovery
 {
   public:
@@ -65,6 +80,13 @@ class ServiceDiscovery
                      const function_ref<void(const capro::ServiceDescription&)>& callableForEach,
                      const popo::MessagingPattern pattern) noexcept;
 
+    /// @brief Applies the changes of the service registry which were published since the last update and calls the
+    /// provided callable for each service which became available or unavailable
+    /// @param[in] callableForEachChange callable to apply to each change
+    /// @note findService applies the changes as well, these changes are not reported again. The callable must not call
+    /// findService.
+    void processChanges(const function_ref<void(const ServiceDiscoveryChange&)>& callableForEachChange) noexcept;
+
     friend iox::popo::NotificationAttorney;
 
   private:
@@ -79,11 +101,22 @@ class ServiceDiscovery
     std::unique_ptr<roudi::ServiceRegistry> m_serviceRegistry{new iox::roudi::ServiceRegistry};
     std::mutex m_serviceRegistryMutex;
 
+    // the full service registry is only taken when changes were missed
     popo::Subscriber<roudi::ServiceRegistry> m_serviceRegistrySubscriber{
         {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_EVENT_NAME},
         {1U, 1U, iox::NodeName_t("Service Registry"), true}};
 
-    void update();
+    popo::Subscriber<roudi::ServiceRegistryChange> m_serviceRegistryChangesSubscriber{
+        {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_CHANGES_EVENT_NAME},
+        {SERVICE_REGISTRY_CHANGES_HISTORY,
+         SERVICE_REGISTRY_CHANGES_HISTORY,
+         iox::NodeName_t("Service Registry"),
+         true}};
+
+    void update(const function_ref<void(const ServiceDiscoveryChange&)>& callableForEachChange) noexcept;
+    void applyChange(const roudi::ServiceRegistryChange& change,
+                     const function_ref<void(const ServiceDiscoveryChange&)>& callableForEachChange) noexcept;
+    void catchUpWithSnapshot(const function_ref<void(const ServiceDiscoveryChange&)>& callableForEachChange) noexcept;
 };
 
 } // namespace runtime
@@ -20,6 +20,8 @@ namespace iox
 {
 namespace capro
 {
+constexpr uint32_t CaproMessage::INVALID_CHUNK_QUEUE_HANDLE;
+
 CaproMessage::CaproMessage(CaproMessageType type,
                            const ServiceDescription& serviceDescription,
                            CaproServiceType serviceType,
@@ -0,0 +1,211 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/chunk_magazine.hpp"
+#include "iceoryx_hoofs/cxx/requires.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iox/algorithm.hpp"
+#include "iox/logging.hpp"
+
+namespace iox
+{
+namespace mepoo
+{
+ChunkMagazine::ChunkMagazine(const uint32_t capacity) noexcept
+    : m_capacity(algorithm::minVal(capacity, MAX_CHUNK_MAGAZINE_CAPACITY))
+{
+    if (m_capacity != capacity)
+    {
+        IOX_LOG(WARN) << "Chunk magazine capacity too large, reducing from " << capacity << " to " << m_capacity;
+    }
+    m_isModified.clear(std::memory_order_release);
+}
+
+bool ChunkMagazine::isEnabled() const noexcept
+{
+    return m_capacity > 0U;
+}
+
+uint32_t ChunkMagazine::capacity() const noexcept
+{
+    return m_capacity;
+}
+
+uint32_t ChunkMagazine::size() const noexcept
+{
+    return m_size.load(std::memory_order_relaxed);
+}
+
+bool ChunkMagazine::canServe(const MemPool& memPool) const noexcept
+{
+    return m_size.load(std::memory_order_relaxed) == 0U || m_memPool.get() == &memPool;
+}
+
+bool ChunkMagazine::acquireChunk(MemPool& memPool,
+                                 MemPool& chunkManagementPool,
+                                 void*& chunk,
+                                 void*& chunkManagement) noexcept
+{
+    m_isModified.test_and_set(std::memory_order_acquire);
+    const bool hasChunk = takeChunk(memPool, chunkManagementPool, chunk, chunkManagement);
+    m_isModified.clear(std::memory_order_release);
+    return hasChunk;
+}
+
+bool ChunkMagazine::takeChunk(MemPool& memPool,
+                              MemPool& chunkManagementPool,
+                              void*& chunk,
+                              void*& chunkManagement) noexcept
+{
+    cxx::Expects(canServe(memPool));
+
+    if (m_size.load(std::memory_order_relaxed) == 0U && !refill(memPool, chunkManagementPool))
+    {
+        return false;
+    }
+
+    // the size is decremented first; if the process terminates before the chunk is stored in the UsedChunkList,
+    // the chunk is lost like with every other allocation in this critical section
+    const auto index = m_size.load(std::memory_order_relaxed) - 1U;
+    m_size.store(index, std::memory_order_relaxed);
+    chunk = memPool.acquireReservedChunk(m_chunkIndices[index]);
+    chunkManagement = chunkManagementPool.acquireReservedChunk(m_chunkManagementIndices[index]);
+    return true;
+}
+
+bool ChunkMagazine::refill(MemPool& memPool, MemPool& chunkManagementPool) noexcept
+{
+    prepareRefill(memPool, chunkManagementPool);
+
+    const auto numberOfChunks = memPool.reserveChunks(&m_chunkIndices[0], m_capacity);
+    if (numberOfChunks == 0U)
+    {
+        m_refillStage.store(RefillStage::IDLE, std::memory_order_relaxed);
+        return false;
+    }
+
+    m_refillStage.store(RefillStage::RESERVING_CHUNK_MANAGEMENTS, std::memory_order_relaxed);
+    const auto numberOfChunkManagements =
+        chunkManagementPool.reserveChunks(&m_chunkManagementIndices[0], numberOfChunks);
+    m_refillStage.store(RefillStage::RESERVED, std::memory_order_relaxed);
+
+    // the surplus chunks are removed from the record before they are returned; if the process terminates in between,
+    // only the chunk which is currently returned is lost
+    for (auto index = numberOfChunks; index > numberOfChunkManagements; --index)
+    {
+        const auto chunkIndex = m_chunkIndices[index - 1U];
+        m_chunkIndices[index - 1U] = INVALID_INDEX;
+        memPool.releaseReservedChunks(&chunkIndex, 1U);
+    }
+
+    // the size is published after the refill is recorded completely; 'drain' inspects the record only while the size
+    // is 0, hence the stage can be reset afterwards
+    m_size.store(numberOfChunkManagements, std::memory_order_relaxed);
+    m_refillStage.store(RefillStage::IDLE, std::memory_order_relaxed);
+    return numberOfChunkManagements > 0U;
+}
+
+void ChunkMagazine::prepareRefill(MemPool& memPool, MemPool& chunkManagementPool) noexcept
+{
+    // the MemPools and the cleared record are set before the stage so that 'drain' knows where to return the chunks
+    // which are recorded by an interrupted refill
+    m_memPool = &memPool;
+    m_chunkManagementPool = &chunkManagementPool;
+    for (uint32_t i = 0U; i < m_capacity; ++i)
+    {
+        m_chunkIndices[i] = INVALID_INDEX;
+        m_chunkManagementIndices[i] = INVALID_INDEX;
+    }
+    m_refillStage.store(RefillStage::RESERVING_CHUNKS, std::memory_order_relaxed);
+}
+
+void ChunkMagazine::drain() noexcept
+{
+    if (m_isModified.test_and_set(std::memory_order_acquire))
+    {
+        IOX_LOG(WARN) << "The chunk magazine was modified when its process terminated; the chunks of an interrupted "
+                         "refill are returned but the chunk of an interrupted acquisition is lost";
+    }
+
+    if (m_size.load(std::memory_order_relaxed) == 0U)
+    {
+        releaseInterruptedRefill();
+    }
+    m_refillStage.store(RefillStage::IDLE, std::memory_order_relaxed);
+
+    releaseChunks();
+
+    m_isModified.clear(std::memory_order_release);
+}
+
+void ChunkMagazine::releaseInterruptedRefill() noexcept
+{
+    // 'reserveChunks' writes each index only after its chunk is taken from the free list, hence the recorded indices
+    // are owned by the magazine; they are not yet counted as used by the MemPool of the interrupted stage
+    switch (m_refillStage.load(std::memory_order_relaxed))
+    {
+    case RefillStage::IDLE:
+        break;
+    case RefillStage::RESERVING_CHUNKS:
+        m_memPool->releaseUncountedChunks(&m_chunkIndices[0], numberOfRecordedIndices(&m_chunkIndices[0]));
+        break;
+    case RefillStage::RESERVING_CHUNK_MANAGEMENTS:
+        m_memPool->releaseReservedChunks(&m_chunkIndices[0], numberOfRecordedIndices(&m_chunkIndices[0]));
+        m_chunkManagementPool->releaseUncountedChunks(&m_chunkManagementIndices[0],
+                                                      numberOfRecordedIndices(&m_chunkManagementIndices[0]));
+        break;
+    case RefillStage::RESERVED:
+        m_memPool->releaseReservedChunks(&m_chunkIndices[0], numberOfRecordedIndices(&m_chunkIndices[0]));
+        m_chunkManagementPool->releaseReservedChunks(&m_chunkManagementIndices[0],
+                                                     numberOfRecordedIndices(&m_chunkManagementIndices[0]));
+        break;
+    }
+}
+
+uint32_t ChunkMagazine::numberOfRecordedIndices(const uint32_t* const indices) const noexcept
+{
+    uint32_t numberOfIndices{0U};
+    while (numberOfIndices < m_capacity && indices[numberOfIndices] != INVALID_INDEX)
+    {
+        ++numberOfIndices;
+    }
+    return numberOfIndices;
+}
+
+void ChunkMagazine::releaseChunks() noexcept
+{
+    while (m_size.load(std::memory_order_relaxed) > 0U)
+    {
+        releaseLastChunk();
+    }
+
+    m_memPool = nullptr;
+    m_chunkManagementPool = nullptr;
+}
+
+void ChunkMagazine::releaseLastChunk() noexcept
+{
+    // the size is decremented first; if the process terminates before the chunk is returned, the chunk is lost but a
+    // subsequent 'drain' does not return it a second time. Returning the chunk first would not be safe since another
+    // process could take it from the free list again before a subsequent 'drain' returns it a second time
+    const auto index = m_size.load(std::memory_order_relaxed) - 1U;
+    m_size.store(index, std::memory_order_relaxed);
+    m_memPool->releaseReservedChunks(&m_chunkIndices[index], 1U);
+    m_chunkManagementPool->releaseReservedChunks(&m_chunkManagementIndices[index], 1U);
+}
+
+} // namespace mepoo
+} // namespace iox
@@ -28,11 +28,13 @@ namespace mepoo
 MemPoolInfo::MemPoolInfo(const uint32_t usedChunks,
                          const uint32_t minFreeChunks,
                          const uint32_t numChunks,
-                         const uint32_t chunkSize) noexcept
+                         const uint32_t chunkSize,
+                         const uint64_t failedAllocations) noexcept
     : m_usedChunks(usedChunks)
     , m_minFreeChunks(minFreeChunks)
     , m_numChunks(numChunks)
     , m_chunkSize(chunkSize)
+    , m_failedAllocations(failedAllocations)
 {
 }
 
@@ -82,19 +84,37 @@ void MemPool::adjustMinFree() noexcept
 void* MemPool::getChunk() noexcept
 {
     uint32_t l_index{0U};
-    if (!m_freeIndices.pop(l_index))
+    if (!reserveChunk(l_index))
     {
-        IOX_LOG(WARN) << "Mempool [m_chunkSize = " << m_chunkSize << ", numberOfChunks = " << m_numberOfChunks
-                      << ", used_chunks = " << m_usedChunks << " ] has no more space left";
+        // this is a hot path when a publisher overruns the mempool; the failure is only counted and the rate limited
+        // reporting is done by the MemoryManager
+        m_failedAllocations.fetch_add(1U, std::memory_order_relaxed);
         return nullptr;
     }
 
-    /// @todo iox-#1714 verify that m_usedChunk is not changed during adjustMInFree
-    ///         without changing m_minFree
-    m_usedChunks.fetch_add(1U, std::memory_order_relaxed);
+    return acquireReservedChunk(l_index);
+}
+
+bool MemPool::getChunks(void** const chunks, const uint32_t count) noexcept
+{
+    cxx::Expects(count <= MAX_CHUNKS_PER_PUBLISHER_BATCH);
+
+    uint32_t indices[MAX_CHUNKS_PER_PUBLISHER_BATCH];
+    if (!m_freeIndices.pop(&indices[0], count))
+    {
+        m_failedAllocations.fetch_add(1U, std::memory_order_relaxed);
+        return false;
+    }
+
+    m_usedChunks.fetch_add(count, std::memory_order_relaxed);
     adjustMinFree();
 
-    return m_rawMemory.get() + l_index * m_chunkSize;
+    for (uint32_t i = 0U; i < count; ++i)
+    {
+        chunks[i] = m_rawMemory.get() + static_cast<uint64_t>(indices[i]) * m_chunkSize;
+    }
+
+    return true;
 }
 
 void MemPool::freeChunk(const void* chunk) noexcept
@@ -115,6 +135,78 @@ void MemPool::freeChunk(const void* chunk) noexcept
     m_usedChunks.fetch_sub(1U, std::memory_order_relaxed);
 }
 
+bool MemPool::reserveChunk(uint32_t& index) noexcept
+{
+    if (!m_freeIndices.pop(index))
+    {
+        return false;
+    }
+
+    /// @todo iox-#1714 verify that m_usedChunk is not changed during adjustMInFree
+    ///         without changing m_minFree
+    m_usedChunks.fetch_add(1U, std::memory_order_relaxed);
+    adjustMinFree();
+    return true;
+}
+
+uint32_t MemPool::reserveChunks(uint32_t* const indices, const uint32_t count) noexcept
+{
+    // the common case is served with a single compare-and-swap; only if the free list holds less than 'count' chunks,
+    // the remaining chunks are reserved one by one
+    uint32_t numberOfReservedChunks{0U};
+    if (m_freeIndices.pop(indices, count))
+    {
+        numberOfReservedChunks = count;
+    }
+    while (numberOfReservedChunks < count && m_freeIndices.pop(indices[numberOfReservedChunks]))
+    {
+        ++numberOfReservedChunks;
+    }
+    if (numberOfReservedChunks == 0U && count > 0U)
+    {
+        m_failedAllocations.fetch_add(1U, std::memory_order_relaxed);
+        return 0U;
+    }
+
+    m_usedChunks.fetch_add(numberOfReservedChunks, std::memory_order_relaxed);
+    adjustMinFree();
+    return numberOfReservedChunks;
+}
+
+void* MemPool::acquireReservedChunk(const uint32_t index) noexcept
+{
+    cxx::Expects(index < m_numberOfChunks);
+
+    return m_rawMemory.get() + static_cast<uint64_t>(index) * m_chunkSize;
+}
+
+void MemPool::releaseReservedChunks(const uint32_t* const indices, const uint32_t count) noexcept
+{
+    pushFreeIndices(indices, count);
+    m_usedChunks.fetch_sub(count, std::memory_order_relaxed);
+}
+
+void MemPool::releaseUncountedChunks(const uint32_t* const indices, const uint32_t count) noexcept
+{
+    pushFreeIndices(indices, count);
+}
+
+void MemPool::pushFreeIndices(const uint32_t* const indices, const uint32_t count) noexcept
+{
+    // the batch is rejected as a whole if it contains an invalid index; the valid indices are then pushed one by one
+    // to report the invalid ones without losing the others
+    if (!m_freeIndices.push(indices, count))
+    {
+        for (uint32_t i = 0U; i < count; ++i)
+        {
+            if (!m_freeIndices.push(indices[i]))
+            {
+                errorHandler(PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+            }
+        }
+    }
+}
+
 uint32_t MemPool::getChunkSize() const noexcept
 {
     return m_chunkSize;
@@ -135,12 +227,18 @@ uint32_t MemPool::getMinFree() const noexcept
     return m_minFree.load(std::memory_order_relaxed);
 }
 
+uint64_t MemPool::getNumberOfFailedAllocations() const noexcept
+{
+    return m_failedAllocations.load(std::memory_order_relaxed);
+}
+
 MemPoolInfo MemPool::getInfo() const noexcept
 {
     return {m_usedChunks.load(std::memory_order_relaxed),
             m_minFree.load(std::memory_order_relaxed),
             m_numberOfChunks,
-            m_chunkSize};
+            m_chunkSize,
+            m_failedAllocations.load(std::memory_order_relaxed)};
 }
 
 } // namespace mepoo
@@ -28,13 +28,18 @@ namespace iox
 {
 namespace mepoo
 {
+constexpr uint64_t MemoryManager::ERROR_REPORTS_PER_SECOND;
+constexpr uint64_t MemoryManager::ERROR_REPORT_BURST_SIZE;
+constexpr uint32_t MemoryManager::NUMBER_OF_SUB_CLASSES;
+
 void MemoryManager::printMemPoolVector(log::LogStream& log) const noexcept
 {
     for (auto& l_mempool : m_memPoolVector)
     {
         log << "  MemPool [ ChunkSize = " << l_mempool.getChunkSize()
             << ", ChunkPayloadSize = " << l_mempool.getChunkSize() - sizeof(ChunkHeader)
-            << ", ChunkCount = " << l_mempool.getChunkCount() << " ]";
+            << ", ChunkCount = " << l_mempool.getChunkCount()
+            << ", FailedAllocations = " << l_mempool.getNumberOfFailedAllocations() << " ]";
     }
 }
 
@@ -74,6 +79,63 @@ void MemoryManager::generateChunkManagementPool(BumpAllocator& managementAllocat
     m_chunkManagementPool.emplace_back(chunkSize, m_totalNumberOfChunks, managementAllocator, managementAllocator);
 }
 
+void MemoryManager::generateSizeClassIndex() noexcept
+{
+    uint32_t memPoolIndex{0U};
+    uint32_t numberOfSharedSizeClasses{0U};
+    for (uint32_t sizeClassIndex = 0U; sizeClassIndex < NUMBER_OF_SIZE_CLASSES; ++sizeClassIndex)
+    {
+        const auto lowerBound = smallestChunkSizeOfSizeClass(sizeClassIndex);
+        while (memPoolIndex < m_memPoolVector.size() && m_memPoolVector[memPoolIndex].getChunkSize() < lowerBound)
+        {
+            ++memPoolIndex;
+        }
+        m_sizeClassIndex[sizeClassIndex] = static_cast<uint16_t>(memPoolIndex);
+
+        // a single compare in 'firstFittingMemPoolIndex' suffices if at most one mempool has a chunk size within the
+        // size class
+        const auto upperBound = (sizeClassIndex + 1U < NUMBER_OF_SIZE_CLASSES)
+                                    ? smallestChunkSizeOfSizeClass(sizeClassIndex + 1U)
+                                    : std::numeric_limits<uint64_t>::max();
+        const auto nextMemPoolIndex = memPoolIndex + 1U;
+        if (nextMemPoolIndex < m_memPoolVector.size() && m_memPoolVector[nextMemPoolIndex].getChunkSize() < upperBound)
+        {
+            ++numberOfSharedSizeClasses;
+        }
+    }
+
+    if (numberOfSharedSizeClasses > 0U)
+    {
+        IOX_LOG(WARN) << "The chunk sizes of some mempools are less than 1/" << NUMBER_OF_SUB_CLASSES
+                      << " of their power of two apart; the mempool lookup for " << numberOfSharedSizeClasses
+                      << " size classes requires more than one compare";
+    }
+}
+
+uint32_t MemoryManager::sizeClass(const uint32_t chunkSize) noexcept
+{
+    if (chunkSize < NUMBER_OF_SUB_CLASSES)
+    {
+        return chunkSize;
+    }
+
+    // the first level is the power of two, the second level are the SUB_CLASS_BITS bits after the most significant one
+    const auto powerOfTwo = static_cast<uint32_t>(indexOfMostSignificantBit(chunkSize));
+    const auto subClass = (chunkSize >> (powerOfTwo - SUB_CLASS_BITS)) - NUMBER_OF_SUB_CLASSES;
+    return (powerOfTwo - SUB_CLASS_BITS + 1U) * NUMBER_OF_SUB_CLASSES + subClass;
+}
+
+uint64_t MemoryManager::smallestChunkSizeOfSizeClass(const uint32_t sizeClass) noexcept
+{
+    const auto firstLevel = sizeClass / NUMBER_OF_SUB_CLASSES;
+    const auto subClass = sizeClass % NUMBER_OF_SUB_CLASSES;
+    if (firstLevel == 0U)
+    {
+        return subClass;
+    }
+    return static_cast<uint64_t>(NUMBER_OF_SUB_CLASSES + subClass) << (firstLevel - 1U);
+}
+
 uint32_t MemoryManager::getNumberOfMemPools() const noexcept
 {
     return static_cast<uint32_t>(m_memPoolVector.size());
@@ -83,11 +145,21 @@ MemPoolInfo MemoryManager::getMemPoolInfo(const uint32_t index) const noexcept
 {
     if (index >= m_memPoolVector.size())
     {
-        return {0, 0, 0, 0};
+        return {0, 0, 0, 0, 0};
     }
     return m_memPoolVector[index].getInfo();
 }
 
+uint64_t MemoryManager::getNumberOfErrors(const Error error) const noexcept
+{
+    return m_errorCounters[static_cast<uint32_t>(error)].load(std::memory_order_relaxed);
+}
+
+void MemoryManager::countError(const Error error) noexcept
+{
+    m_errorCounters[static_cast<uint32_t>(error)].fetch_add(1U, std::memory_order_relaxed);
+}
+
 uint32_t MemoryManager::sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept
 {
     return size + static_cast<uint32_t>(sizeof(ChunkHeader));
@@ -141,67 +213,186 @@ void MemoryManager::configureMemoryManager(const MePooConfig& mePooConfig,
     }
 
     generateChunkManagementPool(managementAllocator);
+    generateSizeClassIndex();
+    m_memPoolExhaustedPolicy = mePooConfig.m_memPoolExhaustedPolicy;
 }
 
 expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
+{
+    return getChunkImpl(chunkSettings, nullptr);
+}
+
+expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings,
+                                                                    ChunkMagazine& chunkMagazine) noexcept
+{
+    return getChunkImpl(chunkSettings, chunkMagazine.isEnabled() ? &chunkMagazine : nullptr);
+}
+
+uint32_t MemoryManager::firstFittingMemPoolIndex(const uint32_t requiredChunkSize) const noexcept
+{
+    // only the mempool which shares the size class with the required chunk size can be too small; the loop iterates
+    // more than once only if several mempools share the size class, see 'generateSizeClassIndex'
+    uint32_t index = m_sizeClassIndex[sizeClass(requiredChunkSize)];
+    while (index < m_memPoolVector.size() && m_memPoolVector[index].getChunkSize() < requiredChunkSize)
+    {
+        ++index;
+    }
+    return index;
+}
+
+MemoryManager::Error MemoryManager::reportError(const Error error, const ChunkSettings& chunkSettings) noexcept
+{
+    countError(error);
+    switch (error)
+    {
+    case Error::NO_MEMPOOLS_AVAILABLE:
+        IOX_LOG(FATAL) << "There are no mempools available!";
+
+        errorHandler(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_CHUNK_WITHOUT_MEMPOOL, ErrorLevel::SEVERE);
+        break;
+    case Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE:
+        IOX_LOG(FATAL) << "The following mempools are available:" << [this](auto& log) -> iox::log::LogStream& {
+            this->printMemPoolVector(log);
+            return log;
+        } << "Could not find a fitting mempool for a chunk of size "
+          << chunkSettings.requiredChunkSize();
+
+        errorHandler(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE, ErrorLevel::SEVERE);
+        break;
+    case Error::MEMPOOL_OUT_OF_CHUNKS:
+        // a publisher which overruns the mempools hits this path with a high frequency; the failure is therefore
+        // only counted and the expensive report is rate limited
+        if (m_errorReportLimiter.tryAcquire())
+        {
+            IOX_LOG(ERROR) << "MemoryManager: unable to acquire a chunk with a chunk-payload size of "
+                           << chunkSettings.userPayloadSize() << " ("
+                           << m_errorReportLimiter.takeNumberOfRejections()
+                           << " further failures since the last report). The following mempools are available:"
+                           << [this](auto& log) -> iox::log::LogStream& {
+                                  this->printMemPoolVector(log);
+                                  return log;
+                              };
+
+            errorHandler(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS, ErrorLevel::MODERATE);
+        }
+        break;
+    }
+    return error;
+}
+
+expected<SharedChunk, MemoryManager::Error>
+MemoryManager::getChunkImpl(const ChunkSettings& chunkSettings, ChunkMagazine* const chunkMagazine) noexcept
 {
     void* chunk{nullptr};
+    void* chunkManagementMemory{nullptr};
     MemPool* memPoolPointer{nullptr};
     const auto requiredChunkSize = chunkSettings.requiredChunkSize();
 
     uint32_t aquiredChunkSize = 0U;
 
-    for (auto& memPool : m_memPoolVector)
+    for (auto index = firstFittingMemPoolIndex(requiredChunkSize), firstFittingIndex = index;
+         index < m_memPoolVector.size();
+         ++index)
     {
-        uint32_t chunkSizeOfMemPool = memPool.getChunkSize();
-        if (chunkSizeOfMemPool >= requiredChunkSize)
+        auto& memPool = m_memPoolVector[index];
+
+        // the magazine serves only the fitting mempool and only while it does not hold the chunks of another one;
+        // swapping its batch whenever the publisher alternates between chunk sizes would be more expensive than
+        // taking the chunk directly from the mempool
+        if (chunkMagazine != nullptr && index == firstFittingIndex && chunkMagazine->canServe(memPool))
+        {
+            chunkMagazine->acquireChunk(memPool, m_chunkManagementPool.front(), chunk, chunkManagementMemory);
+        }
+        else
         {
             chunk = memPool.getChunk();
-            memPoolPointer = &memPool;
-            aquiredChunkSize = chunkSizeOfMemPool;
+        }
+        memPoolPointer = &memPool;
+        aquiredChunkSize = memPool.getChunkSize();
+
+        if (chunk != nullptr || m_memPoolExhaustedPolicy == MemPoolExhaustedPolicy::RETURN_ERROR)
+        {
             break;
         }
     }
 
     if (m_memPoolVector.size() == 0)
     {
-        IOX_LOG(FATAL) << "There are no mempools available!";
-
-        errorHandler(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_CHUNK_WITHOUT_MEMPOOL, ErrorLevel::SEVERE);
-        return err(Error::NO_MEMPOOLS_AVAILABLE);
+        return err(reportError(Error::NO_MEMPOOLS_AVAILABLE, chunkSettings));
     }
     else if (memPoolPointer == nullptr)
     {
-        IOX_LOG(FATAL) << "The following mempools are available:" << [this](auto& log) -> iox::log::LogStream& {
-            this->printMemPoolVector(log);
-            return log;
-        } << "Could not find a fitting mempool for a chunk of size "
-          << requiredChunkSize;
-
-        errorHandler(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE, ErrorLevel::SEVERE);
-        return err(Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE);
+        return err(reportError(Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE, chunkSettings));
     }
     else if (chunk == nullptr)
     {
-        IOX_LOG(ERROR) << "MemoryManager: unable to acquire a chunk with a chunk-payload size of "
-                       << chunkSettings.userPayloadSize()
-                       << "The following mempools are available:" << [this](auto& log) -> iox::log::LogStream& {
-            this->printMemPoolVector(log);
-            return log;
-        };
-
-        errorHandler(iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS, ErrorLevel::MODERATE);
-        return err(Error::MEMPOOL_OUT_OF_CHUNKS);
+        return err(reportError(Error::MEMPOOL_OUT_OF_CHUNKS, chunkSettings));
     }
     else
     {
+        if (chunkManagementMemory == nullptr)
+        {
+            chunkManagementMemory = m_chunkManagementPool.front().getChunk();
+        }
         auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
-        auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
+        auto chunkManagement = new (chunkManagementMemory)
             ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
         return ok(SharedChunk(chunkManagement));
     }
 }
 
+expected<void, MemoryManager::Error> MemoryManager::getChunks(const ChunkSettings& chunkSettings,
+                                                              const span<SharedChunk> chunks) noexcept
+{
+    const auto numberOfChunks = static_cast<uint32_t>(chunks.size());
+    cxx::Expects(numberOfChunks <= MAX_CHUNKS_PER_PUBLISHER_BATCH);
+
+    void* chunkMemory[MAX_CHUNKS_PER_PUBLISHER_BATCH];
+    void* chunkManagementMemory[MAX_CHUNKS_PER_PUBLISHER_BATCH];
+    MemPool* memPoolPointer{nullptr};
+    bool hasChunks{false};
+
+    for (auto index = firstFittingMemPoolIndex(chunkSettings.requiredChunkSize()); index < m_memPoolVector.size();
+         ++index)
+    {
+        memPoolPointer = &m_memPoolVector[index];
+        hasChunks = memPoolPointer->getChunks(&chunkMemory[0], numberOfChunks);
+
+        if (hasChunks || m_memPoolExhaustedPolicy == MemPoolExhaustedPolicy::RETURN_ERROR)
+        {
+            break;
+        }
+    }
+
+    if (m_memPoolVector.size() == 0)
+    {
+        return err(reportError(Error::NO_MEMPOOLS_AVAILABLE, chunkSettings));
+    }
+    else if (memPoolPointer == nullptr)
+    {
+        return err(reportError(Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE, chunkSettings));
+    }
+    else if (!hasChunks)
+    {
+        return err(reportError(Error::MEMPOOL_OUT_OF_CHUNKS, chunkSettings));
+    }
+
+    // there is a chunk management for every chunk of the mempools, therefore it cannot run out while the chunks are
+    // available
+    const bool hasChunkManagements = m_chunkManagementPool.front().getChunks(&chunkManagementMemory[0], numberOfChunks);
+    cxx::Expects(hasChunkManagements);
+
+    for (uint32_t i = 0U; i < numberOfChunks; ++i)
+    {
+        auto chunkHeader = new (chunkMemory[i]) ChunkHeader(memPoolPointer->getChunkSize(), chunkSettings);
+        auto chunkManagement = new (chunkManagementMemory[i])
+            ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
+        chunks[i] = SharedChunk(chunkManagement);
+    }
+
+    return ok();
+}
+
 std::ostream& operator<<(std::ostream& stream, const MemoryManager::Error value) noexcept
 {
     stream << asStringLiteral(value);
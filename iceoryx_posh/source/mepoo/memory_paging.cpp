@@ -0,0 +1,87 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/memory_paging.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
+#include "iox/logging.hpp"
+
+#include "iceoryx_platform/mman.hpp"
+
+#include <cerrno>
+
+namespace iox
+{
+namespace mepoo
+{
+uint64_t
+applyMemoryPagingConfig(void* const baseAddress, const uint64_t size, const MemoryPagingConfig& config) noexcept
+{
+    // the NUMA policy and the huge page advice only affect pages which are not yet faulted in, therefore they have to
+    // be applied before the memory is prefaulted or locked
+    if (config.m_numaNode.has_value())
+    {
+        if (iox_mbind_numa_node(baseAddress, size, config.m_numaNode.value()) != 0)
+        {
+            IOX_LOG(WARN) << "Unable to bind the shared memory at " << log::hex(baseAddress) << " to NUMA node "
+                          << config.m_numaNode.value() << " (errno: " << errno << ")";
+        }
+    }
+
+    if (config.m_useHugePages)
+    {
+        if (iox_madvise_huge_pages(baseAddress, size) != 0)
+        {
+            IOX_LOG(WARN) << "Unable to back the shared memory at " << log::hex(baseAddress)
+                          << " with huge pages (errno: " << errno << ")";
+        }
+    }
+
+    if (config.m_prefault)
+    {
+        // in contrast to anonymous memory, a read access to shared memory already allocates the page; the content is
+        // not touched, therefore this is also safe for memory which is already in use by other processes
+        const uint64_t pageSize = internal::pageSize();
+        const auto* memory = static_cast<const volatile uint8_t*>(baseAddress);
+        for (uint64_t offset = 0U; offset < size; offset += pageSize)
+        {
+            static_cast<void>(memory[offset]);
+        }
+    }
+
+    if (config.m_lockInMemory)
+    {
+        if (iox_mlock(baseAddress, size) != 0)
+        {
+            IOX_LOG(WARN) << "Unable to lock the shared memory at " << log::hex(baseAddress) << " with size " << size
+                          << " in RAM (errno: " << errno << "); consider to raise RLIMIT_MEMLOCK";
+        }
+    }
+
+    const uint64_t pageSize = iox_mapping_page_size(baseAddress);
+    if (config.m_useHugePages)
+    {
+        IOX_LOG(INFO) << "The shared memory at " << log::hex(baseAddress) << " with size " << size
+                      << " is backed by pages with a size of " << pageSize << " bytes";
+    }
+    else
+    {
+        IOX_LOG(DEBUG) << "The shared memory at " << log::hex(baseAddress) << " with size " << size
+                       << " is backed by pages with a size of " << pageSize << " bytes";
+    }
+    return pageSize;
+}
+} // namespace mepoo
+} // namespace iox
@@ -76,6 +76,39 @@ SharedChunk ShmSafeUnmanagedChunk::cloneToSharedChunk() noexcept
     return SharedChunk(chunkMgmt.get());
 }
 
+SharedChunk ShmSafeUnmanagedChunk::tryCloneToSharedChunk() const noexcept
+{
+    if (m_chunkManagement.isLogicalNullptr())
+    {
+        return SharedChunk();
+    }
+    auto chunkMgmt =
+        RelativePointer<mepoo::ChunkManagement>(m_chunkManagement.offset(), segment_id_t{m_chunkManagement.id()});
+    // the chunk management stays accessible when the chunk is released since it is owned by a mempool; once the
+    // reference counter is zero the chunk must not be revived
+    auto referenceCounter = chunkMgmt->m_referenceCounter.load(std::memory_order_relaxed);
+    while (referenceCounter != 0U)
+    {
+        if (chunkMgmt->m_referenceCounter.compare_exchange_weak(
+                referenceCounter, referenceCounter + 1U, std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+            return SharedChunk(chunkMgmt.get());
+        }
+    }
+    return SharedChunk();
+}
+
+void ShmSafeUnmanagedChunk::addReferencesForCopies(const uint64_t numberOfCopies) noexcept
+{
+    if (m_chunkManagement.isLogicalNullptr() || numberOfCopies == 0U)
+    {
+        return;
+    }
+    auto chunkMgmt =
+        RelativePointer<mepoo::ChunkManagement>(m_chunkManagement.offset(), segment_id_t{m_chunkManagement.id()});
+    chunkMgmt->m_referenceCounter.fetch_add(numberOfCopies, std::memory_order_relaxed);
+}
+
 bool ShmSafeUnmanagedChunk::isLogicalNullptr() const noexcept
 {
     return m_chunkManagement.isLogicalNullptr();
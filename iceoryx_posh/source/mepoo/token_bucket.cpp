@@ -0,0 +1,70 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/token_bucket.hpp"
+#include "iceoryx_hoofs/cxx/requires.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace iox
+{
+namespace mepoo
+{
+TokenBucket::TokenBucket(const uint64_t tokensPerSecond, const uint64_t burstSize) noexcept
+{
+    cxx::Expects(tokensPerSecond > 0U);
+    cxx::Expects(burstSize > 0U);
+
+    constexpr uint64_t NANOSECONDS_PER_SECOND{1000000000U};
+    m_emissionIntervalNs = std::max<uint64_t>(NANOSECONDS_PER_SECOND / tokensPerSecond, 1U);
+    m_burstToleranceNs = m_emissionIntervalNs * (burstSize - 1U);
+}
+
+bool TokenBucket::tryAcquire() noexcept
+{
+    // the steady clock is system-wide on all supported platforms, therefore the timestamps are comparable across
+    // the processes which share the bucket
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return tryAcquire(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count()));
+}
+
+bool TokenBucket::tryAcquire(const uint64_t nowNanoseconds) noexcept
+{
+    auto theoreticalArrivalTime = m_theoreticalArrivalTimeNs.load(std::memory_order_relaxed);
+    do
+    {
+        if (theoreticalArrivalTime > nowNanoseconds
+            && theoreticalArrivalTime - nowNanoseconds > m_burstToleranceNs)
+        {
+            m_numberOfRejections.fetch_add(1U, std::memory_order_relaxed);
+            return false;
+        }
+    } while (!m_theoreticalArrivalTimeNs.compare_exchange_weak(theoreticalArrivalTime,
+                                                              std::max(theoreticalArrivalTime, nowNanoseconds)
+                                                                  + m_emissionIntervalNs,
+                                                              std::memory_order_relaxed,
+                                                              std::memory_order_relaxed));
+    return true;
+}
+
+uint64_t TokenBucket::takeNumberOfRejections() noexcept
+{
+    return m_numberOfRejections.exchange(0U, std::memory_order_relaxed);
+}
+
+} // namespace mepoo
+} // namespace iox
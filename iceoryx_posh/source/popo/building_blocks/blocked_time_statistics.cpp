@@ -0,0 +1,86 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/popo/building_blocks/blocked_time_statistics.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+#include "iceoryx_posh/error_handling/error_handling.hpp"
+#include "iceoryx_platform/time.hpp"
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint64_t BlockedTimeStatistics::NUMBER_OF_BUCKETS;
+
+void BlockedTimeStatisticsData::record(const units::Duration blockedTime) noexcept
+{
+    const uint64_t blockedTimeInNanoseconds = blockedTime.toNanoseconds();
+
+    // there is only one writer, therefore no read-modify-write operations are required
+    m_numberOfBlockedDeliveries.store(m_numberOfBlockedDeliveries.load(std::memory_order_relaxed) + 1U,
+                                      std::memory_order_relaxed);
+    m_totalBlockedTimeInNanoseconds.store(
+        m_totalBlockedTimeInNanoseconds.load(std::memory_order_relaxed) + blockedTimeInNanoseconds,
+        std::memory_order_relaxed);
+    if (blockedTimeInNanoseconds > m_maxBlockedTimeInNanoseconds.load(std::memory_order_relaxed))
+    {
+        m_maxBlockedTimeInNanoseconds.store(blockedTimeInNanoseconds, std::memory_order_relaxed);
+    }
+    auto& bucket = m_histogram[bucketOf(blockedTime)];
+    bucket.store(bucket.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+}
+
+BlockedTimeStatistics BlockedTimeStatisticsData::load() const noexcept
+{
+    BlockedTimeStatistics statistics;
+    statistics.numberOfBlockedDeliveries = m_numberOfBlockedDeliveries.load(std::memory_order_relaxed);
+    statistics.totalBlockedTime =
+        units::Duration::fromNanoseconds(m_totalBlockedTimeInNanoseconds.load(std::memory_order_relaxed));
+    statistics.maxBlockedTime =
+        units::Duration::fromNanoseconds(m_maxBlockedTimeInNanoseconds.load(std::memory_order_relaxed));
+    for (uint64_t i = 0U; i < BlockedTimeStatistics::NUMBER_OF_BUCKETS; ++i)
+    {
+        statistics.histogram[i] = m_histogram[i].load(std::memory_order_relaxed);
+    }
+    return statistics;
+}
+
+units::Duration BlockedTimeStatisticsData::currentTime() noexcept
+{
+    timespec timeSinceEpoch{0, 0};
+    cxx::EnsuresWithMsg(!posix::posixCall(clock_gettime)(CLOCK_MONOTONIC, &timeSinceEpoch)
+                             .failureReturnValue(-1)
+                             .evaluate()
+                             .has_error(),
+                        "An error which should never happen occured during 'clock_gettime'!");
+    return units::Duration{timeSinceEpoch};
+}
+
+uint64_t BlockedTimeStatisticsData::bucketOf(const units::Duration blockedTime) noexcept
+{
+    uint64_t blockedTimeInMicroseconds = blockedTime.toMicroseconds();
+    uint64_t bucket{0U};
+    while (blockedTimeInMicroseconds > 1U && bucket < BlockedTimeStatistics::NUMBER_OF_BUCKETS - 1U)
+    {
+        blockedTimeInMicroseconds >>= 1U;
+        ++bucket;
+    }
+    return bucket;
+}
+
+} // namespace popo
+} // namespace iox
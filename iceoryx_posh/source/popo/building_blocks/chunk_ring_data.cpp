@@ -0,0 +1,37 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_ring_data.hpp"
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint64_t ChunkRingSlot::INVALID_SEQUENCE_NUMBER;
+
+ChunkRingSlot::ChunkRingSlot() noexcept
+{
+    m_chunk.store(mepoo::ShmSafeUnmanagedChunk(), std::memory_order_relaxed);
+}
+
+ChunkRingData::ChunkRingData(ChunkRingSlot* const slots, const uint64_t capacity) noexcept
+    : m_slots(slots)
+    , m_capacity(capacity)
+{
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,97 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_ring_reader.hpp"
+#include "iox/algorithm.hpp"
+
+namespace iox
+{
+namespace popo
+{
+ChunkRingReader::ChunkRingReader(not_null<const MemberType_t* const> chunkRingDataPtr) noexcept
+    : m_chunkRingDataPtr(chunkRingDataPtr)
+{
+}
+
+optional<mepoo::SharedChunk> ChunkRingReader::tryRead(uint64_t& cursor, bool& hasLostChunks) const noexcept
+{
+    const auto capacity = m_chunkRingDataPtr->m_capacity;
+    if (capacity == 0U)
+    {
+        return nullopt;
+    }
+
+    // every iteration either returns or advances the cursor; the loop ends at the latest when the cursor reaches the
+    // write counter
+    while (true)
+    {
+        const auto writeCounter = m_chunkRingDataPtr->m_writeCounter.load(std::memory_order_acquire);
+        if (cursor >= writeCounter)
+        {
+            return nullopt;
+        }
+
+        if (writeCounter - cursor > capacity)
+        {
+            hasLostChunks = true;
+            cursor = writeCounter - capacity;
+        }
+
+        // seqlock read; the chunk belongs to the cursor only if the sequence number is the same before and after the
+        // chunk was acquired
+        const auto& slot = m_chunkRingDataPtr->m_slots.get()[cursor % capacity];
+        if (slot.m_sequenceNumber.load(std::memory_order_acquire) == cursor)
+        {
+            auto chunk = slot.m_chunk.load(std::memory_order_acquire).tryCloneToSharedChunk();
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (chunk && slot.m_sequenceNumber.load(std::memory_order_relaxed) == cursor)
+            {
+                ++cursor;
+                return chunk;
+            }
+            // the acquired chunk is either the one of a newer write or a recycled one; the reference is released when
+            // it goes out of scope
+        }
+
+        // the slot was overwritten meanwhile
+        hasLostChunks = true;
+        ++cursor;
+    }
+}
+
+uint64_t ChunkRingReader::getNumberOfUnreadChunks(const uint64_t cursor) const noexcept
+{
+    const auto writeCounter = m_chunkRingDataPtr->m_writeCounter.load(std::memory_order_acquire);
+    if (cursor >= writeCounter)
+    {
+        return 0U;
+    }
+    return algorithm::minVal(writeCounter - cursor, m_chunkRingDataPtr->m_capacity);
+}
+
+uint64_t ChunkRingReader::getCursorForHistory(const uint64_t requestedHistory) const noexcept
+{
+    const auto writeCounter = m_chunkRingDataPtr->m_writeCounter.load(std::memory_order_acquire);
+    return writeCounter - algorithm::minVal(writeCounter, requestedHistory, m_chunkRingDataPtr->m_capacity);
+}
+
+uint64_t ChunkRingReader::getCapacity() const noexcept
+{
+    return m_chunkRingDataPtr->m_capacity;
+}
+
+} // namespace popo
+} // namespace iox
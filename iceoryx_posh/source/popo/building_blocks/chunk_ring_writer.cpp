@@ -0,0 +1,70 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_ring_writer.hpp"
+
+namespace iox
+{
+namespace popo
+{
+ChunkRingWriter::ChunkRingWriter(not_null<MemberType_t* const> chunkRingDataPtr) noexcept
+    : m_chunkRingDataPtr(chunkRingDataPtr)
+{
+}
+
+void ChunkRingWriter::write(mepoo::SharedChunk chunk) noexcept
+{
+    const auto capacity = m_chunkRingDataPtr->m_capacity;
+    if (capacity == 0U)
+    {
+        return;
+    }
+
+    const auto writeCounter = m_chunkRingDataPtr->m_writeCounter.load(std::memory_order_relaxed);
+    replaceChunk(
+        m_chunkRingDataPtr->m_slots.get()[writeCounter % capacity], mepoo::ShmSafeUnmanagedChunk(chunk), writeCounter);
+    m_chunkRingDataPtr->m_writeCounter.store(writeCounter + 1U, std::memory_order_release);
+}
+
+void ChunkRingWriter::clear() noexcept
+{
+    for (uint64_t i = 0U; i < m_chunkRingDataPtr->m_capacity; ++i)
+    {
+        replaceChunk(
+            m_chunkRingDataPtr->m_slots.get()[i], mepoo::ShmSafeUnmanagedChunk(), ChunkRingSlot::INVALID_SEQUENCE_NUMBER);
+    }
+}
+
+void ChunkRingWriter::replaceChunk(ChunkRingSlot& slot,
+                                   const mepoo::ShmSafeUnmanagedChunk chunk,
+                                   const uint64_t sequenceNumber) noexcept
+{
+    // seqlock write; the invalidation must be visible before the chunk is replaced, so that a reader which acquired
+    // the new or a recycled chunk detects the change
+    slot.m_sequenceNumber.store(ChunkRingSlot::INVALID_SEQUENCE_NUMBER, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    auto replacedChunk = slot.m_chunk.exchange(chunk, std::memory_order_acq_rel);
+    slot.m_sequenceNumber.store(sequenceNumber, std::memory_order_release);
+
+    if (!replacedChunk.isLogicalNullptr())
+    {
+        // AXIVION Next Construct AutosarC++19_03-A0.1.2 : d'tor of SharedChunk will release the memory
+        replacedChunk.releaseToSharedChunk();
+    }
+}
+
+} // namespace popo
+} // namespace iox
@@ -17,6 +17,8 @@
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
+#include "iox/algorithm.hpp"
+#include "iox/deadline_timer.hpp"
 
 namespace iox
 {
@@ -24,6 +26,7 @@ namespace popo
 {
 ConditionListener::ConditionListener(ConditionVariableData& condVarData) noexcept
     : m_condVarDataPtr(&condVarData)
+    , m_timerWheel(condVarData)
 {
 }
 
@@ -58,59 +61,159 @@ bool ConditionListener::wasNotified() const noexcept
 
 ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 {
-    return waitImpl([this]() -> bool {
-        if (this->getMembers()->m_semaphore->wait().has_error())
-        {
-            errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT, ErrorLevel::FATAL);
-            return false;
-        }
-        return true;
-    });
+    return waitImpl(
+        [this](const optional<units::Duration>& timeUntilNextTimer) -> bool {
+            if (timeUntilNextTimer.has_value())
+            {
+                if (this->getMembers()->m_semaphore->timedWait(timeUntilNextTimer.value()).has_error())
+                {
+                    errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT, ErrorLevel::FATAL);
+                    return false;
+                }
+                return true;
+            }
+
+            if (this->getMembers()->m_semaphore->wait().has_error())
+            {
+                errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT, ErrorLevel::FATAL);
+                return false;
+            }
+            return true;
+        },
+        m_spinDuration,
+        [] { return false; });
 }
 
 ConditionListener::NotificationVector_t ConditionListener::timedWait(const units::Duration& timeToWait) noexcept
 {
-    return waitImpl([this, timeToWait]() -> bool {
-        if (this->getMembers()->m_semaphore->timedWait(timeToWait).has_error())
-        {
-            errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT, ErrorLevel::FATAL);
-        }
-        return false;
-    });
+    // the spinning is part of the time to wait
+    deadline_timer timeout{timeToWait};
+    return waitImpl(
+        [this, &timeout](const optional<units::Duration>& timeUntilNextTimer) -> bool {
+            const auto remainingTime = timeout.remainingTime();
+            const bool timerExpiresFirst = timeUntilNextTimer.has_value() && timeUntilNextTimer.value() < remainingTime;
+            if (this->getMembers()
+                    ->m_semaphore->timedWait(timerExpiresFirst ? timeUntilNextTimer.value() : remainingTime)
+                    .has_error())
+            {
+                errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT, ErrorLevel::FATAL);
+                return false;
+            }
+            // the wait continues after an expired timer or a wake up due to a newly scheduled timer was handled
+            return !timeout.hasExpired();
+        },
+        algorithm::minVal(m_spinDuration, timeToWait),
+        [&timeout] { return timeout.hasExpired(); });
 }
 
-ConditionListener::NotificationVector_t ConditionListener::waitImpl(const function_ref<bool()>& waitCall) noexcept
+void ConditionListener::setSpinDuration(const units::Duration spinDuration) noexcept
+{
+    m_spinDuration = spinDuration;
+}
+
+TimerWheel& ConditionListener::getTimerWheel() noexcept
+{
+    return m_timerWheel;
+}
+
+ConditionListener::NotificationVector_t
+ConditionListener::waitImpl(const function_ref<bool(const optional<units::Duration>&)>& waitCall,
+                            const units::Duration spinDuration,
+                            const function_ref<bool()>& hasTimedOut) noexcept
 {
-    using Type_t = iox::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     NotificationVector_t activeNotifications;
 
     resetSemaphore();
     bool doReturnAfterNotificationCollection = false;
     while (!m_toBeDestroyed.load(std::memory_order_relaxed))
     {
-        for (Type_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS; i++)
-        {
-            if (getMembers()->m_activeNotifications[i].load(std::memory_order_relaxed))
-            {
-                resetUnchecked(i);
-                activeNotifications.emplace_back(i);
-            }
-        }
+        activateExpiredTimers();
+        collectActiveNotifications(activeNotifications);
         if (!activeNotifications.empty() || doReturnAfterNotificationCollection)
         {
             return activeNotifications;
         }
 
-        doReturnAfterNotificationCollection = !waitCall();
+        if (spinUntilNotified(spinDuration, hasTimedOut))
+        {
+            continue;
+        }
+
+        // announce the waiter before the notifications and timers are checked a last time; pairs with the fence in
+        // ConditionNotifier::notify and TimerWheel::schedule
+        getMembers()->m_numberOfWaiters.fetch_add(1U, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!hasActiveNotifications())
+        {
+            doReturnAfterNotificationCollection =
+                !waitCall(m_timerWheel.timeUntilNextExpiry(TimerWheel::currentTime()));
+        }
+        getMembers()->m_numberOfWaiters.fetch_sub(1U, std::memory_order_relaxed);
     }
 
     return activeNotifications;
 }
 
-void ConditionListener::resetUnchecked(const uint64_t index) noexcept
+void ConditionListener::activateExpiredTimers() noexcept
 {
-    getMembers()->m_activeNotifications[index].store(false, std::memory_order_relaxed);
-    getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
+    m_timerWheel.advance(TimerWheel::currentTime(),
+                         [this](const uint64_t index) { this->getMembers()->activateNotification(index); });
+}
+
+void ConditionListener::collectActiveNotifications(NotificationVector_t& activeNotifications) noexcept
+{
+    using Type_t = iox::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
+    for (uint64_t wordIndex = 0U; wordIndex < ConditionVariableData::NUMBER_OF_NOTIFICATION_WORDS; ++wordIndex)
+    {
+        auto& word = getMembers()->m_activeNotifications[wordIndex];
+        // the exchange is only required if a notification is active, which is rarely the case for most of the words
+        if (word.load(std::memory_order_relaxed) == 0U)
+        {
+            continue;
+        }
+
+        // the indices are collected in ascending order, therefore the vector is sorted
+        for (auto activeBits = word.exchange(0U, std::memory_order_acquire); activeBits != 0U;
+             activeBits &= activeBits - 1U)
+        {
+            activeNotifications.emplace_back(static_cast<Type_t>(
+                wordIndex * ConditionVariableData::NOTIFICATIONS_PER_WORD + countTrailingZeros(activeBits)));
+        }
+        getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
+    }
+}
+
+bool ConditionListener::hasActiveNotifications() const noexcept
+{
+    for (const auto& word : getMembers()->m_activeNotifications)
+    {
+        if (word.load(std::memory_order_relaxed) != 0U)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ConditionListener::spinUntilNotified(const units::Duration spinDuration,
+                                          const function_ref<bool()>& hasTimedOut) const noexcept
+{
+    if (spinDuration == units::Duration::zero())
+    {
+        return false;
+    }
+
+    // the active notifications are polled instead of m_wasNotified since the flag is only reset when notifications
+    // are collected and can therefore stay set after the notification was already collected
+    deadline_timer spinTimeout{spinDuration};
+    while (!spinTimeout.hasExpired() && !hasTimedOut())
+    {
+        if (hasActiveNotifications())
+        {
+            return true;
+        }
+    }
+    return false;
 }
 
 const ConditionVariableData* ConditionListener::getMembers() const noexcept
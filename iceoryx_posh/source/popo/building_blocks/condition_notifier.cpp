@@ -36,8 +36,26 @@ ConditionNotifier::ConditionNotifier(ConditionVariableData& condVarDataRef, cons
 
 void ConditionNotifier::notify() noexcept
 {
-    getMembers()->m_activeNotifications[m_notificationIndex].store(true, std::memory_order_release);
+    activate();
+    wakeUp();
+}
+
+void ConditionNotifier::activate() noexcept
+{
+    getMembers()->activateNotification(m_notificationIndex);
     getMembers()->m_wasNotified.store(true, std::memory_order_relaxed);
+}
+
+void ConditionNotifier::wakeUp() noexcept
+{
+    // pairs with the fence in ConditionListener::waitImpl; either the listener sees the notification before it blocks
+    // or the notifier sees the waiting listener and wakes it up
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (getMembers()->m_numberOfWaiters.load(std::memory_order_relaxed) == 0U)
+    {
+        return;
+    }
+
     getMembers()->m_semaphore->post().or_else(
         [](auto) { errorHandler(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY, ErrorLevel::FATAL); });
 }
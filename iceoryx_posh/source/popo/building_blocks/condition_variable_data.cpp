@@ -21,6 +21,9 @@ namespace iox
 {
 namespace popo
 {
+constexpr uint64_t ConditionVariableData::NOTIFICATIONS_PER_WORD;
+constexpr uint64_t ConditionVariableData::NUMBER_OF_NOTIFICATION_WORDS;
+
 ConditionVariableData::ConditionVariableData() noexcept
     : ConditionVariableData("")
 {
@@ -33,10 +36,23 @@ ConditionVariableData::ConditionVariableData(const RuntimeName_t& runtimeName) n
         errorHandler(PoshError::POPO__CONDITION_VARIABLE_DATA_FAILED_TO_CREATE_SEMAPHORE, ErrorLevel::FATAL);
     });
 
-    for (auto& id : m_activeNotifications)
+    for (auto& word : m_activeNotifications)
     {
-        id.store(false, std::memory_order_relaxed);
+        word.store(0U, std::memory_order_relaxed);
     }
 }
+
+void ConditionVariableData::activateNotification(const uint64_t index) noexcept
+{
+    m_activeNotifications[index / NOTIFICATIONS_PER_WORD].fetch_or(uint64_t{1U} << (index % NOTIFICATIONS_PER_WORD),
+                                                                   std::memory_order_release);
+}
+
+bool ConditionVariableData::isNotificationActive(const uint64_t index) const noexcept
+{
+    return (m_activeNotifications[index / NOTIFICATIONS_PER_WORD].load(std::memory_order_relaxed)
+            & (uint64_t{1U} << (index % NOTIFICATIONS_PER_WORD)))
+           != 0U;
+}
 } // namespace popo
 } // namespace iox
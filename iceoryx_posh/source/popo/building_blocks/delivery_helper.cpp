@@ -0,0 +1,100 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/delivery_helper.hpp"
+#include "iox/detail/adaptive_wait.hpp"
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint64_t DeliveryHelper::SPIN_ITERATIONS_BEFORE_BLOCKING;
+
+DeliveryHelper::DeliveryHelper() noexcept
+    : m_thread([this] { threadLoop(); })
+{
+}
+
+DeliveryHelper::~DeliveryHelper() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_keepRunning.store(false, std::memory_order_relaxed);
+    }
+    m_wakeUpCondition.notify_one();
+    m_thread.join();
+}
+
+void DeliveryHelper::execute(const function_ref<void()> task) noexcept
+{
+    m_task.emplace(task);
+    m_numberOfExecutedTasks.fetch_add(1U, std::memory_order_release);
+
+    // the lock ensures that the helper either sees the task before it blocks or is woken up
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+    }
+    m_wakeUpCondition.notify_one();
+}
+
+void DeliveryHelper::waitForCompletion() noexcept
+{
+    // the helper delivers to about as many queues as the sender, hence the wait is short
+    iox::detail::adaptive_wait adaptiveWait;
+    while (m_numberOfCompletedTasks.load(std::memory_order_acquire)
+           != m_numberOfExecutedTasks.load(std::memory_order_relaxed))
+    {
+        adaptiveWait.wait();
+    }
+}
+
+void DeliveryHelper::threadLoop() noexcept
+{
+    uint64_t numberOfCompletedTasks{0U};
+    auto hasNewTask = [&] {
+        return m_numberOfExecutedTasks.load(std::memory_order_acquire) != numberOfCompletedTasks;
+    };
+
+    while (true)
+    {
+        for (uint64_t i = 0U; i < SPIN_ITERATIONS_BEFORE_BLOCKING && !hasNewTask(); ++i)
+        {
+            if (!m_keepRunning.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+        }
+
+        if (!hasNewTask())
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wakeUpCondition.wait(lock,
+                                   [&] { return hasNewTask() || !m_keepRunning.load(std::memory_order_relaxed); });
+        }
+
+        if (!hasNewTask())
+        {
+            return;
+        }
+
+        m_task.value()();
+        ++numberOfCompletedTasks;
+        m_numberOfCompletedTasks.store(numberOfCompletedTasks, std::memory_order_release);
+    }
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,56 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+
+namespace iox
+{
+namespace popo
+{
+DiscoveryNotifier::DiscoveryNotifier(std::atomic<uint64_t>& pendingFlags,
+                                     const uint64_t pendingMask,
+                                     ConditionVariableData& conditionVariableData) noexcept
+    : m_pendingFlags(&pendingFlags)
+    , m_pendingMask(pendingMask)
+    , m_conditionVariableData(&conditionVariableData)
+{
+}
+
+void DiscoveryNotifier::notify() const noexcept
+{
+    if (!m_pendingFlags)
+    {
+        return;
+    }
+
+    markPending();
+    ConditionNotifier(*m_conditionVariableData.get(), 0U).notify();
+}
+
+void DiscoveryNotifier::markPending() const noexcept
+{
+    if (!m_pendingFlags)
+    {
+        return;
+    }
+
+    // release pairs with the acquire of RouDi when it takes the pending flags; it sees the stored request then
+    m_pendingFlags->fetch_or(m_pendingMask, std::memory_order_release);
+}
+
+} // namespace popo
+} // namespace iox
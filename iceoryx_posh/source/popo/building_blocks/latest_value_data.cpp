@@ -0,0 +1,43 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_data.hpp"
+#include "iox/algorithm.hpp"
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint64_t LatestValueBuffer::MAX_VALUE_SIZE;
+constexpr uint64_t LatestValueBuffer::WORD_SIZE;
+constexpr uint64_t LatestValueBuffer::NUMBER_OF_WORDS;
+constexpr uint64_t LatestValueData::CACHE_LINE_SIZE;
+constexpr uint64_t LatestValueData::NUMBER_OF_BUFFERS;
+
+LatestValueData::LatestValueData(const uint64_t valueSize) noexcept
+    : m_valueSize(algorithm::minVal(valueSize, LatestValueBuffer::MAX_VALUE_SIZE))
+{
+    for (auto& buffer : m_buffers)
+    {
+        for (auto& word : buffer.m_words)
+        {
+            word.store(0U, std::memory_order_relaxed);
+        }
+    }
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,79 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_reader.hpp"
+#include "iox/algorithm.hpp"
+
+#include <cstring>
+
+namespace iox
+{
+namespace popo
+{
+LatestValueReader::LatestValueReader(not_null<const MemberType_t* const> latestValueDataPtr) noexcept
+    : m_latestValueDataPtr(latestValueDataPtr)
+{
+}
+
+optional<uint64_t> LatestValueReader::read(void* const value) const noexcept
+{
+    auto* destination = static_cast<uint8_t*>(value);
+    const auto valueSize = m_latestValueDataPtr->m_valueSize;
+
+    // the writer alternates between the buffers, hence the loop is only repeated when the writer wrote twice while
+    // the value was copied
+    while (true)
+    {
+        const auto version = m_latestValueDataPtr->m_version.load(std::memory_order_acquire);
+        if (version == 0U)
+        {
+            return nullopt;
+        }
+
+        const auto& buffer = m_latestValueDataPtr->m_buffers[version % LatestValueData::NUMBER_OF_BUFFERS];
+        const auto sequenceNumber = buffer.m_sequenceNumber.load(std::memory_order_acquire);
+        if (sequenceNumber % 2U != 0U)
+        {
+            continue;
+        }
+
+        for (uint64_t offset = 0U, i = 0U; offset < valueSize; offset += LatestValueBuffer::WORD_SIZE, ++i)
+        {
+            const auto word = buffer.m_words[i].load(std::memory_order_relaxed);
+            std::memcpy(destination + offset, &word, algorithm::minVal(LatestValueBuffer::WORD_SIZE, valueSize - offset));
+        }
+        const auto bufferVersion = buffer.m_version.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (buffer.m_sequenceNumber.load(std::memory_order_relaxed) == sequenceNumber)
+        {
+            return bufferVersion;
+        }
+    }
+}
+
+uint64_t LatestValueReader::getVersion() const noexcept
+{
+    return m_latestValueDataPtr->m_version.load(std::memory_order_acquire);
+}
+
+uint64_t LatestValueReader::getValueSize() const noexcept
+{
+    return m_latestValueDataPtr->m_valueSize;
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,56 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_writer.hpp"
+#include "iox/algorithm.hpp"
+
+#include <cstring>
+
+namespace iox
+{
+namespace popo
+{
+LatestValueWriter::LatestValueWriter(not_null<MemberType_t* const> latestValueDataPtr) noexcept
+    : m_latestValueDataPtr(latestValueDataPtr)
+{
+}
+
+void LatestValueWriter::write(const void* const value) noexcept
+{
+    const auto version = m_latestValueDataPtr->m_version.load(std::memory_order_relaxed) + 1U;
+    auto& buffer = m_latestValueDataPtr->m_buffers[version % LatestValueData::NUMBER_OF_BUFFERS];
+
+    // seqlock write; the readers of this buffer discard what they copy until the sequence number is even again
+    const auto sequenceNumber = buffer.m_sequenceNumber.load(std::memory_order_relaxed);
+    buffer.m_sequenceNumber.store(sequenceNumber + 1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    const auto* source = static_cast<const uint8_t*>(value);
+    const auto valueSize = m_latestValueDataPtr->m_valueSize;
+    for (uint64_t offset = 0U, i = 0U; offset < valueSize; offset += LatestValueBuffer::WORD_SIZE, ++i)
+    {
+        uint64_t word{0U};
+        std::memcpy(&word, source + offset, algorithm::minVal(LatestValueBuffer::WORD_SIZE, valueSize - offset));
+        buffer.m_words[i].store(word, std::memory_order_relaxed);
+    }
+    buffer.m_version.store(version, std::memory_order_relaxed);
+
+    buffer.m_sequenceNumber.store(sequenceNumber + 2U, std::memory_order_release);
+    m_latestValueDataPtr->m_version.store(version, std::memory_order_release);
+}
+
+} // namespace popo
+} // namespace iox
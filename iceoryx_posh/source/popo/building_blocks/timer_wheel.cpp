@@ -0,0 +1,380 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/popo/building_blocks/timer_wheel.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
+#include "iceoryx_posh/error_handling/error_handling.hpp"
+#include "iceoryx_platform/time.hpp"
+#include "iox/algorithm.hpp"
+
+namespace iox
+{
+namespace popo
+{
+namespace
+{
+constexpr uint64_t ticksPerSlot(const uint64_t level) noexcept
+{
+    return uint64_t{1U} << (TimerWheel::LEVEL_BITS * level);
+}
+} // namespace
+
+static_assert(TimerWheel::SLOTS_PER_LEVEL == 64U, "the occupied slots of a level are stored in a 64 bit word");
+
+constexpr uint64_t TimerWheel::LEVEL_BITS;
+constexpr uint64_t TimerWheel::SLOTS_PER_LEVEL;
+constexpr uint64_t TimerWheel::NUMBER_OF_LEVELS;
+constexpr uint64_t TimerWheel::TICK_IN_NANOSECONDS;
+constexpr uint32_t TimerWheel::INVALID_INDEX;
+
+TimerWheel::TimerWheel(ConditionVariableData& condVarData) noexcept
+    : m_condVarDataPtr(&condVarData)
+    , m_currentTick(currentTime().toNanoseconds() / TICK_IN_NANOSECONDS)
+{
+    for (auto& level : m_slots)
+    {
+        for (auto& slot : level)
+        {
+            slot = INVALID_INDEX;
+        }
+    }
+}
+
+void TimerWheel::schedule(const uint64_t index,
+                          const units::Duration firstExpiry,
+                          const units::Duration period) noexcept
+{
+    cxx::Expects(index < MAX_NUMBER_OF_NOTIFIERS);
+    cxx::Expects(period != units::Duration::zero());
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto timerIndex = static_cast<uint32_t>(index);
+        auto& timer = m_timers[timerIndex];
+        if (timer.m_isScheduled)
+        {
+            unlink(timerIndex);
+        }
+        else if (m_numberOfScheduledTimers.fetch_add(1U, std::memory_order_relaxed) == 0U)
+        {
+            // the wheel does not advance without timers; catch up to not cascade through the idle time later on
+            m_currentTick = algorithm::maxVal(m_currentTick, currentTime().toNanoseconds() / TICK_IN_NANOSECONDS);
+        }
+
+        timer = Timer_t();
+        timer.m_expiry = firstExpiry.toNanoseconds();
+        timer.m_period = period.toNanoseconds();
+        insert(timerIndex);
+    }
+
+    wakeUpWaiter();
+}
+
+void TimerWheel::cancel(const uint64_t index) noexcept
+{
+    if (index >= MAX_NUMBER_OF_NOTIFIERS)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto timerIndex = static_cast<uint32_t>(index);
+    if (m_timers[timerIndex].m_isScheduled)
+    {
+        unlink(timerIndex);
+        m_numberOfScheduledTimers.fetch_sub(1U, std::memory_order_relaxed);
+    }
+}
+
+void TimerWheel::advance(const units::Duration now, const function_ref<void(uint64_t)> onExpiry) noexcept
+{
+    if (m_numberOfScheduledTimers.load(std::memory_order_relaxed) == 0U)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const uint64_t nowInNanoseconds = now.toNanoseconds();
+    const uint64_t nowTick = algorithm::maxVal(m_currentTick, nowInNanoseconds / TICK_IN_NANOSECONDS);
+
+    while (true)
+    {
+        expireSlot(slotOfCurrentTick(0U), nowInNanoseconds, onExpiry);
+        if (m_currentTick == nowTick)
+        {
+            break;
+        }
+
+        // all ticks before the next tick with work have empty slots and nothing to cascade
+        const auto nextTick = nextTickWithWork();
+        m_currentTick = nextTick.has_value() ? algorithm::minVal(nextTick.value(), nowTick) : nowTick;
+
+        // the higher levels are cascaded first since their timers can end up in the slot of a lower level which is
+        // cascaded at the same tick
+        for (uint64_t level = NUMBER_OF_LEVELS - 1U; level > 0U; --level)
+        {
+            if ((m_currentTick & (ticksPerSlot(level) - 1U)) == 0U)
+            {
+                cascade(level);
+            }
+        }
+    }
+}
+
+optional<units::Duration> TimerWheel::timeUntilNextExpiry(const units::Duration now) const noexcept
+{
+    if (m_numberOfScheduledTimers.load(std::memory_order_relaxed) == 0U)
+    {
+        return nullopt;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    constexpr uint64_t NO_EXPIRY{std::numeric_limits<uint64_t>::max()};
+    uint64_t nextExpiry{NO_EXPIRY};
+    for (uint64_t level = 0U; level < NUMBER_OF_LEVELS; ++level)
+    {
+        // the slot of the current tick is the first one of level 0 but on the higher levels it was already cascaded
+        // and can only contain timers which are a whole revolution of the level ahead
+        const uint64_t startSlot =
+            (level == 0U) ? slotOfCurrentTick(0U) : (slotOfCurrentTick(level) + 1U) % SLOTS_PER_LEVEL;
+        const auto distance = firstOccupiedSlot(level, startSlot);
+        if (!distance.has_value())
+        {
+            continue;
+        }
+
+        // the slots of a level are ordered by time, hence the earliest timer of the level is in its first slot
+        const uint64_t slot = (startSlot + distance.value()) % SLOTS_PER_LEVEL;
+        for (auto index = m_slots[level][slot]; index != INVALID_INDEX; index = m_timers[index].m_next)
+        {
+            nextExpiry = algorithm::minVal(nextExpiry, m_timers[index].m_expiry);
+        }
+    }
+
+    if (nextExpiry == NO_EXPIRY)
+    {
+        return nullopt;
+    }
+
+    const uint64_t nowInNanoseconds = now.toNanoseconds();
+    return units::Duration::fromNanoseconds((nextExpiry > nowInNanoseconds) ? nextExpiry - nowInNanoseconds : 0U);
+}
+
+TimerJitterStatistics TimerWheel::getJitterStatistics(const uint64_t index) const noexcept
+{
+    TimerJitterStatistics statistics;
+    if (index >= MAX_NUMBER_OF_NOTIFIERS)
+    {
+        return statistics;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto& timer = m_timers[index];
+    statistics.numberOfExpirations = timer.m_numberOfExpirations;
+    statistics.numberOfMissedExpirations = timer.m_numberOfMissedExpirations;
+    statistics.minJitter = units::Duration::fromNanoseconds(timer.m_minJitter);
+    statistics.maxJitter = units::Duration::fromNanoseconds(timer.m_maxJitter);
+    if (timer.m_numberOfExpirations != 0U)
+    {
+        statistics.meanJitter = units::Duration::fromNanoseconds(timer.m_jitterSum / timer.m_numberOfExpirations);
+    }
+    return statistics;
+}
+
+units::Duration TimerWheel::currentTime() noexcept
+{
+    timespec timeSinceEpoch{0, 0};
+    cxx::EnsuresWithMsg(!posix::posixCall(clock_gettime)(CLOCK_MONOTONIC, &timeSinceEpoch)
+                             .failureReturnValue(-1)
+                             .evaluate()
+                             .has_error(),
+                        "An error which should never happen occured during 'clock_gettime'!");
+    return units::Duration{timeSinceEpoch};
+}
+
+void TimerWheel::insert(const uint32_t index) noexcept
+{
+    auto& timer = m_timers[index];
+    uint64_t expiryTick = algorithm::maxVal(timer.m_expiry / TICK_IN_NANOSECONDS, m_currentTick);
+    const uint64_t ticksUntilExpiry = expiryTick - m_currentTick;
+
+    uint64_t level = 0U;
+    while (level < NUMBER_OF_LEVELS && ticksUntilExpiry >= ticksPerSlot(level + 1U))
+    {
+        ++level;
+    }
+
+    if (level == NUMBER_OF_LEVELS)
+    {
+        // beyond the range of the wheel; the timer is parked in the farthest slot and placed again when it is
+        // cascaded
+        level = NUMBER_OF_LEVELS - 1U;
+        expiryTick = m_currentTick + ticksPerSlot(NUMBER_OF_LEVELS) - 1U;
+    }
+
+    const uint64_t slot = (expiryTick >> (LEVEL_BITS * level)) % SLOTS_PER_LEVEL;
+    auto& head = m_slots[level][slot];
+
+    timer.m_level = static_cast<uint8_t>(level);
+    timer.m_slot = static_cast<uint8_t>(slot);
+    timer.m_previous = INVALID_INDEX;
+    timer.m_next = head;
+    timer.m_isScheduled = true;
+    if (head != INVALID_INDEX)
+    {
+        m_timers[head].m_previous = index;
+    }
+    head = index;
+    m_occupiedSlots[level] |= uint64_t{1U} << slot;
+}
+
+void TimerWheel::unlink(const uint32_t index) noexcept
+{
+    auto& timer = m_timers[index];
+    auto& head = m_slots[timer.m_level][timer.m_slot];
+
+    if (timer.m_previous != INVALID_INDEX)
+    {
+        m_timers[timer.m_previous].m_next = timer.m_next;
+    }
+    else
+    {
+        head = timer.m_next;
+    }
+
+    if (timer.m_next != INVALID_INDEX)
+    {
+        m_timers[timer.m_next].m_previous = timer.m_previous;
+    }
+
+    if (head == INVALID_INDEX)
+    {
+        m_occupiedSlots[timer.m_level] &= ~(uint64_t{1U} << timer.m_slot);
+    }
+
+    timer.m_next = INVALID_INDEX;
+    timer.m_previous = INVALID_INDEX;
+    timer.m_isScheduled = false;
+}
+
+void TimerWheel::expireSlot(const uint64_t slot,
+                            const uint64_t now,
+                            const function_ref<void(uint64_t)> onExpiry) noexcept
+{
+    auto index = m_slots[0U][slot];
+    while (index != INVALID_INDEX)
+    {
+        auto& timer = m_timers[index];
+        // a rescheduled timer is inserted at the head of a slot and therefore not visited again
+        const auto next = timer.m_next;
+
+        if (timer.m_expiry <= now)
+        {
+            unlink(index);
+            onExpiry(index);
+
+            const uint64_t jitter = now - timer.m_expiry;
+            timer.m_minJitter =
+                (timer.m_numberOfExpirations == 0U) ? jitter : algorithm::minVal(timer.m_minJitter, jitter);
+            timer.m_maxJitter = algorithm::maxVal(timer.m_maxJitter, jitter);
+            timer.m_jitterSum += jitter;
+            ++timer.m_numberOfExpirations;
+
+            // the expiries stay on the grid of the first expiry, the periods which passed completely are skipped
+            const uint64_t missedExpirations = jitter / timer.m_period;
+            timer.m_numberOfMissedExpirations += missedExpirations;
+            timer.m_expiry += (missedExpirations + 1U) * timer.m_period;
+            insert(index);
+        }
+
+        index = next;
+    }
+}
+
+void TimerWheel::cascade(const uint64_t level) noexcept
+{
+    const uint64_t slot = slotOfCurrentTick(level);
+    auto index = m_slots[level][slot];
+    m_slots[level][slot] = INVALID_INDEX;
+    m_occupiedSlots[level] &= ~(uint64_t{1U} << slot);
+
+    while (index != INVALID_INDEX)
+    {
+        const auto next = m_timers[index].m_next;
+        insert(index);
+        index = next;
+    }
+}
+
+optional<uint64_t> TimerWheel::nextTickWithWork() const noexcept
+{
+    optional<uint64_t> nextTick;
+    for (uint64_t level = 0U; level < NUMBER_OF_LEVELS; ++level)
+    {
+        const uint64_t startSlot = (slotOfCurrentTick(level) + 1U) % SLOTS_PER_LEVEL;
+        const auto distance = firstOccupiedSlot(level, startSlot);
+        if (!distance.has_value())
+        {
+            continue;
+        }
+
+        // the tick at which the slot is expired on level 0 or cascaded on the higher levels
+        const uint64_t slotsAhead = distance.value() + 1U;
+        const uint64_t tick = ((m_currentTick >> (LEVEL_BITS * level)) + slotsAhead) << (LEVEL_BITS * level);
+        if (!nextTick.has_value() || tick < nextTick.value())
+        {
+            nextTick.emplace(tick);
+        }
+    }
+    return nextTick;
+}
+
+optional<uint64_t> TimerWheel::firstOccupiedSlot(const uint64_t level, const uint64_t startSlot) const noexcept
+{
+    const uint64_t occupiedSlots = m_occupiedSlots[level];
+    if (occupiedSlots == 0U)
+    {
+        return nullopt;
+    }
+
+    const uint64_t rotatedSlots =
+        (startSlot == 0U) ? occupiedSlots
+                          : ((occupiedSlots >> startSlot) | (occupiedSlots << (SLOTS_PER_LEVEL - startSlot)));
+    return countTrailingZeros(rotatedSlots);
+}
+
+uint64_t TimerWheel::slotOfCurrentTick(const uint64_t level) const noexcept
+{
+    return (m_currentTick >> (LEVEL_BITS * level)) % SLOTS_PER_LEVEL;
+}
+
+void TimerWheel::wakeUpWaiter() noexcept
+{
+    // pairs with the fence in ConditionListener::waitImpl; either the waiter sees the new timer before it blocks or
+    // it is woken up to take the timer into account
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_condVarDataPtr->m_numberOfWaiters.load(std::memory_order_relaxed) == 0U)
+    {
+        return;
+    }
+
+    m_condVarDataPtr->m_semaphore->post().or_else(
+        [](auto) { errorHandler(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY, ErrorLevel::FATAL); });
+}
+
+} // namespace popo
+} // namespace iox
@@ -24,8 +24,13 @@ Listener::Listener() noexcept
 {
 }
 
-Listener::Listener(ConditionVariableData& conditionVariableData) noexcept
-    : Parent(conditionVariableData)
+Listener::Listener(const ListenerOptions& options) noexcept
+    : Parent(options)
+{
+}
+
+Listener::Listener(ConditionVariableData& conditionVariableData, const ListenerOptions& options) noexcept
+    : Parent(conditionVariableData, options)
 {
 }
 
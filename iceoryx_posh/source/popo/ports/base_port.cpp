@@ -69,6 +69,7 @@ BasePort::operator bool() const noexcept
 void BasePort::destroy() noexcept
 {
     getMembers()->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+    getMembers()->m_discoveryNotifier.notify();
 }
 
 bool BasePort::toBeDestroyed() const noexcept
@@ -155,6 +155,7 @@ ClientPortRouDi::handleCaProMessageForStateConnectRequested(const capro::CaproMe
                                        caProMessage.m_historyCapacity)
                           .has_error());
 
+        getMembers()->m_responseQueueHandle.store(caProMessage.m_chunkQueueHandle, std::memory_order_relaxed);
         getMembers()->m_connectionState.store(ConnectionState::CONNECTED, std::memory_order_relaxed);
         return nullopt;
     case capro::CaproMessageType::NACK:
@@ -251,5 +252,10 @@ void ClientPortRouDi::releaseAllChunks() noexcept
     m_chunkReceiver.releaseAll();
 }
 
+bool ClientPortRouDi::isChunkQueueReferenced(not_null<const ServerChunkQueueData_t* const> queue) const noexcept
+{
+    return m_chunkSender.isQueueReferenced(queue);
+}
+
 } // namespace popo
 } // namespace iox
@@ -50,7 +50,8 @@ expected<RequestHeader*, AllocationError> ClientPortUser::allocateRequest(const
     }
 
     auto* requestHeader = new (allocateResult.value()->userHeader())
-        RequestHeader(getMembers()->m_chunkReceiverData.m_uniqueId, RpcBaseHeader::UNKNOWN_CLIENT_QUEUE_INDEX);
+        RequestHeader(getMembers()->m_chunkReceiverData.m_uniqueId,
+                      getMembers()->m_responseQueueHandle.load(std::memory_order_relaxed));
 
     return ok(requestHeader);
 }
@@ -99,6 +100,7 @@ void ClientPortUser::connect() noexcept
     if (!getMembers()->m_connectRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_connectRequested.store(true, std::memory_order_relaxed);
+        getMembers()->m_discoveryNotifier.notify();
     }
 }
 
@@ -107,6 +109,7 @@ void ClientPortUser::disconnect() noexcept
     if (getMembers()->m_connectRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_connectRequested.store(false, std::memory_order_relaxed);
+        getMembers()->m_discoveryNotifier.notify();
     }
 }
 
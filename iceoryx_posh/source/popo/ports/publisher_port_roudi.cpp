@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/ports/publisher_port_roudi.hpp"
+#include "iox/attributes.hpp"
 
 namespace iox
 {
@@ -121,5 +122,18 @@ void PublisherPortRouDi::releaseAllChunks() noexcept
     m_chunkSender.releaseAll();
 }
 
+bool PublisherPortRouDi::isChunkQueueReferenced(
+    not_null<const PublisherPortData::ChunkQueueData_t* const> queue) const noexcept
+{
+    return m_chunkSender.isQueueReferenced(queue);
+}
+
+void PublisherPortRouDi::removeChunkQueue(not_null<PublisherPortData::ChunkQueueData_t* const> queue) noexcept
+{
+    // QUEUE_NOT_IN_CONTAINER is expected for every publisher which does not deliver to the queue and
+    // NO_UNPINNED_QUEUE_CONTAINER is handled by the caller with another try
+    IOX_DISCARD_RESULT(m_chunkSender.tryRemoveQueue(queue));
+}
+
 } // namespace popo
 } // namespace iox
@@ -48,6 +48,16 @@ PublisherPortUser::tryAllocateChunk(const uint32_t userPayloadSize,
         getUniqueID(), userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
 }
 
+expected<void, AllocationError> PublisherPortUser::tryAllocateChunks(const span<mepoo::ChunkHeader*> chunkHeaders,
+                                                                     const uint32_t userPayloadSize,
+                                                                     const uint32_t userPayloadAlignment,
+                                                                     const uint32_t userHeaderSize,
+                                                                     const uint32_t userHeaderAlignment) noexcept
+{
+    return m_chunkSender.tryAllocateBatch(
+        getUniqueID(), chunkHeaders, userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
+}
+
 void PublisherPortUser::releaseChunk(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     m_chunkSender.release(chunkHeader);
@@ -71,6 +81,24 @@ void PublisherPortUser::sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcep
     }
 }
 
+void PublisherPortUser::sendChunks(const span<mepoo::ChunkHeader* const> chunkHeaders) noexcept
+{
+    const auto offerRequested = getMembers()->m_offeringRequested.load(std::memory_order_relaxed);
+
+    if (offerRequested)
+    {
+        m_chunkSender.send(chunkHeaders);
+    }
+    else
+    {
+        // see sendChunk; a non offered publisher port only updates the history
+        for (uint64_t i = 0U; i < chunkHeaders.size(); ++i)
+        {
+            m_chunkSender.pushToHistory(chunkHeaders[i]);
+        }
+    }
+}
+
 optional<const mepoo::ChunkHeader*> PublisherPortUser::tryGetPreviousChunk() const noexcept
 {
     return m_chunkSender.tryGetPreviousChunk();
@@ -81,6 +109,7 @@ void PublisherPortUser::offer() noexcept
     if (!getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(true, std::memory_order_relaxed);
+        getMembers()->m_discoveryNotifier.notify();
     }
 }
 
@@ -89,6 +118,7 @@ void PublisherPortUser::stopOffer() noexcept
     if (getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(false, std::memory_order_relaxed);
+        getMembers()->m_discoveryNotifier.notify();
     }
 }
 
@@ -102,5 +132,15 @@ bool PublisherPortUser::hasSubscribers() const noexcept
     return m_chunkSender.hasStoredQueues();
 }
 
+BlockedTimeStatistics PublisherPortUser::getBlockedTimeStatistics() const noexcept
+{
+    return m_chunkSender.getBlockedTimeStatistics();
+}
+
+void PublisherPortUser::setDeliveryHelper(DeliveryHelper* const deliveryHelper) noexcept
+{
+    m_chunkSender.setDeliveryHelper(deliveryHelper);
+}
+
 } // namespace popo
 } // namespace iox
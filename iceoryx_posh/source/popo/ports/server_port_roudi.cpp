@@ -120,10 +120,15 @@ ServerPortRouDi::handleCaProMessageForStateOffered(const capro::CaproMessage& ca
             m_chunkSender
                 .tryAddQueue(static_cast<ClientChunkQueueData_t*>(caProMessage.m_chunkQueueData),
                              caProMessage.m_historyCapacity)
-                .and_then([this, &responseMessage]() {
+                .and_then([this, &caProMessage, &responseMessage]() {
                     responseMessage.m_type = capro::CaproMessageType::ACK;
                     responseMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
                     responseMessage.m_historyCapacity = 0;
+                    responseMessage.m_chunkQueueHandle =
+                        m_chunkSender
+                            .getQueueHandle(
+                                static_cast<ClientChunkQueueData_t*>(caProMessage.m_chunkQueueData)->m_uniqueId)
+                            .value_or(capro::CaproMessage::INVALID_CHUNK_QUEUE_HANDLE);
                 });
         }
         return responseMessage;
@@ -169,5 +174,10 @@ void ServerPortRouDi::releaseAllChunks() noexcept
     m_chunkReceiver.releaseAll();
 }
 
+bool ServerPortRouDi::isChunkQueueReferenced(not_null<const ClientChunkQueueData_t* const> queue) const noexcept
+{
+    return m_chunkSender.isQueueReferenced(queue);
+}
+
 } // namespace popo
 } // namespace iox
@@ -103,7 +103,7 @@ ServerPortUser::allocateResponse(const RequestHeader* const requestHeader,
 
     auto* responseHeader =
         new (allocateResult.value()->userHeader()) ResponseHeader(requestHeader->m_uniqueClientQueueId,
-                                                                  requestHeader->m_lastKnownClientQueueIndex,
+                                                                  requestHeader->m_clientQueueHandle,
                                                                   requestHeader->getSequenceId());
 
     return ok(responseHeader);
@@ -139,14 +139,8 @@ expected<void, ServerSendError> ServerPortUser::sendResponse(ResponseHeader* con
         return err(ServerSendError::NOT_OFFERED);
     }
 
-    bool responseSent{false};
-    m_chunkSender.getQueueIndex(responseHeader->m_uniqueClientQueueId, responseHeader->m_lastKnownClientQueueIndex)
-        .and_then([&](auto queueIndex) {
-            responseHeader->m_lastKnownClientQueueIndex = queueIndex;
-            responseSent = m_chunkSender.sendToQueue(
-                responseHeader->getChunkHeader(), responseHeader->m_uniqueClientQueueId, queueIndex);
-        })
-        .or_else([&] { releaseResponse(responseHeader); });
+    const bool responseSent = m_chunkSender.sendToQueueWithHandle(
+        responseHeader->getChunkHeader(), responseHeader->m_uniqueClientQueueId, responseHeader->m_clientQueueHandle);
 
     if (!responseSent)
     {
@@ -162,6 +156,7 @@ void ServerPortUser::offer() noexcept
     if (!getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(true, std::memory_order_relaxed);
+        getMembers()->m_discoveryNotifier.notify();
     }
 }
 
@@ -170,6 +165,7 @@ void ServerPortUser::stopOffer() noexcept
     if (getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(false, std::memory_order_relaxed);
+        getMembers()->m_discoveryNotifier.notify();
     }
 }
 
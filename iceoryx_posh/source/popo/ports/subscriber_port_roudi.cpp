@@ -47,5 +47,10 @@ void SubscriberPortRouDi::releaseAllChunks() noexcept
     m_chunkReceiver.releaseAll();
 }
 
+bool SubscriberPortRouDi::isChunkRingReferenced(const ChunkRingData& chunkRing) const noexcept
+{
+    return m_chunkReceiver.isChunkRingReferenced(chunkRing);
+}
+
 } // namespace popo
 } // namespace iox
@@ -27,7 +27,11 @@ cxx::Serialization PublisherOptions::serialize() const noexcept
         historyCapacity,
         nodeName,
         offerOnCreate,
-        static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(subscriberTooSlowPolicy));
+        static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(subscriberTooSlowPolicy),
+        chunkMagazineCapacity,
+        broadcastDeliveryThreshold,
+        parallelBroadcastDelivery,
+        chunkRingCapacity);
 }
 
 expected<PublisherOptions, cxx::Serialization::Error>
@@ -41,7 +45,11 @@ PublisherOptions::deserialize(const cxx::Serialization& serialized) noexcept
     auto deserializationSuccessful = serialized.extract(publisherOptions.historyCapacity,
                                                         publisherOptions.nodeName,
                                                         publisherOptions.offerOnCreate,
-                                                        subscriberTooSlowPolicy);
+                                                        subscriberTooSlowPolicy,
+                                                        publisherOptions.chunkMagazineCapacity,
+                                                        publisherOptions.broadcastDeliveryThreshold,
+                                                        publisherOptions.parallelBroadcastDelivery,
+                                                        publisherOptions.chunkRingCapacity);
 
     if (!deserializationSuccessful
         || subscriberTooSlowPolicy > static_cast<ConsumerTooSlowPolicyUT>(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA))
@@ -23,11 +23,11 @@ namespace iox
 namespace popo
 {
 RpcBaseHeader::RpcBaseHeader(const UniqueId& uniqueClientQueueId,
-                             const uint32_t lastKnownClientQueueIndex,
+                             const uint32_t clientQueueHandle,
                              const int64_t sequenceId,
                              const uint8_t rpcHeaderVersion) noexcept
     : m_rpcHeaderVersion(rpcHeaderVersion)
-    , m_lastKnownClientQueueIndex(lastKnownClientQueueIndex)
+    , m_clientQueueHandle(clientQueueHandle)
     , m_uniqueClientQueueId(uniqueClientQueueId)
     , m_sequenceId(sequenceId)
 {
@@ -63,8 +63,8 @@ const void* RpcBaseHeader::getUserPayload() const noexcept
     return mepoo::ChunkHeader::fromUserHeader(this)->userPayload();
 }
 
-RequestHeader::RequestHeader(const UniqueId& uniqueClientQueueId, const uint32_t lastKnownClientQueueIndex) noexcept
-    : RpcBaseHeader(uniqueClientQueueId, lastKnownClientQueueIndex, START_SEQUENCE_ID, RPC_HEADER_VERSION)
+RequestHeader::RequestHeader(const UniqueId& uniqueClientQueueId, const uint32_t clientQueueHandle) noexcept
+    : RpcBaseHeader(uniqueClientQueueId, clientQueueHandle, START_SEQUENCE_ID, RPC_HEADER_VERSION)
 {
 }
 
@@ -86,9 +86,9 @@ const RequestHeader* RequestHeader::fromPayload(const void* const payload) noexc
 }
 
 ResponseHeader::ResponseHeader(const UniqueId& uniqueClientQueueId,
-                               const uint32_t lastKnownClientQueueIndex,
+                               const uint32_t clientQueueHandle,
                                const int64_t sequenceId) noexcept
-    : RpcBaseHeader(uniqueClientQueueId, lastKnownClientQueueIndex, sequenceId, RPC_HEADER_VERSION)
+    : RpcBaseHeader(uniqueClientQueueId, clientQueueHandle, sequenceId, RPC_HEADER_VERSION)
 {
 }
 
@@ -0,0 +1,119 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/popo/timer_trigger.hpp"
+
+namespace iox
+{
+namespace popo
+{
+TimerTrigger::TimerTrigger(const units::Duration period) noexcept
+    : m_period(period)
+{
+    cxx::Expects(period != units::Duration::zero());
+}
+
+TimerTrigger::~TimerTrigger() noexcept
+{
+    disableEvent();
+}
+
+void TimerTrigger::start() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    m_isRunning = true;
+    scheduleTimer();
+}
+
+void TimerTrigger::stop() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    m_isRunning = false;
+    cancelTimer();
+}
+
+bool TimerTrigger::isRunning() const noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    return m_isRunning;
+}
+
+units::Duration TimerTrigger::getPeriod() const noexcept
+{
+    return m_period;
+}
+
+bool TimerTrigger::hasTriggered() const noexcept
+{
+    return m_trigger.wasTriggered();
+}
+
+TimerJitterStatistics TimerTrigger::getJitterStatistics() const noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    auto* timerWheel = m_trigger.getTimerWheel();
+    return (timerWheel != nullptr) ? timerWheel->getJitterStatistics(m_trigger.getUniqueId()) : TimerJitterStatistics();
+}
+
+void TimerTrigger::invalidateTrigger(const uint64_t uniqueTriggerId) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    if (uniqueTriggerId == m_trigger.getUniqueId())
+    {
+        cancelTimer();
+        m_trigger.invalidate();
+    }
+}
+
+void TimerTrigger::enableEvent(iox::popo::TriggerHandle&& triggerHandle) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    cancelTimer();
+    m_trigger = std::move(triggerHandle);
+    if (m_isRunning)
+    {
+        scheduleTimer();
+    }
+}
+
+void TimerTrigger::disableEvent() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    cancelTimer();
+    m_trigger.reset();
+}
+
+void TimerTrigger::scheduleTimer() noexcept
+{
+    auto* timerWheel = m_trigger.getTimerWheel();
+    if (timerWheel != nullptr)
+    {
+        timerWheel->schedule(m_trigger.getUniqueId(), TimerWheel::currentTime() + m_period, m_period);
+    }
+}
+
+void TimerTrigger::cancelTimer() noexcept
+{
+    auto* timerWheel = m_trigger.getTimerWheel();
+    if (timerWheel != nullptr)
+    {
+        timerWheel->cancel(m_trigger.getUniqueId());
+    }
+}
+
+} // namespace popo
+} // namespace iox
@@ -27,8 +27,10 @@ TriggerHandle::TriggerHandle() noexcept
 
 TriggerHandle::TriggerHandle(ConditionVariableData& conditionVariableData,
                              const function<void(uint64_t)>& resetCallback,
-                             const uint64_t uniqueTriggerId) noexcept
+                             const uint64_t uniqueTriggerId,
+                             TimerWheel* const timerWheel) noexcept
     : m_conditionVariableDataPtr(&conditionVariableData)
+    , m_timerWheelPtr(timerWheel)
     , m_resetCallback(resetCallback)
     , m_uniqueTriggerId(uniqueTriggerId)
 {
@@ -39,6 +41,7 @@ TriggerHandle::TriggerHandle(TriggerHandle&& rhs) noexcept
         rhs.m_mutex.lock();
         return rhs.m_conditionVariableDataPtr;
     }()}
+    , m_timerWheelPtr{rhs.m_timerWheelPtr}
     , m_resetCallback{std::move(rhs.m_resetCallback)}
     , m_uniqueTriggerId{rhs.m_uniqueTriggerId}
 {
@@ -57,6 +60,7 @@ TriggerHandle& TriggerHandle::operator=(TriggerHandle&& rhs) noexcept
         reset();
 
         m_conditionVariableDataPtr = rhs.m_conditionVariableDataPtr;
+        m_timerWheelPtr = rhs.m_timerWheelPtr;
         m_resetCallback = std::move(rhs.m_resetCallback);
         m_uniqueTriggerId = rhs.m_uniqueTriggerId;
 
@@ -98,7 +102,7 @@ bool TriggerHandle::wasTriggered() const noexcept
     std::lock_guard<std::recursive_mutex> lock(m_mutex);
     if (m_conditionVariableDataPtr != nullptr)
     {
-        return m_conditionVariableDataPtr->m_activeNotifications[m_uniqueTriggerId].load(std::memory_order_relaxed);
+        return m_conditionVariableDataPtr->isNotificationActive(m_uniqueTriggerId);
     }
     return false;
 }
@@ -122,6 +126,7 @@ void TriggerHandle::invalidate() noexcept
     std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
     m_conditionVariableDataPtr = nullptr;
+    m_timerWheelPtr = nullptr;
     m_resetCallback = [](auto) {};
     m_uniqueTriggerId = Trigger::INVALID_TRIGGER_ID;
 }
@@ -133,6 +138,13 @@ ConditionVariableData* TriggerHandle::getConditionVariableData() noexcept
     return m_conditionVariableDataPtr;
 }
 
+TimerWheel* TriggerHandle::getTimerWheel() const noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+    return m_timerWheelPtr;
+}
+
 uint64_t TriggerHandle::getUniqueId() const noexcept
 {
     std::lock_guard<std::recursive_mutex> lock(m_mutex);
@@ -17,6 +17,7 @@
 
 #include "iceoryx_posh/roudi/memory/default_roudi_memory.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iox/memory.hpp"
 
@@ -27,7 +28,10 @@ namespace roudi
 DefaultRouDiMemory::DefaultRouDiMemory(const RouDiConfig_t& roudiConfig) noexcept
     : m_introspectionMemPoolBlock(introspectionMemPoolConfig())
     , m_segmentManagerBlock(roudiConfig)
-    , m_managementShm(SHM_NAME, posix::AccessMode::READ_WRITE, posix::OpenMode::PURGE_AND_CREATE)
+    , m_managementShm(SHM_NAME,
+                      posix::AccessMode::READ_WRITE,
+                      posix::OpenMode::PURGE_AND_CREATE,
+                      roudiConfig.m_managementMemoryPagingConfig)
 {
     m_managementShm.addMemoryBlock(&m_introspectionMemPoolBlock).or_else([](auto) {
         errorHandler(PoshError::ROUDI__DEFAULT_ROUDI_MEMORY_FAILED_TO_ADD_INTROSPECTION_MEMORY_BLOCK,
@@ -57,6 +61,13 @@ mepoo::MePooConfig DefaultRouDiMemory::introspectionMemPoolConfig() const noexce
     mempoolConfig.m_mempoolConfig.push_back(
         {align(static_cast<uint32_t>(sizeof(roudi::SubscriberPortChangingIntrospectionFieldTopic)), ALIGNMENT),
          CHUNK_COUNT});
+    // the changes of the service registry are held in the history of the publisher and in the queue of each
+    // ServiceDiscovery; if the chunks are exhausted, RouDi falls back to publish the full service registry
+    constexpr uint32_t SERVICE_REGISTRY_CHANGE_CHUNK_COUNT{32U
+                                                           * static_cast<uint32_t>(SERVICE_REGISTRY_CHANGES_HISTORY)};
+    mempoolConfig.m_mempoolConfig.push_back(
+        {align(static_cast<uint32_t>(sizeof(roudi::ServiceRegistryChange)), ALIGNMENT),
+         SERVICE_REGISTRY_CHANGE_CHUNK_COUNT});
 
     mempoolConfig.optimize();
     return mempoolConfig;
@@ -18,6 +18,7 @@
 #include "iceoryx_posh/roudi/memory/posix_shm_memory_provider.hpp"
 
 #include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_paging.hpp"
 #include "iox/logging.hpp"
 
 #include "iceoryx_platform/signal.hpp"
@@ -31,10 +32,12 @@ constexpr access_rights PosixShmMemoryProvider::SHM_MEMORY_PERMISSIONS;
 
 PosixShmMemoryProvider::PosixShmMemoryProvider(const ShmName_t& shmName,
                                                const posix::AccessMode accessMode,
-                                               const posix::OpenMode openMode) noexcept
+                                               const posix::OpenMode openMode,
+                                               const mepoo::MemoryPagingConfig& memoryPagingConfig) noexcept
     : m_shmName(shmName)
     , m_accessMode(accessMode)
     , m_openMode(openMode)
+    , m_memoryPagingConfig(memoryPagingConfig)
 {
 }
 
@@ -72,14 +75,26 @@ expected<void*, MemoryProviderError> PosixShmMemoryProvider::createMemory(const
         return err(MemoryProviderError::MEMORY_CREATION_FAILED);
     }
 
+    const auto pageSize = mepoo::applyMemoryPagingConfig(baseAddress, size, m_memoryPagingConfig);
+    if (pageSize > 0U)
+    {
+        m_pageSize.emplace(pageSize);
+    }
+
     return ok(baseAddress);
 }
 
 expected<void, MemoryProviderError> PosixShmMemoryProvider::destroyMemory() noexcept
 {
     m_shmObject.reset();
+    m_pageSize.reset();
     return ok();
 }
 
+optional<uint64_t> PosixShmMemoryProvider::pageSize() const noexcept
+{
+    return m_pageSize;
+}
+
 } // namespace roudi
 } // namespace iox
@@ -72,9 +72,21 @@ PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
         registryPortOptions,
         introspectionMemoryManager);
 
-    // if we arrive here, the port for service discovery exists and we perform the discovery
+    popo::PublisherOptions registryChangesPortOptions;
+    registryChangesPortOptions.historyCapacity = SERVICE_REGISTRY_CHANGES_HISTORY;
+    registryChangesPortOptions.nodeName = iox::NodeName_t("Service Registry");
+    registryChangesPortOptions.offerOnCreate = true;
+
+    m_serviceRegistryChangesPublisherPortData = acquireInternalPublisherPortDataWithoutDiscovery(
+        {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_CHANGES_EVENT_NAME},
+        registryChangesPortOptions,
+        introspectionMemoryManager);
+
+    // if we arrive here, the ports for service discovery exist and we perform the discovery
     PublisherPortRouDiType serviceRegistryPort(*m_serviceRegistryPublisherPortData);
     doDiscoveryForPublisherPort(serviceRegistryPort);
+    PublisherPortRouDiType serviceRegistryChangesPort(*m_serviceRegistryChangesPublisherPortData);
+    doDiscoveryForPublisherPort(serviceRegistryChangesPort);
 
     popo::PublisherOptions options;
     options.historyCapacity = 1U;
@@ -102,25 +114,48 @@ void PortManager::stopPortIntrospection() noexcept
 
 void PortManager::doDiscovery() noexcept
 {
-    handlePublisherPorts();
+    handlePublisherPorts(m_portPool->getPublisherPortDataList());
 
-    handleSubscriberPorts();
+    handleSubscriberPorts(m_portPool->getSubscriberPortDataList());
 
-    handleServerPorts();
+    handleServerPorts(m_portPool->getServerPortDataList());
 
-    handleClientPorts();
+    handleClientPorts(m_portPool->getClientPortDataList());
 
-    handleInterfaces();
+    handleInterfaces(m_portPool->getInterfacePortDataList());
 
-    handleNodes();
+    handleNodes(m_portPool->getNodeDataList());
 
-    handleConditionVariables();
+    handleConditionVariables(m_portPool->getConditionVariableDataList());
 }
 
-void PortManager::handlePublisherPorts() noexcept
+void PortManager::doDiscoveryForPendingRequests() noexcept
+{
+    handlePublisherPorts(m_portPool->getPendingPublisherPortDataList());
+
+    handleSubscriberPorts(m_portPool->getPendingSubscriberPortDataList());
+
+    handleServerPorts(m_portPool->getPendingServerPortDataList());
+
+    handleClientPorts(m_portPool->getPendingClientPortDataList());
+
+    handleInterfaces(m_portPool->getPendingInterfacePortDataList());
+
+    handleNodes(m_portPool->getPendingNodeDataList());
+
+    handleConditionVariables(m_portPool->getPendingConditionVariableDataList());
+}
+
+popo::ConditionVariableData& PortManager::getDiscoveryConditionVariableData() noexcept
+{
+    return m_portPool->getDiscoveryConditionVariableData();
+}
+
+void PortManager::handlePublisherPorts(
+    const vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS>& publisherPorts) noexcept
 {
     // get the changes of publisher port offer state
-    for (auto publisherPortData : m_portPool->getPublisherPortDataList())
+    for (auto publisherPortData : publisherPorts)
     {
         PublisherPortRouDiType publisherPort(publisherPortData);
 
@@ -162,10 +197,11 @@ void PortManager::doDiscoveryForPublisherPort(PublisherPortRouDiType& publisherP
     });
 }
 
-void PortManager::handleSubscriberPorts() noexcept
+void PortManager::handleSubscriberPorts(
+    const vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS>& subscriberPorts) noexcept
 {
     // get requests for change of subscription state of subscribers
-    for (auto subscriberPortData : m_portPool->getSubscriberPortDataList())
+    for (auto subscriberPortData : subscriberPorts)
     {
         SubscriberPortType subscriberPort(subscriberPortData);
 
@@ -230,6 +266,16 @@ void PortManager::destroyClientPort(popo::ClientPortData* const clientPortData)
 
     clientPortRoudi.releaseAllChunks();
 
+    if (isChunkQueueReferencedByServer(&clientPortData->m_chunkReceiverData))
+    {
+        IOX_LOG(DEBUG) << "Defer destruction of client port from runtime '" << clientPortData->m_runtimeName
+                       << "' since a server might still deliver to it";
+        clientPortData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+        // there is no full discovery sweep, hence the port is retried with the discovery of the next monitoring cycle
+        clientPortData->m_discoveryNotifier.markPending();
+        return;
+    }
+
     /// @todo iox-#1128 remove from to port introspection
 
     IOX_LOG(DEBUG) << "Destroy client port from runtime '" << clientPortData->m_runtimeName
@@ -239,10 +285,10 @@ void PortManager::destroyClientPort(popo::ClientPortData* const clientPortData)
     m_portPool->removeClientPort(clientPortData);
 }
 
-void PortManager::handleClientPorts() noexcept
+void PortManager::handleClientPorts(const vector<popo::ClientPortData*, MAX_CLIENTS>& clientPorts) noexcept
 {
     // get requests for change of connection state of clients
-    for (auto clientPortData : m_portPool->getClientPortDataList())
+    for (auto clientPortData : clientPorts)
     {
         popo::ClientPortRouDi clientPort(*clientPortData);
 
@@ -319,6 +365,16 @@ void PortManager::destroyServerPort(popo::ServerPortData* const serverPortData)
 
     serverPortRoudi.releaseAllChunks();
 
+    if (isChunkQueueReferencedByClient(&serverPortData->m_chunkReceiverData))
+    {
+        IOX_LOG(DEBUG) << "Defer destruction of server port from runtime '" << serverPortData->m_runtimeName
+                       << "' since a client might still deliver to it";
+        serverPortData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+        // there is no full discovery sweep, hence the port is retried with the discovery of the next monitoring cycle
+        serverPortData->m_discoveryNotifier.markPending();
+        return;
+    }
+
     /// @todo iox-#1128 remove from port introspection
 
     IOX_LOG(DEBUG) << "Destroy server port from runtime '" << serverPortData->m_runtimeName
@@ -328,10 +384,10 @@ void PortManager::destroyServerPort(popo::ServerPortData* const serverPortData)
     m_portPool->removeServerPort(serverPortData);
 }
 
-void PortManager::handleServerPorts() noexcept
+void PortManager::handleServerPorts(const vector<popo::ServerPortData*, MAX_SERVERS>& serverPorts) noexcept
 {
     // get the changes of server port offer state
-    for (auto serverPortData : m_portPool->getServerPortDataList())
+    for (auto serverPortData : serverPorts)
     {
         popo::ServerPortRouDi serverPort(*serverPortData);
 
@@ -372,13 +428,82 @@ void PortManager::doDiscoveryForServerPort(popo::ServerPortRouDi& serverPort) no
     });
 }
 
-void PortManager::handleInterfaces() noexcept
+bool PortManager::isChunkQueueReferencedByPublisher(
+    const PublisherPortRouDiType::MemberType_t::ChunkQueueData_t* const queue) noexcept
+{
+    for (auto publisherPortData : m_portPool->getPublisherPortDataList())
+    {
+        PublisherPortRouDiType publisherPort(publisherPortData);
+        if (publisherPort.isChunkQueueReferenced(queue))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void PortManager::removeChunkQueueFromPublishers(
+    PublisherPortRouDiType::MemberType_t::ChunkQueueData_t* const queue) noexcept
+{
+    for (auto publisherPortData : m_portPool->getPublisherPortDataList())
+    {
+        PublisherPortRouDiType publisherPort(publisherPortData);
+        publisherPort.removeChunkQueue(queue);
+    }
+}
+
+bool PortManager::isChunkRingReferencedBySubscriber(const popo::ChunkRingData& chunkRing) noexcept
+{
+    if (chunkRing.m_capacity == 0U)
+    {
+        return false;
+    }
+
+    for (auto subscriberPortData : m_portPool->getSubscriberPortDataList())
+    {
+        SubscriberPortType subscriberPort(subscriberPortData);
+        if (subscriberPort.isChunkRingReferenced(chunkRing))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool PortManager::isChunkQueueReferencedByServer(const popo::ClientChunkQueueData_t* const queue) noexcept
+{
+    for (auto serverPortData : m_portPool->getServerPortDataList())
+    {
+        popo::ServerPortRouDi serverPort(*serverPortData);
+        if (serverPort.isChunkQueueReferenced(queue))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool PortManager::isChunkQueueReferencedByClient(const popo::ServerChunkQueueData_t* const queue) noexcept
+{
+    for (auto clientPortData : m_portPool->getClientPortDataList())
+    {
+        popo::ClientPortRouDi clientPort(*clientPortData);
+        if (clientPort.isChunkQueueReferenced(queue))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void PortManager::handleInterfaces(
+    const vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER>& interfacePorts) noexcept
 {
     // check if there are new interfaces that must get an initial offer information
     vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER> interfacePortsForInitialForwarding;
 
 
-    for (auto interfacePortData : m_portPool->getInterfacePortDataList())
+    for (auto interfacePortData : interfacePorts)
     {
         if (interfacePortData->m_doInitialOfferForward)
         {
@@ -442,14 +567,14 @@ void PortManager::handleInterfaces() noexcept
     }
 }
 
-void PortManager::handleNodes() noexcept
+void PortManager::handleNodes(const vector<runtime::NodeData*, MAX_NODE_NUMBER>& nodes) noexcept
 {
     /// @todo iox-#518 we have to update the introspection but node information is in process introspection which is not
     // accessible here. So currently nodes will be removed not before a process is removed
     // m_processIntrospection->removeNode(RuntimeName_t(process.c_str()),
     // NodeName_t(node.c_str()));
 
-    for (auto nodeData : m_portPool->getNodeDataList())
+    for (auto nodeData : nodes)
     {
         if (nodeData->m_toBeDestroyed.load(std::memory_order_relaxed))
         {
@@ -460,9 +585,10 @@ void PortManager::handleNodes() noexcept
     }
 }
 
-void PortManager::handleConditionVariables() noexcept
+void PortManager::handleConditionVariables(
+    const vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES>& conditionVariables) noexcept
 {
-    for (auto conditionVariableData : m_portPool->getConditionVariableDataList())
+    for (auto conditionVariableData : conditionVariables)
     {
         if (conditionVariableData->m_toBeDestroyed.load(std::memory_order_relaxed))
         {
@@ -725,6 +851,7 @@ void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcep
     if (runtimeName == RuntimeName_t(iox::roudi::IPC_CHANNEL_ROUDI_NAME))
     {
         m_serviceRegistryPublisherPortData.reset();
+        m_serviceRegistryChangesPublisherPortData.reset();
     }
     for (auto port : m_portPool->getPublisherPortDataList())
     {
@@ -789,6 +916,15 @@ void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcep
             IOX_LOG(DEBUG) << "Deleted condition variable of application" << runtimeName;
         }
     }
+
+    for (auto controlChannelData : m_portPool->getControlChannelDataList())
+    {
+        if (runtimeName == controlChannelData->m_runtimeName)
+        {
+            m_portPool->removeControlChannelData(controlChannelData);
+            IOX_LOG(DEBUG) << "Deleted control channel of application " << runtimeName;
+        }
+    }
 }
 
 void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept
@@ -811,6 +947,16 @@ void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* con
 
     publisherPortRoudi.releaseAllChunks();
 
+    if (isChunkRingReferencedBySubscriber(publisherPortData->m_chunkSenderData.m_chunkRing))
+    {
+        IOX_LOG(DEBUG) << "Defer destruction of publisher port from runtime '" << publisherPortData->m_runtimeName
+                       << "' since a subscriber might still read from its chunk ring";
+        publisherPortData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+        // there is no full discovery sweep, hence the port is retried with the discovery of the next monitoring cycle
+        publisherPortData->m_discoveryNotifier.markPending();
+        return;
+    }
+
     m_portIntrospection.removePublisher(publisherPortUser);
 
     IOX_LOG(DEBUG) << "Destroy publisher port from runtime '" << publisherPortData->m_runtimeName
@@ -837,6 +983,19 @@ void PortManager::destroySubscriberPort(SubscriberPortType::MemberType_t* const
 
     subscriberPortRoudi.releaseAllChunks();
 
+    // the subscriber is already unsubscribed when the destruction is retried, hence no further UNSUB is sent
+    removeChunkQueueFromPublishers(&subscriberPortData->m_chunkReceiverData);
+
+    if (isChunkQueueReferencedByPublisher(&subscriberPortData->m_chunkReceiverData))
+    {
+        IOX_LOG(DEBUG) << "Defer destruction of subscriber port from runtime '" << subscriberPortData->m_runtimeName
+                       << "' since a publisher might still deliver to it";
+        subscriberPortData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+        // there is no full discovery sweep, hence the port is retried with the discovery of the next monitoring cycle
+        subscriberPortData->m_discoveryNotifier.markPending();
+        return;
+    }
+
     m_portIntrospection.removeSubscriber(subscriberPortUser);
 
     IOX_LOG(DEBUG) << "Destroy subscriber port from runtime '" << subscriberPortData->m_runtimeName
@@ -855,6 +1014,7 @@ PortManager::acquirePublisherPortData(const capro::ServiceDescription& service,
     return acquirePublisherPortDataWithoutDiscovery(
                service, publisherOptions, runtimeName, payloadDataSegmentMemoryManager, portConfigInfo)
         .and_then([&](auto publisherPortData) {
+            std::lock_guard<std::mutex> lock(m_portCreationMutex);
             PublisherPortRouDiType port(publisherPortData);
             this->doDiscoveryForPublisherPort(port);
         });
@@ -867,6 +1027,12 @@ PortManager::acquirePublisherPortDataWithoutDiscovery(const capro::ServiceDescri
                                                       mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
                                                       const PortConfigInfo& portConfigInfo) noexcept
 {
+    // with the 1:n policy the check for an existing publisher and the creation of the new one must not be interleaved
+    // with the creation of another publisher; otherwise the port is constructed concurrently to other requests
+    constexpr bool IS_UNIQUE_PUBLISHER_POLICY{
+        std::is_same<iox::build::CommunicationPolicy, iox::build::OneToManyPolicy>::value};
+    std::unique_lock<std::mutex> lock(m_portCreationMutex);
+
     if (doesViolateCommunicationPolicy<iox::build::CommunicationPolicy>(service).and_then(
             [&](const auto& usedByProcess) {
                 IOX_LOG(WARN)
@@ -889,6 +1055,11 @@ PortManager::acquirePublisherPortDataWithoutDiscovery(const capro::ServiceDescri
         return err(PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN);
     }
 
+    if (!IS_UNIQUE_PUBLISHER_POLICY)
+    {
+        lock.unlock();
+    }
+
     // we can create a new port
     auto maybePublisherPortData = m_portPool->addPublisherPort(
         service, payloadDataSegmentMemoryManager, runtimeName, publisherOptions, portConfigInfo.memoryInfo);
@@ -898,6 +1069,10 @@ PortManager::acquirePublisherPortDataWithoutDiscovery(const capro::ServiceDescri
         auto publisherPortData = maybePublisherPortData.value();
         if (publisherPortData)
         {
+            if (!lock.owns_lock())
+            {
+                lock.lock();
+            }
             m_portIntrospection.addPublisher(*publisherPortData);
         }
     }
@@ -918,6 +1093,7 @@ PortManager::acquireInternalPublisherPortData(const capro::ServiceDescription& s
         })
         .and_then([&](auto publisherPortData) {
             // now the port to send registry information exists and can be used to publish service registry changes
+            std::lock_guard<std::mutex> lock(m_portCreationMutex);
             PublisherPortRouDiType port(publisherPortData);
             this->doDiscoveryForPublisherPort(port);
         })
@@ -951,6 +1127,7 @@ PortManager::acquireSubscriberPortData(const capro::ServiceDescription& service,
         auto subscriberPortData = maybeSubscriberPortData.value();
         if (subscriberPortData)
         {
+            std::lock_guard<std::mutex> lock(m_portCreationMutex);
             m_portIntrospection.addSubscriber(*subscriberPortData);
 
             // we do discovery here for trying to connect with publishers if subscribe on create is desired
@@ -976,6 +1153,7 @@ PortManager::acquireClientPortData(const capro::ServiceDescription& service,
             /// @todo iox-#1128 add to port introspection
 
             // we do discovery here for trying to connect the client if offer on create is desired
+            std::lock_guard<std::mutex> lock(m_portCreationMutex);
             popo::ClientPortRouDi clientPort(*clientPortData);
             this->doDiscoveryForClientPort(clientPort);
         });
@@ -989,7 +1167,8 @@ PortManager::acquireServerPortData(const capro::ServiceDescription& service,
                                    const PortConfigInfo& portConfigInfo) noexcept
 {
     // it is not allowed to have two servers with the same ServiceDescription;
-    // check if the server is already in the list
+    // check if the server is already in the list and create the new one without being interleaved by another request
+    std::lock_guard<std::mutex> lock(m_portCreationMutex);
     for (const auto serverPortData : m_portPool->getServerPortDataList())
     {
         if (service == serverPortData->m_serviceDescription)
@@ -1036,6 +1215,57 @@ popo::InterfacePortData* PortManager::acquireInterfacePortData(capro::Interfaces
     }
 }
 
+expected<void, ServiceRegistry::Error>
+PortManager::changeServiceRegistry(const ServiceRegistryChange::Operation operation,
+                                   const capro::ServiceDescription& service) noexcept
+{
+    ServiceRegistryChange change;
+    change.sequenceNumber = m_serviceRegistry.sequenceNumber() + 1U;
+    change.operation = operation;
+    change.serviceDescription = service;
+
+    auto result = m_serviceRegistry.apply(change);
+    if (!result.has_error())
+    {
+        publishServiceRegistryChange(change);
+    }
+    return result;
+}
+
+void PortManager::publishServiceRegistryChange(const ServiceRegistryChange& change) const noexcept
+{
+    if (!m_serviceRegistryChangesPublisherPortData.has_value())
+    {
+        // should not happen (except during RouDi shutdown)
+        // the port always exists, otherwise we would terminate during startup
+        IOX_LOG(WARN) << "Could not publish service registry change!";
+        return;
+    }
+    PublisherPortUserType publisher(m_serviceRegistryChangesPublisherPortData.value());
+    publisher
+        .tryAllocateChunk(sizeof(ServiceRegistryChange),
+                          alignof(ServiceRegistryChange),
+                          CHUNK_NO_USER_HEADER_SIZE,
+                          CHUNK_NO_USER_HEADER_ALIGNMENT)
+        .and_then([&](auto& chunk) {
+            // the snapshot is published before the change with the same sequence number; a ServiceDiscovery which
+            // detects a gap in the changes therefore always finds a snapshot to catch up with
+            if (change.sequenceNumber % SERVICE_REGISTRY_SNAPSHOT_INTERVAL == 0U)
+            {
+                publishServiceRegistry();
+            }
+
+            new (chunk->userPayload()) ServiceRegistryChange(change);
+
+            publisher.sendChunk(chunk);
+        })
+        .or_else([&](auto&) {
+            IOX_LOG(WARN) << "Could not allocate a chunk for the service registry change, publishing the service "
+                             "registry instead!";
+            publishServiceRegistry();
+        });
+}
+
 void PortManager::publishServiceRegistry() const noexcept
 {
     if (!m_serviceRegistryPublisherPortData.has_value())
@@ -1067,32 +1297,28 @@ const ServiceRegistry& PortManager::serviceRegistry() const noexcept
 
 void PortManager::addPublisherToServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
-    m_serviceRegistry.addPublisher(service).or_else([&](auto&) {
+    changeServiceRegistry(ServiceRegistryChange::Operation::ADD_PUBLISHER, service).or_else([&](auto&) {
         IOX_LOG(WARN) << "Could not add publisher with service description '" << service << "' to service registry!";
         errorHandler(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, ErrorLevel::MODERATE);
     });
-    publishServiceRegistry();
 }
 
 void PortManager::removePublisherFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
-    m_serviceRegistry.removePublisher(service);
-    publishServiceRegistry();
+    changeServiceRegistry(ServiceRegistryChange::Operation::REMOVE_PUBLISHER, service);
 }
 
 void PortManager::addServerToServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
-    m_serviceRegistry.addServer(service).or_else([&](auto&) {
+    changeServiceRegistry(ServiceRegistryChange::Operation::ADD_SERVER, service).or_else([&](auto&) {
         IOX_LOG(WARN) << "Could not add server with service description '" << service << "' to service registry!";
         errorHandler(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, ErrorLevel::MODERATE);
     });
-    publishServiceRegistry();
 }
 
 void PortManager::removeServerFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
-    m_serviceRegistry.removeServer(service);
-    publishServiceRegistry();
+    changeServiceRegistry(ServiceRegistryChange::Operation::REMOVE_SERVER, service);
 }
 
 expected<runtime::NodeData*, PortPoolError> PortManager::acquireNodeData(const RuntimeName_t& runtimeName,
@@ -1107,6 +1333,12 @@ PortManager::acquireConditionVariableData(const RuntimeName_t& runtimeName) noex
     return m_portPool->addConditionVariableData(runtimeName);
 }
 
+expected<runtime::ControlChannelData*, PortPoolError>
+PortManager::acquireControlChannelData(const RuntimeName_t& runtimeName) noexcept
+{
+    return m_portPool->addControlChannelData(runtimeName);
+}
+
 bool PortManager::isInternal(const capro::ServiceDescription& service) const noexcept
 {
     for (auto& internalService : m_internalServices)
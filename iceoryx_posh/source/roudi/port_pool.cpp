@@ -43,13 +43,18 @@ PortPool::getConditionVariableDataList() noexcept
     return m_portPoolData->m_conditionVariableMembers.content();
 }
 
+vector<runtime::ControlChannelData*, MAX_NUMBER_OF_CONTROL_CHANNELS> PortPool::getControlChannelDataList() noexcept
+{
+    return m_portPoolData->m_controlChannelMembers.content();
+}
+
 expected<popo::InterfacePortData*, PortPoolError> PortPool::addInterfacePort(const RuntimeName_t& runtimeName,
                                                                              const capro::Interfaces interface) noexcept
 {
-    if (m_portPoolData->m_interfacePortMembers.hasFreeSpace())
+    auto interfacePortData = m_portPoolData->m_interfacePortMembers.insert(runtimeName, interface);
+    if (interfacePortData != nullptr)
     {
-        auto interfacePortData = m_portPoolData->m_interfacePortMembers.insert(runtimeName, interface);
-        return ok(interfacePortData);
+        return ok(setupDiscoveryNotifier(m_portPoolData->m_interfacePortMembers, interfacePortData));
     }
     else
     {
@@ -63,10 +68,10 @@ expected<runtime::NodeData*, PortPoolError> PortPool::addNodeData(const RuntimeN
                                                                   const NodeName_t& nodeName,
                                                                   const uint64_t nodeDeviceIdentifier) noexcept
 {
-    if (m_portPoolData->m_nodeMembers.hasFreeSpace())
+    auto nodeData = m_portPoolData->m_nodeMembers.insert(runtimeName, nodeName, nodeDeviceIdentifier);
+    if (nodeData != nullptr)
     {
-        auto nodeData = m_portPoolData->m_nodeMembers.insert(runtimeName, nodeName, nodeDeviceIdentifier);
-        return ok(nodeData);
+        return ok(setupDiscoveryNotifier(m_portPoolData->m_nodeMembers, nodeData));
     }
     else
     {
@@ -80,10 +85,10 @@ expected<runtime::NodeData*, PortPoolError> PortPool::addNodeData(const RuntimeN
 expected<popo::ConditionVariableData*, PortPoolError>
 PortPool::addConditionVariableData(const RuntimeName_t& runtimeName) noexcept
 {
-    if (m_portPoolData->m_conditionVariableMembers.hasFreeSpace())
+    auto conditionVariableData = m_portPoolData->m_conditionVariableMembers.insert(runtimeName);
+    if (conditionVariableData != nullptr)
     {
-        auto conditionVariableData = m_portPoolData->m_conditionVariableMembers.insert(runtimeName);
-        return ok(conditionVariableData);
+        return ok(setupDiscoveryNotifier(m_portPoolData->m_conditionVariableMembers, conditionVariableData));
     }
     else
     {
@@ -93,6 +98,63 @@ PortPool::addConditionVariableData(const RuntimeName_t& runtimeName) noexcept
     }
 }
 
+expected<runtime::ControlChannelData*, PortPoolError>
+PortPool::addControlChannelData(const RuntimeName_t& runtimeName) noexcept
+{
+    auto controlChannelData = m_portPoolData->m_controlChannelMembers.insert(runtimeName);
+    if (controlChannelData != nullptr)
+    {
+        return ok(controlChannelData);
+    }
+    else
+    {
+        IOX_LOG(WARN) << "Out of control channels! Requested by runtime '" << runtimeName << "'";
+        errorHandler(PoshError::PORT_POOL__CONTROL_CHANNEL_LIST_OVERFLOW, ErrorLevel::MODERATE);
+        return err(PortPoolError::CONTROL_CHANNEL_LIST_FULL);
+    }
+}
+
+vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS> PortPool::getPendingPublisherPortDataList() noexcept
+{
+    return m_portPoolData->m_publisherPortMembers.takePending();
+}
+
+vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS> PortPool::getPendingSubscriberPortDataList() noexcept
+{
+    return m_portPoolData->m_subscriberPortMembers.takePending();
+}
+
+vector<popo::ClientPortData*, MAX_CLIENTS> PortPool::getPendingClientPortDataList() noexcept
+{
+    return m_portPoolData->m_clientPortMembers.takePending();
+}
+
+vector<popo::ServerPortData*, MAX_SERVERS> PortPool::getPendingServerPortDataList() noexcept
+{
+    return m_portPoolData->m_serverPortMembers.takePending();
+}
+
+vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER> PortPool::getPendingInterfacePortDataList() noexcept
+{
+    return m_portPoolData->m_interfacePortMembers.takePending();
+}
+
+vector<runtime::NodeData*, MAX_NODE_NUMBER> PortPool::getPendingNodeDataList() noexcept
+{
+    return m_portPoolData->m_nodeMembers.takePending();
+}
+
+vector<popo::ConditionVariableData*, MAX_NUMBER_OF_CONDITION_VARIABLES>
+PortPool::getPendingConditionVariableDataList() noexcept
+{
+    return m_portPoolData->m_conditionVariableMembers.takePending();
+}
+
+popo::ConditionVariableData& PortPool::getDiscoveryConditionVariableData() noexcept
+{
+    return m_portPoolData->m_discoveryConditionVariable;
+}
+
 void PortPool::removeInterfacePort(const popo::InterfacePortData* const portData) noexcept
 {
     m_portPoolData->m_interfacePortMembers.erase(portData);
@@ -108,6 +170,11 @@ void PortPool::removeConditionVariableData(const popo::ConditionVariableData* co
     m_portPoolData->m_conditionVariableMembers.erase(conditionVariableData);
 }
 
+void PortPool::removeControlChannelData(const runtime::ControlChannelData* const controlChannelData) noexcept
+{
+    m_portPoolData->m_controlChannelMembers.erase(controlChannelData);
+}
+
 vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS> PortPool::getPublisherPortDataList() noexcept
 {
     return m_portPoolData->m_publisherPortMembers.content();
@@ -125,11 +192,11 @@ PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
                            const popo::PublisherOptions& publisherOptions,
                            const mepoo::MemoryInfo& memoryInfo) noexcept
 {
-    if (m_portPoolData->m_publisherPortMembers.hasFreeSpace())
+    auto publisherPortData = m_portPoolData->m_publisherPortMembers.insert(
+        serviceDescription, runtimeName, memoryManager, publisherOptions, memoryInfo);
+    if (publisherPortData != nullptr)
     {
-        auto publisherPortData = m_portPoolData->m_publisherPortMembers.insert(
-            serviceDescription, runtimeName, memoryManager, publisherOptions, memoryInfo);
-        return ok(publisherPortData);
+        return ok(setupDiscoveryNotifier(m_portPoolData->m_publisherPortMembers, publisherPortData));
     }
     else
     {
@@ -146,12 +213,11 @@ PortPool::addSubscriberPort(const capro::ServiceDescription& serviceDescription,
                             const popo::SubscriberOptions& subscriberOptions,
                             const mepoo::MemoryInfo& memoryInfo) noexcept
 {
-    if (m_portPoolData->m_subscriberPortMembers.hasFreeSpace())
+    auto subscriberPortData = constructSubscriber<iox::build::CommunicationPolicy>(
+        serviceDescription, runtimeName, subscriberOptions, memoryInfo);
+    if (subscriberPortData != nullptr)
     {
-        auto subscriberPortData = constructSubscriber<iox::build::CommunicationPolicy>(
-            serviceDescription, runtimeName, subscriberOptions, memoryInfo);
-
-        return ok(subscriberPortData);
+        return ok(setupDiscoveryNotifier(m_portPoolData->m_subscriberPortMembers, subscriberPortData));
     }
     else
     {
@@ -179,7 +245,9 @@ PortPool::addClientPort(const capro::ServiceDescription& serviceDescription,
                         const popo::ClientOptions& clientOptions,
                         const mepoo::MemoryInfo& memoryInfo) noexcept
 {
-    if (!m_portPoolData->m_clientPortMembers.hasFreeSpace())
+    auto clientPortData = m_portPoolData->m_clientPortMembers.insert(
+        serviceDescription, runtimeName, clientOptions, memoryManager, memoryInfo);
+    if (clientPortData == nullptr)
     {
         IOX_LOG(WARN) << "Out of client ports! Requested by runtime '" << runtimeName
                       << "' and with service description '" << serviceDescription << "'";
@@ -187,9 +255,7 @@ PortPool::addClientPort(const capro::ServiceDescription& serviceDescription,
         return err(PortPoolError::CLIENT_PORT_LIST_FULL);
     }
 
-    auto clientPortData = m_portPoolData->m_clientPortMembers.insert(
-        serviceDescription, runtimeName, clientOptions, memoryManager, memoryInfo);
-    return ok(clientPortData);
+    return ok(setupDiscoveryNotifier(m_portPoolData->m_clientPortMembers, clientPortData));
 }
 
 expected<popo::ServerPortData*, PortPoolError>
@@ -199,7 +265,9 @@ PortPool::addServerPort(const capro::ServiceDescription& serviceDescription,
                         const popo::ServerOptions& serverOptions,
                         const mepoo::MemoryInfo& memoryInfo) noexcept
 {
-    if (!m_portPoolData->m_serverPortMembers.hasFreeSpace())
+    auto serverPortData = m_portPoolData->m_serverPortMembers.insert(
+        serviceDescription, runtimeName, serverOptions, memoryManager, memoryInfo);
+    if (serverPortData == nullptr)
     {
         IOX_LOG(WARN) << "Out of server ports! Requested by runtime '" << runtimeName
                       << "' and with service description '" << serviceDescription << "'";
@@ -207,9 +275,7 @@ PortPool::addServerPort(const capro::ServiceDescription& serviceDescription,
         return err(PortPoolError::SERVER_PORT_LIST_FULL);
     }
 
-    auto serverPortData = m_portPoolData->m_serverPortMembers.insert(
-        serviceDescription, runtimeName, serverOptions, memoryManager, memoryInfo);
-    return ok(serverPortData);
+    return ok(setupDiscoveryNotifier(m_portPoolData->m_serverPortMembers, serverPortData));
 }
 
 void PortPool::removePublisherPort(const PublisherPortRouDiType::MemberType_t* const portData) noexcept
@@ -84,5 +84,15 @@ bool Process::isMonitored() const noexcept
     return m_isMonitored;
 }
 
+void Process::setControlChannel(runtime::ControlChannelData* const controlChannel) noexcept
+{
+    m_controlChannel = controlChannel;
+}
+
+runtime::ControlChannelData* Process::getControlChannel() const noexcept
+{
+    return m_controlChannel;
+}
+
 } // namespace roudi
 } // namespace iox
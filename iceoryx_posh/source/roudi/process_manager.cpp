@@ -27,7 +27,10 @@
 #include "iox/relative_pointer.hpp"
 #include "iox/vector.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <cstring>
+#include <mutex>
 #include <thread>
 
 using namespace iox::units::duration_literals;
@@ -78,6 +81,7 @@ ProcessManager::ProcessManager(RouDiMemoryInterface& roudiMemoryInterface,
 
 void ProcessManager::handleProcessShutdownPreparationRequest(const RuntimeName_t& name) noexcept
 {
+    std::lock_guard<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) {
             m_portManager.unblockProcessShutdown(name);
@@ -91,6 +95,7 @@ void ProcessManager::handleProcessShutdownPreparationRequest(const RuntimeName_t
 
 void ProcessManager::requestShutdownOfAllProcesses() noexcept
 {
+    std::lock_guard<std::shared_timed_mutex> lock(m_processListMutex);
     // send SIG_TERM to all running applications and wait for processes to answer with TERMINATION
     for (auto& process : m_processList)
     {
@@ -103,6 +108,7 @@ void ProcessManager::requestShutdownOfAllProcesses() noexcept
 
 bool ProcessManager::isAnyRegisteredProcessStillRunning() noexcept
 {
+    std::lock_guard<std::shared_timed_mutex> lock(m_processListMutex);
     for (auto& process : m_processList)
     {
         if (isProcessAlive(process))
@@ -115,6 +121,7 @@ bool ProcessManager::isAnyRegisteredProcessStillRunning() noexcept
 
 void ProcessManager::killAllProcesses() noexcept
 {
+    std::lock_guard<std::shared_timed_mutex> lock(m_processListMutex);
     for (auto& process : m_processList)
     {
         IOX_LOG(WARN) << "Process ID " << process.getPid() << " named '" << process.getName()
@@ -125,6 +132,7 @@ void ProcessManager::killAllProcesses() noexcept
 
 void ProcessManager::printWarningForRegisteredProcessesAndClearProcessList() noexcept
 {
+    std::lock_guard<std::shared_timed_mutex> lock(m_processListMutex);
     for (auto& process : m_processList)
     {
         IOX_LOG(WARN) << "Process ID " << process.getPid() << " named '" << process.getName()
@@ -194,6 +202,7 @@ bool ProcessManager::registerProcess(const RuntimeName_t& name,
                                      const uint64_t sessionId,
                                      const version::VersionInfo& versionInfo) noexcept
 {
+    std::lock_guard<std::shared_timed_mutex> lock(m_processListMutex);
     bool returnValue{false};
 
     findProcess(name)
@@ -280,6 +289,7 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
 
 bool ProcessManager::unregisterProcess(const RuntimeName_t& name) noexcept
 {
+    std::lock_guard<std::shared_timed_mutex> lock(m_processListMutex);
     constexpr TerminationFeedback FEEDBACK{TerminationFeedback::SEND_ACK_TO_PROCESS};
     if (!searchForProcessAndRemoveIt(name, FEEDBACK))
     {
@@ -333,6 +343,7 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
 
 void ProcessManager::updateLivelinessOfProcess(const RuntimeName_t& name) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) {
             // reset timestamp
@@ -345,6 +356,7 @@ void ProcessManager::addInterfaceForProcess(const RuntimeName_t& name,
                                             capro::Interfaces interface,
                                             const NodeName_t& node) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) {
             // create a ReceiverPort
@@ -365,6 +377,7 @@ void ProcessManager::addInterfaceForProcess(const RuntimeName_t& name,
 
 void ProcessManager::addNodeForProcess(const RuntimeName_t& runtimeName, const NodeName_t& nodeName) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(runtimeName)
         .and_then([&](auto& process) {
             m_portManager.acquireNodeData(runtimeName, nodeName)
@@ -398,6 +411,7 @@ void ProcessManager::addNodeForProcess(const RuntimeName_t& runtimeName, const N
 
 void ProcessManager::sendMessageNotSupportedToRuntime(const RuntimeName_t& name) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(name).and_then([&](auto& process) {
         runtime::IpcMessage sendBuffer;
         sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::MESSAGE_NOT_SUPPORTED);
@@ -412,11 +426,11 @@ void ProcessManager::addSubscriberForProcess(const RuntimeName_t& name,
                                              const popo::SubscriberOptions& subscriberOptions,
                                              const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) {
             // create a SubscriberPort
-            auto maybeSubscriber =
-                m_portManager.acquireSubscriberPortData(service, subscriberOptions, name, portConfigInfo);
+            auto maybeSubscriber = acquireSubscriberForProcess(*process, service, subscriberOptions, portConfigInfo);
 
             if (maybeSubscriber.has_value())
             {
@@ -427,18 +441,13 @@ void ProcessManager::addSubscriberForProcess(const RuntimeName_t& name,
                 sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK)
                            << cxx::convert::toString(offset) << cxx::convert::toString(m_mgmtSegmentId);
                 process->sendViaIpcChannel(sendBuffer);
-
-                IOX_LOG(DEBUG) << "Created new SubscriberPort for application '" << name
-                               << "' with service description '" << service << "'";
             }
             else
             {
                 runtime::IpcMessage sendBuffer;
                 sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
+                sendBuffer << runtime::IpcMessageErrorTypeToString(maybeSubscriber.error());
                 process->sendViaIpcChannel(sendBuffer);
-                IOX_LOG(ERROR) << "Could not create SubscriberPort for application '" << name
-                               << "' with service description '" << service << "'";
             }
         })
         .or_else([&]() {
@@ -452,23 +461,10 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
                                             const popo::PublisherOptions& publisherOptions,
                                             const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) { // create a PublisherPort
-            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
-
-            if (!segmentInfo.m_memoryManager.has_value())
-            {
-                // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
-                return;
-            }
-
-            auto maybePublisher = m_portManager.acquirePublisherPortData(
-                service, publisherOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+            auto maybePublisher = acquirePublisherForProcess(*process, service, publisherOptions, portConfigInfo);
 
             if (maybePublisher.has_value())
             {
@@ -479,40 +475,13 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
                 sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER_ACK)
                            << cxx::convert::toString(offset) << cxx::convert::toString(m_mgmtSegmentId);
                 process->sendViaIpcChannel(sendBuffer);
-
-                IOX_LOG(DEBUG) << "Created new PublisherPort for application '" << name
-                               << "' with service description '" << service << "'";
             }
             else
             {
                 runtime::IpcMessage sendBuffer;
                 sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-
-                std::string error;
-                switch (maybePublisher.error())
-                {
-                case PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::NO_UNIQUE_CREATED);
-                    break;
-                }
-                case PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(
-                        runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN);
-                    break;
-                }
-                default:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL);
-                    break;
-                }
-                }
-                sendBuffer << error;
-
+                sendBuffer << runtime::IpcMessageErrorTypeToString(maybePublisher.error());
                 process->sendViaIpcChannel(sendBuffer);
-                IOX_LOG(ERROR) << "Could not create PublisherPort for application '" << name
-                               << "' with service description '" << service << "'";
             }
         })
         .or_else([&]() {
@@ -521,11 +490,71 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
         });
 }
 
+expected<SubscriberPortType::MemberType_t*, runtime::IpcMessageErrorType>
+ProcessManager::acquireSubscriberForProcess(Process& process,
+                                            const capro::ServiceDescription& service,
+                                            const popo::SubscriberOptions& subscriberOptions,
+                                            const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto maybeSubscriber =
+        m_portManager.acquireSubscriberPortData(service, subscriberOptions, process.getName(), portConfigInfo);
+
+    if (maybeSubscriber.has_error())
+    {
+        IOX_LOG(ERROR) << "Could not create SubscriberPort for application '" << process.getName()
+                       << "' with service description '" << service << "'";
+        return err(runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
+    }
+
+    IOX_LOG(DEBUG) << "Created new SubscriberPort for application '" << process.getName()
+                   << "' with service description '" << service << "'";
+    return ok(maybeSubscriber.value());
+}
+
+expected<PublisherPortRouDiType::MemberType_t*, runtime::IpcMessageErrorType>
+ProcessManager::acquirePublisherForProcess(Process& process,
+                                           const capro::ServiceDescription& service,
+                                           const popo::PublisherOptions& publisherOptions,
+                                           const PortConfigInfo& portConfigInfo) noexcept
+{
+    auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process.getUser());
+
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        // Tell the app no writable shared memory segment was found
+        return err(runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
+    }
+
+    auto maybePublisher = m_portManager.acquirePublisherPortData(
+        service, publisherOptions, process.getName(), &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+
+    if (maybePublisher.has_error())
+    {
+        IOX_LOG(ERROR) << "Could not create PublisherPort for application '" << process.getName()
+                       << "' with service description '" << service << "'";
+
+        switch (maybePublisher.error())
+        {
+        case PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS:
+            return err(runtime::IpcMessageErrorType::NO_UNIQUE_CREATED);
+        case PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
+            return err(runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN);
+        default:
+            return err(runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL);
+        }
+    }
+
+    IOX_LOG(DEBUG) << "Created new PublisherPort for application '" << process.getName()
+                   << "' with service description '" << service << "'";
+    return ok(maybePublisher.value());
+}
+
 void ProcessManager::addClientForProcess(const RuntimeName_t& name,
                                          const capro::ServiceDescription& service,
                                          const popo::ClientOptions& clientOptions,
                                          const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) { // create a ClientPort
             auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
@@ -578,6 +607,7 @@ void ProcessManager::addServerForProcess(const RuntimeName_t& name,
                                          const popo::ServerOptions& serverOptions,
                                          const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) { // create a ServerPort
             auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
@@ -627,6 +657,7 @@ void ProcessManager::addServerForProcess(const RuntimeName_t& name,
 
 void ProcessManager::addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(runtimeName)
         .and_then([&](auto& process) { // Try to create a condition variable
             m_portManager.acquireConditionVariableData(runtimeName)
@@ -658,15 +689,227 @@ void ProcessManager::addConditionVariableForProcess(const RuntimeName_t& runtime
             [&]() { IOX_LOG(WARN) << "Unknown application " << runtimeName << " requested a ConditionVariable."; });
 }
 
+void ProcessManager::addControlChannelForProcess(const RuntimeName_t& runtimeName) noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
+    findProcess(runtimeName)
+        .and_then([&](auto& process) {
+            auto sendControlChannel = [&](runtime::ControlChannelData* const controlChannel) {
+                auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, controlChannel);
+
+                runtime::IpcMessage sendBuffer;
+                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_CONTROL_CHANNEL_ACK)
+                           << cxx::convert::toString(offset) << cxx::convert::toString(m_mgmtSegmentId);
+                process->sendViaIpcChannel(sendBuffer);
+            };
+
+            // a process has at most one control channel; a repeated request gets the already existing one
+            if (process->getControlChannel() != nullptr)
+            {
+                sendControlChannel(process->getControlChannel());
+                return;
+            }
+
+            m_portManager.acquireControlChannelData(runtimeName)
+                .and_then([&](auto controlChannel) {
+                    process->setControlChannel(controlChannel);
+                    sendControlChannel(controlChannel);
+
+                    IOX_LOG(DEBUG) << "Created new ControlChannel for application " << runtimeName;
+                })
+                .or_else([&](auto&) {
+                    runtime::IpcMessage sendBuffer;
+                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
+                    sendBuffer << runtime::IpcMessageErrorTypeToString(
+                        runtime::IpcMessageErrorType::CONTROL_CHANNEL_LIST_FULL);
+                    process->sendViaIpcChannel(sendBuffer);
+
+                    IOX_LOG(DEBUG) << "Could not create new ControlChannel for application " << runtimeName;
+                });
+        })
+        .or_else([&]() { IOX_LOG(WARN) << "Unknown application " << runtimeName << " requested a ControlChannel."; });
+}
+
+void ProcessManager::processControlChannelRequests(const RuntimeName_t& runtimeName) noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
+    findProcess(runtimeName)
+        .and_then([&](auto& process) {
+            auto controlChannel = process->getControlChannel();
+            if (controlChannel == nullptr)
+            {
+                runtime::IpcMessage sendBuffer;
+                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
+                sendBuffer << runtime::IpcMessageErrorTypeToString(
+                    runtime::IpcMessageErrorType::CONTROL_CHANNEL_INVALID_REQUEST);
+                process->sendViaIpcChannel(sendBuffer);
+
+                IOX_LOG(WARN) << "Application " << runtimeName << " rang the doorbell without a ControlChannel.";
+                return;
+            }
+
+            // the control channel is writable by the application, therefore the number of requests is not trusted
+            const uint64_t numberOfRequests =
+                std::min(controlChannel->m_numberOfRequests, runtime::ControlChannelData::CAPACITY);
+
+            for (uint64_t i = 0U; i < numberOfRequests; ++i)
+            {
+                // the request is copied before it is validated, otherwise the application could change it in between
+                runtime::ControlRequest request;
+                std::memcpy(
+                    static_cast<void*>(&request), &controlChannel->m_requests[i], sizeof(runtime::ControlRequest));
+
+                auto& response = controlChannel->m_responses[i];
+                if (!isValidControlRequest(request))
+                {
+                    IOX_LOG(WARN) << "Application " << runtimeName << " sent an invalid ControlChannel request.";
+                    response.m_isSuccessful = false;
+                    response.m_error = runtime::IpcMessageErrorType::CONTROL_CHANNEL_INVALID_REQUEST;
+                    continue;
+                }
+
+                processControlRequest(*process, request, response);
+            }
+
+            runtime::IpcMessage sendBuffer;
+            sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CONTROL_CHANNEL_DOORBELL_ACK)
+                       << cxx::convert::toString(numberOfRequests);
+            process->sendViaIpcChannel(sendBuffer);
+        })
+        .or_else([&]() {
+            IOX_LOG(WARN) << "Unknown application " << runtimeName << " rang the doorbell of a ControlChannel.";
+        });
+}
+
+void ProcessManager::processControlRequest(Process& process,
+                                           const runtime::ControlRequest& request,
+                                           runtime::ControlResponse& response) noexcept
+{
+    auto writeResponse = [&](auto& maybePort) {
+        if (maybePort.has_value())
+        {
+            response.m_isSuccessful = true;
+            response.m_error = runtime::IpcMessageErrorType::NOTYPE;
+            response.m_offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybePort.value());
+            response.m_segmentId = m_mgmtSegmentId;
+        }
+        else
+        {
+            response.m_isSuccessful = false;
+            response.m_error = maybePort.error();
+        }
+    };
+
+    switch (request.m_type)
+    {
+    case runtime::ControlRequestType::CREATE_PUBLISHER:
+    {
+        auto maybePublisher = acquirePublisherForProcess(
+            process, request.m_service, request.m_publisherOptions, request.m_portConfigInfo);
+        writeResponse(maybePublisher);
+        break;
+    }
+    case runtime::ControlRequestType::CREATE_SUBSCRIBER:
+    {
+        auto maybeSubscriber = acquireSubscriberForProcess(
+            process, request.m_service, request.m_subscriberOptions, request.m_portConfigInfo);
+        writeResponse(maybeSubscriber);
+        break;
+    }
+    default:
+        IOX_LOG(WARN) << "Application " << process.getName() << " sent an invalid ControlChannel request.";
+        response.m_isSuccessful = false;
+        response.m_error = runtime::IpcMessageErrorType::CONTROL_CHANNEL_INVALID_REQUEST;
+        break;
+    }
+}
+
+namespace
+{
+template <uint64_t Capacity>
+bool isValidString(const string<Capacity>& value) noexcept
+{
+    return value.size() <= Capacity && strnlen(value.c_str(), Capacity + 1U) == value.size();
+}
+
+bool isValidBool(const bool& value) noexcept
+{
+    // a bool with another representation than 0 or 1 is undefined behavior when it is read as bool
+    uint8_t representation{0U};
+    static_assert(sizeof(bool) == sizeof(representation), "bool is expected to have the size of one byte");
+    std::memcpy(&representation, &value, sizeof(representation));
+    return representation <= 1U;
+}
+
+template <typename Enum>
+bool isEnumBelow(const Enum value, const Enum end) noexcept
+{
+    using Underlying_t = typename std::underlying_type<Enum>::type;
+    return static_cast<Underlying_t>(value) < static_cast<Underlying_t>(end);
+}
+
+bool isValidServiceDescription(const capro::ServiceDescription& service) noexcept
+{
+    return isValidString(service.getServiceIDString()) && isValidString(service.getInstanceIDString())
+           && isValidString(service.getEventIDString()) && isEnumBelow(service.getScope(), capro::Scope::INVALID)
+           && isEnumBelow(service.getSourceInterface(), capro::Interfaces::INTERFACE_END);
+}
+
+bool isValidPublisherOptions(const popo::PublisherOptions& options) noexcept
+{
+    constexpr uint64_t MAX_HISTORY_CAPACITY = PublisherPortRouDiType::MemberType_t::ChunkSenderData_t::
+        ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY;
+
+    // the runtime already limits the capacities, larger ones are only written by a misbehaving application
+    return isValidString(options.nodeName) && isValidBool(options.offerOnCreate)
+           && isValidBool(options.parallelBroadcastDelivery)
+           && static_cast<uint8_t>(options.subscriberTooSlowPolicy)
+                  <= static_cast<uint8_t>(popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA)
+           && options.historyCapacity <= MAX_HISTORY_CAPACITY && options.chunkRingCapacity <= MAX_HISTORY_CAPACITY;
+}
+
+bool isValidSubscriberOptions(const popo::SubscriberOptions& options) noexcept
+{
+    constexpr uint64_t MAX_QUEUE_CAPACITY = SubscriberPortType::MemberType_t::ChunkQueueData_t::MAX_CAPACITY;
+
+    return isValidString(options.nodeName) && isValidBool(options.subscribeOnCreate)
+           && isValidBool(options.requiresPublisherHistorySupport)
+           && static_cast<uint8_t>(options.queueFullPolicy)
+                  <= static_cast<uint8_t>(popo::QueueFullPolicy::DISCARD_OLDEST_DATA)
+           && options.queueCapacity > 0U && options.queueCapacity <= MAX_QUEUE_CAPACITY
+           && options.historyRequest <= options.queueCapacity;
+}
+} // namespace
+
+bool ProcessManager::isValidControlRequest(const runtime::ControlRequest& request) noexcept
+{
+    if (!isValidServiceDescription(request.m_service))
+    {
+        return false;
+    }
+
+    switch (request.m_type)
+    {
+    case runtime::ControlRequestType::CREATE_PUBLISHER:
+        return isValidPublisherOptions(request.m_publisherOptions);
+    case runtime::ControlRequestType::CREATE_SUBSCRIBER:
+        return isValidSubscriberOptions(request.m_subscriberOptions);
+    default:
+        return false;
+    }
+}
+
 void ProcessManager::initIntrospection(ProcessIntrospectionType* processIntrospection) noexcept
 {
+    std::lock_guard<std::shared_timed_mutex> lock(m_processListMutex);
     m_processIntrospection = processIntrospection;
 }
 
 void ProcessManager::run() noexcept
 {
+    std::lock_guard<std::shared_timed_mutex> lock(m_processListMutex);
     monitorProcesses();
-    discoveryUpdate();
+    m_portManager.doDiscoveryForPendingRequests();
 }
 
 popo::PublisherPortData*
@@ -730,7 +973,8 @@ void ProcessManager::monitorProcesses() noexcept
 
 void ProcessManager::discoveryUpdate() noexcept
 {
-    m_portManager.doDiscovery();
+    std::lock_guard<std::shared_timed_mutex> lock(m_processListMutex);
+    m_portManager.doDiscoveryForPendingRequests();
 }
 
 } // namespace roudi
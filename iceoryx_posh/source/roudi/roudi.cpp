@@ -21,6 +21,8 @@
 #include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_hoofs/posix_wrapper/thread.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/runtime/node_property.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
@@ -39,24 +41,30 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
     , m_runHandleRuntimeMessageThread(true)
     , m_roudiMemoryInterface(&roudiMemoryInterface)
     , m_portManager(&portManager)
-    , m_prcMgr(concurrent::ForwardArgsToCTor,
-               *m_roudiMemoryInterface,
-               portManager,
-               roudiStartupParameters.m_compatibilityCheckLevel)
+    , m_prcMgr(*m_roudiMemoryInterface, portManager, roudiStartupParameters.m_compatibilityCheckLevel)
     , m_mempoolIntrospection(
           *m_roudiMemoryInterface->introspectionMemoryManager().value(),
           *m_roudiMemoryInterface->segmentManager().value(),
-          PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionMempoolService)))
+          PublisherPortUserType(m_prcMgr.addIntrospectionPublisherPort(IntrospectionMempoolService)))
     , m_monitoringMode(roudiStartupParameters.m_monitoringMode)
     , m_processKillDelay(roudiStartupParameters.m_processKillDelay)
+    , m_numberOfRuntimeMessageWorkers(roudiStartupParameters.m_numberOfRuntimeMessageWorkers)
 {
     if (internal::isCompiledOn32BitSystem())
     {
         IOX_LOG(WARN) << "Runnning RouDi on 32-bit architectures is not supported! Use at your own risk!";
     }
+    const auto requestedNumberOfWorkers = roudiStartupParameters.m_numberOfRuntimeMessageWorkers;
+    if (requestedNumberOfWorkers == 0U || requestedNumberOfWorkers > MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS)
+    {
+        m_numberOfRuntimeMessageWorkers = (requestedNumberOfWorkers == 0U) ? 1U : MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS;
+        IOX_LOG(WARN) << "RouDi supports between 1 and " << MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS
+                      << " runtime message workers but " << requestedNumberOfWorkers
+                      << " were requested. Using " << m_numberOfRuntimeMessageWorkers << " workers.";
+    }
     m_processIntrospection.registerPublisherPort(
-        PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionProcessService)));
-    m_prcMgr->initIntrospection(&m_processIntrospection);
+        PublisherPortUserType(m_prcMgr.addIntrospectionPublisherPort(IntrospectionProcessService)));
+    m_prcMgr.initIntrospection(&m_processIntrospection);
     m_processIntrospection.run();
     m_mempoolIntrospection.run();
 
@@ -91,6 +99,7 @@ void RouDi::shutdown() noexcept
 
     // stop the process management thread in order to prevent application to register while shutting down
     m_runMonitoringAndDiscoveryThread = false;
+    popo::ConditionNotifier(m_portManager->getDiscoveryConditionVariableData(), 0U).notify();
     if (m_monitoringAndDiscoveryThread.joinable())
     {
         IOX_LOG(DEBUG) << "Joining 'Mon+Discover' thread...";
@@ -102,11 +111,11 @@ void RouDi::shutdown() noexcept
     {
         deadline_timer finalKillTimer(m_processKillDelay);
 
-        m_prcMgr->requestShutdownOfAllProcesses();
+        m_prcMgr.requestShutdownOfAllProcesses();
 
         using namespace units::duration_literals;
         auto remainingDurationForWarnPrint = m_processKillDelay - 2_s;
-        while (m_prcMgr->isAnyRegisteredProcessStillRunning() && !finalKillTimer.hasExpired())
+        while (m_prcMgr.isAnyRegisteredProcessStillRunning() && !finalKillTimer.hasExpired())
         {
             if (remainingDurationForWarnPrint > finalKillTimer.remainingTime())
             {
@@ -119,15 +128,15 @@ void RouDi::shutdown() noexcept
         }
 
         // Is any processes still alive?
-        if (m_prcMgr->isAnyRegisteredProcessStillRunning() && finalKillTimer.hasExpired())
+        if (m_prcMgr.isAnyRegisteredProcessStillRunning() && finalKillTimer.hasExpired())
         {
             // Time to kill them
-            m_prcMgr->killAllProcesses();
+            m_prcMgr.killAllProcesses();
         }
 
-        if (m_prcMgr->isAnyRegisteredProcessStillRunning())
+        if (m_prcMgr.isAnyRegisteredProcessStillRunning())
         {
-            m_prcMgr->printWarningForRegisteredProcessesAndClearProcessList();
+            m_prcMgr.printWarningForRegisteredProcessesAndClearProcessList();
         }
     }
 
@@ -149,13 +158,27 @@ void RouDi::cyclicUpdateHook() noexcept
 
 void RouDi::monitorAndDiscoveryUpdate() noexcept
 {
+    // the ports, nodes and condition variables notify this condition variable for each discovery request; the
+    // requests are therefore processed right away while the monitoring of the processes stays cyclic
+    popo::ConditionListener discoveryListener(m_portManager->getDiscoveryConditionVariableData());
+    deadline_timer monitoringTimer(units::Duration::zero());
+
     while (m_runMonitoringAndDiscoveryThread)
     {
-        m_prcMgr->run();
+        if (monitoringTimer.hasExpired())
+        {
+            m_prcMgr.run();
+
+            cyclicUpdateHook();
 
-        cyclicUpdateHook();
+            monitoringTimer.reset(DISCOVERY_INTERVAL);
+        }
+        else
+        {
+            m_prcMgr.discoveryUpdate();
+        }
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(DISCOVERY_INTERVAL.toMilliseconds()));
+        discoveryListener.timedWait(monitoringTimer.remainingTime());
     }
 }
 
@@ -163,6 +186,8 @@ void RouDi::processRuntimeMessages() noexcept
 {
     runtime::IpcInterfaceCreator roudiIpcInterface{IPC_CHANNEL_ROUDI_NAME};
 
+    startRuntimeMessageWorkers();
+
     IOX_LOG(INFO) << "RouDi is ready for clients";
     fflush(stdout); // explicitly flush 'stdout' for 'launch_testing'
 
@@ -172,12 +197,117 @@ void RouDi::processRuntimeMessages() noexcept
         runtime::IpcMessage message;
         if (roudiIpcInterface.timedReceive(m_runtimeMessagesThreadTimeout, message))
         {
-            auto cmd = runtime::stringToIpcMessageType(message.getElementAtIndex(0).c_str());
-            RuntimeName_t runtimeName{into<lossy<RuntimeName_t>>(message.getElementAtIndex(1))};
+            if (m_numberOfRuntimeMessageWorkers == 1U)
+            {
+                processRuntimeMessage(message);
+            }
+            else
+            {
+                dispatchRuntimeMessage(std::move(message));
+            }
+        }
+    }
+
+    stopRuntimeMessageWorkers();
+}
+
+void RouDi::processRuntimeMessage(const runtime::IpcMessage& message) noexcept
+{
+    auto cmd = runtime::stringToIpcMessageType(message.getElementAtIndex(0).c_str());
+    RuntimeName_t runtimeName{into<lossy<RuntimeName_t>>(message.getElementAtIndex(1))};
+
+    processMessage(message, cmd, runtimeName);
+}
+
+uint32_t RouDi::numberOfRuntimeMessageWorkers() const noexcept
+{
+    return m_numberOfRuntimeMessageWorkers;
+}
+
+void RouDi::startRuntimeMessageWorkers() noexcept
+{
+    if (m_numberOfRuntimeMessageWorkers == 1U)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0U; i < m_numberOfRuntimeMessageWorkers; ++i)
+    {
+        auto& worker = m_runtimeMessageWorkers[i];
+        worker.m_stop = false;
+        worker.m_thread = std::thread(&RouDi::runtimeMessageWorkerLoop, this, i);
+
+        posix::ThreadName_t threadName{"IPC-msg-wrk-"};
+        threadName.append(TruncateToCapacity, cxx::convert::toString(i));
+        posix::setThreadName(worker.m_thread.native_handle(), threadName);
+    }
+}
+
+void RouDi::stopRuntimeMessageWorkers() noexcept
+{
+    for (uint32_t i = 0U; i < m_numberOfRuntimeMessageWorkers; ++i)
+    {
+        auto& worker = m_runtimeMessageWorkers[i];
+        if (!worker.m_thread.joinable())
+        {
+            continue;
+        }
+        {
+            std::lock_guard<std::mutex> lock(worker.m_mutex);
+            worker.m_stop = true;
+        }
+        worker.m_messageAvailable.notify_one();
+        worker.m_thread.join();
+    }
+}
+
+void RouDi::dispatchRuntimeMessage(runtime::IpcMessage&& message) noexcept
+{
+    RuntimeName_t runtimeName{into<lossy<RuntimeName_t>>(message.getElementAtIndex(1))};
+    auto& worker = m_runtimeMessageWorkers[runtimeMessageWorkerIndex(runtimeName)];
+    {
+        std::unique_lock<std::mutex> lock(worker.m_mutex);
+        // backpressure; the worker always drains its queue since it is only stopped by this thread
+        worker.m_spaceAvailable.wait(lock, [&] { return !worker.m_messages.full(); });
+        worker.m_messages.push_back(std::move(message));
+    }
+    worker.m_messageAvailable.notify_one();
+}
 
-            processMessage(message, cmd, runtimeName);
+void RouDi::runtimeMessageWorkerLoop(const uint32_t workerIndex) noexcept
+{
+    auto& worker = m_runtimeMessageWorkers[workerIndex];
+    while (true)
+    {
+        runtime::IpcMessage message;
+        {
+            std::unique_lock<std::mutex> lock(worker.m_mutex);
+            worker.m_messageAvailable.wait(lock, [&] { return worker.m_stop || !worker.m_messages.empty(); });
+            // the queued messages are processed before the worker stops, e.g. the TERMINATION of a runtime
+            if (worker.m_messages.empty())
+            {
+                return;
+            }
+            message = std::move(worker.m_messages.front());
+            worker.m_messages.pop_front();
         }
+        worker.m_spaceAvailable.notify_one();
+
+        processRuntimeMessage(message);
+    }
+}
+
+uint32_t RouDi::runtimeMessageWorkerIndex(const RuntimeName_t& runtimeName) const noexcept
+{
+    // FNV-1a; a runtime is always assigned to the same worker which keeps the order of its messages
+    constexpr uint64_t FNV_OFFSET_BASIS{14695981039346656037U};
+    constexpr uint64_t FNV_PRIME{1099511628211U};
+    uint64_t hash{FNV_OFFSET_BASIS};
+    for (const char* c = runtimeName.c_str(); *c != '\0'; ++c)
+    {
+        hash = (hash ^ static_cast<uint8_t>(*c)) * FNV_PRIME;
     }
+    return static_cast<uint32_t>(hash % m_numberOfRuntimeMessageWorkers);
 }
 
 version::VersionInfo RouDi::parseRegisterMessage(const runtime::IpcMessage& message,
@@ -252,7 +382,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(4));
 
-            m_prcMgr->addPublisherForProcess(
+            m_prcMgr.addPublisherForProcess(
                 runtimeName, service, publisherOptions, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
         }
         break;
@@ -289,7 +419,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(4));
 
-            m_prcMgr->addSubscriberForProcess(
+            m_prcMgr.addSubscriberForProcess(
                 runtimeName, service, subscriberOptions, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
         }
         break;
@@ -326,7 +456,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             runtime::PortConfigInfo portConfigInfo{cxx::Serialization(message.getElementAtIndex(4))};
 
-            m_prcMgr->addClientForProcess(runtimeName, service, clientOptions, portConfigInfo);
+            m_prcMgr.addClientForProcess(runtimeName, service, clientOptions, portConfigInfo);
         }
         break;
     }
@@ -362,7 +492,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             runtime::PortConfigInfo portConfigInfo{cxx::Serialization(message.getElementAtIndex(4))};
 
-            m_prcMgr->addServerForProcess(runtimeName, service, serverOptions, portConfigInfo);
+            m_prcMgr.addServerForProcess(runtimeName, service, serverOptions, portConfigInfo);
         }
         break;
     }
@@ -375,7 +505,33 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         else
         {
-            m_prcMgr->addConditionVariableForProcess(runtimeName);
+            m_prcMgr.addConditionVariableForProcess(runtimeName);
+        }
+        break;
+    }
+    case runtime::IpcMessageType::CREATE_CONTROL_CHANNEL:
+    {
+        if (message.getNumberOfElements() != 2)
+        {
+            IOX_LOG(ERROR) << "Wrong number of parameters for \"IpcMessageType::CREATE_CONTROL_CHANNEL\" from \""
+                           << runtimeName << "\"received!";
+        }
+        else
+        {
+            m_prcMgr.addControlChannelForProcess(runtimeName);
+        }
+        break;
+    }
+    case runtime::IpcMessageType::CONTROL_CHANNEL_DOORBELL:
+    {
+        if (message.getNumberOfElements() != 2)
+        {
+            IOX_LOG(ERROR) << "Wrong number of parameters for \"IpcMessageType::CONTROL_CHANNEL_DOORBELL\" from \""
+                           << runtimeName << "\"received!";
+        }
+        else
+        {
+            m_prcMgr.processControlChannelRequests(runtimeName);
         }
         break;
     }
@@ -391,7 +547,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
             capro::Interfaces interface =
                 StringToCaProInterface(into<lossy<capro::IdString_t>>(message.getElementAtIndex(2)));
 
-            m_prcMgr->addInterfaceForProcess(
+            m_prcMgr.addInterfaceForProcess(
                 runtimeName, interface, into<lossy<NodeName_t>>(message.getElementAtIndex(3)));
         }
         break;
@@ -406,13 +562,13 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         else
         {
             runtime::NodeProperty nodeProperty(cxx::Serialization(message.getElementAtIndex(2)));
-            m_prcMgr->addNodeForProcess(runtimeName, nodeProperty.m_name);
+            m_prcMgr.addNodeForProcess(runtimeName, nodeProperty.m_name);
         }
         break;
     }
     case runtime::IpcMessageType::KEEPALIVE:
     {
-        m_prcMgr->updateLivelinessOfProcess(runtimeName);
+        m_prcMgr.updateLivelinessOfProcess(runtimeName);
         break;
     }
     case runtime::IpcMessageType::PREPARE_APP_TERMINATION:
@@ -425,7 +581,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         else
         {
             // this is used to unblock a potentially block application by blocking publisher
-            m_prcMgr->handleProcessShutdownPreparationRequest(runtimeName);
+            m_prcMgr.handleProcessShutdownPreparationRequest(runtimeName);
         }
         break;
     }
@@ -438,7 +594,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         else
         {
-            IOX_DISCARD_RESULT(m_prcMgr->unregisterProcess(runtimeName));
+            IOX_DISCARD_RESULT(m_prcMgr.unregisterProcess(runtimeName));
         }
         break;
     }
@@ -446,7 +602,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
     {
         IOX_LOG(ERROR) << "Unknown IPC message command [" << runtime::IpcMessageTypeToString(cmd) << "]";
 
-        m_prcMgr->sendMessageNotSupportedToRuntime(runtimeName);
+        m_prcMgr.sendMessageNotSupportedToRuntime(runtimeName);
         break;
     }
     }
@@ -461,12 +617,13 @@ void RouDi::registerProcess(const RuntimeName_t& name,
 {
     bool monitorProcess = (m_monitoringMode == roudi::MonitoringMode::ON);
     IOX_DISCARD_RESULT(
-        m_prcMgr->registerProcess(name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo));
+        m_prcMgr.registerProcess(name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo));
 }
 
 uint64_t RouDi::getUniqueSessionIdForProcess() noexcept
 {
-    static uint64_t sessionId = 0;
+    // the registrations of different runtimes are processed concurrently by the runtime message workers
+    static std::atomic<uint64_t> sessionId{0U};
     return ++sessionId;
 }
 
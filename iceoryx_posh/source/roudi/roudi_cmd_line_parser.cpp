@@ -37,10 +37,11 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                                        {"unique-roudi-id", required_argument, nullptr, 'u'},
                                        {"compatibility", required_argument, nullptr, 'x'},
                                        {"kill-delay", required_argument, nullptr, 'k'},
+                                       {"runtime-message-workers", required_argument, nullptr, 'w'},
                                        {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* SHORT_OPTIONS = "hvm:l:u:x:k:";
+    constexpr const char* SHORT_OPTIONS = "hvm:l:u:x:k:w:";
     int index;
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, SHORT_OPTIONS, LONG_OPTIONS, &index), opt != -1))
@@ -73,6 +74,13 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                       << std::endl;
             std::cout << "                                  have't responded after trying SIG_TERM first, in seconds."
                       << std::endl;
+            std::cout << "-w, --runtime-message-workers <UINT>" << std::endl;
+            std::cout << "                                  Set the number of threads which process the messages of"
+                      << std::endl;
+            std::cout << "                                  the runtimes, in the range of [1, "
+                      << roudi::MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS << "]." << std::endl;
+            std::cout << "                                  default = " << roudi::DEFAULT_NUMBER_OF_RUNTIME_MESSAGE_WORKERS
+                      << std::endl;
 
             m_run = false;
             break;
@@ -166,6 +174,22 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             }
             break;
         }
+        case 'w':
+        {
+            uint32_t numberOfRuntimeMessageWorkers{0U};
+            if (!cxx::convert::fromString(optarg, numberOfRuntimeMessageWorkers) || numberOfRuntimeMessageWorkers == 0U
+                || numberOfRuntimeMessageWorkers > roudi::MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS)
+            {
+                IOX_LOG(ERROR) << "The number of runtime message workers must be in the range of [1, "
+                               << roudi::MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS << "]";
+                m_run = false;
+            }
+            else
+            {
+                m_numberOfRuntimeMessageWorkers = numberOfRuntimeMessageWorkers;
+            }
+            break;
+        }
         case 'x':
         {
             if (strcmp(optarg, "off") == 0)
@@ -217,6 +241,7 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                             m_logLevel,
                             m_compatibilityCheckLevel,
                             m_processKillDelay,
+                            m_numberOfRuntimeMessageWorkers,
                             m_uniqueRouDiId,
                             m_run,
                             iox::roudi::ConfigFilePathString_t("")});
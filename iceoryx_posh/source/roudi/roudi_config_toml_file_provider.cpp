@@ -23,6 +23,7 @@
 #include "iceoryx_platform/getopt.hpp"
 #include "iox/into.hpp"
 #include "iox/logging.hpp"
+#include "iox/optional.hpp"
 #include "iox/string.hpp"
 #include "iox/vector.hpp"
 
@@ -35,6 +36,36 @@ namespace iox
 {
 namespace config
 {
+namespace
+{
+iox::mepoo::MemoryPagingConfig parseMemoryPagingConfig(const cpptoml::table& table) noexcept
+{
+    iox::mepoo::MemoryPagingConfig memoryPagingConfig;
+    memoryPagingConfig.m_useHugePages = table.get_as<bool>("huge_pages").value_or(false);
+    memoryPagingConfig.m_prefault = table.get_as<bool>("prefault").value_or(false);
+    memoryPagingConfig.m_lockInMemory = table.get_as<bool>("lock_in_memory").value_or(false);
+    auto numaNode = table.get_as<uint32_t>("numa_node");
+    if (numaNode)
+    {
+        memoryPagingConfig.m_numaNode.emplace(*numaNode);
+    }
+    return memoryPagingConfig;
+}
+
+iox::optional<iox::mepoo::MemPoolExhaustedPolicy> parseMemPoolExhaustedPolicy(const std::string& policy) noexcept
+{
+    if (policy == "return_error")
+    {
+        return iox::mepoo::MemPoolExhaustedPolicy::RETURN_ERROR;
+    }
+    if (policy == "fall_through_to_larger_mempool")
+    {
+        return iox::mepoo::MemPoolExhaustedPolicy::FALL_THROUGH_TO_LARGER_MEMPOOL;
+    }
+    return iox::nullopt;
+}
+} // namespace
+
 TomlRouDiConfigFileProvider::TomlRouDiConfigFileProvider(config::CmdLineArgs_t& cmdLineArgs) noexcept
 {
     /// don't print additional output if not running
@@ -125,11 +156,29 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
 
     auto groupOfCurrentProcess = iox::posix::PosixGroup::getGroupOfCurrentProcess().getName();
     iox::RouDiConfig_t parsedConfig;
+
+    auto management = parsedFile->get_table("management");
+    if (management)
+    {
+        parsedConfig.m_managementMemoryPagingConfig = parseMemoryPagingConfig(*management);
+    }
+
     for (auto segment : *segments)
     {
         auto writer = segment->get_as<std::string>("writer").value_or(into<std::string>(groupOfCurrentProcess));
         auto reader = segment->get_as<std::string>("reader").value_or(into<std::string>(groupOfCurrentProcess));
         iox::mepoo::MePooConfig mempoolConfig;
+        auto memPoolExhaustedPolicy = segment->get_as<std::string>("mempool_exhausted_policy");
+        if (memPoolExhaustedPolicy)
+        {
+            auto policy = parseMemPoolExhaustedPolicy(*memPoolExhaustedPolicy);
+            if (!policy.has_value())
+            {
+                return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_MEMPOOL_EXHAUSTED_POLICY);
+            }
+            mempoolConfig.m_memPoolExhaustedPolicy = policy.value();
+        }
+
         auto mempools = segment->get_table_array("mempool");
         if (!mempools)
         {
@@ -158,7 +207,9 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
         parsedConfig.m_sharedMemorySegments.push_back(
             {iox::posix::PosixGroup::groupName_t(iox::TruncateToCapacity, reader.c_str(), reader.size()),
              iox::posix::PosixGroup::groupName_t(iox::TruncateToCapacity, writer.c_str(), writer.size()),
-             mempoolConfig});
+             mempoolConfig,
+             iox::mepoo::MemoryInfo(),
+             parseMemoryPagingConfig(*segment)});
     }
 
     return iox::ok(parsedConfig);
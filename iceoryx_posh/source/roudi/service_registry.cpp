@@ -21,11 +21,166 @@ namespace iox
 {
 namespace roudi
 {
+constexpr uint32_t ServiceRegistry::CAPACITY;
+constexpr uint32_t ServiceRegistry::NO_INDEX;
+constexpr uint32_t ServiceRegistry::NUMBER_OF_ID_FIELDS;
+constexpr uint32_t ServiceRegistry::HASH_INDEX_CAPACITY;
+constexpr uint32_t ServiceRegistry::NUMBER_OF_BUCKETS;
+
 ServiceRegistry::ServiceDescriptionEntry::ServiceDescriptionEntry(const capro::ServiceDescription& serviceDescription)
     : serviceDescription(serviceDescription)
 {
 }
 
+ServiceRegistry::ServiceRegistry() noexcept
+{
+    for (auto& index : m_hashIndex)
+    {
+        index = NO_INDEX;
+    }
+}
+
+uint64_t ServiceRegistry::hash(const capro::IdString_t& id) noexcept
+{
+    // FNV-1a
+    constexpr uint64_t FNV_OFFSET_BASIS{14695981039346656037U};
+    constexpr uint64_t FNV_PRIME{1099511628211U};
+
+    uint64_t hashValue{FNV_OFFSET_BASIS};
+    const char* data = id.c_str();
+    for (uint64_t i = 0U; i < id.size(); ++i)
+    {
+        hashValue ^= static_cast<uint8_t>(data[i]);
+        hashValue *= FNV_PRIME;
+    }
+    return hashValue;
+}
+
+uint64_t ServiceRegistry::hash(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    uint64_t hashValue{0U};
+    for (uint32_t field = 0U; field < NUMBER_OF_ID_FIELDS; ++field)
+    {
+        // mix the hashes of the fields in order to distinguish e.g. (a, b, c) from (b, a, c)
+        const auto fieldHash = hash(idString(serviceDescription, static_cast<IdField>(field)));
+        hashValue ^= fieldHash + 0x9e3779b97f4a7c15U + (hashValue << 6U) + (hashValue >> 2U);
+    }
+    return hashValue;
+}
+
+const capro::IdString_t& ServiceRegistry::idString(const capro::ServiceDescription& serviceDescription,
+                                                   const IdField field) noexcept
+{
+    switch (field)
+    {
+    case IdField::SERVICE:
+        return serviceDescription.getServiceIDString();
+    case IdField::INSTANCE:
+        return serviceDescription.getInstanceIDString();
+    case IdField::EVENT:
+        break;
+    }
+    return serviceDescription.getEventIDString();
+}
+
+uint32_t ServiceRegistry::bucketIndex(const capro::ServiceDescription& serviceDescription, const IdField field) noexcept
+{
+    return static_cast<uint32_t>(hash(idString(serviceDescription, field)) & (NUMBER_OF_BUCKETS - 1U));
+}
+
+void ServiceRegistry::insertIntoIndices(const uint32_t index, const uint64_t hashValue) noexcept
+{
+    auto& entryIndex = m_entryIndices[index];
+    entryIndex.hash = static_cast<uint32_t>(hashValue);
+
+    // the load factor is at most 0.5, therefore there is always a free position
+    auto position = entryIndex.hash & (HASH_INDEX_CAPACITY - 1U);
+    while (m_hashIndex[position] != NO_INDEX)
+    {
+        position = (position + 1U) & (HASH_INDEX_CAPACITY - 1U);
+    }
+    m_hashIndex[position] = static_cast<Index_t>(index);
+
+    const auto& serviceDescription = m_serviceDescriptions[index]->serviceDescription;
+    for (uint32_t field = 0U; field < NUMBER_OF_ID_FIELDS; ++field)
+    {
+        auto& bucket = m_buckets[field][bucketIndex(serviceDescription, static_cast<IdField>(field))];
+
+        // append to keep the insertion order within a bucket
+        entryIndex.next[field] = NO_INDEX;
+        entryIndex.previous[field] = bucket.tail;
+        if (bucket.tail != NO_INDEX)
+        {
+            m_entryIndices[bucket.tail].next[field] = static_cast<Index_t>(index);
+        }
+        else
+        {
+            bucket.head = static_cast<Index_t>(index);
+        }
+        bucket.tail = static_cast<Index_t>(index);
+        ++bucket.size;
+    }
+}
+
+void ServiceRegistry::removeFromIndices(const uint32_t index) noexcept
+{
+    auto& entryIndex = m_entryIndices[index];
+
+    auto position = entryIndex.hash & (HASH_INDEX_CAPACITY - 1U);
+    while (m_hashIndex[position] != index)
+    {
+        position = (position + 1U) & (HASH_INDEX_CAPACITY - 1U);
+    }
+
+    // backward shift deletion; the following entries of the probe sequence are moved to keep them reachable without
+    // the need for tombstones
+    auto next = position;
+    while (true)
+    {
+        next = (next + 1U) & (HASH_INDEX_CAPACITY - 1U);
+        const auto nextIndex = m_hashIndex[next];
+        if (nextIndex == NO_INDEX)
+        {
+            break;
+        }
+        const auto home = m_entryIndices[nextIndex].hash & (HASH_INDEX_CAPACITY - 1U);
+        const bool isHomeBetweenPositionAndNext =
+            (position <= next) ? (position < home && home <= next) : (position < home || home <= next);
+        if (!isHomeBetweenPositionAndNext)
+        {
+            m_hashIndex[position] = nextIndex;
+            position = next;
+        }
+    }
+    m_hashIndex[position] = NO_INDEX;
+
+    const auto& serviceDescription = m_serviceDescriptions[index]->serviceDescription;
+    for (uint32_t field = 0U; field < NUMBER_OF_ID_FIELDS; ++field)
+    {
+        auto& bucket = m_buckets[field][bucketIndex(serviceDescription, static_cast<IdField>(field))];
+        const auto previousIndex = entryIndex.previous[field];
+        const auto nextIndex = entryIndex.next[field];
+
+        if (previousIndex != NO_INDEX)
+        {
+            m_entryIndices[previousIndex].next[field] = nextIndex;
+        }
+        else
+        {
+            bucket.head = nextIndex;
+        }
+        if (nextIndex != NO_INDEX)
+        {
+            m_entryIndices[nextIndex].previous[field] = previousIndex;
+        }
+        else
+        {
+            bucket.tail = previousIndex;
+        }
+        --bucket.size;
+    }
+}
+
 expected<void, ServiceRegistry::Error> ServiceRegistry::add(const capro::ServiceDescription& serviceDescription,
                                                             ReferenceCounter_t ServiceDescriptionEntry::*count)
 {
@@ -40,40 +195,36 @@ expected<void, ServiceRegistry::Error> ServiceRegistry::add(const capro::Service
         return ok();
     }
 
-    // entry does not exist, find a free slot if it exists
-
-    // fast path to a free slot (which was occupied by previously removed entry),
-    // prefer to fill entries close to the front
-    if (m_freeIndex != NO_INDEX)
+    // entry does not exist, reuse the slot of a previously removed entry or append a new one (the size only grows up
+    // to capacity)
+    if (m_numberOfFreeIndices > 0U)
     {
-        auto& entry = m_serviceDescriptions[m_freeIndex];
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
-        m_freeIndex = NO_INDEX;
-        return ok();
+        --m_numberOfFreeIndices;
+        index = m_freeIndices[m_numberOfFreeIndices];
     }
-
-    // search from start
-    for (auto& entry : m_serviceDescriptions)
+    else if (m_serviceDescriptions.emplace_back())
     {
-        if (!entry)
-        {
-            entry.emplace(serviceDescription);
-            (*entry).*count = 1U;
-            return ok();
-        }
+        index = static_cast<uint32_t>(m_serviceDescriptions.size() - 1U);
     }
-
-    // append new entry at the end (the size only grows up to capacity)
-    if (m_serviceDescriptions.emplace_back())
+    else
     {
-        auto& entry = m_serviceDescriptions.back();
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
-        return ok();
+        return err(Error::SERVICE_REGISTRY_FULL);
     }
 
-    return err(Error::SERVICE_REGISTRY_FULL);
+    auto& entry = m_serviceDescriptions[index];
+    entry.emplace(serviceDescription);
+    (*entry).*count = 1U;
+    insertIntoIndices(index, hash(serviceDescription));
+    return ok();
+}
+
+void ServiceRegistry::remove(const uint32_t index) noexcept
+{
+    removeFromIndices(index);
+    m_serviceDescriptions[index].reset();
+    // reuse the slot in the next insertion
+    m_freeIndices[m_numberOfFreeIndices] = static_cast<Index_t>(index);
+    ++m_numberOfFreeIndices;
 }
 
 expected<void, ServiceRegistry::Error>
@@ -99,9 +250,7 @@ void ServiceRegistry::removePublisher(const capro::ServiceDescription& serviceDe
         {
             if (--entry->publisherCount == 0U && entry->serverCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
+                remove(index);
             }
         }
     }
@@ -118,9 +267,7 @@ void ServiceRegistry::removeServer(const capro::ServiceDescription& serviceDescr
         {
             if (--entry->serverCount == 0U && entry->publisherCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
+                remove(index);
             }
         }
     }
@@ -131,11 +278,47 @@ void ServiceRegistry::purge(const capro::ServiceDescription& serviceDescription)
     auto index = findIndex(serviceDescription);
     if (index != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[index];
-        entry.reset();
-        // reuse the slot in the next insertion
-        m_freeIndex = index;
+        remove(index);
+    }
+}
+
+expected<void, ServiceRegistry::Error> ServiceRegistry::apply(const ServiceRegistryChange& change) noexcept
+{
+    switch (change.operation)
+    {
+    case ServiceRegistryChange::Operation::ADD_PUBLISHER:
+    {
+        auto result = addPublisher(change.serviceDescription);
+        if (result.has_error())
+        {
+            return result;
+        }
+        break;
+    }
+    case ServiceRegistryChange::Operation::REMOVE_PUBLISHER:
+        removePublisher(change.serviceDescription);
+        break;
+    case ServiceRegistryChange::Operation::ADD_SERVER:
+    {
+        auto result = addServer(change.serviceDescription);
+        if (result.has_error())
+        {
+            return result;
+        }
+        break;
     }
+    case ServiceRegistryChange::Operation::REMOVE_SERVER:
+        removeServer(change.serviceDescription);
+        break;
+    }
+
+    m_sequenceNumber = change.sequenceNumber;
+    return ok();
+}
+
+uint64_t ServiceRegistry::sequenceNumber() const noexcept
+{
+    return m_sequenceNumber;
 }
 
 void ServiceRegistry::find(const optional<capro::IdString_t>& service,
@@ -143,30 +326,68 @@ void ServiceRegistry::find(const optional<capro::IdString_t>& service,
                            const optional<capro::IdString_t>& event,
                            function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
 {
-    for (auto& entry : m_serviceDescriptions)
+    if (service && instance && event)
     {
-        if (entry)
+        auto index = findIndex(capro::ServiceDescription(*service, *instance, *event));
+        if (index != NO_INDEX)
         {
-            bool match = (service) ? (entry->serviceDescription.getServiceIDString() == *service) : true;
-            match &= (instance) ? (entry->serviceDescription.getInstanceIDString() == *instance) : true;
-            match &= (event) ? (entry->serviceDescription.getEventIDString() == *event) : true;
+            callable(*m_serviceDescriptions[index]);
+        }
+        return;
+    }
 
-            if (match)
+    auto matches = [&](const ServiceDescriptionEntry& entry) {
+        bool match = (service) ? (entry.serviceDescription.getServiceIDString() == *service) : true;
+        match &= (instance) ? (entry.serviceDescription.getInstanceIDString() == *instance) : true;
+        match &= (event) ? (entry.serviceDescription.getEventIDString() == *event) : true;
+        return match;
+    };
+
+    // use the smallest bucket of the secondary indices of the provided strings
+    const optional<capro::IdString_t>* ids[NUMBER_OF_ID_FIELDS]{&service, &instance, &event};
+    const Bucket* smallestBucket{nullptr};
+    uint32_t smallestBucketField{0U};
+    for (uint32_t field = 0U; field < NUMBER_OF_ID_FIELDS; ++field)
+    {
+        if (*ids[field])
+        {
+            const auto& bucket = m_buckets[field][hash(**ids[field]) & (NUMBER_OF_BUCKETS - 1U)];
+            if (smallestBucket == nullptr || bucket.size < smallestBucket->size)
             {
-                callable(*entry);
+                smallestBucket = &bucket;
+                smallestBucketField = field;
             }
         }
     }
+
+    if (smallestBucket == nullptr)
+    {
+        forEach(callable);
+        return;
+    }
+
+    for (auto index = smallestBucket->head; index != NO_INDEX; index = m_entryIndices[index].next[smallestBucketField])
+    {
+        const auto& entry = *m_serviceDescriptions[index];
+        if (matches(entry))
+        {
+            callable(entry);
+        }
+    }
 }
 
 uint32_t ServiceRegistry::findIndex(const capro::ServiceDescription& serviceDescription) const noexcept
 {
-    for (uint32_t i = 0; i < m_serviceDescriptions.size(); ++i)
+    const auto hashValue = static_cast<uint32_t>(hash(serviceDescription));
+    for (auto position = hashValue & (HASH_INDEX_CAPACITY - 1U);
+         m_hashIndex[position] != NO_INDEX;
+         position = (position + 1U) & (HASH_INDEX_CAPACITY - 1U))
     {
-        auto& entry = m_serviceDescriptions[i];
-        if (entry && entry->serviceDescription == serviceDescription)
+        const auto index = m_hashIndex[position];
+        if (m_entryIndices[index].hash == hashValue
+            && m_serviceDescriptions[index]->serviceDescription == serviceDescription)
         {
-            return i;
+            return index;
         }
     }
     return NO_INDEX;
@@ -41,6 +41,7 @@ Node::~Node() noexcept
     if (m_data)
     {
         m_data->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+        m_data->m_discoveryNotifier.notify();
     }
 }
 
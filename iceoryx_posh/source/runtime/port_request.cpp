@@ -0,0 +1,62 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/runtime/port_request.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+PortRequest PortRequest::publisher(const capro::ServiceDescription& service,
+                                   const popo::PublisherOptions& publisherOptions,
+                                   const PortConfigInfo& portConfigInfo) noexcept
+{
+    PortRequest request;
+    request.type = PortRequestType::PUBLISHER;
+    request.service = service;
+    request.publisherOptions = publisherOptions;
+    request.portConfigInfo = portConfigInfo;
+    return request;
+}
+
+PortRequest PortRequest::subscriber(const capro::ServiceDescription& service,
+                                    const popo::SubscriberOptions& subscriberOptions,
+                                    const PortConfigInfo& portConfigInfo) noexcept
+{
+    PortRequest request;
+    request.type = PortRequestType::SUBSCRIBER;
+    request.service = service;
+    request.subscriberOptions = subscriberOptions;
+    request.portConfigInfo = portConfigInfo;
+    return request;
+}
+
+void PortRequest::releasePort() noexcept
+{
+    if (publisherPortData != nullptr)
+    {
+        PublisherPortUserType(publisherPortData).destroy();
+        publisherPortData = nullptr;
+    }
+    if (subscriberPortData != nullptr)
+    {
+        SubscriberPortUserType(subscriberPortData).destroy();
+        subscriberPortData = nullptr;
+    }
+}
+
+} // namespace runtime
+} // namespace iox
@@ -153,5 +153,41 @@ void PoshRuntime::shutdown() noexcept
     m_shutdownRequested.store(true, std::memory_order_relaxed);
 }
 
+uint64_t PoshRuntime::createPorts(const span<PortRequest> requests) noexcept
+{
+    for (uint64_t i = 0U; i < requests.size(); ++i)
+    {
+        auto& request = requests[i];
+        bool isCreated{false};
+        if (request.type == PortRequestType::SUBSCRIBER)
+        {
+            request.subscriberPortData =
+                getMiddlewareSubscriber(request.service, request.subscriberOptions, request.portConfigInfo);
+            isCreated = (request.subscriberPortData != nullptr);
+        }
+        else
+        {
+            request.publisherPortData =
+                getMiddlewarePublisher(request.service, request.publisherOptions, request.portConfigInfo);
+            isCreated = (request.publisherPortData != nullptr);
+        }
+
+        if (!isCreated)
+        {
+            releasePorts(span<PortRequest>(requests.data(), i));
+            return 0U;
+        }
+    }
+    return requests.size();
+}
+
+void PoshRuntime::releasePorts(const span<PortRequest> requests) noexcept
+{
+    for (uint64_t i = 0U; i < requests.size(); ++i)
+    {
+        requests[i].releasePort();
+    }
+}
+
 } // namespace runtime
 } // namespace iox
@@ -25,6 +25,7 @@
 #include "iceoryx_posh/runtime/port_config_info.hpp"
 #include "iox/logging.hpp"
 
+#include <algorithm>
 #include <cstdint>
 
 namespace iox
@@ -45,6 +46,7 @@ PoshRuntimeImpl::PoshRuntimeImpl(optional<const RuntimeName_t*> name, const Runt
                                                  m_ipcChannelInterface.getSegmentManagerAddressOffset()});
     }())
 {
+    m_controlChannelDoorbell << IpcMessageTypeToString(IpcMessageType::CONTROL_CHANNEL_DOORBELL) << m_appName;
 }
 
 PoshRuntimeImpl::~PoshRuntimeImpl() noexcept
@@ -79,11 +81,27 @@ PublisherPortUserType::MemberType_t*
 PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service,
                                         const popo::PublisherOptions& publisherOptions,
                                         const PortConfigInfo& portConfigInfo) noexcept
+{
+    ControlResponse response;
+    requestPortsFromRoudi(
+        1U,
+        [&](const uint64_t, ControlRequest& request) {
+            makePublisherRequest(service, publisherOptions, portConfigInfo, request);
+        },
+        &response);
+    return publisherFromResponse(service, response);
+}
+
+void PoshRuntimeImpl::makePublisherRequest(const capro::ServiceDescription& service,
+                                           const popo::PublisherOptions& publisherOptions,
+                                           const PortConfigInfo& portConfigInfo,
+                                           ControlRequest& request) const noexcept
 {
     constexpr uint64_t MAX_HISTORY_CAPACITY =
         PublisherPortUserType::MemberType_t::ChunkSenderData_t::ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY;
 
-    auto options = publisherOptions;
+    request.m_publisherOptions = publisherOptions;
+    auto& options = request.m_publisherOptions;
     if (options.historyCapacity > MAX_HISTORY_CAPACITY)
     {
         IOX_LOG(WARN) << "Requested history capacity " << options.historyCapacity
@@ -92,20 +110,30 @@ PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service
         options.historyCapacity = MAX_HISTORY_CAPACITY;
     }
 
+    if (options.chunkRingCapacity > MAX_HISTORY_CAPACITY)
+    {
+        IOX_LOG(WARN) << "Requested chunk ring capacity " << options.chunkRingCapacity
+                      << " exceeds the maximum possible one for this publisher"
+                      << ", limiting from " << publisherOptions.chunkRingCapacity << " to " << MAX_HISTORY_CAPACITY;
+        options.chunkRingCapacity = MAX_HISTORY_CAPACITY;
+    }
+
     if (options.nodeName.empty())
     {
         options.nodeName = m_appName;
     }
 
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PUBLISHER) << m_appName
-               << static_cast<cxx::Serialization>(service).toString() << publisherOptions.serialize().toString()
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+    request.m_type = ControlRequestType::CREATE_PUBLISHER;
+    request.m_service = service;
+    request.m_portConfigInfo = portConfigInfo;
+}
 
-    auto maybePublisher = requestPublisherFromRoudi(sendBuffer);
-    if (maybePublisher.has_error())
+PublisherPortUserType::MemberType_t* PoshRuntimeImpl::publisherFromResponse(const capro::ServiceDescription& service,
+                                                                            const ControlResponse& response) noexcept
+{
+    if (!response.m_isSuccessful)
     {
-        switch (maybePublisher.error())
+        switch (response.m_error)
         {
         case IpcMessageErrorType::NO_UNIQUE_CREATED:
             IOX_LOG(WARN) << "Service '" << service << "' already in use by another process.";
@@ -145,56 +173,34 @@ PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service
         }
         return nullptr;
     }
-    return maybePublisher.value();
-}
-
-expected<PublisherPortUserType::MemberType_t*, IpcMessageErrorType>
-PoshRuntimeImpl::requestPublisherFromRoudi(const IpcMessage& sendBuffer) noexcept
-{
-    IpcMessage receiveBuffer;
-    if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
-    {
-        IOX_LOG(ERROR) << "Request publisher got invalid response!";
-        return err(IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE);
-    }
-    else if (receiveBuffer.getNumberOfElements() == 3U)
-    {
-        std::string IpcMessage = receiveBuffer.getElementAtIndex(0U);
-
-        if (stringToIpcMessageType(IpcMessage.c_str()) == IpcMessageType::CREATE_PUBLISHER_ACK)
-
-        {
-            segment_id_underlying_t segmentId{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(2U).c_str(), segmentId);
-            UntypedRelativePointer::offset_t offset{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), offset);
-            auto ptr = UntypedRelativePointer::getPtr(segment_id_t{segmentId}, offset);
-            return ok(reinterpret_cast<PublisherPortUserType::MemberType_t*>(ptr));
-        }
-    }
-    else if (receiveBuffer.getNumberOfElements() == 2U)
-    {
-        std::string IpcMessage1 = receiveBuffer.getElementAtIndex(0U);
-        std::string IpcMessage2 = receiveBuffer.getElementAtIndex(1U);
-        if (stringToIpcMessageType(IpcMessage1.c_str()) == IpcMessageType::ERROR)
-        {
-            IOX_LOG(ERROR) << "Request publisher received no valid publisher port from RouDi.";
-            return err(stringToIpcMessageErrorType(IpcMessage2.c_str()));
-        }
-    }
-
-    IOX_LOG(ERROR) << "Request publisher got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'";
-    return err(IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE);
+    return reinterpret_cast<PublisherPortUserType::MemberType_t*>(
+        UntypedRelativePointer::getPtr(segment_id_t{response.m_segmentId}, response.m_offset));
 }
 
 SubscriberPortUserType::MemberType_t*
 PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& service,
                                          const popo::SubscriberOptions& subscriberOptions,
                                          const PortConfigInfo& portConfigInfo) noexcept
+{
+    ControlResponse response;
+    requestPortsFromRoudi(
+        1U,
+        [&](const uint64_t, ControlRequest& request) {
+            makeSubscriberRequest(service, subscriberOptions, portConfigInfo, request);
+        },
+        &response);
+    return subscriberFromResponse(service, response);
+}
+
+void PoshRuntimeImpl::makeSubscriberRequest(const capro::ServiceDescription& service,
+                                            const popo::SubscriberOptions& subscriberOptions,
+                                            const PortConfigInfo& portConfigInfo,
+                                            ControlRequest& request) const noexcept
 {
     constexpr uint64_t MAX_QUEUE_CAPACITY = SubscriberPortUserType::MemberType_t::ChunkQueueData_t::MAX_CAPACITY;
 
-    auto options = subscriberOptions;
+    request.m_subscriberOptions = subscriberOptions;
+    auto& options = request.m_subscriberOptions;
     if (options.queueCapacity > MAX_QUEUE_CAPACITY)
     {
         IOX_LOG(WARN) << "Requested queue capacity " << options.queueCapacity
@@ -209,11 +215,12 @@ PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& servic
         options.queueCapacity = 1U;
     }
 
-    if (subscriberOptions.historyRequest > subscriberOptions.queueCapacity)
+    // the history is clamped to the queue capacity which the subscriber actually gets
+    if (options.historyRequest > options.queueCapacity)
     {
         IOX_LOG(WARN) << "Requested historyRequest for " << service
                       << " is larger than queueCapacity. Clamping historyRequest to queueCapacity!";
-        options.historyRequest = subscriberOptions.queueCapacity;
+        options.historyRequest = options.queueCapacity;
     }
 
     if (options.nodeName.empty())
@@ -221,16 +228,18 @@ PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& servic
         options.nodeName = m_appName;
     }
 
-    IpcMessage sendBuffer;
-    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SUBSCRIBER) << m_appName
-               << static_cast<cxx::Serialization>(service).toString() << options.serialize().toString()
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
-
-    auto maybeSubscriber = requestSubscriberFromRoudi(sendBuffer);
+    request.m_type = ControlRequestType::CREATE_SUBSCRIBER;
+    request.m_service = service;
+    request.m_portConfigInfo = portConfigInfo;
+}
 
-    if (maybeSubscriber.has_error())
+SubscriberPortUserType::MemberType_t*
+PoshRuntimeImpl::subscriberFromResponse(const capro::ServiceDescription& service,
+                                        const ControlResponse& response) noexcept
+{
+    if (!response.m_isSuccessful)
     {
-        switch (maybeSubscriber.error())
+        switch (response.m_error)
         {
         case IpcMessageErrorType::SUBSCRIBER_LIST_FULL:
             IOX_LOG(WARN) << "Service '" << service
@@ -255,46 +264,62 @@ PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& servic
         }
         return nullptr;
     }
-    return maybeSubscriber.value();
+    return reinterpret_cast<SubscriberPortUserType::MemberType_t*>(
+        UntypedRelativePointer::getPtr(segment_id_t{response.m_segmentId}, response.m_offset));
 }
 
-expected<SubscriberPortUserType::MemberType_t*, IpcMessageErrorType>
-PoshRuntimeImpl::requestSubscriberFromRoudi(const IpcMessage& sendBuffer) noexcept
+uint64_t PoshRuntimeImpl::createPorts(const span<PortRequest> requests) noexcept
 {
-    IpcMessage receiveBuffer;
-    if (sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
-    {
-        IOX_LOG(ERROR) << "Request subscriber got invalid response!";
-        return err(IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE);
-    }
-    else if (receiveBuffer.getNumberOfElements() == 3U)
-    {
-        std::string IpcMessage = receiveBuffer.getElementAtIndex(0U);
-
-        if (stringToIpcMessageType(IpcMessage.c_str()) == IpcMessageType::CREATE_SUBSCRIBER_ACK)
+    // the requests are written in place into the control channel, only the small responses are copied out of it
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    ControlResponse controlResponses[ControlChannelData::CAPACITY];
+
+    for (uint64_t batchBegin = 0U; batchBegin < requests.size(); batchBegin += ControlChannelData::CAPACITY)
+    {
+        const uint64_t batchSize = std::min(requests.size() - batchBegin, ControlChannelData::CAPACITY);
+        requestPortsFromRoudi(
+            batchSize,
+            [&](const uint64_t index, ControlRequest& controlRequest) {
+                const auto& request = requests[batchBegin + index];
+                if (request.type == PortRequestType::SUBSCRIBER)
+                {
+                    makeSubscriberRequest(
+                        request.service, request.subscriberOptions, request.portConfigInfo, controlRequest);
+                }
+                else
+                {
+                    makePublisherRequest(
+                        request.service, request.publisherOptions, request.portConfigInfo, controlRequest);
+                }
+            },
+            controlResponses);
+
+        bool isBatchCreated{true};
+        for (uint64_t i = 0U; i < batchSize; ++i)
         {
-            segment_id_underlying_t segmentId{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(2U).c_str(), segmentId);
-            UntypedRelativePointer::offset_t offset{0U};
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), offset);
-            auto ptr = UntypedRelativePointer::getPtr(segment_id_t{segmentId}, offset);
-            return ok(reinterpret_cast<SubscriberPortUserType::MemberType_t*>(ptr));
+            auto& request = requests[batchBegin + i];
+            if (request.type == PortRequestType::SUBSCRIBER)
+            {
+                request.subscriberPortData = subscriberFromResponse(request.service, controlResponses[i]);
+                isBatchCreated = isBatchCreated && (request.subscriberPortData != nullptr);
+            }
+            else
+            {
+                request.publisherPortData = publisherFromResponse(request.service, controlResponses[i]);
+                isBatchCreated = isBatchCreated && (request.publisherPortData != nullptr);
+            }
         }
-    }
-    else if (receiveBuffer.getNumberOfElements() == 2U)
-    {
-        std::string IpcMessage1 = receiveBuffer.getElementAtIndex(0U);
-        std::string IpcMessage2 = receiveBuffer.getElementAtIndex(1U);
 
-        if (stringToIpcMessageType(IpcMessage1.c_str()) == IpcMessageType::ERROR)
+        if (!isBatchCreated)
         {
-            IOX_LOG(ERROR) << "Request subscriber received no valid subscriber port from RouDi.";
-            return err(stringToIpcMessageErrorType(IpcMessage2.c_str()));
+            // all responses of the failed batch were evaluated, hence every port which RouDi created is released;
+            // the remaining batches are not sent to RouDi
+            releasePorts(span<PortRequest>(requests.data(), batchBegin + batchSize));
+            return 0U;
         }
     }
 
-    IOX_LOG(ERROR) << "Request subscriber got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'";
-    return err(IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE);
+    return requests.size();
 }
 
 popo::ClientPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareClient(const capro::ServiceDescription& service,
@@ -652,6 +677,168 @@ bool PoshRuntimeImpl::sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answ
     return m_ipcChannelInterface.sendRequestToRouDi(msg, answer);
 }
 
+void PoshRuntimeImpl::requestPortsFromRoudi(const uint64_t numberOfRequests,
+                                            const function_ref<void(const uint64_t, ControlRequest&)> writeRequest,
+                                            ControlResponse* const responses) noexcept
+{
+    // runtime must be thread safe
+    std::lock_guard<posix::mutex> g(m_appIpcRequestMutex);
+
+    auto controlChannel = getControlChannel();
+    if (controlChannel == nullptr)
+    {
+        for (uint64_t i = 0U; i < numberOfRequests; ++i)
+        {
+            ControlRequest request;
+            writeRequest(i, request);
+            responses[i] = requestPortViaIpcMessage(request);
+        }
+        return;
+    }
+
+    for (uint64_t batchBegin = 0U; batchBegin < numberOfRequests; batchBegin += ControlChannelData::CAPACITY)
+    {
+        const uint64_t batchSize = std::min(numberOfRequests - batchBegin, ControlChannelData::CAPACITY);
+        for (uint64_t i = 0U; i < batchSize; ++i)
+        {
+            writeRequest(batchBegin + i, controlChannel->m_requests[i]);
+            controlChannel->m_responses[i] = ControlResponse();
+        }
+        controlChannel->m_numberOfRequests = batchSize;
+
+        IpcMessage receiveBuffer;
+        const bool hasResponse = m_ipcChannelInterface.sendRequestToRouDi(m_controlChannelDoorbell, receiveBuffer);
+        const bool isAcknowledged = hasResponse && (receiveBuffer.getNumberOfElements() == 2U)
+                                    && (stringToIpcMessageType(receiveBuffer.getElementAtIndex(0U).c_str())
+                                        == IpcMessageType::CONTROL_CHANNEL_DOORBELL_ACK);
+        if (!isAcknowledged)
+        {
+            IOX_LOG(ERROR) << "Ringing the doorbell of the control channel got wrong response from IPC channel :'"
+                           << receiveBuffer.getMessage() << "'";
+        }
+
+        for (uint64_t i = 0U; i < batchSize; ++i)
+        {
+            auto& response = responses[batchBegin + i];
+            if (isAcknowledged)
+            {
+                response = controlChannel->m_responses[i];
+            }
+            else
+            {
+                response.m_isSuccessful = false;
+                const auto requestType = controlChannel->m_requests[i].m_type;
+                response.m_error =
+                    hasResponse ? wrongIpcMessageResponseError(requestType) : invalidResponseError(requestType);
+            }
+        }
+    }
+}
+
+ControlChannelData* PoshRuntimeImpl::getControlChannel() noexcept
+{
+    if (m_isControlChannelRequested)
+    {
+        return m_controlChannel;
+    }
+    m_isControlChannelRequested = true;
+
+    IpcMessage sendBuffer;
+    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_CONTROL_CHANNEL) << m_appName;
+    IpcMessage receiveBuffer;
+
+    if (m_ipcChannelInterface.sendRequestToRouDi(sendBuffer, receiveBuffer)
+        && (receiveBuffer.getNumberOfElements() == 3U)
+        && (stringToIpcMessageType(receiveBuffer.getElementAtIndex(0U).c_str())
+            == IpcMessageType::CREATE_CONTROL_CHANNEL_ACK))
+    {
+        segment_id_underlying_t segmentId{0U};
+        cxx::convert::fromString(receiveBuffer.getElementAtIndex(2U).c_str(), segmentId);
+        UntypedRelativePointer::offset_t offset{0U};
+        cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), offset);
+        m_controlChannel =
+            reinterpret_cast<ControlChannelData*>(UntypedRelativePointer::getPtr(segment_id_t{segmentId}, offset));
+    }
+    else
+    {
+        IOX_LOG(WARN) << "Could not create the control channel, the ports are requested via the IPC channel :'"
+                      << receiveBuffer.getMessage() << "'";
+    }
+
+    return m_controlChannel;
+}
+
+ControlResponse PoshRuntimeImpl::requestPortViaIpcMessage(const ControlRequest& request) noexcept
+{
+    IpcMessage sendBuffer;
+    IpcMessageType expectedAck{IpcMessageType::NOTYPE};
+    switch (request.m_type)
+    {
+    case ControlRequestType::CREATE_PUBLISHER:
+        sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PUBLISHER) << m_appName
+                   << static_cast<cxx::Serialization>(request.m_service).toString()
+                   << request.m_publisherOptions.serialize().toString()
+                   << static_cast<cxx::Serialization>(request.m_portConfigInfo).toString();
+        expectedAck = IpcMessageType::CREATE_PUBLISHER_ACK;
+        break;
+    case ControlRequestType::CREATE_SUBSCRIBER:
+        sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SUBSCRIBER) << m_appName
+                   << static_cast<cxx::Serialization>(request.m_service).toString()
+                   << request.m_subscriberOptions.serialize().toString()
+                   << static_cast<cxx::Serialization>(request.m_portConfigInfo).toString();
+        expectedAck = IpcMessageType::CREATE_SUBSCRIBER_ACK;
+        break;
+    default:
+        break;
+    }
+
+    ControlResponse response;
+    IpcMessage receiveBuffer;
+    if (expectedAck == IpcMessageType::NOTYPE)
+    {
+        response.m_error = IpcMessageErrorType::CONTROL_CHANNEL_INVALID_REQUEST;
+        return response;
+    }
+    if (m_ipcChannelInterface.sendRequestToRouDi(sendBuffer, receiveBuffer) == false)
+    {
+        IOX_LOG(ERROR) << "Request port got invalid response!";
+        response.m_error = invalidResponseError(request.m_type);
+        return response;
+    }
+
+    const auto messageType = stringToIpcMessageType(receiveBuffer.getElementAtIndex(0U).c_str());
+    if (receiveBuffer.getNumberOfElements() == 3U && messageType == expectedAck)
+    {
+        cxx::convert::fromString(receiveBuffer.getElementAtIndex(2U).c_str(), response.m_segmentId);
+        cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), response.m_offset);
+        response.m_isSuccessful = true;
+        return response;
+    }
+    if (receiveBuffer.getNumberOfElements() == 2U && messageType == IpcMessageType::ERROR)
+    {
+        IOX_LOG(ERROR) << "Request port received no valid port from RouDi.";
+        response.m_error = stringToIpcMessageErrorType(receiveBuffer.getElementAtIndex(1U).c_str());
+        return response;
+    }
+
+    IOX_LOG(ERROR) << "Request port got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'";
+    response.m_error = wrongIpcMessageResponseError(request.m_type);
+    return response;
+}
+
+IpcMessageErrorType PoshRuntimeImpl::invalidResponseError(const ControlRequestType type) noexcept
+{
+    return (type == ControlRequestType::CREATE_SUBSCRIBER) ? IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE
+                                                           : IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE;
+}
+
+IpcMessageErrorType PoshRuntimeImpl::wrongIpcMessageResponseError(const ControlRequestType type) noexcept
+{
+    return (type == ControlRequestType::CREATE_SUBSCRIBER)
+               ? IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE
+               : IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE;
+}
+
 // this is the callback for the m_keepAliveTimer
 void PoshRuntimeImpl::sendKeepAliveAndHandleShutdownPreparation() noexcept
 {
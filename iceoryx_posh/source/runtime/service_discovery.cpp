@@ -21,26 +21,144 @@ namespace iox
 {
 namespace runtime
 {
+namespace
+{
+using ServiceDescriptionEntry = roudi::ServiceRegistry::ServiceDescriptionEntry;
+
+const ServiceDescriptionEntry* findEntry(const roudi::ServiceRegistry& serviceRegistry,
+                                         const capro::ServiceDescription& serviceDescription) noexcept
+{
+    const ServiceDescriptionEntry* foundEntry{nullptr};
+    serviceRegistry.find(serviceDescription.getServiceIDString(),
+                         serviceDescription.getInstanceIDString(),
+                         serviceDescription.getEventIDString(),
+                         [&](const ServiceDescriptionEntry& entry) {
+                             if (entry.serviceDescription == serviceDescription)
+                             {
+                                 foundEntry = &entry;
+                             }
+                         });
+    return foundEntry;
+}
+
+void reportChanges(const capro::ServiceDescription& serviceDescription,
+                   const ServiceDescriptionEntry* const previousEntry,
+                   const ServiceDescriptionEntry* const currentEntry,
+                   const function_ref<void(const ServiceDiscoveryChange&)>& callableForEachChange) noexcept
+{
+    auto report = [&](const popo::MessagingPattern pattern, const bool wasAvailable, const bool isAvailable) {
+        if (wasAvailable != isAvailable)
+        {
+            callableForEachChange({serviceDescription,
+                                   pattern,
+                                   isAvailable ? ServiceDiscoveryChange::Availability::AVAILABLE
+                                               : ServiceDiscoveryChange::Availability::UNAVAILABLE});
+        }
+    };
+
+    report(popo::MessagingPattern::PUB_SUB,
+           previousEntry != nullptr && previousEntry->publisherCount > 0U,
+           currentEntry != nullptr && currentEntry->publisherCount > 0U);
+    report(popo::MessagingPattern::REQ_RES,
+           previousEntry != nullptr && previousEntry->serverCount > 0U,
+           currentEntry != nullptr && currentEntry->serverCount > 0U);
+}
+} // namespace
+
 ServiceDiscovery::ServiceDiscovery() noexcept
 {
 }
 
-void ServiceDiscovery::update()
+void ServiceDiscovery::update(const function_ref<void(const ServiceDiscoveryChange&)>& callableForEachChange) noexcept
 {
     // allows us to use update and hence findService concurrently
     std::lock_guard<std::mutex> lock(m_serviceRegistryMutex);
+
+    bool hasChanges{true};
+    while (hasChanges)
+    {
+        hasChanges =
+            m_serviceRegistryChangesSubscriber.take()
+                .and_then([&](popo::Sample<const roudi::ServiceRegistryChange>& changeSample) {
+                    if (changeSample->sequenceNumber > m_serviceRegistry->sequenceNumber() + 1U)
+                    {
+                        // changes were missed, either since the queue overflowed or since we joined late
+                        catchUpWithSnapshot(callableForEachChange);
+                    }
+
+                    // older changes are already contained in the snapshot; if there is still a gap the change is
+                    // dropped and we catch up with the next snapshot
+                    if (changeSample->sequenceNumber == m_serviceRegistry->sequenceNumber() + 1U)
+                    {
+                        applyChange(*changeSample, callableForEachChange);
+                    }
+                })
+                .has_value();
+    }
+
+    // RouDi publishes only the snapshot when it cannot publish a change
+    catchUpWithSnapshot(callableForEachChange);
+}
+
+void ServiceDiscovery::applyChange(
+    const roudi::ServiceRegistryChange& change,
+    const function_ref<void(const ServiceDiscoveryChange&)>& callableForEachChange) noexcept
+{
+    const auto* entry = findEntry(*m_serviceRegistry, change.serviceDescription);
+    const ServiceDescriptionEntry previousEntry{entry != nullptr ? *entry
+                                                                 : ServiceDescriptionEntry(change.serviceDescription)};
+
+    m_serviceRegistry->apply(change).or_else([&](auto&) {
+        IOX_LOG(WARN) << "ServiceDiscovery could not apply the change of service '" << change.serviceDescription
+                      << "' to the service registry!";
+    });
+
+    reportChanges(change.serviceDescription,
+                  &previousEntry,
+                  findEntry(*m_serviceRegistry, change.serviceDescription),
+                  callableForEachChange);
+}
+
+void ServiceDiscovery::catchUpWithSnapshot(
+    const function_ref<void(const ServiceDiscoveryChange&)>& callableForEachChange) noexcept
+{
     m_serviceRegistrySubscriber.take().and_then([&](popo::Sample<const roudi::ServiceRegistry>& serviceRegistrySample) {
+        // a snapshot which is not newer than the applied changes is dropped without copying it
+        if (serviceRegistrySample->sequenceNumber() <= m_serviceRegistry->sequenceNumber())
+        {
+            return;
+        }
+
+        serviceRegistrySample->forEach([&](const ServiceDescriptionEntry& entry) {
+            reportChanges(entry.serviceDescription,
+                          findEntry(*m_serviceRegistry, entry.serviceDescription),
+                          &entry,
+                          callableForEachChange);
+        });
+        m_serviceRegistry->forEach([&](const ServiceDescriptionEntry& entry) {
+            if (findEntry(*serviceRegistrySample, entry.serviceDescription) == nullptr)
+            {
+                reportChanges(entry.serviceDescription, &entry, nullptr, callableForEachChange);
+            }
+        });
+
         *m_serviceRegistry = *serviceRegistrySample;
     });
 }
 
+void ServiceDiscovery::processChanges(
+    const function_ref<void(const ServiceDiscoveryChange&)>& callableForEachChange) noexcept
+{
+    update(callableForEachChange);
+}
+
 void ServiceDiscovery::findService(const optional<capro::IdString_t>& service,
                                    const optional<capro::IdString_t>& instance,
                                    const optional<capro::IdString_t>& event,
                                    const function_ref<void(const capro::ServiceDescription&)>& callableForEach,
                                    const popo::MessagingPattern pattern) noexcept
 {
-    update();
+    update([](const ServiceDiscoveryChange&) {});
 
     switch (pattern)
     {
@@ -80,7 +198,16 @@ void ServiceDiscovery::enableEvent(popo::TriggerHandle&& triggerHandle, const Se
     {
     case ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED:
     {
-        m_serviceRegistrySubscriber.enableEvent(std::move(triggerHandle), popo::SubscriberEvent::DATA_RECEIVED);
+        // RouDi publishes only the snapshot when it cannot publish a change, therefore the snapshot subscriber has to
+        // notify the same trigger; its handle does not own the trigger and leaves the reset to the original one
+        if (triggerHandle.isValid())
+        {
+            m_serviceRegistrySubscriber.enableEvent(popo::TriggerHandle(*triggerHandle.getConditionVariableData(),
+                                                                        [](const uint64_t) {},
+                                                                        triggerHandle.getUniqueId()),
+                                                    popo::SubscriberEvent::DATA_RECEIVED);
+        }
+        m_serviceRegistryChangesSubscriber.enableEvent(std::move(triggerHandle), popo::SubscriberEvent::DATA_RECEIVED);
         break;
     }
     default:
@@ -98,6 +225,7 @@ void ServiceDiscovery::disableEvent(const ServiceDiscoveryEvent event) noexcept
     case ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED:
     {
         m_serviceRegistrySubscriber.disableEvent(popo::SubscriberEvent::DATA_RECEIVED);
+        m_serviceRegistryChangesSubscriber.disableEvent(popo::SubscriberEvent::DATA_RECEIVED);
         break;
     }
     default:
@@ -111,12 +239,13 @@ void ServiceDiscovery::disableEvent(const ServiceDiscoveryEvent event) noexcept
 void ServiceDiscovery::invalidateTrigger(const uint64_t uniqueTriggerId)
 {
     m_serviceRegistrySubscriber.invalidateTrigger(uniqueTriggerId);
+    m_serviceRegistryChangesSubscriber.invalidateTrigger(uniqueTriggerId);
 }
 
 popo::WaitSetIsConditionSatisfiedCallback
 ServiceDiscovery::getCallbackForIsStateConditionSatisfied(const popo::SubscriberState state)
 {
-    return m_serviceRegistrySubscriber.getCallbackForIsStateConditionSatisfied(state);
+    return m_serviceRegistryChangesSubscriber.getCallbackForIsStateConditionSatisfied(state);
 }
 
 } // namespace runtime
@@ -18,6 +18,7 @@
 #include "iceoryx_posh/internal/runtime/shared_memory_user.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_paging.hpp"
 #include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
 #include "iox/logging.hpp"
 
@@ -99,6 +100,19 @@ void SharedMemoryUser::openDataSegments(const uint64_t segmentId,
                                << sharedMemoryObject.get_size().expect("Failed to get SHM size.") << " to id "
                                << segment.m_segmentId;
 
+                // huge page advice, prefaulting and locking act on the mapping of a process, therefore the application
+                // has to repeat them; the NUMA binding of shared memory is a property of the memory object which
+                // RouDi has already set
+                mepoo::MemoryPagingConfig memoryPagingConfig{segment.m_memoryPagingConfig};
+                memoryPagingConfig.m_numaNode.reset();
+                if (memoryPagingConfig.m_useHugePages || memoryPagingConfig.m_prefault
+                    || memoryPagingConfig.m_lockInMemory)
+                {
+                    mepoo::applyMemoryPagingConfig(sharedMemoryObject.getBaseAddress(),
+                                                   sharedMemoryObject.get_size().expect("Failed to get SHM size."),
+                                                   memoryPagingConfig);
+                }
+
                 m_dataShmObjects.emplace_back(std::move(sharedMemoryObject));
             })
             .or_else([](auto&) { errorHandler(PoshError::POSH__SHM_APP_SEGMENT_MAPP_ERR); });
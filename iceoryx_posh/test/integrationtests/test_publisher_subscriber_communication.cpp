@@ -19,6 +19,8 @@
 #include "iceoryx_hoofs/cxx/list.hpp"
 #include "iceoryx_hoofs/testing/barrier.hpp"
 #include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/popo/latest_value_publisher.hpp"
+#include "iceoryx_posh/popo/latest_value_subscriber.hpp"
 #include "iceoryx_posh/popo/publisher.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
@@ -738,4 +740,95 @@ TEST_F(PublisherSubscriberCommunication_test, PublisherUniqueIdMatchesReceivedSa
     }
 }
 
+struct LatestValueState
+{
+    uint64_t counter{0U};
+    float position[3]{0.0F, 0.0F, 0.0F};
+};
+
+TEST_F(PublisherSubscriberCommunication_test, LatestValueSubscriberReadsTheNewestValue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0f4adfc5-b1fb-492b-8637-9663eeac24b5");
+    LatestValuePublisher<LatestValueState> publisher(m_serviceDescription);
+    this->InterOpWait();
+    LatestValueSubscriber<LatestValueState> subscriber(m_serviceDescription);
+    this->InterOpWait();
+
+    EXPECT_FALSE(subscriber.hasNewValue());
+    EXPECT_FALSE(subscriber.read().has_value());
+
+    for (uint64_t i = 1U; i <= 3U; ++i)
+    {
+        LatestValueState state;
+        state.counter = i;
+        state.position[2] = static_cast<float>(i);
+        ASSERT_FALSE(publisher.publish(state).has_error());
+    }
+
+    EXPECT_TRUE(subscriber.hasNewValue());
+    auto value = subscriber.read();
+    ASSERT_TRUE(value.has_value());
+    EXPECT_THAT(value->counter, Eq(3U));
+    EXPECT_THAT(value->position[2], Eq(3.0F));
+    EXPECT_FALSE(subscriber.hasNewValue());
+}
+
+TEST_F(PublisherSubscriberCommunication_test, LateJoiningLatestValueSubscriberReadsTheNewestValue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a82bc44d-9b78-4b8d-bf65-918ffc49454a");
+    LatestValuePublisher<LatestValueState> publisher(m_serviceDescription);
+    LatestValueState state;
+    state.counter = 73U;
+    ASSERT_FALSE(publisher.publish(state).has_error());
+    this->InterOpWait();
+
+    LatestValueSubscriber<LatestValueState> subscriber(m_serviceDescription);
+    this->InterOpWait();
+
+    auto value = subscriber.read();
+    ASSERT_TRUE(value.has_value());
+    EXPECT_THAT(value->counter, Eq(73U));
+}
+
+TEST_F(PublisherSubscriberCommunication_test, LatestValueSubscriberReadsTheValuesOfANewPublisher)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0fc8f532-3cf3-48ba-98d5-f91511d942ff");
+    LatestValueSubscriber<LatestValueState> subscriber(m_serviceDescription);
+    LatestValueState state;
+    {
+        LatestValuePublisher<LatestValueState> publisher(m_serviceDescription);
+        this->InterOpWait();
+        state.counter = 1U;
+        ASSERT_FALSE(publisher.publish(state).has_error());
+        auto value = subscriber.read();
+        ASSERT_TRUE(value.has_value());
+        EXPECT_THAT(value->counter, Eq(1U));
+    }
+    this->InterOpWait();
+
+    LatestValuePublisher<LatestValueState> newPublisher(m_serviceDescription);
+    this->InterOpWait();
+    state.counter = 2U;
+    ASSERT_FALSE(newPublisher.publish(state).has_error());
+
+    EXPECT_TRUE(subscriber.hasNewValue());
+    auto value = subscriber.read();
+    ASSERT_TRUE(value.has_value());
+    EXPECT_THAT(value->counter, Eq(2U));
+}
+
+TEST_F(PublisherSubscriberCommunication_test, LatestValueSubscriberDiscardsSamplesOfARegularPublisher)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a74b0d05-d9e5-4b34-b0e1-ee145268eeb3");
+    auto publisher = createPublisher<LatestValueState>(1U);
+    this->InterOpWait();
+    LatestValueSubscriber<LatestValueState> subscriber(m_serviceDescription);
+    this->InterOpWait();
+
+    ASSERT_FALSE(publisher->publishCopyOf(LatestValueState()).has_error());
+
+    EXPECT_FALSE(subscriber.hasNewValue());
+    EXPECT_FALSE(subscriber.read().has_value());
+}
+
 } // namespace
@@ -18,7 +18,9 @@
 #include "iceoryx_hoofs/testing/timing_test.hpp"
 #include "iceoryx_hoofs/testing/watch_dog.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry.hpp"
 #include "iceoryx_posh/popo/listener.hpp"
+#include "iceoryx_posh/popo/subscriber.hpp"
 #include "iceoryx_posh/popo/untyped_publisher.hpp"
 #include "iceoryx_posh/popo/untyped_server.hpp"
 #include "iceoryx_posh/popo/wait_set.hpp"
@@ -28,8 +30,10 @@
 #include "iceoryx_posh/testing/roudi_gtest.hpp"
 #include "test.hpp"
 
+#include <memory>
 #include <random>
 #include <set>
+#include <string>
 #include <type_traits>
 #include <vector>
 
@@ -191,7 +195,7 @@ TEST_F(ServiceDiscoveryBase_test, FindServiceWithWildcardsReturnsOnlyIntrospecti
     ::testing::Test::RecordProperty("TEST_ID", "d944f32c-edef-44f5-a6eb-c19ee73c98eb");
     findService(iox::capro::Wildcard, iox::capro::Wildcard, iox::capro::Wildcard, MessagingPattern::PUB_SUB);
 
-    constexpr uint32_t NUM_INTERNAL_SERVICES = 6U;
+    constexpr uint32_t NUM_INTERNAL_SERVICES = 7U;
     EXPECT_EQ(serviceContainer.size(), NUM_INTERNAL_SERVICES);
     for (auto& service : serviceContainer)
     {
@@ -251,6 +255,43 @@ TYPED_TEST(ServiceDiscovery_test, ServiceOfferedMultipleTimesCanBeFound)
     EXPECT_THAT(serviceContainer[0], Eq(SERVICE_DESCRIPTION));
 }
 
+TYPED_TEST(ServiceDiscovery_test, ProcessChangesReportsOfferAndStopOfferOfService)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "eed9fecc-8fe8-44de-9067-53b7ac5891e2");
+    const iox::capro::ServiceDescription SERVICE_DESCRIPTION("service", "instance", "event");
+    std::vector<ServiceDiscoveryChange> changes;
+    auto collectChanges = [&](const ServiceDiscoveryChange& change) { changes.push_back(change); };
+
+    // the internal services of RouDi are not of interest
+    this->sut.processChanges([](const ServiceDiscoveryChange&) {});
+
+    typename TestFixture::CommunicationKind::Producer producer(SERVICE_DESCRIPTION);
+    this->sut.processChanges(collectChanges);
+    while (changes.empty())
+    {
+        this->waitUntilServiceChange();
+        this->sut.processChanges(collectChanges);
+    }
+
+    ASSERT_THAT(changes.size(), Eq(1U));
+    EXPECT_THAT(changes[0].serviceDescription, Eq(SERVICE_DESCRIPTION));
+    EXPECT_THAT(changes[0].pattern, Eq(TestFixture::CommunicationKind::PATTERN));
+    EXPECT_THAT(changes[0].availability, Eq(ServiceDiscoveryChange::Availability::AVAILABLE));
+
+    changes.clear();
+    producer.stopOffer();
+    while (changes.empty())
+    {
+        this->waitUntilServiceChange();
+        this->sut.processChanges(collectChanges);
+    }
+
+    ASSERT_THAT(changes.size(), Eq(1U));
+    EXPECT_THAT(changes[0].serviceDescription, Eq(SERVICE_DESCRIPTION));
+    EXPECT_THAT(changes[0].pattern, Eq(TestFixture::CommunicationKind::PATTERN));
+    EXPECT_THAT(changes[0].availability, Eq(ServiceDiscoveryChange::Availability::UNAVAILABLE));
+}
+
 //
 // Notification Tests
 // Check whether attaching, notification and detaching of waitset and listener works
@@ -322,6 +363,81 @@ TEST_F(ServiceDiscoveryNotification_test, ServiceDiscoveryNotifiedbyWaitSetFinds
     EXPECT_THAT(serviceContainer.front(), Eq(serviceDescriptionToSearchFor));
 }
 
+TEST_F(ServiceDiscoveryNotification_test, ServiceDiscoveryIsNotifiedbyWaitSetWhenOnlyTheServiceRegistryIsPublished)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "83da78b6-d864-4976-84b2-465756c920d9");
+    iox::popo::WaitSet<1U> waitSet;
+
+    waitSet.attachEvent(this->sut, ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED).or_else([](auto) {
+        GTEST_FAIL() << "Could not attach to wait set";
+    });
+
+    // the changes are held by subscribers which never release them; when the chunks for the changes are exhausted,
+    // RouDi can only publish the full service registry
+    using ChangesSubscriber = iox::popo::Subscriber<iox::roudi::ServiceRegistryChange>;
+    iox::popo::SubscriberOptions changesSubscriberOptions;
+    changesSubscriberOptions.queueCapacity = iox::MAX_SUBSCRIBER_QUEUE_CAPACITY;
+    std::vector<std::unique_ptr<ChangesSubscriber>> changesSubscribers;
+    std::vector<iox::popo::Sample<const iox::roudi::ServiceRegistryChange>> heldChanges;
+    uint64_t numberOfChangesHeldByLastSubscriber{iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY};
+
+    // servers and publishers are created since RouDi has more chunks for the changes than ports of one kind
+    std::vector<std::unique_ptr<iox::popo::UntypedServer>> servers;
+    std::vector<std::unique_ptr<iox::popo::UntypedPublisher>> publishers;
+    bool areChangesExhausted{false};
+    for (uint64_t i = 0U; i < iox::MAX_SERVERS + iox::MAX_PUBLISHERS / 2U && !areChangesExhausted; ++i)
+    {
+        if (numberOfChangesHeldByLastSubscriber == iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY)
+        {
+            changesSubscribers.emplace_back(new ChangesSubscriber(
+                {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_CHANGES_EVENT_NAME},
+                changesSubscriberOptions));
+            this->InterOpWait();
+            numberOfChangesHeldByLastSubscriber = 0U;
+        }
+
+        // RouDi publishes the change while the port is created
+        const iox::capro::ServiceDescription service{
+            "Exhausting", "Changes", IdString_t(iox::TruncateToCapacity, std::to_string(i).c_str())};
+        if (i < iox::MAX_SERVERS)
+        {
+            servers.emplace_back(new iox::popo::UntypedServer(service));
+        }
+        else
+        {
+            publishers.emplace_back(new iox::popo::UntypedPublisher(service));
+        }
+        changesSubscribers.back()
+            ->take()
+            .and_then([&](auto& change) {
+                heldChanges.emplace_back(std::move(change));
+                ++numberOfChangesHeldByLastSubscriber;
+            })
+            .or_else([&](auto&) { areChangesExhausted = true; });
+    }
+
+    if (!areChangesExhausted)
+    {
+        GTEST_SKIP() << "The chunks for the service registry changes could not be exhausted";
+    }
+
+    // consumes the pending notifications without releasing the changes in the queue of the ServiceDiscovery
+    waitSet.timedWait(1_ms);
+
+    const iox::capro::ServiceDescription SERVICE_DESCRIPTION("Only", "In", "Registry");
+    iox::popo::UntypedPublisher publisher(SERVICE_DESCRIPTION);
+
+    auto notificationVector = waitSet.timedWait(1_s);
+    EXPECT_THAT(notificationVector.size(), Eq(1U));
+
+    findService(SERVICE_DESCRIPTION.getServiceIDString(),
+                SERVICE_DESCRIPTION.getInstanceIDString(),
+                SERVICE_DESCRIPTION.getEventIDString(),
+                iox::popo::MessagingPattern::PUB_SUB);
+    ASSERT_THAT(serviceContainer.size(), Eq(1U));
+    EXPECT_THAT(serviceContainer.front(), Eq(SERVICE_DESCRIPTION));
+}
+
 TEST_F(ServiceDiscoveryNotification_test, ServiceDiscoveryIsAttachableToListener)
 {
     ::testing::Test::RecordProperty("TEST_ID", "def201f7-d1bf-4031-8e50-a2ad22ee303c");
@@ -457,6 +573,9 @@ class ReferenceDiscovery
             services.emplace(iox::SERVICE_DISCOVERY_SERVICE_NAME,
                              iox::SERVICE_DISCOVERY_INSTANCE_NAME,
                              iox::SERVICE_DISCOVERY_EVENT_NAME);
+            services.emplace(iox::SERVICE_DISCOVERY_SERVICE_NAME,
+                             iox::SERVICE_DISCOVERY_INSTANCE_NAME,
+                             iox::SERVICE_DISCOVERY_CHANGES_EVENT_NAME);
         }
     }
 
@@ -26,6 +26,10 @@ class MePooMemoryManager_MOCK
     {
         return iox::MAX_NUMBER_OF_MEMPOOLS;
     }
+    uint64_t getNumberOfErrors(const iox::mepoo::MemoryManager::Error) const
+    {
+        return 0U;
+    }
     MOCK_CONST_METHOD1(getMemPoolInfo, iox::mepoo::MemPoolInfo(uint32_t));
 };
 
@@ -56,13 +56,22 @@ class MockPublisherPortUser
     MOCK_METHOD4(tryAllocateChunk,
                  iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>(
                      const uint32_t, const uint32_t, const uint32_t, const uint32_t));
+    MOCK_METHOD5(tryAllocateChunks,
+                 iox::expected<void, iox::popo::AllocationError>(const iox::span<iox::mepoo::ChunkHeader*>,
+                                                                 const uint32_t,
+                                                                 const uint32_t,
+                                                                 const uint32_t,
+                                                                 const uint32_t));
     MOCK_METHOD1(releaseChunk, void(iox::mepoo::ChunkHeader* const));
     MOCK_METHOD1(sendChunk, void(iox::mepoo::ChunkHeader* const));
+    MOCK_METHOD1(sendChunks, void(const iox::span<iox::mepoo::ChunkHeader* const>));
     MOCK_METHOD0(tryGetPreviousChunk, iox::optional<iox::mepoo::ChunkHeader*>());
+    MOCK_METHOD1(setDeliveryHelper, void(iox::popo::DeliveryHelper* const));
     MOCK_METHOD0(offer, void());
     MOCK_METHOD0(stopOffer, void());
     MOCK_CONST_METHOD0(isOffered, bool());
     MOCK_CONST_METHOD0(hasSubscribers, bool());
+    MOCK_CONST_METHOD0(getBlockedTimeStatistics, iox::popo::BlockedTimeStatistics());
 
     operator bool() const
     {
@@ -21,6 +21,69 @@
 #include "iox/bump_allocator.hpp"
 #include "test.hpp"
 
+namespace iox
+{
+namespace mepoo
+{
+/// @brief simulates a process which terminates while it modifies a ChunkMagazine
+class ChunkMagazineTestAccess
+{
+  public:
+    static void interruptedAcquireChunk(ChunkMagazine& magazine, MemPool& memPool, MemPool& chunkManagementPool)
+    {
+        void* chunk{nullptr};
+        void* chunkManagement{nullptr};
+        magazine.m_isModified.test_and_set(std::memory_order_acquire);
+        EXPECT_TRUE(magazine.takeChunk(memPool, chunkManagementPool, chunk, chunkManagement));
+    }
+
+    static void interruptedChunkReservation(ChunkMagazine& magazine,
+                                            MemPool& memPool,
+                                            MemPool& chunkManagementPool,
+                                            const uint32_t numberOfRecordedChunks)
+    {
+        magazine.m_isModified.test_and_set(std::memory_order_acquire);
+        magazine.prepareRefill(memPool, chunkManagementPool);
+        EXPECT_THAT(memPool.reserveChunks(&magazine.m_chunkIndices[0], numberOfRecordedChunks),
+                    ::testing::Eq(numberOfRecordedChunks));
+    }
+
+    static void interruptedChunkManagementReservation(ChunkMagazine& magazine,
+                                                      MemPool& memPool,
+                                                      MemPool& chunkManagementPool,
+                                                      const uint32_t numberOfRecordedChunkManagements)
+    {
+        magazine.m_isModified.test_and_set(std::memory_order_acquire);
+        magazine.prepareRefill(memPool, chunkManagementPool);
+        EXPECT_THAT(memPool.reserveChunks(&magazine.m_chunkIndices[0], magazine.m_capacity), ::testing::Eq(magazine.m_capacity));
+        magazine.m_refillStage.store(ChunkMagazine::RefillStage::RESERVING_CHUNK_MANAGEMENTS);
+        EXPECT_THAT(
+            chunkManagementPool.reserveChunks(&magazine.m_chunkManagementIndices[0], numberOfRecordedChunkManagements),
+            ::testing::Eq(numberOfRecordedChunkManagements));
+    }
+
+    static void interruptedRefillBeforeThePublication(ChunkMagazine& magazine,
+                                                      MemPool& memPool,
+                                                      MemPool& chunkManagementPool)
+    {
+        magazine.m_isModified.test_and_set(std::memory_order_acquire);
+        magazine.prepareRefill(memPool, chunkManagementPool);
+        EXPECT_THAT(memPool.reserveChunks(&magazine.m_chunkIndices[0], magazine.m_capacity), ::testing::Eq(magazine.m_capacity));
+        magazine.m_refillStage.store(ChunkMagazine::RefillStage::RESERVING_CHUNK_MANAGEMENTS);
+        EXPECT_THAT(chunkManagementPool.reserveChunks(&magazine.m_chunkManagementIndices[0], magazine.m_capacity),
+                    ::testing::Eq(magazine.m_capacity));
+        magazine.m_refillStage.store(ChunkMagazine::RefillStage::RESERVED);
+    }
+
+    static void interruptedDrain(ChunkMagazine& magazine)
+    {
+        magazine.m_isModified.test_and_set(std::memory_order_acquire);
+        magazine.releaseChunks();
+    }
+};
+} // namespace mepoo
+} // namespace iox
+
 namespace
 {
 using namespace ::testing;
@@ -240,6 +303,48 @@ TEST_F(MemoryManager_test, GetChunkMethodWhenNoFreeChunksInMemPoolConfigReturnsE
     EXPECT_EQ(detectedError.value(), iox::PoshError::MEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
 }
 
+TEST_F(MemoryManager_test, GetChunkMethodWhenNoFreeChunksInMemPoolConfigCountsEveryFailure)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a2e7cd04-04dc-4e9c-8891-69ae5dd3c90d");
+    using Error = iox::mepoo::MemoryManager::Error;
+    constexpr uint32_t CHUNK_COUNT{1U};
+    constexpr uint64_t NUMBER_OF_FAILED_ALLOCATIONS{100U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_32);
+
+    uint64_t numberOfReportedErrors{0U};
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&numberOfReportedErrors](const iox::PoshError, const iox::ErrorLevel) { ++numberOfReportedErrors; });
+
+    for (uint64_t i = 0U; i < NUMBER_OF_FAILED_ALLOCATIONS; ++i)
+    {
+        EXPECT_TRUE(sut->getChunk(chunkSettings_32).has_error());
+    }
+
+    EXPECT_THAT(sut->getNumberOfErrors(Error::MEMPOOL_OUT_OF_CHUNKS), Eq(NUMBER_OF_FAILED_ALLOCATIONS));
+    EXPECT_THAT(sut->getNumberOfErrors(Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE), Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_failedAllocations, Eq(NUMBER_OF_FAILED_ALLOCATIONS));
+    // the failures are counted but only reported with a limited rate
+    EXPECT_THAT(numberOfReportedErrors, Ge(1U));
+    EXPECT_THAT(numberOfReportedErrors, Le(iox::mepoo::MemoryManager::ERROR_REPORT_BURST_SIZE + 1U));
+}
+
+TEST_F(MemoryManager_test, GetChunkMethodWithChunkSizeGreaterThanAvailableChunkSizeCountsTheError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1c6dac79-c0e2-4db7-abd1-c44ac7182ff3");
+    using Error = iox::mepoo::MemoryManager::Error;
+    mempoolconf.addMemPool({CHUNK_SIZE_32, 1U});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [](const iox::PoshError, const iox::ErrorLevel) {});
+
+    EXPECT_TRUE(sut->getChunk(chunkSettings_256).has_error());
+
+    EXPECT_THAT(sut->getNumberOfErrors(Error::NO_MEMPOOL_FOR_REQUESTED_CHUNK_SIZE), Eq(1U));
+    EXPECT_THAT(sut->getNumberOfErrors(Error::MEMPOOL_OUT_OF_CHUNKS), Eq(0U));
+}
+
 TEST_F(MemoryManager_test, VerifyGetChunkMethodWhenTheRequestedChunkIsAvailableInMemPoolConfig)
 {
     ::testing::Test::RecordProperty("TEST_ID", "a5069a9d-ae2f-4466-ae13-53b0794dd292");
@@ -410,6 +515,193 @@ TEST_F(MemoryManager_test, emptyMemPoolDoesNotResultInAcquiringChunksFromOtherMe
     EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(0U));
 }
 
+TEST_F(MemoryManager_test, getChunkSelectsTheFittingMemPoolAmongManyMemPoolsOfOnePowerOfTwo)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0f3c8a6e-2d91-4b57-a1e4-8c6b9d2f7e03");
+    constexpr uint32_t NUMBER_OF_MEMPOOLS{16U};
+    constexpr uint32_t CHUNK_SIZE_STEP{1024U};
+    constexpr uint32_t SMALLEST_USER_PAYLOAD_SIZE{16U * CHUNK_SIZE_STEP};
+    for (uint32_t i = 0U; i < NUMBER_OF_MEMPOOLS; ++i)
+    {
+        mempoolconf.addMemPool({SMALLEST_USER_PAYLOAD_SIZE + i * CHUNK_SIZE_STEP, 1U});
+    }
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto expectChunkFromMemPool = [&](const uint32_t userPayloadSize, const uint32_t expectedMemPoolIndex) {
+        auto chunkSettings =
+            iox::mepoo::ChunkSettings::create(userPayloadSize, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+        auto chunk = sut->getChunk(chunkSettings);
+        ASSERT_FALSE(chunk.has_error());
+        for (uint32_t i = 0U; i < NUMBER_OF_MEMPOOLS; ++i)
+        {
+            EXPECT_THAT(sut->getMemPoolInfo(i).m_usedChunks, Eq(i == expectedMemPoolIndex ? 1U : 0U))
+                << "user-payload size " << userPayloadSize << ", mempool " << i;
+        }
+    };
+
+    expectChunkFromMemPool(1U, 0U);
+    for (uint32_t i = 0U; i < NUMBER_OF_MEMPOOLS; ++i)
+    {
+        const auto userPayloadSize = SMALLEST_USER_PAYLOAD_SIZE + i * CHUNK_SIZE_STEP;
+        expectChunkFromMemPool(userPayloadSize - CHUNK_SIZE_STEP + 1U, i);
+        expectChunkFromMemPool(userPayloadSize, i);
+    }
+}
+
+TEST_F(MemoryManager_test, getChunkSelectsTheFittingMemPoolAlsoWhenMemPoolsShareASizeClass)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a5e71d09-6c3b-4f28-9d84-3b0e2f6a1c57");
+    constexpr uint32_t NUMBER_OF_MEMPOOLS{4U};
+    constexpr uint32_t SMALLEST_USER_PAYLOAD_SIZE{4096U};
+    constexpr uint32_t CHUNK_SIZE_STEP{8U};
+    for (uint32_t i = 0U; i < NUMBER_OF_MEMPOOLS; ++i)
+    {
+        mempoolconf.addMemPool({SMALLEST_USER_PAYLOAD_SIZE + i * CHUNK_SIZE_STEP, 1U});
+    }
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    for (uint32_t i = 0U; i < NUMBER_OF_MEMPOOLS; ++i)
+    {
+        auto chunkSettings = iox::mepoo::ChunkSettings::create(SMALLEST_USER_PAYLOAD_SIZE + i * CHUNK_SIZE_STEP,
+                                                               iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT)
+                                 .value();
+        auto chunk = sut->getChunk(chunkSettings);
+        ASSERT_FALSE(chunk.has_error());
+        EXPECT_THAT(sut->getMemPoolInfo(i).m_usedChunks, Eq(1U));
+    }
+}
+
+TEST_F(MemoryManager_test, emptyMemPoolWithFallThroughPolicyResultsInAcquiringChunksFromLargerMemPools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "586b5ad4-2fc9-4775-bf40-e70599f2ebe6");
+    constexpr uint32_t CHUNK_COUNT{100};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.m_memPoolExhaustedPolicy = iox::mepoo::MemPoolExhaustedPolicy::FALL_THROUGH_TO_LARGER_MEMPOOL;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(2U * CHUNK_COUNT, chunkSettings_64);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(chunkStore.back().getChunkHeader()->chunkSize(), Eq(sut->getMemPoolInfo(2).m_chunkSize));
+}
+
+TEST_F(MemoryManager_test, getChunksAcquiresAllRequestedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9a8f2b61-4d7e-4b3a-a0c2-7e5f1d3b2c40");
+    constexpr uint32_t CHUNK_COUNT{100U};
+    constexpr uint32_t NUMBER_OF_REQUESTED_CHUNKS{10U};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::SharedChunk chunks[NUMBER_OF_REQUESTED_CHUNKS];
+    ASSERT_FALSE(sut->getChunks(chunkSettings_64, iox::span<iox::mepoo::SharedChunk>(chunks)).has_error());
+
+    for (auto& chunk : chunks)
+    {
+        ASSERT_TRUE(chunk);
+        EXPECT_THAT(chunk.getChunkHeader()->chunkSize(), Eq(sut->getMemPoolInfo(1).m_chunkSize));
+    }
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(NUMBER_OF_REQUESTED_CHUNKS));
+}
+
+TEST_F(MemoryManager_test, getChunksWithTooFewAvailableChunksAcquiresNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2f6d1c8e-0b5a-4e79-9c31-a4b8e7d05f62");
+    constexpr uint32_t CHUNK_COUNT{10U};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(1U, chunkSettings_32);
+
+    iox::mepoo::SharedChunk chunks[CHUNK_COUNT];
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS};
+    sut->getChunks(chunkSettings_32, iox::span<iox::mepoo::SharedChunk>(chunks))
+        .and_then([&]() { GTEST_FAIL() << "getChunks should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+
+    for (auto& chunk : chunks)
+    {
+        EXPECT_FALSE(chunk);
+    }
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(1U));
+}
+
+TEST_F(MemoryManager_test, getChunksWithFallThroughPolicyAcquiresTheWholeBatchFromALargerMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c7e3a950-1f2b-4d86-b4a9-5d0e6c8f1a73");
+    constexpr uint32_t CHUNK_COUNT{10U};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.m_memPoolExhaustedPolicy = iox::mepoo::MemPoolExhaustedPolicy::FALL_THROUGH_TO_LARGER_MEMPOOL;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(1U, chunkSettings_32);
+
+    iox::mepoo::SharedChunk chunks[CHUNK_COUNT];
+    ASSERT_FALSE(sut->getChunks(chunkSettings_32, iox::span<iox::mepoo::SharedChunk>(chunks)).has_error());
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CHUNK_COUNT));
+}
+
+TEST_F(MemoryManager_test, allMemPoolsEmptyWithFallThroughPolicyReturnsError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c36be86b-c3a4-4391-a046-f64eccc59894");
+    constexpr uint32_t CHUNK_COUNT{10};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.m_memPoolExhaustedPolicy = iox::mepoo::MemPoolExhaustedPolicy::FALL_THROUGH_TO_LARGER_MEMPOOL;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(2U * CHUNK_COUNT, chunkSettings_32);
+
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS};
+    sut->getChunk(chunkSettings_32)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+}
+
+TEST_F(MemoryManager_test, getChunkSelectsTheSmallestFittingMemPoolOutOfManyMemPools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "67f57514-981b-48f1-9a08-4583f34a6969");
+    constexpr uint32_t CHUNK_COUNT{10};
+    constexpr uint32_t NUMBER_OF_MEMPOOLS{std::min(iox::MAX_NUMBER_OF_MEMPOOLS, 24U)};
+    constexpr uint32_t CHUNK_SIZE_INCREMENT{40U};
+
+    for (uint32_t i = 1U; i <= NUMBER_OF_MEMPOOLS; ++i)
+    {
+        mempoolconf.addMemPool({i * CHUNK_SIZE_INCREMENT, CHUNK_COUNT});
+    }
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    for (uint32_t i = 0U; i < NUMBER_OF_MEMPOOLS; ++i)
+    {
+        const uint32_t chunkSizeOfMemPool = sut->getMemPoolInfo(i).m_chunkSize;
+        const uint32_t previousChunkSize = (i == 0U) ? 0U : sut->getMemPoolInfo(i - 1U).m_chunkSize;
+        for (const uint32_t userPayloadSize : {(i + 1U) * CHUNK_SIZE_INCREMENT, i * CHUNK_SIZE_INCREMENT + 1U})
+        {
+            auto chunkSettings = ChunkSettings::create(userPayloadSize, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+            ASSERT_FALSE(chunkSettings.has_error());
+            ASSERT_THAT(chunkSettings->requiredChunkSize(), Gt(previousChunkSize));
+            sut->getChunk(chunkSettings.value())
+                .and_then([&](auto& chunk) { EXPECT_THAT(chunk.getChunkHeader()->chunkSize(), Eq(chunkSizeOfMemPool)); })
+                .or_else([](const auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
+        }
+    }
+}
+
 TEST_F(MemoryManager_test, freeChunkMultiMemPoolFullToEmptyToFull)
 {
     ::testing::Test::RecordProperty("TEST_ID", "0eddc5b5-e28f-43df-9da7-2c12014284a5");
@@ -475,6 +767,303 @@ TEST_F(MemoryManager_test, addMemPoolWithChunkCountZeroShouldFail)
     EXPECT_DEATH({ sut->configureMemoryManager(mempoolconf, *allocator, *allocator); }, ".*");
 }
 
+TEST_F(MemoryManager_test, getChunkWithChunkMagazineCountsTheReservedChunksAsUsed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "44b57996-251f-421c-876a-5c0e70b84055");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t MAGAZINE_CAPACITY{4U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::ChunkMagazine magazine{MAGAZINE_CAPACITY};
+
+    auto chunk = sut->getChunk(chunkSettings_32, magazine);
+
+    ASSERT_FALSE(chunk.has_error());
+    EXPECT_THAT(magazine.size(), Eq(MAGAZINE_CAPACITY - 1U));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(MAGAZINE_CAPACITY));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_minFreeChunks, Eq(CHUNK_COUNT - MAGAZINE_CAPACITY));
+}
+
+TEST_F(MemoryManager_test, getChunkWithChunkMagazineReservesAndReturnsTheChunksInBatches)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b7e2c4f9-1a3d-4e68-9c05-d8f6a2b1e374");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t MAGAZINE_CAPACITY{4U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::ChunkMagazine magazine{MAGAZINE_CAPACITY};
+
+    ChunkStore chunkStore;
+    auto acquireChunks = [&](const uint32_t numberOfChunks) {
+        for (uint32_t i = 0; i < numberOfChunks; ++i)
+        {
+            sut->getChunk(chunkSettings_32, magazine)
+                .and_then([&](auto& chunk) { chunkStore.push_back(chunk); })
+                .or_else([](const auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
+        }
+    };
+
+    // the first refill reserves a full batch which is handed out without touching the MemPool
+    acquireChunks(MAGAZINE_CAPACITY);
+    EXPECT_THAT(magazine.size(), Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(MAGAZINE_CAPACITY));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_minFreeChunks, Eq(CHUNK_COUNT - MAGAZINE_CAPACITY));
+
+    acquireChunks(MAGAZINE_CAPACITY);
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(2U * MAGAZINE_CAPACITY));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_minFreeChunks, Eq(CHUNK_COUNT - 2U * MAGAZINE_CAPACITY));
+
+    // the last refill reserves the remaining chunks, which are less than the capacity
+    constexpr uint32_t REMAINING_CHUNKS{CHUNK_COUNT - 2U * MAGAZINE_CAPACITY};
+    acquireChunks(1U);
+    EXPECT_THAT(magazine.size(), Eq(REMAINING_CHUNKS - 1U));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_minFreeChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_failedAllocations, Eq(0U));
+
+    magazine.drain();
+    EXPECT_THAT(magazine.size(), Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(2U * MAGAZINE_CAPACITY + 1U));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_minFreeChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, getChunkWithChunkMagazineCanAcquireAllChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "07b9023e-61f3-4de3-b30c-4b0ad8078799");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t MAGAZINE_CAPACITY{4U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::ChunkMagazine magazine{MAGAZINE_CAPACITY};
+
+    ChunkStore chunkStore;
+    for (uint32_t i = 0; i < CHUNK_COUNT; ++i)
+    {
+        sut->getChunk(chunkSettings_32, magazine)
+            .and_then([&](auto& chunk) { chunkStore.push_back(chunk); })
+            .or_else([](const auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
+    }
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(CHUNK_COUNT));
+
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS};
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [](const iox::PoshError, const iox::ErrorLevel) {});
+    sut->getChunk(chunkSettings_32, magazine)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+}
+
+TEST_F(MemoryManager_test, getChunkWithChunkMagazineForDifferentMemPoolBypassesTheMagazine)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "976c3a95-4fef-4c59-aa5d-acfbf4e7348a");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t MAGAZINE_CAPACITY{4U};
+    constexpr uint32_t NUMBER_OF_ALTERNATIONS{3U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::ChunkMagazine magazine{MAGAZINE_CAPACITY};
+
+    ChunkStore chunkStore;
+    for (uint32_t i = 0; i < NUMBER_OF_ALTERNATIONS; ++i)
+    {
+        for (const auto& chunkSettings : {chunkSettings_32, chunkSettings_64})
+        {
+            sut->getChunk(chunkSettings, magazine)
+                .and_then([&](auto& chunk) { chunkStore.push_back(chunk); })
+                .or_else([](const auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
+        }
+    }
+
+    // the magazine keeps the batch of the first mempool and the chunks of the other one are taken one by one
+    EXPECT_THAT(magazine.size(), Eq(MAGAZINE_CAPACITY - NUMBER_OF_ALTERNATIONS));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(MAGAZINE_CAPACITY));
+    EXPECT_THAT(sut->getMemPoolInfo(1U).m_usedChunks, Eq(NUMBER_OF_ALTERNATIONS));
+}
+
+TEST_F(MemoryManager_test, getChunkWithChunkMagazineAndFallThroughPolicyDoesNotReserveChunksOfLargerMemPools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c9a9af0c-ad9c-4f12-b839-c59b6ecc3474");
+    constexpr uint32_t CHUNK_COUNT{8U};
+    constexpr uint32_t MAGAZINE_CAPACITY{4U};
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.m_memPoolExhaustedPolicy = iox::mepoo::MemPoolExhaustedPolicy::FALL_THROUGH_TO_LARGER_MEMPOOL;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::ChunkMagazine magazine{MAGAZINE_CAPACITY};
+
+    ChunkStore chunkStore;
+    for (uint32_t i = 0; i <= CHUNK_COUNT; ++i)
+    {
+        sut->getChunk(chunkSettings_64, magazine)
+            .and_then([&](auto& chunk) { chunkStore.push_back(chunk); })
+            .or_else([](const auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
+    }
+
+    EXPECT_THAT(magazine.size(), Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(1U).m_usedChunks, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(1U).m_minFreeChunks, Eq(CHUNK_COUNT - 1U));
+}
+
+TEST_F(MemoryManager_test, drainingTheChunkMagazineMakesTheReservedChunksAvailableAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1a9ae822-67e1-4b07-bac8-918e4918e693");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t MAGAZINE_CAPACITY{CHUNK_COUNT};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::ChunkMagazine magazine{MAGAZINE_CAPACITY};
+
+    {
+        auto chunk = sut->getChunk(chunkSettings_32, magazine);
+        ASSERT_FALSE(chunk.has_error());
+    }
+    magazine.drain();
+
+    EXPECT_THAT(magazine.size(), Eq(0U));
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_32);
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(CHUNK_COUNT));
+}
+
+TEST_F(MemoryManager_test, getChunkWithDisabledChunkMagazineDoesNotReserveChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1ca5abc4-c1bc-4fbd-8fcd-d75717ac8f4a");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+    iox::mepoo::ChunkMagazine magazine;
+
+    auto chunk = sut->getChunk(chunkSettings_32, magazine);
+
+    ASSERT_FALSE(chunk.has_error());
+    EXPECT_FALSE(magazine.isEnabled());
+    EXPECT_THAT(magazine.size(), Eq(0U));
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT - 1U, chunkSettings_32);
+}
+
+class ChunkMagazine_test : public Test
+{
+  public:
+    uint32_t numberOfAvailableChunks(iox::mepoo::MemPool& memPool)
+    {
+        uint32_t numberOfChunks{0U};
+        while (memPool.getChunk() != nullptr)
+        {
+            ++numberOfChunks;
+        }
+        return numberOfChunks;
+    }
+
+    static constexpr uint32_t CHUNK_SIZE{128U};
+    static constexpr uint32_t CHUNK_COUNT{10U};
+    static constexpr uint32_t MAGAZINE_CAPACITY{4U};
+    static constexpr size_t MEMORY_SIZE{2U * (CHUNK_SIZE + sizeof(uint32_t)) * CHUNK_COUNT + 1024U};
+    std::unique_ptr<char[]> memory{new char[MEMORY_SIZE]};
+    iox::BumpAllocator allocator{memory.get(), MEMORY_SIZE};
+    iox::mepoo::MemPool memPool{CHUNK_SIZE, CHUNK_COUNT, allocator, allocator};
+    iox::mepoo::MemPool chunkManagementPool{CHUNK_SIZE, CHUNK_COUNT, allocator, allocator};
+    iox::mepoo::ChunkMagazine sut{MAGAZINE_CAPACITY};
+    iox::optional<iox::PoshError> detectedError;
+    iox::ScopeGuard errorHandlerGuard{iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&](const iox::PoshError error, const iox::ErrorLevel) { detectedError.emplace(error); })};
+};
+
+TEST_F(ChunkMagazine_test, DrainAfterInterruptedAcquireChunkDoesNotReturnTheAcquiredChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9dcfd57d-eeee-4fa7-b408-7cc8736913b5");
+    iox::mepoo::ChunkMagazineTestAccess::interruptedAcquireChunk(sut, memPool, chunkManagementPool);
+
+    sut.drain();
+
+    EXPECT_FALSE(detectedError.has_value());
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(numberOfAvailableChunks(memPool), Eq(CHUNK_COUNT - 1U));
+    EXPECT_THAT(numberOfAvailableChunks(chunkManagementPool), Eq(CHUNK_COUNT - 1U));
+}
+
+TEST_F(ChunkMagazine_test, DrainAfterInterruptedRefillReturnsTheReservedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e3f0b7a2-9c51-4d8e-b6a4-15d2c8e7f091");
+    iox::mepoo::ChunkMagazineTestAccess::interruptedRefillBeforeThePublication(sut, memPool, chunkManagementPool);
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(MAGAZINE_CAPACITY));
+
+    sut.drain();
+
+    EXPECT_FALSE(detectedError.has_value());
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(chunkManagementPool.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(numberOfAvailableChunks(memPool), Eq(CHUNK_COUNT));
+    EXPECT_THAT(numberOfAvailableChunks(chunkManagementPool), Eq(CHUNK_COUNT));
+}
+
+TEST_F(ChunkMagazine_test, DrainAfterInterruptedChunkReservationReturnsTheRecordedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2b6f4e1d-8a37-4c09-9e52-7d1a3f8c6b40");
+    constexpr uint32_t NUMBER_OF_RECORDED_CHUNKS{MAGAZINE_CAPACITY - 1U};
+    iox::mepoo::ChunkMagazineTestAccess::interruptedChunkReservation(
+        sut, memPool, chunkManagementPool, NUMBER_OF_RECORDED_CHUNKS);
+
+    sut.drain();
+
+    EXPECT_FALSE(detectedError.has_value());
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(numberOfAvailableChunks(memPool), Eq(CHUNK_COUNT));
+    EXPECT_THAT(numberOfAvailableChunks(chunkManagementPool), Eq(CHUNK_COUNT));
+}
+
+TEST_F(ChunkMagazine_test, DrainAfterInterruptedChunkManagementReservationReturnsTheRecordedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c84e0a92-5f1b-4d73-b6e8-0a9d2c7f3e15");
+    constexpr uint32_t NUMBER_OF_RECORDED_CHUNK_MANAGEMENTS{MAGAZINE_CAPACITY - 2U};
+    iox::mepoo::ChunkMagazineTestAccess::interruptedChunkManagementReservation(
+        sut, memPool, chunkManagementPool, NUMBER_OF_RECORDED_CHUNK_MANAGEMENTS);
+
+    sut.drain();
+
+    EXPECT_FALSE(detectedError.has_value());
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(numberOfAvailableChunks(memPool), Eq(CHUNK_COUNT));
+    EXPECT_THAT(numberOfAvailableChunks(chunkManagementPool), Eq(CHUNK_COUNT));
+}
+
+TEST_F(ChunkMagazine_test, DrainAfterCompletedRefillDoesNotInspectTheRefillRecordAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "71d3b9e6-0c4a-4f82-a5d7-e2f8b1c6a093");
+    void* chunk{nullptr};
+    void* chunkManagement{nullptr};
+    ASSERT_TRUE(sut.acquireChunk(memPool, chunkManagementPool, chunk, chunkManagement));
+    ASSERT_TRUE(sut.acquireChunk(memPool, chunkManagementPool, chunk, chunkManagement));
+
+    sut.drain();
+    sut.drain();
+
+    EXPECT_FALSE(detectedError.has_value());
+    EXPECT_THAT(memPool.getUsedChunks(), Eq(2U));
+    EXPECT_THAT(numberOfAvailableChunks(memPool), Eq(CHUNK_COUNT - 2U));
+    EXPECT_THAT(numberOfAvailableChunks(chunkManagementPool), Eq(CHUNK_COUNT - 2U));
+}
+
+TEST_F(ChunkMagazine_test, DrainAfterInterruptedDrainDoesNotReturnChunksTwice)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6e51f8da-c003-44e6-8f8f-870fada1aa60");
+    void* chunk{nullptr};
+    void* chunkManagement{nullptr};
+    ASSERT_TRUE(sut.acquireChunk(memPool, chunkManagementPool, chunk, chunkManagement));
+    iox::mepoo::ChunkMagazineTestAccess::interruptedDrain(sut);
+
+    sut.drain();
+
+    EXPECT_FALSE(detectedError.has_value());
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(numberOfAvailableChunks(memPool), Eq(CHUNK_COUNT - 1U));
+    EXPECT_THAT(numberOfAvailableChunks(chunkManagementPool), Eq(CHUNK_COUNT - 1U));
+}
+
 TEST(MemoryManagerEnumString_test, asStringLiteralConvertsEnumValuesToStrings)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5f6c3942-0af5-4c48-b44c-7268191dbac5");
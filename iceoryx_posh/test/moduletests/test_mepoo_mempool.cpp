@@ -112,6 +112,25 @@ TEST_F(MemPool_test, GetChunkMethodWhenAllTheChunksAreUsedReturnsNullPointer)
     EXPECT_THAT(sut.getChunk(), Eq(nullptr));
 }
 
+TEST_F(MemPool_test, GetChunkMethodWhenAllTheChunksAreUsedCountsTheFailedAllocations)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "959dfdc3-7514-40fc-9876-4d31f8926191");
+    constexpr uint64_t NUMBER_OF_FAILED_ALLOCATIONS{3U};
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; i++)
+    {
+        sut.getChunk();
+    }
+    EXPECT_THAT(sut.getNumberOfFailedAllocations(), Eq(0U));
+
+    for (uint64_t i = 0U; i < NUMBER_OF_FAILED_ALLOCATIONS; i++)
+    {
+        EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+    }
+
+    EXPECT_THAT(sut.getNumberOfFailedAllocations(), Eq(NUMBER_OF_FAILED_ALLOCATIONS));
+    EXPECT_THAT(sut.getInfo().m_failedAllocations, Eq(NUMBER_OF_FAILED_ALLOCATIONS));
+}
+
 TEST_F(MemPool_test, WritingDataToAChunkStoresTheCorrespondingDataInTheChunk)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4550d044-d1c8-493d-b839-40509b03407f");
@@ -209,6 +228,149 @@ TEST_F(MemPool_test, GetMinFreeMethodReturnsTheNumberOfFreeChunks)
     }
 }
 
+TEST_F(MemPool_test, ReserveChunksCountsTheChunksAsUsed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "55480df6-17e0-492e-ad0c-8ad37c7415d8");
+    constexpr uint32_t NUMBER_OF_RESERVED_CHUNKS{10U};
+    uint32_t indices[NUMBER_OF_RESERVED_CHUNKS];
+
+    EXPECT_THAT(sut.reserveChunks(indices, NUMBER_OF_RESERVED_CHUNKS), Eq(NUMBER_OF_RESERVED_CHUNKS));
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_RESERVED_CHUNKS));
+    EXPECT_THAT(sut.getMinFree(), Eq(NUMBER_OF_CHUNKS - NUMBER_OF_RESERVED_CHUNKS));
+}
+
+TEST_F(MemPool_test, ReserveChunkCountsTheChunkAsUsed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8f2a6d1e-3c4b-4e5f-a617-2b8c9d0e1f23");
+    uint32_t index{0U};
+
+    ASSERT_TRUE(sut.reserveChunk(index));
+
+    EXPECT_THAT(index, Lt(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(1U));
+    EXPECT_THAT(sut.getMinFree(), Eq(NUMBER_OF_CHUNKS - 1U));
+}
+
+TEST_F(MemPool_test, ReserveChunkDoesNotCountAFailedAllocationWhenNoChunkIsAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4b7e1c90-5d2a-4f36-8e41-c7a9b3d2e605");
+    uint32_t indices[NUMBER_OF_CHUNKS];
+    ASSERT_THAT(sut.reserveChunks(indices, NUMBER_OF_CHUNKS), Eq(NUMBER_OF_CHUNKS));
+
+    uint32_t index{0U};
+    EXPECT_FALSE(sut.reserveChunk(index));
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(sut.getNumberOfFailedAllocations(), Eq(0U));
+}
+
+TEST_F(MemPool_test, ReserveChunksReturnsOnlyTheNumberOfAvailableChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0ed76d37-9de2-44b5-9b86-63464c46d9bf");
+    uint32_t indices[NUMBER_OF_CHUNKS + 1U];
+
+    EXPECT_THAT(sut.reserveChunks(indices, NUMBER_OF_CHUNKS + 1U), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+}
+
+TEST_F(MemPool_test, ReserveChunksCountsAFailedAllocationOnlyWhenNoChunkIsAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b5003542-72a1-4000-8c14-41908e03b101");
+    uint32_t indices[NUMBER_OF_CHUNKS + 1U];
+
+    EXPECT_THAT(sut.reserveChunks(indices, NUMBER_OF_CHUNKS + 1U), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(sut.getNumberOfFailedAllocations(), Eq(0U));
+
+    EXPECT_THAT(sut.reserveChunks(indices, 1U), Eq(0U));
+    EXPECT_THAT(sut.getNumberOfFailedAllocations(), Eq(1U));
+}
+
+TEST_F(MemPool_test, AcquireReservedChunkDoesNotCountTheChunkASecondTime)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d1dd79da-affd-4ab0-94e2-3348924f659a");
+    constexpr uint32_t NUMBER_OF_RESERVED_CHUNKS{10U};
+    uint32_t indices[NUMBER_OF_RESERVED_CHUNKS];
+    ASSERT_THAT(sut.reserveChunks(indices, NUMBER_OF_RESERVED_CHUNKS), Eq(NUMBER_OF_RESERVED_CHUNKS));
+
+    for (uint32_t i = 0U; i < NUMBER_OF_RESERVED_CHUNKS; ++i)
+    {
+        EXPECT_THAT(sut.acquireReservedChunk(indices[i]), Ne(nullptr));
+        EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_RESERVED_CHUNKS));
+        EXPECT_THAT(sut.getMinFree(), Eq(NUMBER_OF_CHUNKS - NUMBER_OF_RESERVED_CHUNKS));
+    }
+}
+
+TEST_F(MemPool_test, ReleaseReservedChunksMakesTheChunksAvailableAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5848065d-9623-4316-b646-62c6b6a487d0");
+    uint32_t indices[NUMBER_OF_CHUNKS];
+    ASSERT_THAT(sut.reserveChunks(indices, NUMBER_OF_CHUNKS), Eq(NUMBER_OF_CHUNKS));
+
+    sut.releaseReservedChunks(indices, NUMBER_OF_CHUNKS);
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(sut.getChunk(), Ne(nullptr));
+    }
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TEST_F(MemPool_test, ReleaseUncountedChunksMakesTheChunksAvailableWithoutChangingTheUsedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9a3e6c1f-2b7d-4e50-8f14-d6c0b2a9e837");
+    constexpr uint32_t NUMBER_OF_UNCOUNTED_CHUNKS{3U};
+    uint32_t indices[NUMBER_OF_CHUNKS];
+    ASSERT_THAT(sut.reserveChunks(indices, NUMBER_OF_CHUNKS), Eq(NUMBER_OF_CHUNKS));
+
+    sut.releaseUncountedChunks(indices, NUMBER_OF_UNCOUNTED_CHUNKS);
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_CHUNKS));
+    for (uint32_t i = 0U; i < NUMBER_OF_UNCOUNTED_CHUNKS; ++i)
+    {
+        EXPECT_THAT(sut.getChunk(), Ne(nullptr));
+    }
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+}
+
+TEST_F(MemPool_test, GetChunksMarksAllRequestedChunksAsUsed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1c4c3d0e-62a4-4f0b-9a55-0c0d2b7f64a1");
+    constexpr uint32_t NUMBER_OF_REQUESTED_CHUNKS{10U};
+    void* chunks[NUMBER_OF_REQUESTED_CHUNKS];
+
+    ASSERT_TRUE(sut.getChunks(&chunks[0], NUMBER_OF_REQUESTED_CHUNKS));
+
+    for (uint32_t i = 0U; i < NUMBER_OF_REQUESTED_CHUNKS; ++i)
+    {
+        EXPECT_THAT(chunks[i], Ne(nullptr));
+        for (uint32_t k = 0U; k < i; ++k)
+        {
+            EXPECT_THAT(chunks[i], Ne(chunks[k]));
+        }
+    }
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_REQUESTED_CHUNKS));
+    EXPECT_THAT(sut.getMinFree(), Eq(NUMBER_OF_CHUNKS - NUMBER_OF_REQUESTED_CHUNKS));
+}
+
+TEST_F(MemPool_test, GetChunksWithMoreChunksThanAvailableAcquiresNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e1b0a7d-3e7c-4f49-8f0b-6b5d9a2f3c18");
+    constexpr uint32_t NUMBER_OF_REQUESTED_CHUNKS{10U};
+    void* chunks[NUMBER_OF_REQUESTED_CHUNKS];
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS - NUMBER_OF_REQUESTED_CHUNKS + 1U; ++i)
+    {
+        ASSERT_THAT(sut.getChunk(), Ne(nullptr));
+    }
+
+    EXPECT_FALSE(sut.getChunks(&chunks[0], NUMBER_OF_REQUESTED_CHUNKS));
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_CHUNKS - NUMBER_OF_REQUESTED_CHUNKS + 1U));
+    EXPECT_THAT(sut.getNumberOfFailedAllocations(), Eq(1U));
+    EXPECT_TRUE(sut.getChunks(&chunks[0], NUMBER_OF_REQUESTED_CHUNKS - 1U));
+}
+
 TEST_F(MemPool_test, dieWhenMempoolChunkSizeIsSmallerThan32Bytes)
 {
     ::testing::Test::RecordProperty("TEST_ID", "7704246e-42b5-46fd-8827-ebac200390e1");
@@ -40,7 +40,8 @@ class MePooSegmentMock
                      iox::BumpAllocator& managementAllocator IOX_MAYBE_UNUSED,
                      const PosixGroup& readerGroup IOX_MAYBE_UNUSED,
                      const PosixGroup& writerGroup IOX_MAYBE_UNUSED,
-                     const MemoryInfo& memoryInfo IOX_MAYBE_UNUSED) noexcept
+                     const MemoryInfo& memoryInfo IOX_MAYBE_UNUSED,
+                     const MemoryPagingConfig& memoryPagingConfig IOX_MAYBE_UNUSED) noexcept
     {
     }
 };
@@ -125,6 +126,24 @@ TEST_F(SegmentManager_test, getSegmentMappingsForWriteUser)
     EXPECT_THAT(mapping[0].m_isWritable == mapping[1].m_isWritable, Eq(false));
 }
 
+TEST_F(SegmentManager_test, getSegmentMappingsContainTheMemoryPagingConfigOfTheSegments)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a2d9ec68-fb64-4268-9046-6b5fda9b1c44");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    MemoryPagingConfig memoryPagingConfig;
+    memoryPagingConfig.m_prefault = true;
+    segmentConfig.m_sharedMemorySegments.clear();
+    segmentConfig.m_sharedMemorySegments.push_back(
+        {"iox_roudi_test1", "iox_roudi_test2", mepooConfig, MemoryInfo(), memoryPagingConfig});
+
+    auto sut = createSut();
+    auto mapping = sut->getSegmentMappings(PosixUser{"iox_roudi_test1"});
+    ASSERT_THAT(mapping.size(), Eq(1u));
+    EXPECT_TRUE(mapping[0].m_memoryPagingConfig.m_prefault);
+    EXPECT_FALSE(mapping[0].m_memoryPagingConfig.m_lockInMemory);
+}
+
 TEST_F(SegmentManager_test, getSegmentMappingsEmptyForNonRegisteredUser)
 {
     ::testing::Test::RecordProperty("TEST_ID", "7cf9a658-bb2d-444f-af67-0355e8f45ea2");
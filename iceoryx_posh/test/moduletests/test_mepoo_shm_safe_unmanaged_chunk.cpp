@@ -182,6 +182,37 @@ TEST_F(ShmSafeUnmanagedChunk_test,
     EXPECT_FALSE(sut.cloneToSharedChunk());
 }
 
+TEST_F(ShmSafeUnmanagedChunk_test, CallTryCloneToSharedChunkOnSutConstructedWithSharedChunkResultsInNotEmptySharedChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cfb3b0be-0c4e-436f-a3eb-5ed297ccc092");
+    auto sharedChunk = getChunkFromMemoryManager();
+
+    ShmSafeUnmanagedChunk sut(sharedChunk);
+
+    auto clonedSharedChunk = sut.tryCloneToSharedChunk();
+    EXPECT_TRUE(clonedSharedChunk);
+    EXPECT_THAT(clonedSharedChunk, Eq(sharedChunk));
+
+    sut.releaseToSharedChunk();
+    EXPECT_EQ(memoryManager.getMemPoolInfo(0).m_usedChunks, 1U);
+}
+
+TEST_F(ShmSafeUnmanagedChunk_test, CallTryCloneToSharedChunkOnSutWithReleasedChunkResultsInEmptySharedChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "61b3b04a-b8bb-402a-970c-4b123bd8d625");
+    auto sharedChunk = getChunkFromMemoryManager();
+
+    ShmSafeUnmanagedChunk sut(sharedChunk);
+    // a copy still refers to the chunk when all owners released it, like a concurrent reader of an overwritten slot
+    ShmSafeUnmanagedChunk staleCopy = sut;
+    sut.releaseToSharedChunk();
+    sharedChunk = SharedChunk();
+    ASSERT_EQ(memoryManager.getMemPoolInfo(0).m_usedChunks, 0U);
+
+    EXPECT_FALSE(staleCopy.tryCloneToSharedChunk());
+    EXPECT_EQ(memoryManager.getMemPoolInfo(0).m_usedChunks, 0U);
+}
+
 TEST_F(ShmSafeUnmanagedChunk_test, CallGetChunkHeaderOnNonConstDefaultConstructedSutResultsInNullptr)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ca9d879c-73e5-466f-a84c-356719b660f5");
@@ -0,0 +1,96 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/token_bucket.hpp"
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using iox::mepoo::TokenBucket;
+
+constexpr uint64_t NANOSECONDS_PER_SECOND{1000000000U};
+constexpr uint64_t TOKENS_PER_SECOND{10U};
+constexpr uint64_t EMISSION_INTERVAL_NS{NANOSECONDS_PER_SECOND / TOKENS_PER_SECOND};
+constexpr uint64_t BURST_SIZE{3U};
+constexpr uint64_t START_TIME_NS{42U * NANOSECONDS_PER_SECOND};
+
+TEST(TokenBucket_test, FullBucketGrantsBurstSizeTokensAtOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7d543516-00d9-4a35-9ff3-cca7f671f53d");
+    TokenBucket sut{TOKENS_PER_SECOND, BURST_SIZE};
+
+    for (uint64_t i = 0U; i < BURST_SIZE; ++i)
+    {
+        EXPECT_TRUE(sut.tryAcquire(START_TIME_NS));
+    }
+    EXPECT_FALSE(sut.tryAcquire(START_TIME_NS));
+}
+
+TEST(TokenBucket_test, EmptyBucketIsRefilledWithConfiguredRate)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b43f1f41-ef92-4d58-a3a0-e8eca2144851");
+    TokenBucket sut{TOKENS_PER_SECOND, BURST_SIZE};
+    for (uint64_t i = 0U; i < BURST_SIZE; ++i)
+    {
+        ASSERT_TRUE(sut.tryAcquire(START_TIME_NS));
+    }
+
+    EXPECT_FALSE(sut.tryAcquire(START_TIME_NS + EMISSION_INTERVAL_NS - 1U));
+    EXPECT_TRUE(sut.tryAcquire(START_TIME_NS + EMISSION_INTERVAL_NS));
+    EXPECT_FALSE(sut.tryAcquire(START_TIME_NS + EMISSION_INTERVAL_NS));
+}
+
+TEST(TokenBucket_test, BucketDoesNotHoldMoreThanBurstSizeTokens)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "62ed8bfe-13b3-4d88-86c3-c594cb77b5bc");
+    TokenBucket sut{TOKENS_PER_SECOND, BURST_SIZE};
+    constexpr uint64_t LATER_NS{START_TIME_NS + 100U * NANOSECONDS_PER_SECOND};
+    ASSERT_TRUE(sut.tryAcquire(START_TIME_NS));
+
+    for (uint64_t i = 0U; i < BURST_SIZE; ++i)
+    {
+        EXPECT_TRUE(sut.tryAcquire(LATER_NS));
+    }
+    EXPECT_FALSE(sut.tryAcquire(LATER_NS));
+}
+
+TEST(TokenBucket_test, RejectionsAreCountedUntilTheyAreTaken)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "52fff7e2-3136-418e-b214-b933da8cd292");
+    TokenBucket sut{TOKENS_PER_SECOND, 1U};
+    constexpr uint64_t NUMBER_OF_REJECTIONS{5U};
+    ASSERT_TRUE(sut.tryAcquire(START_TIME_NS));
+
+    for (uint64_t i = 0U; i < NUMBER_OF_REJECTIONS; ++i)
+    {
+        EXPECT_FALSE(sut.tryAcquire(START_TIME_NS));
+    }
+
+    EXPECT_THAT(sut.takeNumberOfRejections(), Eq(NUMBER_OF_REJECTIONS));
+    EXPECT_THAT(sut.takeNumberOfRejections(), Eq(0U));
+}
+
+TEST(TokenBucket_test, TryAcquireWithMonotonicClockGrantsTokensOfFullBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b5e8ced5-88b5-4d94-87eb-f698630813f0");
+    TokenBucket sut{1U, BURST_SIZE};
+
+    EXPECT_TRUE(sut.tryAcquire());
+    EXPECT_THAT(sut.takeNumberOfRejections(), Eq(0U));
+}
+
+} // namespace
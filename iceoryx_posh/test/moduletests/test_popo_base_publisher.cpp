@@ -102,6 +102,20 @@ TEST_F(BasePublisherTest, isOfferedDoesCheckIfUnderylingPortHasSubscribers)
     // ===== Cleanup ===== //
 }
 
+TEST_F(BasePublisherTest, GetBlockedTimeStatisticsCallForwardedToUnderlyingPublisherPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2dc9bce4-b8e2-4534-9dcc-eb1dbd9590b4");
+    // ===== Setup ===== //
+    iox::popo::BlockedTimeStatistics statistics;
+    statistics.numberOfBlockedDeliveries = 42U;
+    EXPECT_CALL(sut.port(), getBlockedTimeStatistics).WillOnce(Return(statistics));
+    // ===== Test ===== //
+    const auto result = sut.getBlockedTimeStatistics();
+    // ===== Verify ===== //
+    EXPECT_THAT(result.numberOfBlockedDeliveries, Eq(42U));
+    // ===== Cleanup ===== //
+}
+
 TEST_F(BasePublisherTest, GetServiceDescriptionCallForwardedToUnderlyingPublisherPort)
 {
     ::testing::Test::RecordProperty("TEST_ID", "c3b989a9-61d5-4d8f-81b0-eacb0e368a14");
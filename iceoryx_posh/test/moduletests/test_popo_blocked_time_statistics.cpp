@@ -0,0 +1,83 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/popo/building_blocks/blocked_time_statistics.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::units;
+using namespace iox::units::duration_literals;
+
+TEST(BlockedTimeStatistics_test, NewStatisticsHaveNoBlockedDeliveries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "22e541a0-14ad-4568-a483-d0aa9973fc37");
+    BlockedTimeStatisticsData sut;
+
+    const auto statistics = sut.load();
+
+    EXPECT_THAT(statistics.numberOfBlockedDeliveries, Eq(0U));
+    EXPECT_THAT(statistics.totalBlockedTime, Eq(Duration::zero()));
+    EXPECT_THAT(statistics.maxBlockedTime, Eq(Duration::zero()));
+    for (auto bucket : statistics.histogram)
+    {
+        EXPECT_THAT(bucket, Eq(0U));
+    }
+}
+
+TEST(BlockedTimeStatistics_test, RecordAccumulatesTheBlockedTimes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1230e85a-98a0-4265-9542-c80e2db6ac85");
+    BlockedTimeStatisticsData sut;
+
+    sut.record(3_us);
+    sut.record(1_ms);
+    sut.record(5_us);
+
+    const auto statistics = sut.load();
+    EXPECT_THAT(statistics.numberOfBlockedDeliveries, Eq(3U));
+    EXPECT_THAT(statistics.totalBlockedTime, Eq(1008_us));
+    EXPECT_THAT(statistics.maxBlockedTime, Eq(1_ms));
+    EXPECT_THAT(statistics.histogram[1U], Eq(1U));
+    EXPECT_THAT(statistics.histogram[2U], Eq(1U));
+    EXPECT_THAT(statistics.histogram[9U], Eq(1U));
+}
+
+TEST(BlockedTimeStatistics_test, BucketIsTheLogarithmOfTheBlockedMicroseconds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1bf7ab25-176b-4bfc-b364-d10ceb2ae8d3");
+    EXPECT_THAT(BlockedTimeStatisticsData::bucketOf(Duration::zero()), Eq(0U));
+    EXPECT_THAT(BlockedTimeStatisticsData::bucketOf(1_us), Eq(0U));
+    EXPECT_THAT(BlockedTimeStatisticsData::bucketOf(2_us), Eq(1U));
+    EXPECT_THAT(BlockedTimeStatisticsData::bucketOf(3_us), Eq(1U));
+    EXPECT_THAT(BlockedTimeStatisticsData::bucketOf(4_us), Eq(2U));
+    EXPECT_THAT(BlockedTimeStatisticsData::bucketOf(1_ms), Eq(9U));
+}
+
+TEST(BlockedTimeStatistics_test, LongBlockedTimesAreCountedInTheLastBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ba51e92e-0214-4bb4-b43b-9db317eca536");
+    constexpr uint64_t LAST_BUCKET{BlockedTimeStatistics::NUMBER_OF_BUCKETS - 1U};
+
+    EXPECT_THAT(BlockedTimeStatisticsData::bucketOf(Duration::fromMicroseconds(1U << LAST_BUCKET)), Eq(LAST_BUCKET));
+    EXPECT_THAT(BlockedTimeStatisticsData::bucketOf(10_s), Eq(LAST_BUCKET));
+}
+
+} // namespace
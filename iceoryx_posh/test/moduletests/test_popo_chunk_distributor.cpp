@@ -26,11 +26,16 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/delivery_helper.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "test.hpp"
 
+#include <atomic>
 #include <memory>
+#include <set>
+#include <thread>
 
 namespace
 {
@@ -114,9 +119,16 @@ class ChunkDistributor_test : public Test
     }
 
     std::shared_ptr<ChunkDistributorData_t>
-    getChunkDistributorData(const ConsumerTooSlowPolicy policy = ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA)
+    getChunkDistributorData(const ConsumerTooSlowPolicy policy = ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                            const uint64_t broadcastDeliveryThreshold = 0U)
     {
-        return std::make_shared<ChunkDistributorData_t>(policy, HISTORY_SIZE);
+        return std::make_shared<ChunkDistributorData_t>(policy, HISTORY_SIZE, broadcastDeliveryThreshold);
+    }
+
+    std::shared_ptr<ChunkDistributorData_t> getChunkDistributorDataWithChunkRing(const uint64_t chunkRingCapacity)
+    {
+        return std::make_shared<ChunkDistributorData_t>(
+            ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, HISTORY_SIZE, 0U, chunkRingCapacity);
     }
 
     static constexpr std::chrono::milliseconds BLOCKING_DURATION{100};
@@ -244,6 +256,145 @@ TYPED_TEST(ChunkDistributor_test, RemoveAllQueuesWhenContainingMultipleQueues)
     EXPECT_THAT(sut.hasStoredQueues(), Eq(false));
 }
 
+TYPED_TEST(ChunkDistributor_test, ModifyingQueuesWithQueuesPinnedByTerminatedSenderWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a0f3c2e-51d4-4b8e-9f7a-2d8c41e5b936");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    // simulate a sender which was terminated while reading the active queues
+    const auto pinnedIndex = sutData->activeQueueContainerIndex();
+    sutData->m_queueContainerReaders[pinnedIndex].fetch_add(1U);
+
+    auto queueData = this->getChunkQueueData();
+    auto queueData2 = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+
+    EXPECT_FALSE(sut.getQueueIndex(queueData->m_uniqueId, 0U).has_value());
+    EXPECT_TRUE(sut.getQueueIndex(queueData2->m_uniqueId, 0U).has_value());
+    EXPECT_THAT(sutData->m_queueContainerReaders[pinnedIndex].load(), Eq(1U));
+}
+
+TYPED_TEST(ChunkDistributor_test, CleanupReleasesQueuesPinnedByTerminatedSender)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d93e7b18-4c6a-4f02-8e15-b7a9c03f62d4");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    // simulate a sender which was terminated while reading the active queues
+    const auto pinnedIndex = sutData->activeQueueContainerIndex();
+    sutData->m_queueContainerReaders[pinnedIndex].fetch_add(1U);
+
+    sut.cleanup();
+
+    for (const auto& readers : sutData->m_queueContainerReaders)
+    {
+        EXPECT_THAT(readers.load(), Eq(0U));
+    }
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    EXPECT_THAT(sut.hasStoredQueues(), Eq(true));
+}
+
+TYPED_TEST(ChunkDistributor_test, StoredQueueIsReferenced)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d8e3d2d2-82f4-4efe-bf4d-b10e90e2556c");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    EXPECT_FALSE(sut.isQueueReferenced(queueData.get()));
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    EXPECT_TRUE(sut.isQueueReferenced(queueData.get()));
+
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    EXPECT_FALSE(sut.isQueueReferenced(queueData.get()));
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovedQueueStaysReferencedAsLongAsAPreemptedSenderPinsThePreviousQueues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ad99bf30-19d1-4756-b658-0a2e10246716");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    // simulates a sender which is preempted while it delivers to the active queues
+    const auto pinnedIndex = sutData->activeQueueContainerIndex();
+    sutData->m_queueContainerReaders[pinnedIndex].store(1U);
+
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    EXPECT_TRUE(sut.isQueueReferenced(queueData.get()));
+
+    // further modifications must not reuse the pinned queues
+    auto anotherQueueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(anotherQueueData.get()).has_error());
+    ASSERT_FALSE(sut.tryRemoveQueue(anotherQueueData.get()).has_error());
+    EXPECT_TRUE(sut.isQueueReferenced(queueData.get()));
+
+    sutData->m_queueContainerReaders[pinnedIndex].store(0U);
+    EXPECT_FALSE(sut.isQueueReferenced(queueData.get()));
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovedQueueIsNotReferencedAfterCleanupOfATerminatedSender)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "38bb9f5a-2268-4706-937e-86638d7df1ea");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    sutData->m_queueContainerReaders[sutData->activeQueueContainerIndex()].store(1U);
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    EXPECT_TRUE(sut.isQueueReferenced(queueData.get()));
+
+    sut.cleanup();
+
+    EXPECT_FALSE(sut.isQueueReferenced(queueData.get()));
+}
+
+TYPED_TEST(ChunkDistributor_test, ModifyingQueuesWhileAllPreviousQueuesArePinnedFailsAfterTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "07e5a282-f43e-4c12-9ce1-1acb8dccb234");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    iox::optional<iox::PoshError> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&detectedError](const iox::PoshError error, const iox::ErrorLevel) { detectedError.emplace(error); });
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    const auto activeIndex = sutData->activeQueueContainerIndex();
+    for (auto& readers : sutData->m_queueContainerReaders)
+    {
+        readers.store(1U);
+    }
+
+    auto anotherQueueData = this->getChunkQueueData();
+    auto addResult = sut.tryAddQueue(anotherQueueData.get());
+    ASSERT_TRUE(addResult.has_error());
+    EXPECT_THAT(addResult.error(), Eq(ChunkDistributorError::NO_UNPINNED_QUEUE_CONTAINER));
+    auto removeResult = sut.tryRemoveQueue(queueData.get());
+    ASSERT_TRUE(removeResult.has_error());
+    EXPECT_THAT(removeResult.error(), Eq(ChunkDistributorError::NO_UNPINNED_QUEUE_CONTAINER));
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::PoshError::POPO__CHUNK_DISTRIBUTOR_NO_UNPINNED_QUEUE_CONTAINER));
+    EXPECT_THAT(sutData->activeQueueContainerIndex(), Eq(activeIndex));
+    EXPECT_TRUE(sut.isQueueReferenced(queueData.get()));
+    EXPECT_FALSE(sut.isQueueReferenced(anotherQueueData.get()));
+
+    sut.cleanup();
+    EXPECT_FALSE(sut.tryAddQueue(anotherQueueData.get()).has_error());
+}
+
 TYPED_TEST(ChunkDistributor_test, GetQueueIndexWithoutAddedQueueReturnsNoIndex)
 {
     ::testing::Test::RecordProperty("TEST_ID", "92a9e4a8-3964-4d34-b144-10024914ab0d");
@@ -352,6 +503,136 @@ TYPED_TEST(ChunkDistributor_test, GetQueueIndexWithPreviouslyAddedQueueRemovedRe
     EXPECT_FALSE(maybeIndex.has_value());
 }
 
+TYPED_TEST(ChunkDistributor_test, GetQueueHandleOfUnknownQueueReturnsNullopt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cfe58530-125c-4996-b6dd-a05781785c4e");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+
+    EXPECT_FALSE(sut.getQueueHandle(queueData->m_uniqueId).has_value());
+}
+
+TYPED_TEST(ChunkDistributor_test, QueueHandleStaysValidWhenAQueueInFrontIsRemoved)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a2175965-a7d9-4c3c-8390-b0e97cc156b6");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData1 = this->getChunkQueueData();
+    auto queueData2 = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData1.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+
+    auto maybeHandle = sut.getQueueHandle(queueData2->m_uniqueId);
+    ASSERT_TRUE(maybeHandle.has_value());
+
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData1.get()).has_error());
+
+    auto maybeHandleAfterRemove = sut.getQueueHandle(queueData2->m_uniqueId);
+    ASSERT_TRUE(maybeHandleAfterRemove.has_value());
+    EXPECT_THAT(*maybeHandleAfterRemove, Eq(*maybeHandle));
+
+    EXPECT_FALSE(sut.deliverToQueueWithHandle(queueData2->m_uniqueId, *maybeHandle, this->allocateChunk(7337))
+                     .has_error());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData2.get());
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_TRUE(maybeSharedChunk.has_value());
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(7337U));
+}
+
+TYPED_TEST(ChunkDistributor_test, QueueHandleOfRemovedQueueIsNotReusedForANewQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "156268ce-c539-48cd-ae74-cf27dab6de6d");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData1 = this->getChunkQueueData();
+    auto queueData2 = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData1.get()).has_error());
+    auto maybeStaleHandle = sut.getQueueHandle(queueData1->m_uniqueId);
+    ASSERT_TRUE(maybeStaleHandle.has_value());
+
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData1.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+
+    auto maybeNewHandle = sut.getQueueHandle(queueData2->m_uniqueId);
+    ASSERT_TRUE(maybeNewHandle.has_value());
+    EXPECT_THAT(*maybeNewHandle, Ne(*maybeStaleHandle));
+
+    auto result = sut.deliverToQueueWithHandle(queueData1->m_uniqueId, *maybeStaleHandle, this->allocateChunk(1));
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER));
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData2.get());
+    EXPECT_FALSE(queue.tryPop().has_value());
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToQueueWithInvalidHandleFallsBackToLookup)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "344b15ed-7ed1-4c9b-9540-2ce4c482d499");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData1 = this->getChunkQueueData();
+    auto queueData2 = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData1.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+
+    constexpr uint32_t INVALID_QUEUE_HANDLE{TestFixture::ChunkDistributor_t::INVALID_QUEUE_HANDLE};
+    auto chunk = this->allocateChunk(42);
+    EXPECT_FALSE(sut.deliverToQueueWithHandle(queueData2->m_uniqueId, INVALID_QUEUE_HANDLE, chunk).has_error());
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue1(queueData1.get());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue2(queueData2.get());
+    EXPECT_FALSE(queue1.tryPop().has_value());
+    auto maybeSharedChunk = queue2.tryPop();
+    ASSERT_TRUE(maybeSharedChunk.has_value());
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(42U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToQueueWithHandleOfOtherQueueFallsBackToLookup)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cfb27ce2-2868-4549-ae8d-f893d1aa5c2c");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData1 = this->getChunkQueueData();
+    auto queueData2 = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData1.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+    auto maybeHandle1 = sut.getQueueHandle(queueData1->m_uniqueId);
+    ASSERT_TRUE(maybeHandle1.has_value());
+
+    EXPECT_FALSE(sut.deliverToQueueWithHandle(queueData2->m_uniqueId, *maybeHandle1, this->allocateChunk(73))
+                     .has_error());
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue1(queueData1.get());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue2(queueData2.get());
+    EXPECT_FALSE(queue1.tryPop().has_value());
+    EXPECT_TRUE(queue2.tryPop().has_value());
+}
+
+TYPED_TEST(ChunkDistributor_test, RemoveAllQueuesInvalidatesAllQueueHandles)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ae5f5da4-e5e9-40ef-aee9-6ce00d9aafa0");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData1 = this->getChunkQueueData();
+    auto queueData2 = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData1.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+    auto maybeHandle = sut.getQueueHandle(queueData2->m_uniqueId);
+    ASSERT_TRUE(maybeHandle.has_value());
+
+    sut.removeAllQueues();
+
+    EXPECT_FALSE(sut.getQueueHandle(queueData1->m_uniqueId).has_value());
+    EXPECT_FALSE(sut.getQueueHandle(queueData2->m_uniqueId).has_value());
+    EXPECT_TRUE(sut.deliverToQueueWithHandle(queueData2->m_uniqueId, *maybeHandle, this->allocateChunk(1)).has_error());
+}
+
 TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithOneQueueDeliversOneChunk)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5bc10e0a-d67b-4123-887c-a50dc16cf680");
@@ -486,6 +767,124 @@ TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithMultipleQueuesMult
     EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToAllStoredQueuesWithMultipleQueuesDeliversAllChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "efa98a98-0bb6-4e30-baa8-af137b348b6a");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_QUEUES = 10U;
+    constexpr uint64_t NUMBER_OF_CHUNKS = 13U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+
+    std::vector<SharedChunk> chunks;
+    for (auto i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk(i * 34));
+    }
+
+    auto numberOfDeliveries = sut.deliverToAllStoredQueues(iox::span<SharedChunk>(chunks.data(), chunks.size()));
+    EXPECT_THAT(numberOfDeliveries, Eq(NUMBER_OF_QUEUES));
+
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData[i].get());
+        for (auto k = 0U; k < NUMBER_OF_CHUNKS; ++k)
+        {
+            auto maybeSharedChunk = queue.tryPop();
+            ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+            EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(k * 34u));
+        }
+        EXPECT_FALSE(queue.tryPop().has_value());
+    }
+    EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverEmptyBatchToAllStoredQueuesDeliversNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "181790e9-2507-4066-a69d-25d2cf8c580e");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    std::vector<SharedChunk> chunks;
+    auto numberOfDeliveries = sut.deliverToAllStoredQueues(iox::span<SharedChunk>(chunks.data(), chunks.size()));
+
+    EXPECT_THAT(numberOfDeliveries, Eq(0U));
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    EXPECT_FALSE(queue.tryPop().has_value());
+    EXPECT_THAT(sut.getHistorySize(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToAllStoredQueuesNotifiesEachQueueOnlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "191e2cb5-f59a-4105-8a0b-0d7535bcc896");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    ConditionVariableData condVar("Horscht");
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setConditionVariable(condVar, 0U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    // simulate a waiting listener, otherwise the notifier does not post the semaphore
+    condVar.m_numberOfWaiters.store(1U);
+
+    constexpr uint64_t NUMBER_OF_CHUNKS = 7U;
+    std::vector<SharedChunk> chunks;
+    for (auto i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk(i));
+    }
+
+    sut.deliverToAllStoredQueues(iox::span<SharedChunk>(chunks.data(), chunks.size()));
+
+    auto firstWakeup = condVar.m_semaphore->tryWait();
+    ASSERT_FALSE(firstWakeup.has_error());
+    EXPECT_TRUE(firstWakeup.value());
+    auto secondWakeup = condVar.m_semaphore->tryWait();
+    ASSERT_FALSE(secondWakeup.has_error());
+    EXPECT_FALSE(secondWakeup.value());
+    EXPECT_TRUE(condVar.isNotificationActive(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToAllStoredQueuesWithMoreChunksThanCapacityLeadsToLostChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c9032469-2f52-48a4-bbbf-0c9f18dd9711");
+    constexpr uint64_t QUEUE_CAPACITY{2U};
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(QUEUE_CAPACITY);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    std::vector<SharedChunk> chunks;
+    for (auto i = 0U; i < QUEUE_CAPACITY + 1U; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk(i));
+    }
+
+    auto numberOfDeliveries = sut.deliverToAllStoredQueues(iox::span<SharedChunk>(chunks.data(), chunks.size()));
+
+    EXPECT_THAT(numberOfDeliveries, Eq(1U));
+    EXPECT_TRUE(queue.hasLostChunks());
+    for (auto i = 1U; i < QUEUE_CAPACITY + 1U; ++i)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+    }
+}
+
 TYPED_TEST(ChunkDistributor_test, AddToHistoryWithoutQueues)
 {
     ::testing::Test::RecordProperty("TEST_ID", "1ed709b1-9129-454b-8440-50463ba1c02e");
@@ -725,32 +1124,135 @@ TYPED_TEST(ChunkDistributor_test, DeliverHistoryOnAddWithMoreThanAvailable)
     EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(3u));
 }
 
-TYPED_TEST(ChunkDistributor_test, DeliverToSingleQueueBlocksWhenOptionsAreSetToBlocking)
+TYPED_TEST(ChunkDistributor_test, HistoryOverflowEvictsTheOldestChunksAndReleasesThem)
 {
-    ::testing::Test::RecordProperty("TEST_ID", "c0500dec-bbd8-4958-9545-a14ef68108a1");
-    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    ::testing::Test::RecordProperty("TEST_ID", "d3281f01-94d0-4367-ac55-8e5bbdcb61d2");
+    auto sutData = this->getChunkDistributorData();
     typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    const uint64_t NUMBER_OF_EVICTED_CHUNKS{5U};
 
-    auto queueData =
-        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
-    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
-    queue.setCapacity(1U);
-
-    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
-    sut.deliverToAllStoredQueues(this->allocateChunk(155U));
-
-    Barrier isThreadStarted(1U);
-    std::atomic_bool wasChunkDelivered{false};
-    std::thread t1([&] {
-        isThreadStarted.notify();
-        sut.deliverToAllStoredQueues(this->allocateChunk(152U));
-        wasChunkDelivered = true;
-    });
+    for (uint64_t i = 0U; i < this->HISTORY_SIZE + NUMBER_OF_EVICTED_CHUNKS; ++i)
+    {
+        sut.deliverToAllStoredQueues(this->allocateChunk(i));
+    }
 
-    isThreadStarted.wait();
+    EXPECT_THAT(sut.getHistorySize(), Eq(this->HISTORY_SIZE));
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(this->HISTORY_SIZE));
 
-    std::this_thread::sleep_for(this->BLOCKING_DURATION);
-    EXPECT_THAT(wasChunkDelivered.load(), Eq(false));
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), this->HISTORY_SIZE).has_error());
+
+    EXPECT_THAT(queue.size(), Eq(this->HISTORY_SIZE));
+    for (uint64_t i = 0U; i < this->HISTORY_SIZE; ++i)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i + NUMBER_OF_EVICTED_CHUNKS));
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, ClearHistoryReleasesAllChunksOfTheHistory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bcb36f1b-122c-4bb1-81dd-14ab3483214f");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    for (uint64_t i = 0U; i < this->HISTORY_SIZE * 3U; ++i)
+    {
+        sut.deliverToAllStoredQueues(this->allocateChunk(i));
+    }
+    sut.clearHistory();
+
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+
+    sut.deliverToAllStoredQueues(this->allocateChunk(73));
+    EXPECT_THAT(sut.getHistorySize(), Eq(1U));
+}
+
+TYPED_TEST(ChunkDistributor_test, AddingQueuesWhileSendingWithHistoryDeliversNoChunkTwiceAndLeaksNoChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bf88a5c4-5565-4381-87f9-93909f031893");
+    constexpr uint32_t NUMBER_OF_QUEUE_ADDITIONS{50U};
+    // together with the history the chunks fit into the queue, hence no chunk is lost by an overflow
+    constexpr uint32_t CHUNKS_PER_QUEUE_ADDITION{64U};
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    std::atomic<uint32_t> chunksToSend{0U};
+    std::atomic_bool keepSending{true};
+    std::thread sender([&] {
+        uint64_t value{0U};
+        while (keepSending.load())
+        {
+            if (chunksToSend.load() == 0U)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            sut.deliverToAllStoredQueues(this->allocateChunk(value++));
+            chunksToSend.fetch_sub(1U);
+        }
+    });
+
+    for (uint32_t i = 0U; i < NUMBER_OF_QUEUE_ADDITIONS; ++i)
+    {
+        // RouDi and the sender push concurrently to the queue
+        auto queueData = this->getChunkQueueData(QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                                 VariantQueueTypes::SoFi_MultiProducerSingleConsumer);
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+        chunksToSend.store(CHUNKS_PER_QUEUE_ADDITION);
+        ASSERT_FALSE(sut.tryAddQueue(queueData.get(), this->HISTORY_SIZE).has_error());
+        while (chunksToSend.load() != 0U)
+        {
+            std::this_thread::yield();
+        }
+        ASSERT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+
+        // a chunk which is sent while the queue is added is received once, either from the history or from the sender
+        std::set<uint32_t> receivedValues;
+        for (auto maybeSharedChunk = queue.tryPop(); maybeSharedChunk.has_value(); maybeSharedChunk = queue.tryPop())
+        {
+            EXPECT_TRUE(receivedValues.insert(this->getSharedChunkValue(*maybeSharedChunk)).second);
+        }
+        ASSERT_FALSE(receivedValues.empty());
+        EXPECT_THAT(*receivedValues.rbegin(), Eq((i + 1U) * CHUNKS_PER_QUEUE_ADDITION - 1U));
+        EXPECT_THAT(receivedValues.size(), Eq(*receivedValues.rbegin() - *receivedValues.begin() + 1U));
+    }
+
+    keepSending.store(false);
+    sender.join();
+
+    sut.clearHistory();
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToSingleQueueBlocksWhenOptionsAreSetToBlocking)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c0500dec-bbd8-4958-9545-a14ef68108a1");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(155U));
+
+    Barrier isThreadStarted(1U);
+    std::atomic_bool wasChunkDelivered{false};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        sut.deliverToAllStoredQueues(this->allocateChunk(152U));
+        wasChunkDelivered = true;
+    });
+
+    isThreadStarted.wait();
+
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(false));
 
     auto maybeSharedChunk = queue.tryPop();
     ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
@@ -823,4 +1325,910 @@ TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBec
     }
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToBlockingQueueDeliversTheRemainingChunksInOrderWhenSpaceBecomesAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4c7e2b91-0d5a-4f38-a6e1-8b3f9c2d7e50");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto blockingQueueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> blockingQueue(blockingQueueData.get());
+    blockingQueue.setCapacity(2U);
+    ASSERT_FALSE(sut.tryAddQueue(blockingQueueData.get(), 0U).has_error());
+
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS = 4U;
+    std::vector<SharedChunk> chunks;
+    for (auto i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk(i * 73));
+    }
+
+    Barrier isThreadStarted(1U);
+    std::atomic_bool wasBatchDelivered{false};
+    uint64_t numberOfDeliveries{0U};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        numberOfDeliveries = sut.deliverToAllStoredQueues(iox::span<SharedChunk>(chunks.data(), chunks.size()));
+        wasBatchDelivered = true;
+    });
+
+    isThreadStarted.wait();
+
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_THAT(wasBatchDelivered.load(), Eq(false));
+    // the queue which does not block got the whole batch in the first pass
+    for (auto i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i * 73U));
+    }
+
+    for (auto i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = blockingQueue.tryPop();
+        while (!maybeSharedChunk.has_value())
+        {
+            std::this_thread::yield();
+            maybeSharedChunk = blockingQueue.tryPop();
+        }
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i * 73U));
+    }
+
+    t1.join();
+    EXPECT_THAT(wasBatchDelivered.load(), Eq(true));
+    EXPECT_THAT(numberOfDeliveries, Eq(2U));
+    EXPECT_FALSE(blockingQueue.tryPop().has_value());
+    EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TYPED_TEST(ChunkDistributor_test, BroadcastToAllStoredQueuesDeliversChunkToEveryQueueAndLeaksNoChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a05d8933-3f84-4088-8247-a6296b4eb0ba");
+    constexpr uint64_t BROADCAST_DELIVERY_THRESHOLD{1U};
+    auto sutData =
+        this->getChunkDistributorData(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, BROADCAST_DELIVERY_THRESHOLD);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_QUEUES = 10U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+
+    auto numberOfDeliveries = sut.deliverToAllStoredQueues(this->allocateChunk(7331U));
+    EXPECT_THAT(numberOfDeliveries, Eq(NUMBER_OF_QUEUES));
+
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData[i].get());
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(7331U));
+        EXPECT_FALSE(queue.tryPop().has_value());
+    }
+    EXPECT_THAT(sut.getHistorySize(), Eq(1U));
+
+    sut.clearHistory();
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, BroadcastWithQueueOverflowLeadsToLostChunkAndLeaksNoChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "08db0809-c907-422b-b04b-8bcca5961e3c");
+    constexpr uint64_t BROADCAST_DELIVERY_THRESHOLD{1U};
+    constexpr uint64_t QUEUE_CAPACITY{2U};
+    auto sutData =
+        this->getChunkDistributorData(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, BROADCAST_DELIVERY_THRESHOLD);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_QUEUES = 3U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>(queueData.back().get()).setCapacity(QUEUE_CAPACITY);
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+
+    for (auto i = 0U; i < QUEUE_CAPACITY + 1U; ++i)
+    {
+        EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(i)), Eq(NUMBER_OF_QUEUES));
+    }
+
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData[i].get());
+        EXPECT_TRUE(queue.hasLostChunks());
+        for (auto k = 1U; k < QUEUE_CAPACITY + 1U; ++k)
+        {
+            auto maybeSharedChunk = queue.tryPop();
+            ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+            EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(k));
+        }
+    }
+
+    sut.clearHistory();
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, BroadcastWakesUpSharedConditionVariableOnlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "027b1f90-d397-4432-aa51-2a0cd2f5f507");
+    constexpr uint64_t BROADCAST_DELIVERY_THRESHOLD{1U};
+    auto sutData =
+        this->getChunkDistributorData(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, BROADCAST_DELIVERY_THRESHOLD);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    ConditionVariableData condVar("Horscht");
+    constexpr uint64_t NUMBER_OF_QUEUES = 4U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>(queueData.back().get())
+            .setConditionVariable(condVar, i);
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+    // simulate a waiting listener, otherwise the notifier does not post the semaphore
+    condVar.m_numberOfWaiters.store(1U);
+
+    sut.deliverToAllStoredQueues(this->allocateChunk(42U));
+
+    auto firstWakeup = condVar.m_semaphore->tryWait();
+    ASSERT_FALSE(firstWakeup.has_error());
+    EXPECT_TRUE(firstWakeup.value());
+    auto secondWakeup = condVar.m_semaphore->tryWait();
+    ASSERT_FALSE(secondWakeup.has_error());
+    EXPECT_FALSE(secondWakeup.value());
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        EXPECT_TRUE(condVar.isNotificationActive(i));
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, BroadcastWakesUpEveryConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f9477e87-5cdf-423e-8da2-038c67deddef");
+    constexpr uint64_t BROADCAST_DELIVERY_THRESHOLD{1U};
+    auto sutData =
+        this->getChunkDistributorData(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, BROADCAST_DELIVERY_THRESHOLD);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_QUEUES = 3U;
+    std::vector<std::unique_ptr<ConditionVariableData>> condVars;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        condVars.emplace_back(new ConditionVariableData("Horscht"));
+        condVars.back()->m_numberOfWaiters.store(1U);
+        queueData.emplace_back(this->getChunkQueueData());
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>(queueData.back().get())
+            .setConditionVariable(*condVars.back(), 0U);
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+
+    sut.deliverToAllStoredQueues(this->allocateChunk(42U));
+
+    for (auto& condVar : condVars)
+    {
+        auto wakeup = condVar->m_semaphore->tryWait();
+        ASSERT_FALSE(wakeup.has_error());
+        EXPECT_TRUE(wakeup.value());
+        EXPECT_TRUE(condVar->isNotificationActive(0U));
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, BroadcastWakesUpEveryConditionVariableOnceAfterTheConditionVariablesChanged)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3451186f-c14b-47d9-8e0b-85f7b475e3dd");
+    constexpr uint64_t BROADCAST_DELIVERY_THRESHOLD{1U};
+    auto sutData =
+        this->getChunkDistributorData(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, BROADCAST_DELIVERY_THRESHOLD);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    ConditionVariableData condVarA("Horscht");
+    ConditionVariableData condVarB("Hypnotoad");
+    constexpr uint64_t NUMBER_OF_QUEUES = 4U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>(queueData.back().get())
+            .setConditionVariable((i < NUMBER_OF_QUEUES / 2U) ? condVarA : condVarB, i);
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+    sut.deliverToAllStoredQueues(this->allocateChunk(42U));
+
+    // the queues are no longer grouped by their condition variable in the order of the first broadcast
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>(queueData[1U].get()).unsetConditionVariable();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>(queueData[1U].get()).setConditionVariable(condVarB, 1U);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>(queueData[2U].get()).unsetConditionVariable();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>(queueData[2U].get()).setConditionVariable(condVarA, 2U);
+    // simulate waiting listeners, otherwise the notifier does not post the semaphore
+    condVarA.m_numberOfWaiters.store(1U);
+    condVarB.m_numberOfWaiters.store(1U);
+
+    sut.deliverToAllStoredQueues(this->allocateChunk(73U));
+
+    for (auto condVar : {&condVarA, &condVarB})
+    {
+        auto firstWakeup = condVar->m_semaphore->tryWait();
+        ASSERT_FALSE(firstWakeup.has_error());
+        EXPECT_TRUE(firstWakeup.value());
+        auto secondWakeup = condVar->m_semaphore->tryWait();
+        ASSERT_FALSE(secondWakeup.has_error());
+        EXPECT_FALSE(secondWakeup.value());
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, BroadcastToFullQueueWhichDropsTheChunkDoesNotActivateItsNotification)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a8704c12-7dd0-4719-ad41-6e9c74ebde0e");
+    constexpr uint64_t BROADCAST_DELIVERY_THRESHOLD{1U};
+    constexpr uint64_t QUEUE_CAPACITY{1U};
+    auto sutData =
+        this->getChunkDistributorData(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, BROADCAST_DELIVERY_THRESHOLD);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    ConditionVariableData condVar("Horscht");
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(QUEUE_CAPACITY);
+    queue.setConditionVariable(condVar, 0U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    sut.deliverToAllStoredQueues(this->allocateChunk(42U));
+    EXPECT_TRUE(condVar.isNotificationActive(0U));
+    // the consumer handles the notification but not yet the chunk
+    condVar.m_activeNotifications[0U].store(0U);
+
+    sut.deliverToAllStoredQueues(this->allocateChunk(73U));
+
+    EXPECT_TRUE(queue.hasLostChunks());
+    EXPECT_FALSE(condVar.isNotificationActive(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, BroadcastWithDeliveryHelperDeliversAllChunksToEveryQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9a94da9d-fbb1-45c7-bd56-f3cb4ca7f228");
+    constexpr uint64_t BROADCAST_DELIVERY_THRESHOLD{1U};
+    auto sutData =
+        this->getChunkDistributorData(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, BROADCAST_DELIVERY_THRESHOLD);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    DeliveryHelper deliveryHelper;
+    sut.setDeliveryHelper(&deliveryHelper);
+
+    constexpr uint64_t NUMBER_OF_QUEUES = 11U;
+    constexpr uint64_t NUMBER_OF_CHUNKS = 13U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+
+    for (auto i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(i * 34U)), Eq(NUMBER_OF_QUEUES));
+    }
+
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData[i].get());
+        for (auto k = 0U; k < NUMBER_OF_CHUNKS; ++k)
+        {
+            auto maybeSharedChunk = queue.tryPop();
+            ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+            EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(k * 34U));
+        }
+        EXPECT_FALSE(queue.tryPop().has_value());
+    }
+    sut.setDeliveryHelper(nullptr);
+}
+
+TYPED_TEST(ChunkDistributor_test, BroadcastToBlockingQueuesWaitsUntilThereIsSpaceAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7f0044b1-92c1-4a69-be0f-20837ab6cfa6");
+    constexpr uint64_t BROADCAST_DELIVERY_THRESHOLD{1U};
+    auto sutData =
+        this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER, BROADCAST_DELIVERY_THRESHOLD);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_QUEUES = 2U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueDatas;
+    std::vector<ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>> queues;
+    for (uint64_t i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueDatas.emplace_back(this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER,
+                                                        VariantQueueTypes::FiFo_MultiProducerSingleConsumer));
+        queues.emplace_back(queueDatas.back().get());
+        queues.back().setCapacity(1U);
+        ASSERT_FALSE(sut.tryAddQueue(queueDatas.back().get(), 0U).has_error());
+    }
+
+    sut.deliverToAllStoredQueues(this->allocateChunk(425U));
+
+    Barrier isThreadStarted(1U);
+    std::atomic_bool wasChunkDelivered{false};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        sut.deliverToAllStoredQueues(this->allocateChunk(1152U));
+        wasChunkDelivered = true;
+    });
+
+    isThreadStarted.wait();
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(false));
+
+    for (auto& queue : queues)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(425U));
+    }
+
+    t1.join();
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(true));
+    for (auto& queue : queues)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(1152U));
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovingFullBlockingQueueWakesUpTheWaitingSender)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a8e27cc8-0b1c-4570-a4f8-83cdb8aef803");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(155U));
+
+    Barrier isThreadStarted(1U);
+    std::atomic_bool wasChunkDelivered{false};
+    uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        numberOfQueuesTheChunkWasDeliveredTo = sut.deliverToAllStoredQueues(this->allocateChunk(152U));
+        wasChunkDelivered = true;
+    });
+
+    isThreadStarted.wait();
+
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(false));
+
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+
+    t1.join();
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(true));
+    EXPECT_THAT(numberOfQueuesTheChunkWasDeliveredTo, Eq(0U));
+
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(155U));
+    EXPECT_FALSE(queue.tryPop().has_value());
+}
+
+TYPED_TEST(ChunkDistributor_test, BlockedDeliveryToAllStoredQueuesIsRecordedInBlockedTimeStatistics)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "312de2ec-169d-4e79-a213-4f8e8453b730");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(155U));
+    EXPECT_THAT(sut.getBlockedTimeStatistics().numberOfBlockedDeliveries, Eq(0U));
+
+    Barrier isThreadStarted(1U);
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        sut.deliverToAllStoredQueues(this->allocateChunk(152U));
+    });
+
+    isThreadStarted.wait();
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_TRUE(queue.tryPop().has_value());
+    t1.join();
+
+    const auto statistics = sut.getBlockedTimeStatistics();
+    EXPECT_THAT(statistics.numberOfBlockedDeliveries, Eq(1U));
+    EXPECT_THAT(statistics.maxBlockedTime, Eq(statistics.totalBlockedTime));
+    EXPECT_THAT(statistics.maxBlockedTime.toMilliseconds(), Ge(this->BLOCKING_DURATION.count() / 2));
+    EXPECT_THAT(statistics.histogram[BlockedTimeStatisticsData::bucketOf(statistics.maxBlockedTime)], Eq(1U));
+}
+
+TYPED_TEST(ChunkDistributor_test, BlockedDeliveryToSingleQueueIsRecordedInBlockedTimeStatistics)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d6417230-c5c5-49ed-a49a-b41088ab8161");
+    constexpr uint32_t EXPECTED_QUEUE_INDEX{0U};
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    ASSERT_FALSE(
+        sut.deliverToQueue(queueData->m_uniqueId, EXPECTED_QUEUE_INDEX, this->allocateChunk(155U)).has_error());
+
+    Barrier isThreadStarted(1U);
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        EXPECT_FALSE(
+            sut.deliverToQueue(queueData->m_uniqueId, EXPECTED_QUEUE_INDEX, this->allocateChunk(152U)).has_error());
+    });
+
+    isThreadStarted.wait();
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_TRUE(queue.tryPop().has_value());
+    t1.join();
+
+    const auto statistics = sut.getBlockedTimeStatistics();
+    EXPECT_THAT(statistics.numberOfBlockedDeliveries, Eq(1U));
+    EXPECT_THAT(statistics.maxBlockedTime.toMilliseconds(), Ge(this->BLOCKING_DURATION.count() / 2));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliveryWithoutFullQueueIsNotRecordedInBlockedTimeStatistics)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cee61f5e-d9b2-4ae7-a576-8f1707d37a8b");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{10U};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(i)), Eq(1U));
+    }
+
+    const auto statistics = sut.getBlockedTimeStatistics();
+    EXPECT_THAT(statistics.numberOfBlockedDeliveries, Eq(0U));
+    EXPECT_THAT(statistics.totalBlockedTime, Eq(iox::units::Duration::zero()));
+}
+
+TYPED_TEST(ChunkDistributor_test, ChunkRingDeliversEveryChunkToEveryQueueAndLeaksNoChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0ec93229-5963-46fc-8741-ff6319a0a050");
+    constexpr uint64_t CHUNK_RING_CAPACITY{4U};
+    auto sutData = this->getChunkDistributorDataWithChunkRing(CHUNK_RING_CAPACITY);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    EXPECT_TRUE(sut.isChunkRingEnabled());
+
+    constexpr uint64_t NUMBER_OF_QUEUES = 3U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(1U)), Eq(NUMBER_OF_QUEUES));
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(2U)), Eq(NUMBER_OF_QUEUES));
+    EXPECT_THAT(sut.getHistorySize(), Eq(0U));
+
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData[i].get());
+        EXPECT_THAT(queue.size(), Eq(2U));
+        for (auto k = 1U; k <= 2U; ++k)
+        {
+            auto maybeSharedChunk = queue.tryPop();
+            ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+            EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(k));
+        }
+        EXPECT_FALSE(queue.tryPop().has_value());
+        EXPECT_TRUE(queue.empty());
+        EXPECT_FALSE(queue.hasLostChunks());
+    }
+    // the ring holds the only reference of the delivered chunks
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(2U));
+
+    sut.removeAllQueues();
+    sut.cleanup();
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, ChunkRingWithSlowQueueLeadsToLostChunksAndDeliversTheLatestChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d15ed78-7ffb-42b1-b4cf-48fad1c0ef8c");
+    constexpr uint64_t CHUNK_RING_CAPACITY{2U};
+    auto sutData = this->getChunkDistributorDataWithChunkRing(CHUNK_RING_CAPACITY);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    for (auto i = 0U; i < CHUNK_RING_CAPACITY + 3U; ++i)
+    {
+        sut.deliverToAllStoredQueues(this->allocateChunk(i));
+    }
+
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(CHUNK_RING_CAPACITY));
+    EXPECT_THAT(queue.size(), Eq(CHUNK_RING_CAPACITY));
+    for (auto i = 3U; i < CHUNK_RING_CAPACITY + 3U; ++i)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+    }
+    EXPECT_TRUE(queue.hasLostChunks());
+}
+
+TYPED_TEST(ChunkDistributor_test, ChunkRingDeliversRequestedHistoryToNewQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2dd5430d-dbb3-435b-9fc9-97d4c89302c8");
+    constexpr uint64_t CHUNK_RING_CAPACITY{4U};
+    auto sutData = this->getChunkDistributorDataWithChunkRing(CHUNK_RING_CAPACITY);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    for (auto i = 0U; i < 3U; ++i)
+    {
+        sut.deliverToAllStoredQueues(this->allocateChunk(i));
+    }
+
+    ConditionVariableData condVar("Horscht");
+    condVar.m_numberOfWaiters.store(1U);
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setConditionVariable(condVar, 0U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 2U).has_error());
+
+    EXPECT_TRUE(condVar.isNotificationActive(0U));
+    EXPECT_THAT(queue.size(), Eq(2U));
+    for (auto i = 1U; i < 3U; ++i)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+    }
+    EXPECT_FALSE(queue.hasLostChunks());
+}
+
+TYPED_TEST(ChunkDistributor_test, ChunkRingNotifiesEveryStoredQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d708e0db-0698-47e6-8db3-df6605487e4a");
+    constexpr uint64_t CHUNK_RING_CAPACITY{4U};
+    auto sutData = this->getChunkDistributorDataWithChunkRing(CHUNK_RING_CAPACITY);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    ConditionVariableData condVar("Horscht");
+    constexpr uint64_t NUMBER_OF_QUEUES = 3U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>(queueData.back().get())
+            .setConditionVariable(condVar, i);
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        EXPECT_FALSE(condVar.isNotificationActive(i));
+    }
+
+    sut.deliverToAllStoredQueues(this->allocateChunk(42U));
+
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        EXPECT_TRUE(condVar.isNotificationActive(i));
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovedQueueIsDetachedFromChunkRing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b1e36b9a-3979-4812-bbc1-c9c31308f9ec");
+    constexpr uint64_t CHUNK_RING_CAPACITY{4U};
+    auto sutData = this->getChunkDistributorDataWithChunkRing(CHUNK_RING_CAPACITY);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(1U));
+    EXPECT_THAT(queue.size(), Eq(1U));
+
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.tryPop().has_value());
+}
+
+TYPED_TEST(ChunkDistributor_test, QueueAttachedToChunkRingReceivesChunksOfSenderWithoutChunkRing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c9b05014-9bd9-4f55-ad89-03af0d5d8437");
+    constexpr uint64_t CHUNK_RING_CAPACITY{4U};
+    auto ringSenderData = this->getChunkDistributorDataWithChunkRing(CHUNK_RING_CAPACITY);
+    typename TestFixture::ChunkDistributor_t ringSender(ringSenderData.get());
+    auto queueSenderData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t queueSender(queueSenderData.get());
+
+    auto queueData = this->getChunkQueueData(QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                             VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(ringSender.tryAddQueue(queueData.get()).has_error());
+    ASSERT_FALSE(queueSender.tryAddQueue(queueData.get()).has_error());
+
+    ringSender.deliverToAllStoredQueues(this->allocateChunk(1U));
+    queueSender.deliverToAllStoredQueues(this->allocateChunk(2U));
+    ringSender.deliverToAllStoredQueues(this->allocateChunk(3U));
+    EXPECT_THAT(queue.size(), Eq(3U));
+
+    std::set<uint32_t> receivedValues;
+    while (auto maybeSharedChunk = queue.tryPop())
+    {
+        receivedValues.insert(this->getSharedChunkValue(*maybeSharedChunk));
+    }
+    EXPECT_THAT(receivedValues, Eq(std::set<uint32_t>{1U, 2U, 3U}));
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.hasLostChunks());
+
+    ringSender.removeAllQueues();
+    queueSender.removeAllQueues();
+    ringSender.cleanup();
+    queueSender.cleanup();
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, QueueReadsFromTheChunkRingsOfMultipleSenders)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7d5f6b4c-d407-4263-b7e8-06a99f6035bb");
+    constexpr uint64_t CHUNK_RING_CAPACITY{4U};
+    auto sutData1 = this->getChunkDistributorDataWithChunkRing(CHUNK_RING_CAPACITY);
+    typename TestFixture::ChunkDistributor_t sut1(sutData1.get());
+    auto sutData2 = this->getChunkDistributorDataWithChunkRing(CHUNK_RING_CAPACITY);
+    typename TestFixture::ChunkDistributor_t sut2(sutData2.get());
+
+    auto queueData1 = this->getChunkQueueData();
+    auto queueData2 = this->getChunkQueueData();
+    for (auto& queueData : {queueData1, queueData2})
+    {
+        ASSERT_FALSE(sut1.tryAddQueue(queueData.get()).has_error());
+        ASSERT_FALSE(sut2.tryAddQueue(queueData.get()).has_error());
+    }
+
+    sut1.deliverToAllStoredQueues(this->allocateChunk(11U));
+    sut2.deliverToAllStoredQueues(this->allocateChunk(21U));
+    sut1.deliverToAllStoredQueues(this->allocateChunk(12U));
+    sut2.deliverToAllStoredQueues(this->allocateChunk(22U));
+
+    for (auto& queueData : {queueData1, queueData2})
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+        EXPECT_THAT(queue.size(), Eq(4U));
+
+        std::vector<uint32_t> receivedValues;
+        while (auto maybeSharedChunk = queue.tryPop())
+        {
+            receivedValues.emplace_back(this->getSharedChunkValue(*maybeSharedChunk));
+        }
+        // the chunks of each sender are received in order and no sender is starved
+        EXPECT_THAT(receivedValues, ElementsAre(11U, 21U, 12U, 22U));
+        EXPECT_FALSE(queue.hasLostChunks());
+    }
+
+    sut1.removeAllQueues();
+    sut2.removeAllQueues();
+    sut1.cleanup();
+    sut2.cleanup();
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovingOneChunkRingSenderKeepsTheQueueAttachedToTheOtherOne)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d3200b7e-0af8-45b5-8d6a-5aed7485851d");
+    constexpr uint64_t CHUNK_RING_CAPACITY{4U};
+    auto sutData1 = this->getChunkDistributorDataWithChunkRing(CHUNK_RING_CAPACITY);
+    typename TestFixture::ChunkDistributor_t sut1(sutData1.get());
+    auto sutData2 = this->getChunkDistributorDataWithChunkRing(CHUNK_RING_CAPACITY);
+    typename TestFixture::ChunkDistributor_t sut2(sutData2.get());
+
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut1.tryAddQueue(queueData.get()).has_error());
+    ASSERT_FALSE(sut2.tryAddQueue(queueData.get()).has_error());
+    sut1.deliverToAllStoredQueues(this->allocateChunk(1U));
+
+    ASSERT_FALSE(sut1.tryRemoveQueue(queueData.get()).has_error());
+    EXPECT_FALSE(queue.isChunkRingReferenced(sutData1->m_chunkRing));
+    EXPECT_TRUE(queue.isChunkRingReferenced(sutData2->m_chunkRing));
+
+    sut2.deliverToAllStoredQueues(this->allocateChunk(2U));
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(2U));
+    EXPECT_FALSE(queue.tryPop().has_value());
+}
+
+TYPED_TEST(ChunkDistributor_test, AddingQueueToMoreChunkRingsThanSupportedFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a83af8ad-94a8-401b-8724-c8a204c28133");
+    constexpr uint64_t CHUNK_RING_CAPACITY{1U};
+    iox::optional<iox::PoshError> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&detectedError](const iox::PoshError error, const iox::ErrorLevel) { detectedError.emplace(error); });
+
+    auto queueData = this->getChunkQueueData();
+    std::vector<std::shared_ptr<typename TestFixture::ChunkDistributorData_t>> sutData;
+    for (auto i = 0U; i < iox::MAX_CHUNK_RINGS_PER_SUBSCRIBER; ++i)
+    {
+        sutData.emplace_back(this->getChunkDistributorDataWithChunkRing(CHUNK_RING_CAPACITY));
+        typename TestFixture::ChunkDistributor_t sut(sutData.back().get());
+        ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    }
+
+    auto sutDataOverflow = this->getChunkDistributorDataWithChunkRing(CHUNK_RING_CAPACITY);
+    typename TestFixture::ChunkDistributor_t sut(sutDataOverflow.get());
+    auto result = sut.tryAddQueue(queueData.get());
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(ChunkDistributorError::CHUNK_RING_ATTACHMENT_OVERFLOW));
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::PoshError::POPO__CHUNK_DISTRIBUTOR_OVERFLOW_OF_CHUNK_RING_ATTACHMENTS));
+    EXPECT_FALSE(sut.hasStoredQueues());
+}
+
+TYPED_TEST(ChunkDistributor_test, DetachedChunkRingStaysReferencedWhileTheReaderPinsIt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "30d2660d-11a5-4c2b-a10c-15a8d510893b");
+    constexpr uint64_t CHUNK_RING_CAPACITY{4U};
+    auto sutData = this->getChunkDistributorDataWithChunkRing(CHUNK_RING_CAPACITY);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    // simulates a reader which is preempted while it reads from the chunk ring
+    auto& attachment = queueData->m_chunkRings[0U];
+    ASSERT_TRUE(attachment.m_isAttached.load());
+    attachment.m_readers.store(1U);
+
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    EXPECT_TRUE(queue.isChunkRingReferenced(sutData->m_chunkRing));
+
+    // a pinned attachment is not reused
+    auto anotherSutData = this->getChunkDistributorDataWithChunkRing(CHUNK_RING_CAPACITY);
+    typename TestFixture::ChunkDistributor_t anotherSut(anotherSutData.get());
+    ASSERT_FALSE(anotherSut.tryAddQueue(queueData.get()).has_error());
+    EXPECT_THAT(attachment.m_chunkRing.get(), Eq(&sutData->m_chunkRing));
+
+    attachment.m_readers.store(0U);
+    EXPECT_FALSE(queue.isChunkRingReferenced(sutData->m_chunkRing));
+}
+
+TYPED_TEST(ChunkDistributor_test, ConcurrentChunkRingSendersAndQueueSenderDeliverAllChunksToTheReader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0192357c-d78e-431a-b0c1-a5e340733e0e");
+    constexpr uint64_t CHUNK_RING_CAPACITY{iox::MAX_PUBLISHER_HISTORY};
+    constexpr uint32_t NUMBER_OF_CHUNKS_PER_SENDER{200U};
+    constexpr uint32_t NUMBER_OF_SENDERS{3U};
+    auto ringSenderData1 = this->getChunkDistributorDataWithChunkRing(CHUNK_RING_CAPACITY);
+    auto ringSenderData2 = this->getChunkDistributorDataWithChunkRing(CHUNK_RING_CAPACITY);
+    auto queueSenderData = this->getChunkDistributorData();
+    std::vector<typename TestFixture::ChunkDistributorData_t*> senderData{
+        ringSenderData1.get(), ringSenderData2.get(), queueSenderData.get()};
+
+    auto queueData = this->getChunkQueueData(QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                             VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    for (auto data : senderData)
+    {
+        typename TestFixture::ChunkDistributor_t sender(data);
+        ASSERT_FALSE(sender.tryAddQueue(queueData.get()).has_error());
+    }
+
+    // every sender waits until the reader received its previous chunk, hence no chunk is lost
+    std::atomic<uint32_t> receivedChunksOfSender[NUMBER_OF_SENDERS];
+    for (auto& receivedChunks : receivedChunksOfSender)
+    {
+        receivedChunks.store(0U);
+    }
+    std::vector<std::thread> senders;
+    for (uint32_t senderIndex = 0U; senderIndex < NUMBER_OF_SENDERS; ++senderIndex)
+    {
+        senders.emplace_back([&, senderIndex] {
+            typename TestFixture::ChunkDistributor_t sender(senderData[senderIndex]);
+            for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS_PER_SENDER; ++i)
+            {
+                sender.deliverToAllStoredQueues(this->allocateChunk(senderIndex * NUMBER_OF_CHUNKS_PER_SENDER + i));
+                while (receivedChunksOfSender[senderIndex].load() <= i)
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    uint32_t numberOfReceivedChunks{0U};
+    std::vector<uint32_t> lastValueOfSender(NUMBER_OF_SENDERS, 0U);
+    while (numberOfReceivedChunks < NUMBER_OF_SENDERS * NUMBER_OF_CHUNKS_PER_SENDER)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        if (!maybeSharedChunk.has_value())
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        const auto value = this->getSharedChunkValue(*maybeSharedChunk);
+        const auto senderIndex = value / NUMBER_OF_CHUNKS_PER_SENDER;
+        ASSERT_THAT(senderIndex, Lt(NUMBER_OF_SENDERS));
+        if (receivedChunksOfSender[senderIndex].load() > 0U)
+        {
+            EXPECT_THAT(value, Gt(lastValueOfSender[senderIndex]));
+        }
+        lastValueOfSender[senderIndex] = value;
+        ++receivedChunksOfSender[senderIndex];
+        ++numberOfReceivedChunks;
+    }
+
+    for (auto& sender : senders)
+    {
+        sender.join();
+    }
+    EXPECT_FALSE(queue.hasLostChunks());
+    for (auto& receivedChunks : receivedChunksOfSender)
+    {
+        EXPECT_THAT(receivedChunks.load(), Eq(NUMBER_OF_CHUNKS_PER_SENDER));
+    }
+
+    for (auto data : senderData)
+    {
+        typename TestFixture::ChunkDistributor_t sender(data);
+        sender.removeAllQueues();
+        sender.cleanup();
+    }
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, ChunkRingWithBatchDeliveryDeliversAllChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "af6cdf44-e7aa-4a1f-8d8c-821be70ccddc");
+    constexpr uint64_t CHUNK_RING_CAPACITY{4U};
+    auto sutData = this->getChunkDistributorDataWithChunkRing(CHUNK_RING_CAPACITY);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    SharedChunk chunks[] = {this->allocateChunk(5U), this->allocateChunk(6U), this->allocateChunk(7U)};
+    EXPECT_THAT(sut.deliverToAllStoredQueues(iox::span<SharedChunk>(chunks)), Eq(1U));
+
+    for (auto i = 5U; i <= 7U; ++i)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+    }
+    EXPECT_FALSE(queue.tryPop().has_value());
+}
+
 } // namespace
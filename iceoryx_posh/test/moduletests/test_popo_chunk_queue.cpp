@@ -328,6 +328,39 @@ TYPED_TEST(ChunkQueueFiFo_test, PushFull)
     EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
 }
 
+TYPED_TEST(ChunkQueueFiFo_test, PushOrWaitForSpaceConsumesOnlyOneWakeUpOfTheWaitingProducers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d20b29c3-94e9-420e-b56f-29d93112c356");
+    using ChunkQueueData_t = typename TestFixture::ChunkQueueData_t;
+    ChunkQueueData_t chunkData{QueueFullPolicy::BLOCK_PRODUCER,
+                               iox::cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer};
+    ChunkQueuePopper<ChunkQueueData_t> popper{&chunkData};
+    ChunkQueuePusher<ChunkQueueData_t> pusher{&chunkData};
+    for (auto i = 0U; i < iox::MAX_SUBSCRIBER_QUEUE_CAPACITY; ++i)
+    {
+        EXPECT_TRUE(pusher.push(this->allocateChunk()));
+    }
+
+    // another producer waits for space and is woken up by each pop
+    chunkData.m_numberOfWaitingProducers.store(1U);
+    EXPECT_TRUE(popper.tryPop().has_value());
+    EXPECT_TRUE(popper.tryPop().has_value());
+    EXPECT_TRUE(pusher.push(this->allocateChunk()));
+    EXPECT_TRUE(pusher.push(this->allocateChunk()));
+
+    EXPECT_FALSE(pusher.pushOrWaitForSpace(this->allocateChunk(), 0_ms));
+
+    // the wake-up of the other producer is still pending
+    EXPECT_TRUE(chunkData.m_waitingProducerSemaphore->tryWait().value_or(false));
+    EXPECT_FALSE(chunkData.m_waitingProducerSemaphore->tryWait().value_or(true));
+
+    chunkData.m_numberOfWaitingProducers.store(0U);
+    while (popper.tryPop().has_value())
+    {
+    }
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+}
+
 /// @note this could be changed to a parameterized ChunkQueueOverflowingFIFO_test when there are more FIFOs available
 using ChunkQueueSoFiSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
 
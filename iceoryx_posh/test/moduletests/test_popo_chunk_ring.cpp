@@ -0,0 +1,302 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_ring_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_ring_reader.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_ring_writer.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::mepoo;
+
+class ChunkRing_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        MePooConfig mempoolconf;
+        mempoolconf.addMemPool({CHUNK_SIZE, NUM_CHUNKS_IN_POOL});
+        memoryManager.configureMemoryManager(mempoolconf, m_memoryAllocator, m_memoryAllocator);
+    }
+
+    SharedChunk getChunkWithValue(const uint64_t value)
+    {
+        auto chunkSettingsResult = ChunkSettings::create(sizeof(uint64_t), alignof(uint64_t));
+        iox::cxx::Ensures(chunkSettingsResult.has_value());
+
+        auto getChunkResult = memoryManager.getChunk(chunkSettingsResult.value());
+        iox::cxx::Ensures(getChunkResult.has_value());
+        *static_cast<uint64_t*>(getChunkResult.value().getUserPayload()) = value;
+        return getChunkResult.value();
+    }
+
+    static uint64_t getValue(const SharedChunk& chunk)
+    {
+        return *static_cast<const uint64_t*>(chunk.getUserPayload());
+    }
+
+    uint64_t getNumberOfUsedChunks()
+    {
+        return memoryManager.getMemPoolInfo(0).m_usedChunks;
+    }
+
+    void writeChunks(const uint64_t firstValue, const uint64_t numberOfChunks)
+    {
+        for (uint64_t i = 0U; i < numberOfChunks; ++i)
+        {
+            writer.write(getChunkWithValue(firstValue + i));
+        }
+    }
+
+    static constexpr uint64_t CAPACITY{4U};
+    static constexpr uint32_t NUM_CHUNKS_IN_POOL{20U};
+    static constexpr uint32_t CHUNK_SIZE{128U};
+
+    iox::mepoo::MemoryManager memoryManager;
+    ChunkRingSlot slots[CAPACITY];
+    ChunkRingData chunkRingData{slots, CAPACITY};
+    ChunkRingWriter writer{&chunkRingData};
+    ChunkRingReader reader{&chunkRingData};
+
+  private:
+    static constexpr size_t KILOBYTE = 1 << 10;
+    static constexpr size_t MEMORY_SIZE = 100 * KILOBYTE;
+    std::unique_ptr<char[]> m_memory{new char[MEMORY_SIZE]};
+
+    iox::BumpAllocator m_memoryAllocator{m_memory.get(), MEMORY_SIZE};
+};
+
+constexpr uint64_t ChunkRing_test::CAPACITY;
+
+TEST_F(ChunkRing_test, ReadFromEmptyRingReturnsNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8b0c9f7e-3f1d-4a47-9c3e-2f5e7a61b0d4");
+    uint64_t cursor{0U};
+    bool hasLostChunks{false};
+
+    EXPECT_FALSE(reader.tryRead(cursor, hasLostChunks).has_value());
+    EXPECT_THAT(cursor, Eq(0U));
+    EXPECT_FALSE(hasLostChunks);
+    EXPECT_THAT(reader.getNumberOfUnreadChunks(cursor), Eq(0U));
+}
+
+TEST_F(ChunkRing_test, WrittenChunksAreReadInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d2a6e43c-51a8-4c0e-b1b3-7f93c8e2a5f1");
+    writeChunks(10U, CAPACITY);
+
+    uint64_t cursor{0U};
+    bool hasLostChunks{false};
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        EXPECT_THAT(reader.getNumberOfUnreadChunks(cursor), Eq(CAPACITY - i));
+        auto maybeChunk = reader.tryRead(cursor, hasLostChunks);
+        ASSERT_TRUE(maybeChunk.has_value());
+        EXPECT_THAT(getValue(*maybeChunk), Eq(10U + i));
+    }
+    EXPECT_FALSE(reader.tryRead(cursor, hasLostChunks).has_value());
+    EXPECT_THAT(cursor, Eq(CAPACITY));
+    EXPECT_FALSE(hasLostChunks);
+}
+
+TEST_F(ChunkRing_test, ReadersHaveIndependentCursors)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4f7d0b2e-96c5-4e1a-8a0d-5b3c1e9f72a6");
+    writeChunks(0U, 2U);
+
+    uint64_t cursorA{0U};
+    uint64_t cursorB{0U};
+    bool hasLostChunks{false};
+
+    auto chunkA = reader.tryRead(cursorA, hasLostChunks);
+    auto chunkB = reader.tryRead(cursorB, hasLostChunks);
+    ASSERT_TRUE(chunkA.has_value());
+    ASSERT_TRUE(chunkB.has_value());
+    EXPECT_THAT(*chunkA, Eq(*chunkB));
+    EXPECT_THAT(reader.getNumberOfUnreadChunks(cursorA), Eq(1U));
+    EXPECT_THAT(reader.getNumberOfUnreadChunks(cursorB), Eq(1U));
+}
+
+TEST_F(ChunkRing_test, OverrunReaderLosesOldestChunksAndReadsTheLatest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a19e6c52-0d3b-4f8e-9b27-c64d5e81f0a3");
+    constexpr uint64_t NUMBER_OF_OVERWRITTEN_CHUNKS{3U};
+    writeChunks(0U, CAPACITY + NUMBER_OF_OVERWRITTEN_CHUNKS);
+
+    uint64_t cursor{0U};
+    bool hasLostChunks{false};
+    EXPECT_THAT(reader.getNumberOfUnreadChunks(cursor), Eq(CAPACITY));
+
+    for (uint64_t i = 0U; i < CAPACITY; ++i)
+    {
+        auto maybeChunk = reader.tryRead(cursor, hasLostChunks);
+        ASSERT_TRUE(maybeChunk.has_value());
+        EXPECT_THAT(getValue(*maybeChunk), Eq(NUMBER_OF_OVERWRITTEN_CHUNKS + i));
+    }
+    EXPECT_TRUE(hasLostChunks);
+    EXPECT_FALSE(reader.tryRead(cursor, hasLostChunks).has_value());
+}
+
+TEST_F(ChunkRing_test, OverwrittenChunksAreReleased)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6c3b8e1f-2a7d-4d95-b0e4-9f1a7c52d863");
+    writeChunks(0U, 3U * CAPACITY);
+
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(CAPACITY));
+}
+
+TEST_F(ChunkRing_test, ReadChunkStaysValidWhenItIsOverwrittenInTheRing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e5d2f7a9-8c14-4b3e-a6f0-1d9b3c7e4a28");
+    writeChunks(42U, 1U);
+    uint64_t cursor{0U};
+    bool hasLostChunks{false};
+    auto maybeChunk = reader.tryRead(cursor, hasLostChunks);
+    ASSERT_TRUE(maybeChunk.has_value());
+
+    writeChunks(0U, CAPACITY);
+
+    EXPECT_THAT(getValue(*maybeChunk), Eq(42U));
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(CAPACITY + 1U));
+    maybeChunk.reset();
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(CAPACITY));
+}
+
+TEST_F(ChunkRing_test, CursorForHistoryIsLimitedByTheWrittenChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3a8f1c6d-e4b7-4290-8d5a-b2c9e0f71d34");
+    writeChunks(0U, 2U);
+
+    auto cursor = reader.getCursorForHistory(CAPACITY);
+
+    EXPECT_THAT(cursor, Eq(0U));
+    EXPECT_THAT(reader.getNumberOfUnreadChunks(cursor), Eq(2U));
+}
+
+TEST_F(ChunkRing_test, CursorForHistoryIsLimitedByTheCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b7e04d9c-1f62-48a3-95c8-d0a3f6e2b791");
+    writeChunks(0U, 2U * CAPACITY);
+
+    auto cursor = reader.getCursorForHistory(CAPACITY + 1U);
+    bool hasLostChunks{false};
+    auto maybeChunk = reader.tryRead(cursor, hasLostChunks);
+
+    ASSERT_TRUE(maybeChunk.has_value());
+    EXPECT_THAT(getValue(*maybeChunk), Eq(CAPACITY));
+    EXPECT_FALSE(hasLostChunks);
+}
+
+TEST_F(ChunkRing_test, CursorWithoutHistoryReadsOnlyNewChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d5c9a3e-7b28-4f16-a4e9-c81f2d6b03a7");
+    writeChunks(0U, 2U);
+
+    auto cursor = reader.getCursorForHistory(0U);
+    EXPECT_THAT(reader.getNumberOfUnreadChunks(cursor), Eq(0U));
+
+    writeChunks(7U, 1U);
+    bool hasLostChunks{false};
+    auto maybeChunk = reader.tryRead(cursor, hasLostChunks);
+
+    ASSERT_TRUE(maybeChunk.has_value());
+    EXPECT_THAT(getValue(*maybeChunk), Eq(7U));
+}
+
+TEST_F(ChunkRing_test, ClearReleasesAllChunksAndKeepsTheCursorsValid)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f1a47b3d-6e92-4c08-b5d1-8e3c7a0f29b6");
+    writeChunks(0U, CAPACITY);
+    uint64_t cursor{0U};
+
+    writer.clear();
+
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(0U));
+    bool hasLostChunks{false};
+    EXPECT_FALSE(reader.tryRead(cursor, hasLostChunks).has_value());
+    EXPECT_TRUE(hasLostChunks);
+    EXPECT_THAT(cursor, Eq(CAPACITY));
+
+    writeChunks(13U, 1U);
+    auto maybeChunk = reader.tryRead(cursor, hasLostChunks);
+    ASSERT_TRUE(maybeChunk.has_value());
+    EXPECT_THAT(getValue(*maybeChunk), Eq(13U));
+}
+
+TEST_F(ChunkRing_test, RingWithZeroCapacityIsDisabled)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9c2e5f8a-3d71-4b6c-8e04-a7f1b9d3c562");
+    ChunkRingData disabledRingData{nullptr, 0U};
+    ChunkRingWriter disabledWriter{&disabledRingData};
+    ChunkRingReader disabledReader{&disabledRingData};
+
+    disabledWriter.write(getChunkWithValue(1U));
+
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(0U));
+    uint64_t cursor{0U};
+    bool hasLostChunks{false};
+    EXPECT_FALSE(disabledReader.tryRead(cursor, hasLostChunks).has_value());
+    EXPECT_FALSE(hasLostChunks);
+    EXPECT_THAT(disabledReader.getCapacity(), Eq(0U));
+}
+
+TEST_F(ChunkRing_test, ConcurrentReaderReadsAscendingChunksWhileWriterOverwritesThem)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2e8b6d1c-a5f3-4097-b3d8-6c0e9a4f7b15");
+    constexpr uint64_t NUMBER_OF_WRITES{10000U};
+    std::atomic_bool isWriterFinished{false};
+
+    std::thread writerThread([&] {
+        writeChunks(1U, NUMBER_OF_WRITES);
+        isWriterFinished = true;
+    });
+
+    uint64_t cursor{0U};
+    bool hasLostChunks{false};
+    uint64_t lastValue{0U};
+    bool isAscending{true};
+    bool isLastChunkRead{false};
+    while (!isLastChunkRead)
+    {
+        const bool wasWriterFinished = isWriterFinished.load();
+        while (auto maybeChunk = reader.tryRead(cursor, hasLostChunks))
+        {
+            const auto value = getValue(*maybeChunk);
+            isAscending &= (value > lastValue);
+            lastValue = value;
+        }
+        isLastChunkRead = wasWriterFinished;
+    }
+    writerThread.join();
+
+    EXPECT_TRUE(isAscending);
+    EXPECT_THAT(lastValue, Eq(NUMBER_OF_WRITES));
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(CAPACITY));
+}
+
+} // namespace
@@ -35,6 +35,7 @@
 #include "test.hpp"
 
 #include <memory>
+#include <vector>
 
 namespace
 {
@@ -76,6 +77,7 @@ class ChunkSender_test : public Test
     static constexpr uint32_t BIG_CHUNK = 256;
     static constexpr uint64_t HISTORY_CAPACITY = 4;
     static constexpr uint32_t MAX_NUMBER_QUEUES = 128;
+    static constexpr uint32_t MAX_CHUNKS_PER_BATCH = 8;
 
     static constexpr uint32_t USER_PAYLOAD_ALIGNMENT = iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT;
     static constexpr uint32_t USER_HEADER_SIZE = iox::CHUNK_NO_USER_HEADER_SIZE;
@@ -101,8 +103,8 @@ class ChunkSender_test : public Test
                                                                    iox::popo::ThreadSafePolicy,
                                                                    iox::popo::ChunkQueuePusher<ChunkQueueData_t>>;
     using ChunkDistributor_t = iox::popo::ChunkDistributor<ChunkDistributorData_t>;
-    using ChunkSenderData_t =
-        iox::popo::ChunkSenderData<iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY, ChunkDistributorData_t>;
+    using ChunkSenderData_t = iox::popo::
+        ChunkSenderData<iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY, ChunkDistributorData_t, MAX_CHUNKS_PER_BATCH>;
 
     ChunkQueueData_t m_chunkQueueData{iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA,
                                       iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer};
@@ -205,6 +207,83 @@ TEST_F(ChunkSender_test, allocate_Overflow)
                 Eq(iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY));
 }
 
+TEST_F(ChunkSender_test, allocateBatch_AllocatesTheRequestedNumberOfChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2f6f5d0e-7c8b-4a1d-9e3f-6b0a4c2d8e17");
+    UniquePortId uniqueId;
+    iox::mepoo::ChunkHeader* chunkHeaders[MAX_CHUNKS_PER_BATCH]{};
+    auto result = m_chunkSender.tryAllocateBatch(uniqueId,
+                                                 iox::span<iox::mepoo::ChunkHeader*>(chunkHeaders, MAX_CHUNKS_PER_BATCH),
+                                                 sizeof(DummySample),
+                                                 alignof(DummySample),
+                                                 USER_HEADER_SIZE,
+                                                 USER_HEADER_ALIGNMENT);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(MAX_CHUNKS_PER_BATCH));
+    for (auto chunkHeader : chunkHeaders)
+    {
+        ASSERT_THAT(chunkHeader, Ne(nullptr));
+        EXPECT_THAT(chunkHeader->originId(), Eq(uniqueId));
+        m_chunkSender.release(chunkHeader);
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkSender_test, allocateBatch_WorksInAdditionToTheChunksAllocatedInParallel)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8d1c4e7a-3b2f-4f60-a9d5-0e7b6c1f2a93");
+    for (size_t i = 0; i < iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY; i++)
+    {
+        ASSERT_FALSE(m_chunkSender
+                         .tryAllocate(UniquePortId(),
+                                      sizeof(DummySample),
+                                      alignof(DummySample),
+                                      USER_HEADER_SIZE,
+                                      USER_HEADER_ALIGNMENT)
+                         .has_error());
+    }
+
+    iox::mepoo::ChunkHeader* chunkHeaders[MAX_CHUNKS_PER_BATCH]{};
+    auto result = m_chunkSender.tryAllocateBatch(UniquePortId(),
+                                                 iox::span<iox::mepoo::ChunkHeader*>(chunkHeaders, MAX_CHUNKS_PER_BATCH),
+                                                 sizeof(DummySample),
+                                                 alignof(DummySample),
+                                                 USER_HEADER_SIZE,
+                                                 USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks,
+                Eq(iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY + MAX_CHUNKS_PER_BATCH));
+
+    auto overflowResult = m_chunkSender.tryAllocateBatch(UniquePortId(),
+                                                         iox::span<iox::mepoo::ChunkHeader*>(chunkHeaders, 1U),
+                                                         sizeof(DummySample),
+                                                         alignof(DummySample),
+                                                         USER_HEADER_SIZE,
+                                                         USER_HEADER_ALIGNMENT);
+    ASSERT_TRUE(overflowResult.has_error());
+    EXPECT_THAT(overflowResult.error(), Eq(iox::popo::AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks,
+                Eq(iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY + MAX_CHUNKS_PER_BATCH));
+}
+
+TEST_F(ChunkSender_test, allocateBatch_LargerThanTheBatchCapacityFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c0e93a57-1f4d-4b8e-b62a-9d3f5e8a7c04");
+    iox::mepoo::ChunkHeader* chunkHeaders[MAX_CHUNKS_PER_BATCH + 1U]{};
+    auto result =
+        m_chunkSender.tryAllocateBatch(UniquePortId(),
+                                       iox::span<iox::mepoo::ChunkHeader*>(chunkHeaders, MAX_CHUNKS_PER_BATCH + 1U),
+                                       sizeof(DummySample),
+                                       alignof(DummySample),
+                                       USER_HEADER_SIZE,
+                                       USER_HEADER_ALIGNMENT);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(iox::popo::AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
 TEST_F(ChunkSender_test, freeChunk)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b4a6eb09-a431-4f38-bd0c-38baf896a639");
@@ -394,6 +473,68 @@ TEST_F(ChunkSender_test, sendMultipleWithReceiver)
     }
 }
 
+TEST_F(ChunkSender_test, sendBatchWithReceiverDeliversAllChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "48bf05b7-c4a1-48b3-bbdc-dfff5c878444");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    std::vector<iox::mepoo::ChunkHeader*> chunkHeaders;
+    for (uint64_t i = 0; i < iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY; i++)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        auto sample = new ((*maybeChunkHeader)->userPayload()) DummySample();
+        sample->dummy = i;
+        chunkHeaders.push_back(*maybeChunkHeader);
+    }
+
+    auto numberOfDeliveries =
+        m_chunkSender.send(iox::span<iox::mepoo::ChunkHeader* const>(chunkHeaders.data(), chunkHeaders.size()));
+    EXPECT_THAT(numberOfDeliveries, Eq(1U));
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    for (uint64_t i = 0; i < iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY; i++)
+    {
+        auto popRet = myQueue.tryPop();
+        ASSERT_TRUE(popRet.has_value());
+        EXPECT_THAT(popRet->getChunkHeader()->sequenceNumber(), Eq(i));
+        EXPECT_THAT(reinterpret_cast<DummySample*>(popRet->getUserPayload())->dummy, Eq(i));
+    }
+    EXPECT_TRUE(myQueue.empty());
+
+    auto maybeLastChunk = m_chunkSender.tryGetPreviousChunk();
+    ASSERT_TRUE(maybeLastChunk.has_value());
+    EXPECT_THAT(*maybeLastChunk, Eq(chunkHeaders.back()));
+}
+
+TEST_F(ChunkSender_test, sendBatchWithInvalidChunkDeliversOnlyTheValidChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b657627e-b1a0-46d0-b0f5-1f29815ac04f");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    new ((*maybeChunkHeader)->userPayload()) DummySample();
+
+    auto errorHandlerCalled{false};
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&errorHandlerCalled](const iox::PoshError, const iox::ErrorLevel) { errorHandlerCalled = true; });
+
+    ChunkMock<bool> myCrazyChunk;
+    iox::mepoo::ChunkHeader* chunkHeaders[] = {myCrazyChunk.chunkHeader(), *maybeChunkHeader};
+    auto numberOfDeliveries = m_chunkSender.send(iox::span<iox::mepoo::ChunkHeader* const>(chunkHeaders, 2U));
+    EXPECT_THAT(numberOfDeliveries, Eq(1U));
+    EXPECT_TRUE(errorHandlerCalled);
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    auto popRet = myQueue.tryPop();
+    ASSERT_TRUE(popRet.has_value());
+    EXPECT_THAT(popRet->getChunkHeader(), Eq(*maybeChunkHeader));
+    EXPECT_TRUE(myQueue.empty());
+}
+
 TEST_F(ChunkSender_test, sendTillRunningOutOfChunks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b951495a-e216-43ff-96a0-a530b7a6455b");
@@ -725,6 +866,37 @@ TEST_F(ChunkSender_test, Cleanup)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(ChunkSender_test, ReleaseAllReturnsTheChunksReservedByTheChunkMagazine)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "87edd1a2-2fc6-483b-832a-fa081127394e");
+    constexpr uint32_t MAGAZINE_CAPACITY{8U};
+    ChunkSenderData_t chunkSenderData{&m_memoryManager,
+                                      iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                      0U,
+                                      iox::mepoo::MemoryInfo(),
+                                      MAGAZINE_CAPACITY};
+    iox::popo::ChunkSender<ChunkSenderData_t> sut{&chunkSenderData};
+
+    auto maybeChunkHeader =
+        sut.tryAllocate(UniquePortId(), SMALL_CHUNK, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(MAGAZINE_CAPACITY));
+    EXPECT_THAT(chunkSenderData.m_chunkMagazine.size(), Eq(MAGAZINE_CAPACITY - 1U));
+
+    sut.releaseAll();
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(chunkSenderData.m_chunkMagazine.size(), Eq(0U));
+    const auto chunkSettings = iox::mepoo::ChunkSettings::create(SMALL_CHUNK, USER_PAYLOAD_ALIGNMENT).value();
+    std::vector<iox::mepoo::SharedChunk> chunks;
+    for (uint32_t i = 0; i < NUM_CHUNKS_IN_POOL; ++i)
+    {
+        auto chunk = m_memoryManager.getChunk(chunkSettings);
+        ASSERT_FALSE(chunk.has_error());
+        chunks.push_back(chunk.value());
+    }
+}
+
 TEST_F(ChunkSender_test, asStringLiteralConvertsAllocationErrorValuesToStrings)
 {
     ::testing::Test::RecordProperty("TEST_ID", "fdb713e1-0e2c-411e-a3ee-02c216d510d0");
@@ -401,7 +401,7 @@ TEST_F(ClientPort_test, GetResponseOnConnectedClientPortWithNonEmptyResponseQueu
     constexpr uint32_t USER_PAYLOAD_SIZE{10};
     auto sharedChunk = getChunkFromMemoryManager(USER_PAYLOAD_SIZE, sizeof(ResponseHeader));
     new (sharedChunk.getChunkHeader()->userHeader())
-        ResponseHeader(iox::UniqueId(), RpcBaseHeader::UNKNOWN_CLIENT_QUEUE_INDEX, SEQUENCE_ID);
+        ResponseHeader(iox::UniqueId(), RpcBaseHeader::UNKNOWN_CLIENT_QUEUE_HANDLE, SEQUENCE_ID);
     sut.responseQueuePusher.push(sharedChunk);
 
     sut.portUser.getResponse()
@@ -815,6 +815,31 @@ TEST_F(ClientPort_test, StateConnectRequestedWithCaProMessageTypeAckTransitionsT
     ASSERT_FALSE(responseCaproMessage.has_value());
 }
 
+TEST_F(ClientPort_test, StateConnectRequestedWithCaProMessageTypeAckStoresResponseQueueHandleInRequests)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "471b4bc7-6775-4ef1-825c-72a1e3980ffe");
+    constexpr uint32_t RESPONSE_QUEUE_HANDLE{0x00050003U};
+    auto& sut = initAndGetClientPortForStateTransitionTests();
+    sut.portUser.connect();
+    tryAdvanceToState(sut, iox::ConnectionState::CONNECT_REQUESTED);
+
+    auto caproMessage = CaproMessage{CaproMessageType::ACK, sut.portData.m_serviceDescription};
+    caproMessage.m_chunkQueueData = &serverChunkQueueData;
+    caproMessage.m_chunkQueueHandle = RESPONSE_QUEUE_HANDLE;
+    sut.portRouDi.dispatchCaProMessageAndGetPossibleResponse(caproMessage);
+
+    auto maybeRequest = sut.portUser.allocateRequest(USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(maybeRequest.has_error());
+    class RequestHeaderAccess : public RequestHeader
+    {
+      public:
+        using RpcBaseHeader::m_clientQueueHandle;
+    };
+    EXPECT_THAT(static_cast<RequestHeaderAccess*>(maybeRequest.value())->m_clientQueueHandle,
+                Eq(RESPONSE_QUEUE_HANDLE));
+    sut.portUser.releaseRequest(maybeRequest.value());
+}
+
 TEST_F(ClientPort_test, StateWaitForOfferWithCaProMessageTypeDisconnetTransitionsToStateNotConnected)
 {
     ::testing::Test::RecordProperty("TEST_ID", "fa9925d1-e867-4155-aa8c-3bfa411b09db");
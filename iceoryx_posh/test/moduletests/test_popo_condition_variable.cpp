@@ -25,9 +25,11 @@
 #include "test.hpp"
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <thread>
 #include <type_traits>
+#include <vector>
 
 namespace
 {
@@ -135,9 +137,9 @@ TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstruction)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4e5f6dbc-84cc-468a-9d64-f5ed88012ebc");
     ConditionVariableData sut;
-    for (auto& notification : sut.m_activeNotifications)
+    for (Type_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; i++)
     {
-        EXPECT_THAT(notification, Eq(false));
+        EXPECT_FALSE(sut.isNotificationActive(i));
     }
 }
 
@@ -150,9 +152,9 @@ TEST_F(ConditionVariable_test, CorrectRuntimeNameAfterConstructionWithRuntimeNam
 TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstructionWithRuntimeName)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4825e152-08e3-414e-a34f-d93d048f84b8");
-    for (auto& notification : m_condVarData.m_activeNotifications)
+    for (Type_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; i++)
     {
-        EXPECT_THAT(notification, Eq(false));
+        EXPECT_FALSE(m_condVarData.isNotificationActive(i));
     }
 }
 
@@ -166,15 +168,123 @@ TEST_F(ConditionVariable_test, NotifyActivatesCorrectIndex)
     {
         if (i == EVENT_INDEX)
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i], Eq(true));
+            EXPECT_TRUE(m_condVarData.isNotificationActive(i));
         }
         else
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i], Eq(false));
+            EXPECT_FALSE(m_condVarData.isNotificationActive(i));
         }
     }
 }
 
+TEST_F(ConditionVariable_test, WaitReturnsSortedNotificationsAcrossWordBoundaries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a9d4c1f6-3e72-4b08-8c5d-17e2f09b6a34");
+    constexpr uint64_t WORD_SIZE = ConditionVariableData::NOTIFICATIONS_PER_WORD;
+    constexpr Type_t LAST_INDEX = iox::MAX_NUMBER_OF_NOTIFIERS - 1U;
+    const std::vector<Type_t> expectedIndices{0U, WORD_SIZE - 1U, WORD_SIZE, LAST_INDEX};
+
+    for (auto index = expectedIndices.rbegin(); index != expectedIndices.rend(); ++index)
+    {
+        ConditionNotifier(m_condVarData, *index).notify();
+    }
+
+    const auto activeNotifications = m_waiter.wait();
+    ASSERT_THAT(activeNotifications.size(), Eq(expectedIndices.size()));
+    for (uint64_t i = 0U; i < expectedIndices.size(); ++i)
+    {
+        EXPECT_THAT(activeNotifications[i], Eq(expectedIndices[i]));
+    }
+    for (Type_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; i++)
+    {
+        EXPECT_FALSE(m_condVarData.isNotificationActive(i));
+    }
+}
+
+TEST_F(ConditionVariable_test, NotifyWithoutWaitingListenerDoesNotPostSemaphore)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0e5c8f27-93a4-4d1b-b6e2-7f04a9c3d158");
+    m_signaler.notify();
+
+    auto wasPosted = m_condVarData.m_semaphore->tryWait();
+    ASSERT_FALSE(wasPosted.has_error());
+    EXPECT_FALSE(wasPosted.value());
+    EXPECT_TRUE(m_waiter.wasNotified());
+}
+
+TEST_F(ConditionVariable_test, NotifyWithWaitingListenerPostsSemaphore)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b47a1d93-2c6e-4f80-a5d9-1e3b8c72f604");
+    // simulate a listener which is about to block on the semaphore
+    m_condVarData.m_numberOfWaiters.store(1U);
+    m_signaler.notify();
+
+    auto wasPosted = m_condVarData.m_semaphore->tryWait();
+    ASSERT_FALSE(wasPosted.has_error());
+    EXPECT_TRUE(wasPosted.value());
+}
+
+TEST_F(ConditionVariable_test, NoListenerIsWaitingAfterWaitReturned)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d2e9b41-7a0c-4e63-8f1b-c9a4d6e20b75");
+    Barrier isThreadStarted(1U);
+    std::thread waiter([&] {
+        isThreadStarted.notify();
+        EXPECT_THAT(m_waiter.wait().size(), Eq(1U));
+    });
+    isThreadStarted.wait();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    m_signaler.notify();
+    waiter.join();
+
+    EXPECT_THAT(m_condVarData.m_numberOfWaiters.load(), Eq(0U));
+}
+
+TEST_F(ConditionVariable_test, WaitWithSpinDurationReturnsNotificationWhichArrivesWhileSpinning)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e83f0c6a-1b57-4d29-9a4e-62f7b1d8c039");
+    m_waiter.setSpinDuration(m_timeToWait);
+    std::atomic_bool isWaiting{false};
+    std::thread notifier([&] {
+        while (!isWaiting.load())
+        {
+        }
+        ConditionNotifier(m_condVarData, 7U).notify();
+    });
+
+    isWaiting.store(true);
+    const auto activeNotifications = m_waiter.wait();
+    notifier.join();
+
+    ASSERT_THAT(activeNotifications.size(), Eq(1U));
+    EXPECT_THAT(activeNotifications[0], Eq(7U));
+}
+
+TEST_F(ConditionVariable_test, TimedWaitWithSpinDurationLongerThanTimeoutReturnsAfterTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f61a7d8-c4b2-4e05-b19a-8d2c05e7f463");
+    m_waiter.setSpinDuration(m_timeToWait * 10U);
+
+    EXPECT_THAT(m_waiter.timedWait(m_timingTestTime).size(), Eq(0U));
+}
+
+TEST_F(ConditionVariable_test, TimedWaitWithSpinDurationAndStaleWasNotifiedFlagReturnsAfterTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3801b6b1-f3c3-41a7-b220-f060c1ab6619");
+    m_waiter.setSpinDuration(m_timeToWait * 10U);
+    // a notifier which stores the flag after its notification was already collected leaves the flag set without any
+    // active notification
+    m_condVarData.m_wasNotified.store(true);
+
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_THAT(m_waiter.timedWait(m_timingTestTime).size(), Eq(0U));
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_THAT(elapsed, Ge(std::chrono::nanoseconds(m_timingTestTime.toNanoseconds())));
+    EXPECT_THAT(elapsed, Lt(std::chrono::nanoseconds(m_timeToWait.toNanoseconds())));
+}
+
 TEST_F(ConditionVariable_test, TimedWaitWithZeroTimeoutWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "582f0b1c-c717-410e-8143-61459db672ad");
@@ -420,9 +530,9 @@ TIMING_TEST_F(ConditionVariable_test, SecondWaitBlocksUntilNewNotification, Repe
         hasWaited.store(true, std::memory_order_relaxed);
         ASSERT_THAT(activeNotifications.size(), Eq(1U));
         EXPECT_THAT(activeNotifications[0], Eq(FIRST_EVENT_INDEX));
-        for (const auto& notification : m_condVarData.m_activeNotifications)
+        for (Type_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; i++)
         {
-            EXPECT_THAT(notification, Eq(false));
+            EXPECT_FALSE(m_condVarData.isNotificationActive(i));
         }
     });
 
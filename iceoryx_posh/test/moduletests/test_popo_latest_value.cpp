@@ -0,0 +1,176 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_reader.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_writer.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+struct TestValue
+{
+    static constexpr uint64_t NUMBER_OF_FIELDS{7U};
+
+    explicit TestValue(const uint64_t value = 0U)
+    {
+        for (auto& field : fields)
+        {
+            field = value;
+        }
+    }
+
+    uint64_t fields[NUMBER_OF_FIELDS];
+};
+
+struct OddSizedValue
+{
+    uint8_t bytes[13];
+};
+
+class LatestValue_test : public Test
+{
+  public:
+    LatestValueData sutData{sizeof(TestValue)};
+    LatestValueWriter writer{&sutData};
+    LatestValueReader reader{&sutData};
+};
+
+TEST_F(LatestValue_test, ReadWithoutWrittenValueReturnsNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e1f2c8a-93b4-4d07-a6e1-0c7d3b9f4a52");
+    TestValue value;
+
+    EXPECT_FALSE(reader.read(&value).has_value());
+    EXPECT_THAT(reader.getVersion(), Eq(0U));
+}
+
+TEST_F(LatestValue_test, ReadReturnsTheWrittenValue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b82d7a14-6c3e-4f90-8d25-e1a4c6b7f039");
+    const TestValue writtenValue(42U);
+    writer.write(&writtenValue);
+
+    TestValue value;
+    auto version = reader.read(&value);
+
+    ASSERT_TRUE(version.has_value());
+    EXPECT_THAT(version.value(), Eq(1U));
+    for (auto field : value.fields)
+    {
+        EXPECT_THAT(field, Eq(42U));
+    }
+}
+
+TEST_F(LatestValue_test, ReadReturnsTheNewestValueAndItsVersion)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0f6a3e92-d51c-4b87-9e04-7a2c8d1b5e63");
+    constexpr uint64_t NUMBER_OF_WRITES{5U};
+    for (uint64_t i = 1U; i <= NUMBER_OF_WRITES; ++i)
+    {
+        const TestValue writtenValue(i * 10U);
+        writer.write(&writtenValue);
+    }
+
+    TestValue value;
+    auto version = reader.read(&value);
+
+    ASSERT_TRUE(version.has_value());
+    EXPECT_THAT(version.value(), Eq(NUMBER_OF_WRITES));
+    EXPECT_THAT(reader.getVersion(), Eq(NUMBER_OF_WRITES));
+    EXPECT_THAT(value.fields[0], Eq(NUMBER_OF_WRITES * 10U));
+}
+
+TEST_F(LatestValue_test, ValueWithSizeWhichIsNoMultipleOfTheWordSizeIsReadCompletely)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c3e94b70-2a8f-4d16-b5c3-9f0e1d7a6b28");
+    LatestValueData oddSizedData{sizeof(OddSizedValue)};
+    OddSizedValue writtenValue;
+    for (uint8_t i = 0U; i < sizeof(OddSizedValue); ++i)
+    {
+        writtenValue.bytes[i] = static_cast<uint8_t>(i + 1U);
+    }
+    LatestValueWriter(&oddSizedData).write(&writtenValue);
+
+    // the byte behind the value must not be touched by the reader
+    uint8_t readBuffer[sizeof(OddSizedValue) + 1U];
+    readBuffer[sizeof(OddSizedValue)] = 0xFFU;
+    ASSERT_TRUE(LatestValueReader(&oddSizedData).read(readBuffer).has_value());
+
+    for (uint8_t i = 0U; i < sizeof(OddSizedValue); ++i)
+    {
+        EXPECT_THAT(readBuffer[i], Eq(i + 1U));
+    }
+    EXPECT_THAT(readBuffer[sizeof(OddSizedValue)], Eq(0xFFU));
+}
+
+TEST_F(LatestValue_test, ValueSizeIsLimitedByTheBufferSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7d2b5f61-e8a3-4c94-a0b7-3e6f9c1d8a45");
+    LatestValueData tooLargeData{LatestValueBuffer::MAX_VALUE_SIZE + 1U};
+
+    EXPECT_THAT(LatestValueReader(&tooLargeData).getValueSize(), Eq(LatestValueBuffer::MAX_VALUE_SIZE));
+}
+
+TEST_F(LatestValue_test, ConcurrentReaderNeverReadsATornValue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e9a07c3d-5b16-4f82-8c4e-d2b1a6f3e074");
+    constexpr uint64_t NUMBER_OF_WRITES{100000U};
+    std::atomic_bool isWriterFinished{false};
+
+    std::thread writerThread([&] {
+        for (uint64_t i = 1U; i <= NUMBER_OF_WRITES; ++i)
+        {
+            const TestValue writtenValue(i);
+            writer.write(&writtenValue);
+        }
+        isWriterFinished = true;
+    });
+
+    uint64_t lastVersion{0U};
+    bool isConsistent{true};
+    bool isMonotonic{true};
+    while (!isWriterFinished.load())
+    {
+        TestValue value;
+        auto version = reader.read(&value);
+        if (!version.has_value())
+        {
+            continue;
+        }
+        for (auto field : value.fields)
+        {
+            isConsistent &= (field == version.value());
+        }
+        isMonotonic &= (version.value() >= lastVersion);
+        lastVersion = version.value();
+    }
+    writerThread.join();
+
+    EXPECT_TRUE(isConsistent);
+    EXPECT_TRUE(isMonotonic);
+    TestValue value;
+    EXPECT_THAT(reader.read(&value).value(), Eq(NUMBER_OF_WRITES));
+}
+
+} // namespace
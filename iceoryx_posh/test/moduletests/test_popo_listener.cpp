@@ -134,8 +134,8 @@ class SimpleEventClass
 class TestListener : public Listener
 {
   public:
-    TestListener(ConditionVariableData& data) noexcept
-        : Listener(data)
+    TestListener(ConditionVariableData& data, const ListenerOptions& options = {}) noexcept
+        : Listener(data, options)
     {
     }
 };
@@ -158,6 +158,14 @@ std::array<TriggerSourceAndCount, iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER> g_trig
 uint64_t g_triggerCallbackRuntimeInMs = 0U;
 iox::optional<iox::posix::UnnamedSemaphore> g_callbackBlocker;
 
+struct WorkerPoolCallbackStatistics
+{
+    std::atomic<uint64_t> m_runningCallbacks{0U};
+    std::atomic<uint64_t> m_maxRunningCallbacks{0U};
+    std::atomic<uint64_t> m_numberOfCalls{0U};
+    std::atomic<uint64_t> m_waitForConcurrentCallbacksInMs{0U};
+};
+
 class Listener_test : public Test
 {
   public:
@@ -180,6 +188,41 @@ class Listener_test : public Test
         ++(*userType);
     }
 
+    static void workerPoolCallback(SimpleEventClass* const, WorkerPoolCallbackStatistics* const statistics) noexcept
+    {
+        const auto runningCallbacks = ++statistics->m_runningCallbacks;
+        auto maxRunningCallbacks = statistics->m_maxRunningCallbacks.load();
+        while (runningCallbacks > maxRunningCallbacks
+               && !statistics->m_maxRunningCallbacks.compare_exchange_weak(maxRunningCallbacks, runningCallbacks))
+        {
+        }
+
+        // give a concurrently running callback the chance to show up
+        const auto waitTime = std::chrono::milliseconds(statistics->m_waitForConcurrentCallbacksInMs.load());
+        const auto deadline = std::chrono::steady_clock::now() + waitTime;
+        while (statistics->m_maxRunningCallbacks.load() < 2U && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+
+        --statistics->m_runningCallbacks;
+        ++statistics->m_numberOfCalls;
+    }
+
+    static bool waitForNumberOfCalls(const WorkerPoolCallbackStatistics& statistics, const uint64_t numberOfCalls)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(10U * CALLBACK_WAIT_IN_MS);
+        while (statistics.m_numberOfCalls.load() < numberOfCalls)
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1U));
+        }
+        return true;
+    }
+
     static void attachCallback(SimpleEventClass* const) noexcept
     {
         for (auto& e : g_toBeAttached.getCopy())
@@ -1238,4 +1281,197 @@ TIMING_TEST_F(Listener_test, AttachingInCallbackWorks, Repeat(5), [&] {
 // END
 //////////////////////////////////
 
+//////////////////////////////////
+// BEGIN worker pool
+//////////////////////////////////
+TEST_F(Listener_test, ListenerHasNoWorkersByDefault)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "024b762a-4194-4544-aab3-3667e448a43c");
+    EXPECT_THAT(m_sut->numberOfWorkers(), Eq(0U));
+}
+
+TEST_F(Listener_test, NumberOfWorkersIsLimitedToMaximum)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "998afa30-c8e5-42f3-bea4-73a8f91362a1");
+    ListenerOptions options;
+    options.numberOfWorkers = iox::MAX_NUMBER_OF_WORKERS_PER_LISTENER + 1U;
+    m_sut.emplace(m_condVarData, options);
+
+    EXPECT_THAT(m_sut->numberOfWorkers(), Eq(iox::MAX_NUMBER_OF_WORKERS_PER_LISTENER));
+}
+
+TEST_F(Listener_test, AttachingEventToNonExistingWorkerFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0c1e6662-7bce-4b45-8d2e-e215d3dcd61b");
+    ListenerOptions options;
+    options.numberOfWorkers = 2U;
+    m_sut.emplace(m_condVarData, options);
+    SimpleEventClass fuu;
+
+    auto result = m_sut->attachEvent(fuu,
+                                     SimpleEvent::StoepselBachelorParty,
+                                     createNotificationCallback(Listener_test::triggerCallback<0U>),
+                                     options.numberOfWorkers);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(ListenerError::INVALID_WORKER_INDEX));
+    EXPECT_THAT(m_sut->size(), Eq(0U));
+}
+
+TEST_F(Listener_test, AttachingEventToWorkerWithoutWorkerPoolFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1e4c43ef-d6c4-46a5-8688-7d6246d1ab48");
+    SimpleEventClass fuu;
+
+    constexpr uint32_t WORKER_INDEX{0U};
+    auto result = m_sut->attachEvent(fuu, createNotificationCallback(Listener_test::triggerCallback<0U>), WORKER_INDEX);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(ListenerError::INVALID_WORKER_INDEX));
+}
+
+TEST_F(Listener_test, AllCallbacksAreCalledWithWorkerPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "830819b2-43a4-4be2-9003-bff486344429");
+    ListenerOptions options;
+    options.numberOfWorkers = 4U;
+    m_sut.emplace(m_condVarData, options);
+    WorkerPoolCallbackStatistics statistics;
+    auto callback = createNotificationCallback(Listener_test::workerPoolCallback, statistics);
+
+    for (uint64_t i = 0U; i < m_sut->capacity(); ++i)
+    {
+        ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[i], callback).has_error());
+    }
+
+    for (uint64_t i = 0U; i < m_sut->capacity(); ++i)
+    {
+        m_simpleEvents[i].triggerNoEventType();
+    }
+
+    EXPECT_TRUE(waitForNumberOfCalls(statistics, m_sut->capacity()));
+}
+
+TIMING_TEST_F(Listener_test, CallbacksOfDifferentEventsRunConcurrentlyWithWorkerPool, Repeat(5), [&] {
+    ::testing::Test::RecordProperty("TEST_ID", "14993e07-3792-411b-bde5-5f77b2aa63b8");
+    ListenerOptions options;
+    options.numberOfWorkers = 2U;
+    m_sut.emplace(m_condVarData, options);
+    WorkerPoolCallbackStatistics statistics;
+    statistics.m_waitForConcurrentCallbacksInMs = CALLBACK_WAIT_IN_MS;
+    auto callback = createNotificationCallback(Listener_test::workerPoolCallback, statistics);
+    SimpleEventClass fuu1;
+    SimpleEventClass fuu2;
+    ASSERT_FALSE(m_sut->attachEvent(fuu1, callback).has_error());
+    ASSERT_FALSE(m_sut->attachEvent(fuu2, callback).has_error());
+
+    fuu1.triggerNoEventType();
+    fuu2.triggerNoEventType();
+
+    TIMING_TEST_EXPECT_TRUE(waitForNumberOfCalls(statistics, 2U));
+    TIMING_TEST_EXPECT_TRUE(statistics.m_maxRunningCallbacks.load() == 2U);
+})
+
+TEST_F(Listener_test, CallbackOfOneEventIsNeverRunConcurrentlyWithWorkerPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "aec550af-0d09-4b7a-b7a6-831bcb824bf3");
+    ListenerOptions options;
+    options.numberOfWorkers = 4U;
+    m_sut.emplace(m_condVarData, options);
+    WorkerPoolCallbackStatistics statistics;
+    statistics.m_waitForConcurrentCallbacksInMs = 1U;
+    auto callback = createNotificationCallback(Listener_test::workerPoolCallback, statistics);
+    SimpleEventClass fuu;
+    ASSERT_FALSE(m_sut->attachEvent(fuu, callback).has_error());
+
+    constexpr uint64_t NUMBER_OF_TRIGGERS = 100U;
+    for (uint64_t i = 0U; i < NUMBER_OF_TRIGGERS; ++i)
+    {
+        fuu.triggerNoEventType();
+        std::this_thread::sleep_for(std::chrono::microseconds(100U));
+    }
+
+    EXPECT_TRUE(waitForNumberOfCalls(statistics, 1U));
+    m_sut.reset();
+    EXPECT_THAT(statistics.m_maxRunningCallbacks.load(), Eq(1U));
+}
+
+TIMING_TEST_F(Listener_test, EventsPinnedToTheSameWorkerAreExecutedSequentially, Repeat(5), [&] {
+    ::testing::Test::RecordProperty("TEST_ID", "f21207c8-fee9-4076-a6b7-94651f6d94b6");
+    ListenerOptions options;
+    options.numberOfWorkers = 2U;
+    m_sut.emplace(m_condVarData, options);
+    WorkerPoolCallbackStatistics statistics;
+    statistics.m_waitForConcurrentCallbacksInMs = CALLBACK_WAIT_IN_MS / 2U;
+    auto callback = createNotificationCallback(Listener_test::workerPoolCallback, statistics);
+    SimpleEventClass fuu1;
+    SimpleEventClass fuu2;
+    constexpr uint32_t WORKER_INDEX{1U};
+    ASSERT_FALSE(m_sut->attachEvent(fuu1, callback, WORKER_INDEX).has_error());
+    ASSERT_FALSE(m_sut->attachEvent(fuu2, callback, WORKER_INDEX).has_error());
+
+    fuu1.triggerNoEventType();
+    fuu2.triggerNoEventType();
+
+    TIMING_TEST_EXPECT_TRUE(waitForNumberOfCalls(statistics, 2U));
+    TIMING_TEST_EXPECT_TRUE(statistics.m_maxRunningCallbacks.load() == 1U);
+})
+
+TEST_F(Listener_test, WorkerPoolWithCpuAffinityExecutesCallbacks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8cc6945d-b972-4a12-a24f-a6a79baff731");
+    ListenerOptions options;
+    options.numberOfWorkers = 1U;
+    options.workerCpus.emplace_back(0U);
+    m_sut.emplace(m_condVarData, options);
+    WorkerPoolCallbackStatistics statistics;
+    auto callback = createNotificationCallback(Listener_test::workerPoolCallback, statistics);
+    SimpleEventClass fuu;
+    constexpr uint32_t WORKER_INDEX{0U};
+    ASSERT_FALSE(m_sut->attachEvent(fuu, callback, WORKER_INDEX).has_error());
+
+    fuu.triggerNoEventType();
+
+    EXPECT_TRUE(waitForNumberOfCalls(statistics, 1U));
+}
+
+TEST_F(Listener_test, QueuedExecutionOfDetachedEventIsDiscardedWithWorkerPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d0d96621-efc9-4f1d-b28a-247835163622");
+    ListenerOptions options;
+    options.numberOfWorkers = 1U;
+    m_sut.emplace(m_condVarData, options);
+    activateTriggerCallbackBlocker();
+    SimpleEventClass blockingEvent;
+    SimpleEventClass detachedEvent;
+    SimpleEventClass reattachedEvent;
+    WorkerPoolCallbackStatistics statistics;
+    auto callback = createNotificationCallback(Listener_test::workerPoolCallback, statistics);
+    ASSERT_FALSE(
+        m_sut->attachEvent(blockingEvent, createNotificationCallback(Listener_test::triggerCallback<0U>)).has_error());
+    ASSERT_FALSE(m_sut->attachEvent(detachedEvent, callback).has_error());
+
+    // the only worker is blocked, hence the execution of the second event stays queued
+    blockingEvent.triggerNoEventType();
+    while (g_triggerCallbackArg[0U].m_count == 0U)
+    {
+        std::this_thread::yield();
+    }
+    detachedEvent.triggerNoEventType();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS / 10U));
+
+    m_sut->detachEvent(detachedEvent);
+    unblockTriggerCallback(1U);
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS / 10U));
+    EXPECT_THAT(statistics.m_numberOfCalls.load(), Eq(0U));
+
+    // the event which is attached with the index of the detached event is scheduled again
+    ASSERT_FALSE(m_sut->attachEvent(reattachedEvent, callback).has_error());
+    reattachedEvent.triggerNoEventType();
+    EXPECT_TRUE(waitForNumberOfCalls(statistics, 1U));
+}
+//////////////////////////////////
+// END
+//////////////////////////////////
+
 } // namespace
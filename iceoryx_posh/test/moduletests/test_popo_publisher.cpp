@@ -21,6 +21,8 @@
 
 #include "test.hpp"
 
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -274,6 +276,96 @@ TEST_F(PublisherTest, PublishingSendsUnderlyingMemoryChunkOnPublisherPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(PublisherTest, LoanBatchLoansTheRequestedNumberOfSamplesWithOneCallOnPublisherPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b21bef5-7bec-4331-9efc-aa9093920ffa");
+    ChunkMock<DummyData> secondChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunks(_, sizeof(DummyData), _, _, _))
+        .WillOnce(Invoke([&](const iox::span<iox::mepoo::ChunkHeader*> chunkHeaders,
+                             const uint32_t,
+                             const uint32_t,
+                             const uint32_t,
+                             const uint32_t) -> iox::expected<void, iox::popo::AllocationError> {
+            EXPECT_THAT(chunkHeaders.size(), Eq(2U));
+            chunkHeaders[0] = chunkMock.chunkHeader();
+            chunkHeaders[1] = secondChunkMock.chunkHeader();
+            return iox::ok();
+        }));
+    // ===== Test ===== //
+    auto result = sut.loanBatch(2U);
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    ASSERT_THAT(result.value().size(), Eq(2U));
+    EXPECT_EQ(chunkMock.chunkHeader(), result.value()[0].getChunkHeader());
+    EXPECT_EQ(secondChunkMock.chunkHeader(), result.value()[1].getChunkHeader());
+    EXPECT_EQ(result.value()[1]->val, DummyData::defaultVal());
+    EXPECT_CALL(portMock, releaseChunk(chunkMock.chunkHeader()));
+    EXPECT_CALL(portMock, releaseChunk(secondChunkMock.chunkHeader()));
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, LoanBatchReturnsAllocationErrorOfPublisherPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "38b656f0-846c-43f0-9d65-8feffc0fc487");
+    EXPECT_CALL(portMock, tryAllocateChunks(_, sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::err(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS))));
+    EXPECT_CALL(portMock, releaseChunk(_)).Times(0);
+    // ===== Test ===== //
+    auto result = sut.loanBatch(2U);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS, result.error());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, LoanBatchWithMoreSamplesThanAllowedPerBatchFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dc433e26-97ed-45f0-afcc-2e2c50c74cdd");
+    EXPECT_CALL(portMock, tryAllocateChunks(_, _, _, _, _)).Times(0);
+    // ===== Test ===== //
+    auto result = sut.loanBatch(iox::MAX_CHUNKS_PER_PUBLISHER_BATCH + 1U);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL, result.error());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, PublishBatchSendsAllUnderlyingMemoryChunksWithOneCallOnPublisherPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "97e622af-2764-4c95-8468-cbabde00a34b");
+    ChunkMock<DummyData> secondChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunks(_, sizeof(DummyData), _, _, _))
+        .WillOnce(Invoke([&](const iox::span<iox::mepoo::ChunkHeader*> chunkHeaders,
+                             const uint32_t,
+                             const uint32_t,
+                             const uint32_t,
+                             const uint32_t) -> iox::expected<void, iox::popo::AllocationError> {
+            EXPECT_THAT(chunkHeaders.size(), Eq(2U));
+            chunkHeaders[0] = chunkMock.chunkHeader();
+            chunkHeaders[1] = secondChunkMock.chunkHeader();
+            return iox::ok();
+        }));
+    std::vector<iox::mepoo::ChunkHeader*> sentChunkHeaders;
+    EXPECT_CALL(portMock, sendChunks(_))
+        .WillOnce(Invoke([&](const iox::span<iox::mepoo::ChunkHeader* const> chunkHeaders) {
+            sentChunkHeaders.assign(chunkHeaders.data(), chunkHeaders.data() + chunkHeaders.size());
+        }));
+    EXPECT_CALL(portMock, sendChunk(_)).Times(0);
+    EXPECT_CALL(portMock, releaseChunk(_)).Times(0);
+    auto result = sut.loanBatch(2U);
+    ASSERT_FALSE(result.has_error());
+    auto& samples = result.value();
+    // ===== Test ===== //
+    sut.publishBatch(iox::span<iox::popo::Sample<DummyData>>(samples.data(), samples.size()));
+    // ===== Verify ===== //
+    ASSERT_THAT(sentChunkHeaders.size(), Eq(2U));
+    EXPECT_EQ(chunkMock.chunkHeader(), sentChunkHeaders[0]);
+    EXPECT_EQ(secondChunkMock.chunkHeader(), sentChunkHeaders[1]);
+    EXPECT_FALSE(samples[0]);
+    EXPECT_FALSE(samples[1]);
+    // ===== Cleanup ===== //
+}
+
 // test whether the BasePublisher methods are called
 
 TEST_F(PublisherTest, OfferDoesOfferServiceOnUnderlyingPort)
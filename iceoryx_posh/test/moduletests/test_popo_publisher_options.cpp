@@ -32,6 +32,10 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.nodeName = "hypnotoad";
     testOptions.offerOnCreate = false;
     testOptions.subscriberTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.chunkMagazineCapacity = 8U;
+    testOptions.broadcastDeliveryThreshold = 16U;
+    testOptions.parallelBroadcastDelivery = true;
+    testOptions.chunkRingCapacity = 4U;
 
     iox::popo::PublisherOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -46,6 +50,18 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
 
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Ne(defaultOptions.subscriberTooSlowPolicy));
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Eq(testOptions.subscriberTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.chunkMagazineCapacity, Ne(defaultOptions.chunkMagazineCapacity));
+            EXPECT_THAT(roundTripOptions.chunkMagazineCapacity, Eq(testOptions.chunkMagazineCapacity));
+
+            EXPECT_THAT(roundTripOptions.broadcastDeliveryThreshold, Ne(defaultOptions.broadcastDeliveryThreshold));
+            EXPECT_THAT(roundTripOptions.broadcastDeliveryThreshold, Eq(testOptions.broadcastDeliveryThreshold));
+
+            EXPECT_THAT(roundTripOptions.parallelBroadcastDelivery, Ne(defaultOptions.parallelBroadcastDelivery));
+            EXPECT_THAT(roundTripOptions.parallelBroadcastDelivery, Eq(testOptions.parallelBroadcastDelivery));
+
+            EXPECT_THAT(roundTripOptions.chunkRingCapacity, Ne(defaultOptions.chunkRingCapacity));
+            EXPECT_THAT(roundTripOptions.chunkRingCapacity, Eq(testOptions.chunkRingCapacity));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of PublisherOptions failed!"; });
 }
@@ -29,7 +29,7 @@ using iox::UniqueId;
 class RpcBaseHeaderAccess : public RpcBaseHeader
 {
   public:
-    using RpcBaseHeader::m_lastKnownClientQueueIndex;
+    using RpcBaseHeader::m_clientQueueHandle;
     using RpcBaseHeader::m_uniqueClientQueueId;
 };
 
@@ -45,21 +45,21 @@ class RpcBaseHeader_test : public Test
     }
 
     ChunkMock<bool, RpcBaseHeader> chunk;
-    static constexpr uint32_t LAST_KNOWN_CLIENT_QUEUE_INDEX{73};
+    static constexpr uint32_t CLIENT_QUEUE_HANDLE{73};
     static constexpr int64_t SEQUENCE_ID{37};
     RpcBaseHeader* sut{new (chunk.userHeader()) RpcBaseHeader(
-        UniqueId(), LAST_KNOWN_CLIENT_QUEUE_INDEX, SEQUENCE_ID, RpcBaseHeader::RPC_HEADER_VERSION)};
+        UniqueId(), CLIENT_QUEUE_HANDLE, SEQUENCE_ID, RpcBaseHeader::RPC_HEADER_VERSION)};
 };
 
 void checkRpcBaseHeader(const RpcBaseHeaderAccess* sut,
                         const UniqueId& uniqueClientQueueId,
-                        const uint32_t lastKnownClientQueueIndex,
+                        const uint32_t clientQueueHandle,
                         const int64_t sequenceId,
                         const uint8_t rpcHeaderVersion)
 {
     EXPECT_THAT(sut->getRpcHeaderVersion(), rpcHeaderVersion);
     EXPECT_THAT(sut->m_uniqueClientQueueId, Eq(uniqueClientQueueId));
-    EXPECT_THAT(sut->m_lastKnownClientQueueIndex, lastKnownClientQueueIndex);
+    EXPECT_THAT(sut->m_clientQueueHandle, clientQueueHandle);
     EXPECT_THAT(sut->getSequenceId(), Eq(sequenceId));
 }
 
@@ -67,17 +67,17 @@ TEST_F(RpcBaseHeader_test, ConstructorWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "54b62ac7-30a7-424b-b149-8255afbf0a0d");
     const UniqueId uniqueClientQueueId;
-    constexpr uint32_t LAST_KNOWN_CLIENT_QUEUE_INDEX{13};
+    constexpr uint32_t CLIENT_QUEUE_HANDLE{13};
     constexpr int64_t SEQUENCE_ID{42};
     constexpr uint8_t RPC_HEADER_VERSION{222};
 
     ChunkMock<bool, RpcBaseHeader> chunk;
     new (chunk.userHeader())
-        RpcBaseHeader(uniqueClientQueueId, LAST_KNOWN_CLIENT_QUEUE_INDEX, SEQUENCE_ID, RPC_HEADER_VERSION);
+        RpcBaseHeader(uniqueClientQueueId, CLIENT_QUEUE_HANDLE, SEQUENCE_ID, RPC_HEADER_VERSION);
 
     checkRpcBaseHeader(static_cast<RpcBaseHeaderAccess*>(chunk.userHeader()),
                        uniqueClientQueueId,
-                       LAST_KNOWN_CLIENT_QUEUE_INDEX,
+                       CLIENT_QUEUE_HANDLE,
                        SEQUENCE_ID,
                        RPC_HEADER_VERSION);
 }
@@ -149,24 +149,24 @@ class RequestHeader_test : public Test
     }
 
     ChunkMock<bool, RequestHeader> chunk;
-    static constexpr uint32_t LAST_KNOWN_CLIENT_QUEUE_INDEX{7};
-    RequestHeader* sut{new (chunk.userHeader()) RequestHeader(UniqueId(), LAST_KNOWN_CLIENT_QUEUE_INDEX)};
+    static constexpr uint32_t CLIENT_QUEUE_HANDLE{7};
+    RequestHeader* sut{new (chunk.userHeader()) RequestHeader(UniqueId(), CLIENT_QUEUE_HANDLE)};
 };
 
 TEST_F(RequestHeader_test, ConstructorWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4af7c64c-5f9f-4598-b405-567658e128db");
     const UniqueId uniqueClientQueueId;
-    constexpr uint32_t LAST_KNOWN_CLIENT_QUEUE_INDEX{13};
+    constexpr uint32_t CLIENT_QUEUE_HANDLE{13};
     constexpr int64_t EXPECTED_SEQUENCE_ID{0};
     constexpr uint8_t EXPECTED_RPC_HEADER_VERSION{RpcBaseHeader::RPC_HEADER_VERSION};
 
     ChunkMock<bool, RequestHeader> chunk;
-    auto requestHeader = new (chunk.userHeader()) RequestHeader(uniqueClientQueueId, LAST_KNOWN_CLIENT_QUEUE_INDEX);
+    auto requestHeader = new (chunk.userHeader()) RequestHeader(uniqueClientQueueId, CLIENT_QUEUE_HANDLE);
 
     checkRpcBaseHeader(reinterpret_cast<RpcBaseHeaderAccess*>(requestHeader),
                        uniqueClientQueueId,
-                       LAST_KNOWN_CLIENT_QUEUE_INDEX,
+                       CLIENT_QUEUE_HANDLE,
                        EXPECTED_SEQUENCE_ID,
                        EXPECTED_RPC_HEADER_VERSION);
 }
@@ -229,27 +229,27 @@ class ResponseHeader_test : public Test
     }
 
     ChunkMock<bool, ResponseHeader> chunk;
-    static constexpr uint32_t LAST_KNOWN_CLIENT_QUEUE_INDEX{13};
+    static constexpr uint32_t CLIENT_QUEUE_HANDLE{13};
     static constexpr int64_t SEQUENCE_ID{1111};
     ResponseHeader* sut{new (chunk.userHeader())
-                            ResponseHeader(UniqueId(), LAST_KNOWN_CLIENT_QUEUE_INDEX, SEQUENCE_ID)};
+                            ResponseHeader(UniqueId(), CLIENT_QUEUE_HANDLE, SEQUENCE_ID)};
 };
 
 TEST_F(ResponseHeader_test, ConstructorWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ec3d90c3-2126-420c-a31c-f1c6a0731791");
     const UniqueId uniqueClientQueueId;
-    constexpr uint32_t LAST_KNOWN_CLIENT_QUEUE_INDEX{17};
+    constexpr uint32_t CLIENT_QUEUE_HANDLE{17};
     constexpr int64_t SEQUENCE_ID{555};
     constexpr uint8_t EXPECTED_RPC_HEADER_VERSION{RpcBaseHeader::RPC_HEADER_VERSION};
 
     ChunkMock<bool, ResponseHeader> chunk;
     auto responseHeader =
-        new (chunk.userHeader()) ResponseHeader(uniqueClientQueueId, LAST_KNOWN_CLIENT_QUEUE_INDEX, SEQUENCE_ID);
+        new (chunk.userHeader()) ResponseHeader(uniqueClientQueueId, CLIENT_QUEUE_HANDLE, SEQUENCE_ID);
 
     checkRpcBaseHeader(reinterpret_cast<RpcBaseHeaderAccess*>(responseHeader),
                        uniqueClientQueueId,
-                       LAST_KNOWN_CLIENT_QUEUE_INDEX,
+                       CLIENT_QUEUE_HANDLE,
                        SEQUENCE_ID,
                        EXPECTED_RPC_HEADER_VERSION);
 
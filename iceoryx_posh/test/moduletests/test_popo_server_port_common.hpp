@@ -122,7 +122,7 @@ class ServerPort_test : public Test
         constexpr uint32_t USER_PAYLOAD_SIZE{sizeof(uint64_t)};
         auto sharedChunk = getChunkFromMemoryManager(USER_PAYLOAD_SIZE, sizeof(RequestHeader));
         new (sharedChunk.getChunkHeader()->userHeader())
-            RequestHeader(clientChunkQueueData.m_uniqueId, RpcBaseHeader::UNKNOWN_CLIENT_QUEUE_INDEX);
+            RequestHeader(clientChunkQueueData.m_uniqueId, RpcBaseHeader::UNKNOWN_CLIENT_QUEUE_HANDLE);
         new (sharedChunk.getUserPayload()) uint64_t(data);
         return sharedChunk;
     }
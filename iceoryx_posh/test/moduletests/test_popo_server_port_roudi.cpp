@@ -190,6 +190,22 @@ TEST_F(ServerPort_test, StateOfferedWithCaProMessageTypeConnectReactsWithAckAndV
     EXPECT_TRUE(sut.portUser.hasClients());
 }
 
+TEST_F(ServerPort_test, StateOfferedWithCaProMessageTypeConnectReactsWithAckAndValidResponseQueueHandle)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d042cfe8-cd97-45f9-a42c-b650bc939b4b");
+    auto& sut = serverPortWithOfferOnCreate;
+
+    auto caproMessage = CaproMessage{CaproMessageType::CONNECT, sut.portData.m_serviceDescription};
+    caproMessage.m_chunkQueueData = &clientChunkQueueData;
+
+    sut.portRouDi.dispatchCaProMessageAndGetPossibleResponse(caproMessage)
+        .and_then([&](const auto& responseCaproMessage) {
+            EXPECT_THAT(responseCaproMessage.m_type, Eq(iox::capro::CaproMessageType::ACK));
+            EXPECT_THAT(responseCaproMessage.m_chunkQueueHandle, Ne(CaproMessage::INVALID_CHUNK_QUEUE_HANDLE));
+        })
+        .or_else([&]() { GTEST_FAIL() << "Expected CaPro message but got none"; });
+}
+
 TEST_F(ServerPort_test, StateOfferedWithCaProMessageTypeConnectAndNoResponseQueueCallsErrorHandler)
 {
     ::testing::Test::RecordProperty("TEST_ID", "616b7a3d-6463-43bd-b75e-a257f62a006b");
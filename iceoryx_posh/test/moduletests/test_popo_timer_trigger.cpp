@@ -0,0 +1,266 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/popo/listener.hpp"
+#include "iceoryx_posh/popo/timer_trigger.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+#include "iox/deadline_timer.hpp"
+#include "iox/duration.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+class WaitSetTest : public iox::popo::WaitSet<>
+{
+  public:
+    WaitSetTest(iox::popo::ConditionVariableData& condVarData) noexcept
+        : WaitSet(condVarData)
+    {
+    }
+};
+
+class ListenerTest : public iox::popo::Listener
+{
+  public:
+    ListenerTest(iox::popo::ConditionVariableData& condVarData) noexcept
+        : Listener(condVarData)
+    {
+    }
+};
+
+std::atomic<uint64_t> g_numberOfListenerCallbacks{0U};
+void listenerCallback(TimerTrigger*)
+{
+    ++g_numberOfListenerCallbacks;
+}
+
+class TimerTrigger_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        g_numberOfListenerCallbacks.store(0U);
+    }
+
+    static constexpr units::Duration PERIOD{units::Duration::fromMilliseconds(10)};
+    // generous upper bound for the wake up on a loaded machine
+    static constexpr units::Duration MAX_WAKE_UP_DELAY{units::Duration::fromSeconds(5)};
+
+    TimerTrigger m_sut{PERIOD};
+    ConditionVariableData m_condVar{"Funkenmariechen"};
+    WaitSetTest m_waitSet{m_condVar};
+};
+
+constexpr units::Duration TimerTrigger_test::PERIOD;
+constexpr units::Duration TimerTrigger_test::MAX_WAKE_UP_DELAY;
+
+TEST_F(TimerTrigger_test, IsNotRunningAndNotTriggeredWhenCreated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "20dd9daa-8a30-4141-907d-db41ef926b52");
+    EXPECT_FALSE(m_sut.isRunning());
+    EXPECT_FALSE(m_sut.hasTriggered());
+    EXPECT_THAT(m_sut.getPeriod(), Eq(PERIOD));
+}
+
+TEST_F(TimerTrigger_test, IsRunningAfterStartAndNotRunningAfterStop)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0b8ca327-8407-469c-95b8-c065a5c0f857");
+    m_sut.start();
+    EXPECT_TRUE(m_sut.isRunning());
+    m_sut.stop();
+    EXPECT_FALSE(m_sut.isRunning());
+}
+
+TEST_F(TimerTrigger_test, WaitSetWaitReturnsTheTimerAfterOnePeriod)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "96e69972-9470-4093-ae34-a344e56ad7f5");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut, 1337U).has_error());
+    m_sut.start();
+
+    deadline_timer period{PERIOD};
+    auto notifications = m_waitSet.wait();
+
+    EXPECT_TRUE(period.hasExpired());
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_TRUE(notifications[0]->doesOriginateFrom(&m_sut));
+    EXPECT_THAT(notifications[0]->getNotificationId(), Eq(1337U));
+}
+
+TEST_F(TimerTrigger_test, WaitSetWaitReturnsTheTimerOncePerPeriod)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ab3d21f1-b776-404c-b4d3-469134380a63");
+    constexpr uint64_t NUMBER_OF_PERIODS{5U};
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+    m_sut.start();
+
+    deadline_timer periods{PERIOD * NUMBER_OF_PERIODS};
+    for (uint64_t i = 0U; i < NUMBER_OF_PERIODS; ++i)
+    {
+        auto notifications = m_waitSet.wait();
+        ASSERT_THAT(notifications.size(), Eq(1U));
+        EXPECT_TRUE(notifications[0]->doesOriginateFrom(&m_sut));
+    }
+    EXPECT_TRUE(periods.hasExpired());
+
+    auto statistics = m_sut.getJitterStatistics();
+    EXPECT_THAT(statistics.numberOfExpirations, Eq(NUMBER_OF_PERIODS));
+    EXPECT_THAT(statistics.maxJitter, Le(MAX_WAKE_UP_DELAY));
+    EXPECT_THAT(statistics.minJitter, Le(statistics.meanJitter));
+    EXPECT_THAT(statistics.meanJitter, Le(statistics.maxJitter));
+}
+
+TEST_F(TimerTrigger_test, WaitSetTimedWaitReturnsTheTimerWhenItExpiresBeforeTheTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fbb3d8fa-12fb-48b7-8511-d2e2abc89591");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+    m_sut.start();
+
+    auto notifications = m_waitSet.timedWait(MAX_WAKE_UP_DELAY);
+
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_TRUE(notifications[0]->doesOriginateFrom(&m_sut));
+}
+
+TEST_F(TimerTrigger_test, WaitSetTimedWaitTimesOutWhenTheTimerExpiresAfterTheTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1b200af0-adf6-4bf7-88b2-fd771e85c951");
+    TimerTrigger sut{MAX_WAKE_UP_DELAY};
+    ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+    sut.start();
+
+    EXPECT_TRUE(m_waitSet.timedWait(PERIOD).empty());
+}
+
+TEST_F(TimerTrigger_test, StoppedTimerDoesNotWakeUpTheWaitSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6604a2ac-402d-4a20-a490-809d49f2823d");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+    m_sut.start();
+    m_sut.stop();
+
+    EXPECT_TRUE(m_waitSet.timedWait(PERIOD * 5U).empty());
+    EXPECT_FALSE(m_sut.hasTriggered());
+}
+
+TEST_F(TimerTrigger_test, TimerWhichIsStartedBeforeItIsAttachedStartsWhenItIsAttached)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2aee2c80-7dce-4203-9719-f09ea9930ec3");
+    m_sut.start();
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+
+    auto notifications = m_waitSet.timedWait(MAX_WAKE_UP_DELAY);
+
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_TRUE(notifications[0]->doesOriginateFrom(&m_sut));
+}
+
+TEST_F(TimerTrigger_test, TimerWhichIsStartedWhileTheWaitSetIsBlockedWakesItUp)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3cba1b01-e6c0-4c47-b510-0a6e2f25d472");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+
+    std::thread starter([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(PERIOD.toMilliseconds()));
+        m_sut.start();
+    });
+    auto notifications = m_waitSet.timedWait(MAX_WAKE_UP_DELAY);
+    starter.join();
+
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_TRUE(notifications[0]->doesOriginateFrom(&m_sut));
+}
+
+TEST_F(TimerTrigger_test, DetachedTimerDoesNotWakeUpTheWaitSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d30aa45a-d8d3-48fe-bfc8-38af08a7c1d4");
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+    m_sut.start();
+    m_waitSet.detachEvent(m_sut);
+
+    EXPECT_THAT(m_waitSet.size(), Eq(0U));
+    EXPECT_TRUE(m_waitSet.timedWait(PERIOD * 5U).empty());
+    EXPECT_TRUE(m_sut.isRunning());
+}
+
+TEST_F(TimerTrigger_test, DestroyedTimerIsDetachedAndDoesNotWakeUpTheWaitSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4ddd6543-404b-41f1-97de-007d7d2751d4");
+    {
+        TimerTrigger sut{PERIOD};
+        ASSERT_FALSE(m_waitSet.attachEvent(sut).has_error());
+        sut.start();
+    }
+
+    EXPECT_THAT(m_waitSet.size(), Eq(0U));
+    EXPECT_TRUE(m_waitSet.timedWait(PERIOD * 5U).empty());
+}
+
+TEST_F(TimerTrigger_test, TimerCanBeReattachedToAnotherWaitSet)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "693c0481-09cf-4d8f-8aed-7f893d3e4664");
+    ConditionVariableData condVar{"Rosenmontag"};
+    WaitSetTest waitSet{condVar};
+    ASSERT_FALSE(m_waitSet.attachEvent(m_sut).has_error());
+    m_sut.start();
+    ASSERT_FALSE(waitSet.attachEvent(m_sut).has_error());
+
+    EXPECT_THAT(m_waitSet.size(), Eq(0U));
+    auto notifications = waitSet.timedWait(MAX_WAKE_UP_DELAY);
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_TRUE(notifications[0]->doesOriginateFrom(&m_sut));
+}
+
+TEST_F(TimerTrigger_test, JitterStatisticsAreEmptyWhenNotAttached)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "66d60ae2-2d76-4d31-a481-423aaee8c0fe");
+    m_sut.start();
+
+    auto statistics = m_sut.getJitterStatistics();
+    EXPECT_THAT(statistics.numberOfExpirations, Eq(0U));
+    EXPECT_THAT(statistics.maxJitter, Eq(0_ns));
+}
+
+TEST_F(TimerTrigger_test, ListenerCallsTheCallbackOncePerPeriod)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7bac63f2-0675-4cb2-8096-ff034c5287c1");
+    constexpr uint64_t NUMBER_OF_PERIODS{3U};
+    ConditionVariableData condVar{"Helau"};
+    ListenerTest listener{condVar};
+    ASSERT_FALSE(listener.attachEvent(m_sut, createNotificationCallback(listenerCallback)).has_error());
+    m_sut.start();
+
+    deadline_timer timeout{MAX_WAKE_UP_DELAY};
+    while (g_numberOfListenerCallbacks.load() < NUMBER_OF_PERIODS && !timeout.hasExpired())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    m_sut.stop();
+
+    EXPECT_THAT(g_numberOfListenerCallbacks.load(), Ge(NUMBER_OF_PERIODS));
+    EXPECT_THAT(m_sut.getJitterStatistics().numberOfExpirations, Ge(NUMBER_OF_PERIODS));
+}
+} // namespace
@@ -0,0 +1,288 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/timer_wheel.hpp"
+#include "iox/duration.hpp"
+
+#include "test.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+class TimerWheel_test : public Test
+{
+  public:
+    std::vector<uint64_t> advance(const units::Duration now)
+    {
+        std::vector<uint64_t> expiredTimers;
+        m_sut.advance(now, [&](const uint64_t index) { expiredTimers.emplace_back(index); });
+        std::sort(expiredTimers.begin(), expiredTimers.end());
+        return expiredTimers;
+    }
+
+    ConditionVariableData m_condVar{"Mauerbluemchen"};
+    TimerWheel m_sut{m_condVar};
+    units::Duration m_start{TimerWheel::currentTime()};
+};
+
+TEST_F(TimerWheel_test, HasNoNextExpiryWhenNoTimerIsScheduled)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8e7939e0-be4e-4ebe-9f5d-a900c3b9cf41");
+    EXPECT_FALSE(m_sut.timeUntilNextExpiry(m_start).has_value());
+    EXPECT_TRUE(advance(m_start + 1_s).empty());
+}
+
+TEST_F(TimerWheel_test, TimeUntilNextExpiryIsTheTimeUntilTheFirstExpiry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2adc2f16-fb98-4eb5-8982-1dd696561a05");
+    m_sut.schedule(3U, m_start + 10_ms, 10_ms);
+
+    auto timeUntilNextExpiry = m_sut.timeUntilNextExpiry(m_start);
+    ASSERT_TRUE(timeUntilNextExpiry.has_value());
+    EXPECT_THAT(timeUntilNextExpiry.value(), Eq(10_ms));
+}
+
+TEST_F(TimerWheel_test, TimeUntilNextExpiryIsNotRoundedToTheTickOfTheWheel)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "08169d95-57ab-4c09-bea3-da9dc46becbd");
+    m_sut.schedule(3U, m_start + 10_ms + 123_ns, 10_ms);
+
+    auto timeUntilNextExpiry = m_sut.timeUntilNextExpiry(m_start + 17_ns);
+    ASSERT_TRUE(timeUntilNextExpiry.has_value());
+    EXPECT_THAT(timeUntilNextExpiry.value(), Eq(10_ms + 106_ns));
+}
+
+TEST_F(TimerWheel_test, TimeUntilNextExpiryIsZeroWhenTheExpiryIsOverdue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d644997d-63f9-4dfb-a9d1-f32525f1025f");
+    m_sut.schedule(3U, m_start + 10_ms, 10_ms);
+
+    auto timeUntilNextExpiry = m_sut.timeUntilNextExpiry(m_start + 15_ms);
+    ASSERT_TRUE(timeUntilNextExpiry.has_value());
+    EXPECT_THAT(timeUntilNextExpiry.value(), Eq(0_ns));
+}
+
+TEST_F(TimerWheel_test, TimerDoesNotExpireBeforeItsExpiry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1e708097-d915-4c91-8fbb-30d4ec513ea9");
+    m_sut.schedule(3U, m_start + 10_ms, 10_ms);
+
+    EXPECT_TRUE(advance(m_start + 10_ms - 1_ns).empty());
+}
+
+TEST_F(TimerWheel_test, TimerExpiresAtItsExpiryAndIsScheduledForTheNextPeriod)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e394ae61-2a70-489f-b724-f4cc67cbf54f");
+    m_sut.schedule(3U, m_start + 10_ms, 10_ms);
+
+    EXPECT_THAT(advance(m_start + 10_ms), ElementsAre(3U));
+
+    auto timeUntilNextExpiry = m_sut.timeUntilNextExpiry(m_start + 10_ms);
+    ASSERT_TRUE(timeUntilNextExpiry.has_value());
+    EXPECT_THAT(timeUntilNextExpiry.value(), Eq(10_ms));
+}
+
+TEST_F(TimerWheel_test, PeriodicTimerExpiresOncePerPeriod)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5aee0854-3324-4b3a-b760-bd1ec8750b39");
+    constexpr uint64_t NUMBER_OF_PERIODS{1000U};
+    m_sut.schedule(7U, m_start + 3_ms, 3_ms);
+
+    uint64_t numberOfExpirations{0U};
+    for (uint64_t i = 1U; i <= NUMBER_OF_PERIODS; ++i)
+    {
+        EXPECT_TRUE(advance(m_start + 3_ms * i - 1_ns).empty());
+        numberOfExpirations += advance(m_start + 3_ms * i).size();
+    }
+
+    EXPECT_THAT(numberOfExpirations, Eq(NUMBER_OF_PERIODS));
+    EXPECT_THAT(m_sut.getJitterStatistics(7U).numberOfExpirations, Eq(NUMBER_OF_PERIODS));
+    EXPECT_THAT(m_sut.getJitterStatistics(7U).numberOfMissedExpirations, Eq(0U));
+}
+
+TEST_F(TimerWheel_test, MissedPeriodsAreSkippedAndCounted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0872541c-a86e-48aa-95db-b00af901ef70");
+    m_sut.schedule(3U, m_start + 10_ms, 10_ms);
+
+    EXPECT_THAT(advance(m_start + 35_ms), ElementsAre(3U));
+
+    auto statistics = m_sut.getJitterStatistics(3U);
+    EXPECT_THAT(statistics.numberOfExpirations, Eq(1U));
+    EXPECT_THAT(statistics.numberOfMissedExpirations, Eq(2U));
+
+    auto timeUntilNextExpiry = m_sut.timeUntilNextExpiry(m_start + 35_ms);
+    ASSERT_TRUE(timeUntilNextExpiry.has_value());
+    EXPECT_THAT(timeUntilNextExpiry.value(), Eq(5_ms));
+}
+
+TEST_F(TimerWheel_test, JitterStatisticsContainTheDelayOfTheExpiries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4a5aa31d-d113-40a3-b385-a4b242137436");
+    m_sut.schedule(3U, m_start + 10_ms, 10_ms);
+
+    EXPECT_THAT(advance(m_start + 11_ms), ElementsAre(3U));
+    EXPECT_THAT(advance(m_start + 22_ms), ElementsAre(3U));
+
+    auto statistics = m_sut.getJitterStatistics(3U);
+    EXPECT_THAT(statistics.numberOfExpirations, Eq(2U));
+    EXPECT_THAT(statistics.minJitter, Eq(1_ms));
+    EXPECT_THAT(statistics.maxJitter, Eq(2_ms));
+    EXPECT_THAT(statistics.meanJitter, Eq(1500_us));
+}
+
+TEST_F(TimerWheel_test, CanceledTimerDoesNotExpire)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f4ce4a23-e929-4faa-b014-5839f404478f");
+    m_sut.schedule(3U, m_start + 10_ms, 10_ms);
+    m_sut.cancel(3U);
+
+    EXPECT_TRUE(advance(m_start + 1_s).empty());
+    EXPECT_FALSE(m_sut.timeUntilNextExpiry(m_start).has_value());
+}
+
+TEST_F(TimerWheel_test, CancelingTimerWhichIsNotScheduledDoesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "17e7f97b-8b2e-4d3a-9bdb-fffa3ce7c595");
+    m_sut.schedule(3U, m_start + 10_ms, 10_ms);
+    m_sut.cancel(4U);
+    m_sut.cancel(MAX_NUMBER_OF_NOTIFIERS);
+
+    EXPECT_THAT(advance(m_start + 10_ms), ElementsAre(3U));
+}
+
+TEST_F(TimerWheel_test, SchedulingTimerAgainReplacesItAndResetsItsStatistics)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9a59a33f-f00f-45f1-871b-d7a26accd3f7");
+    m_sut.schedule(3U, m_start + 10_ms, 10_ms);
+    EXPECT_THAT(advance(m_start + 10_ms), ElementsAre(3U));
+
+    m_sut.schedule(3U, m_start + 50_ms, 40_ms);
+
+    EXPECT_THAT(m_sut.getJitterStatistics(3U).numberOfExpirations, Eq(0U));
+    EXPECT_TRUE(advance(m_start + 50_ms - 1_ns).empty());
+    EXPECT_THAT(advance(m_start + 50_ms), ElementsAre(3U));
+    EXPECT_TRUE(advance(m_start + 90_ms - 1_ns).empty());
+    EXPECT_THAT(advance(m_start + 90_ms), ElementsAre(3U));
+}
+
+TEST_F(TimerWheel_test, TimersExpiringInTheSameTickExpireTogether)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "948a62f2-0421-4339-b899-91a476cdab1e");
+    m_sut.schedule(1U, m_start + 10_ms, 10_ms);
+    m_sut.schedule(5U, m_start + 10_ms, 20_ms);
+    m_sut.schedule(9U, m_start + 20_ms, 20_ms);
+
+    EXPECT_THAT(advance(m_start + 10_ms), ElementsAre(1U, 5U));
+    EXPECT_THAT(advance(m_start + 20_ms), ElementsAre(1U, 9U));
+    EXPECT_THAT(advance(m_start + 30_ms), ElementsAre(1U, 5U));
+}
+
+TEST_F(TimerWheel_test, TimersOnAllLevelsAndBeyondTheRangeOfTheWheelExpireAtTheirExpiry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3b34992b-88da-4204-a951-4acae0f5079d");
+    const std::vector<units::Duration> timeUntilExpiry{
+        300_us, 5_ms, 50_ms, 700_ms, 30_s, 1500_s, units::Duration::fromHours(10)};
+    const auto period = units::Duration::fromDays(1000);
+    for (uint64_t i = 0U; i < timeUntilExpiry.size(); ++i)
+    {
+        m_sut.schedule(i, m_start + timeUntilExpiry[i], period);
+    }
+
+    for (uint64_t i = 0U; i < timeUntilExpiry.size(); ++i)
+    {
+        auto timeUntilNextExpiry = m_sut.timeUntilNextExpiry(m_start);
+        ASSERT_TRUE(timeUntilNextExpiry.has_value());
+        EXPECT_THAT(timeUntilNextExpiry.value(), Eq(timeUntilExpiry[i]));
+
+        EXPECT_TRUE(advance(m_start + timeUntilExpiry[i] - 1_ns).empty());
+        EXPECT_THAT(advance(m_start + timeUntilExpiry[i]), ElementsAre(i));
+    }
+}
+
+TEST_F(TimerWheel_test, ManyTimersWithDifferentPeriodsExpireExactlyAtTheirExpiries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "19fc685e-38b6-42c9-b7ee-f67b00b84b3f");
+    // deterministic pseudo random periods from 100us to about 6.5s which are spread over the first three levels
+    std::vector<units::Duration> periods;
+    std::vector<units::Duration> nextExpiries;
+    uint64_t seed{42U};
+    for (uint64_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS; ++i)
+    {
+        seed = seed * 6364136223846793005U + 1442695040888963407U;
+        periods.emplace_back(units::Duration::fromMicroseconds(100U + (seed >> 48U) * 100U));
+        nextExpiries.emplace_back(m_start + periods.back());
+        m_sut.schedule(i, nextExpiries.back(), periods.back());
+    }
+
+    auto now = m_start;
+    const auto end = m_start + 20_s;
+    while (now < end)
+    {
+        seed = seed * 6364136223846793005U + 1442695040888963407U;
+        now = now + units::Duration::fromMicroseconds(1U + (seed >> 48U) % 20000U);
+
+        std::vector<uint64_t> expectedTimers;
+        for (uint64_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS; ++i)
+        {
+            if (nextExpiries[i] <= now)
+            {
+                expectedTimers.emplace_back(i);
+                while (nextExpiries[i] <= now)
+                {
+                    nextExpiries[i] = nextExpiries[i] + periods[i];
+                }
+            }
+        }
+
+        ASSERT_THAT(advance(now), ContainerEq(expectedTimers));
+        auto timeUntilNextExpiry = m_sut.timeUntilNextExpiry(now);
+        ASSERT_TRUE(timeUntilNextExpiry.has_value());
+        EXPECT_THAT(now + timeUntilNextExpiry.value(), Eq(*std::min_element(nextExpiries.begin(), nextExpiries.end())));
+    }
+}
+
+TEST_F(TimerWheel_test, SchedulingTimerWakesUpTheWaiter)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a5d7de17-7f1d-4241-8aab-e8ad06324927");
+    m_condVar.m_numberOfWaiters.store(1U);
+
+    m_sut.schedule(3U, m_start + 10_ms, 10_ms);
+
+    auto wasPosted = m_condVar.m_semaphore->tryWait();
+    ASSERT_FALSE(wasPosted.has_error());
+    EXPECT_TRUE(wasPosted.value());
+}
+
+TEST_F(TimerWheel_test, SchedulingTimerDoesNotPostTheSemaphoreWithoutWaiter)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a0c43681-1843-4576-8974-395444356b77");
+    m_sut.schedule(3U, m_start + 10_ms, 10_ms);
+
+    auto wasPosted = m_condVar.m_semaphore->tryWait();
+    ASSERT_FALSE(wasPosted.has_error());
+    EXPECT_FALSE(wasPosted.value());
+}
+} // namespace
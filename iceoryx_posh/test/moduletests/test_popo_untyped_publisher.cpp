@@ -21,6 +21,9 @@
 
 #include "test.hpp"
 
+#include <memory>
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -137,6 +140,137 @@ TEST_F(UntypedPublisherTest, PublishesUserPayloadViaUnderlyingPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(UntypedPublisherTest, LoanBatchLoansTheRequestedNumberOfChunksWithOneCallOnUnderlyingPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c7badc6c-56e7-4e4f-b9c8-63856fe33048");
+    constexpr uint32_t ALLOCATION_SIZE = 7U;
+    ChunkMock<uint64_t> secondChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunks(_, ALLOCATION_SIZE, _, _, _))
+        .WillOnce(Invoke([&](const iox::span<iox::mepoo::ChunkHeader*> chunkHeaders,
+                             const uint32_t,
+                             const uint32_t,
+                             const uint32_t,
+                             const uint32_t) -> iox::expected<void, iox::popo::AllocationError> {
+            EXPECT_THAT(chunkHeaders.size(), Eq(2U));
+            chunkHeaders[0] = chunkMock.chunkHeader();
+            chunkHeaders[1] = secondChunkMock.chunkHeader();
+            return iox::ok();
+        }));
+    EXPECT_CALL(portMock, tryAllocateChunk).Times(0);
+    // ===== Test ===== //
+    auto result = sut.loanBatch(2U, ALLOCATION_SIZE);
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    ASSERT_THAT(result.value().size(), Eq(2U));
+    EXPECT_EQ(chunkMock.chunkHeader()->userPayload(), result.value()[0]);
+    EXPECT_EQ(secondChunkMock.chunkHeader()->userPayload(), result.value()[1]);
+    // ===== Cleanup ===== //
+}
+
+TEST_F(UntypedPublisherTest, LoanBatchReturnsAllocationErrorOfUnderlyingPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6d8dbc41-c9f5-4925-b6f8-c092761b4291");
+    constexpr uint32_t ALLOCATION_SIZE = 7U;
+    EXPECT_CALL(portMock, tryAllocateChunks(_, ALLOCATION_SIZE, _, _, _))
+        .WillOnce(Return(ByMove(iox::err(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS))));
+    EXPECT_CALL(portMock, releaseChunk).Times(0);
+    // ===== Test ===== //
+    auto result = sut.loanBatch(2U, ALLOCATION_SIZE);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS, result.error());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(UntypedPublisherTest, LoanBatchWithMoreChunksThanAllowedPerBatchFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a5e3f0c2-9b7d-4e1a-8c64-2f0d9b3e7a15");
+    constexpr uint32_t ALLOCATION_SIZE = 7U;
+    EXPECT_CALL(portMock, tryAllocateChunks).Times(0);
+    // ===== Test ===== //
+    auto result = sut.loanBatch(iox::MAX_CHUNKS_PER_PUBLISHER_BATCH + 1U, ALLOCATION_SIZE);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL, result.error());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(UntypedPublisherTest, PublishBatchSendsAllUserPayloadsWithOneCallOnUnderlyingPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0bee9185-c1b8-4175-8bd2-adb253ecea44");
+    // ===== Setup ===== //
+    ChunkMock<uint64_t> secondChunkMock;
+    void* userPayloads[] = {chunkMock.chunkHeader()->userPayload(), secondChunkMock.chunkHeader()->userPayload()};
+    std::vector<iox::mepoo::ChunkHeader*> sentChunkHeaders;
+    EXPECT_CALL(portMock, sendChunks(_))
+        .WillOnce(Invoke([&](const iox::span<iox::mepoo::ChunkHeader* const> chunkHeaders) {
+            sentChunkHeaders.assign(chunkHeaders.data(), chunkHeaders.data() + chunkHeaders.size());
+        }));
+    EXPECT_CALL(portMock, sendChunk).Times(0);
+    // ===== Test ===== //
+    sut.publishBatch(iox::span<void* const>(userPayloads, 2U));
+    // ===== Verify ===== //
+    ASSERT_THAT(sentChunkHeaders.size(), Eq(2U));
+    EXPECT_EQ(chunkMock.chunkHeader(), sentChunkHeaders[0]);
+    EXPECT_EQ(secondChunkMock.chunkHeader(), sentChunkHeaders[1]);
+    // ===== Cleanup ===== //
+}
+
+TEST_F(UntypedPublisherTest, PublishBatchWithNullptrReportsErrorAndSendsTheOtherUserPayloads)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e6756460-e701-477e-8797-c3fcb01efc1f");
+    // ===== Setup ===== //
+    void* userPayloads[] = {nullptr, chunkMock.chunkHeader()->userPayload()};
+    std::vector<iox::mepoo::ChunkHeader*> sentChunkHeaders;
+    EXPECT_CALL(portMock, sendChunks(_))
+        .WillOnce(Invoke([&](const iox::span<iox::mepoo::ChunkHeader* const> chunkHeaders) {
+            sentChunkHeaders.assign(chunkHeaders.data(), chunkHeaders.data() + chunkHeaders.size());
+        }));
+    iox::optional<iox::PoshError> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&](const iox::PoshError error, const iox::ErrorLevel) { detectedError.emplace(error); });
+    // ===== Test ===== //
+    sut.publishBatch(iox::span<void* const>(userPayloads, 2U));
+    // ===== Verify ===== //
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::PoshError::POPO__CHUNK_SENDER_INVALID_CHUNK_TO_SEND_FROM_USER));
+    ASSERT_THAT(sentChunkHeaders.size(), Eq(1U));
+    EXPECT_EQ(chunkMock.chunkHeader(), sentChunkHeaders[0]);
+    // ===== Cleanup ===== //
+}
+
+TEST_F(UntypedPublisherTest, PublishBatchLargerThanTheNumberOfChunksAllowedPerBatchSendsAllUserPayloadsInParts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d73bb08-d920-4d70-96e0-6e725b8e6fb3");
+    // ===== Setup ===== //
+    constexpr uint64_t NUMBER_OF_CHUNKS{iox::MAX_CHUNKS_PER_PUBLISHER_BATCH + 3U};
+    std::vector<std::unique_ptr<ChunkMock<uint64_t>>> chunkMocks;
+    std::vector<void*> userPayloads;
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunkMocks.emplace_back(new ChunkMock<uint64_t>());
+        userPayloads.push_back(chunkMocks.back()->chunkHeader()->userPayload());
+    }
+    std::vector<iox::mepoo::ChunkHeader*> sentChunkHeaders;
+    EXPECT_CALL(portMock, sendChunks(_))
+        .Times(2)
+        .WillRepeatedly(Invoke([&](const iox::span<iox::mepoo::ChunkHeader* const> chunkHeaders) {
+            EXPECT_THAT(chunkHeaders.size(), Le(iox::MAX_CHUNKS_PER_PUBLISHER_BATCH));
+            sentChunkHeaders.insert(
+                sentChunkHeaders.end(), chunkHeaders.data(), chunkHeaders.data() + chunkHeaders.size());
+        }));
+    EXPECT_CALL(portMock, sendChunk).Times(0);
+    // ===== Test ===== //
+    sut.publishBatch(iox::span<void* const>(userPayloads.data(), userPayloads.size()));
+    // ===== Verify ===== //
+    ASSERT_THAT(sentChunkHeaders.size(), Eq(NUMBER_OF_CHUNKS));
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_EQ(chunkMocks[i]->chunkHeader(), sentChunkHeaders[i]);
+    }
+    // ===== Cleanup ===== //
+}
+
 // test whether the BasePublisher methods are called
 
 TEST_F(UntypedPublisherTest, OfferDoesOfferServiceOnUnderlyingPort)
@@ -22,6 +22,10 @@
 
 #include "test.hpp"
 
+#include <algorithm>
+#include <random>
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -123,6 +127,24 @@ TEST_F(UsedChunkList_test, AddChunksUntilOverflowIsHandledGracefully)
     EXPECT_FALSE(sut.insert(getChunkFromMemoryManager()));
 }
 
+TEST_F(UsedChunkList_test, SizeCountsInsertedAndRemovedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f0e6f52-4c1e-4d0b-95e2-2b7a0c8d5e91");
+    EXPECT_THAT(sut.size(), Eq(0U));
+
+    auto chunk = getChunkFromMemoryManager();
+    sut.insert(chunk);
+    sut.insert(getChunkFromMemoryManager());
+    EXPECT_THAT(sut.size(), Eq(2U));
+
+    SharedChunk removedChunk;
+    EXPECT_TRUE(sut.remove(chunk.getChunkHeader(), removedChunk));
+    EXPECT_THAT(sut.size(), Eq(1U));
+
+    sut.cleanup();
+    EXPECT_THAT(sut.size(), Eq(0U));
+}
+
 TEST_F(UsedChunkList_test, OneChunkCanBeRemoved)
 {
     ::testing::Test::RecordProperty("TEST_ID", "50ffb5df-59ef-4dd4-a2a6-c7ad342c24ae");
@@ -233,6 +255,68 @@ TEST_F(UsedChunkList_test, UsedChunkListCanBeFilledToCapacityAndFullyEmptied)
     checkIfEmpty();
 }
 
+TEST_F(UsedChunkList_test, ManyChunksCanBeRemovedInShuffledOrderAndReinserted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d95cdf4-6209-4bcf-8692-d6d70f638d0f");
+    constexpr uint32_t LARGE_CAPACITY{64U};
+    UsedChunkList<LARGE_CAPACITY> largeSut;
+
+    std::vector<ChunkHeader*> chunkHeaderInUse;
+    createMultipleChunks(LARGE_CAPACITY, [&](SharedChunk&& chunk) {
+        chunkHeaderInUse.push_back(chunk.getChunkHeader());
+        EXPECT_TRUE(largeSut.insert(chunk));
+    });
+
+    std::mt19937 generator{42U};
+    for (uint32_t round = 0U; round < 3U; ++round)
+    {
+        std::shuffle(chunkHeaderInUse.begin(), chunkHeaderInUse.end(), generator);
+        const auto numberOfChunksToRemove = chunkHeaderInUse.size() / 2U;
+        std::vector<SharedChunk> removedChunks;
+        for (uint32_t i = 0U; i < numberOfChunksToRemove; ++i)
+        {
+            SharedChunk removedChunk;
+            ASSERT_TRUE(largeSut.remove(chunkHeaderInUse[i], removedChunk));
+            EXPECT_THAT(removedChunk.getChunkHeader(), Eq(chunkHeaderInUse[i]));
+            removedChunks.push_back(removedChunk);
+        }
+
+        for (auto& chunk : removedChunks)
+        {
+            EXPECT_TRUE(largeSut.insert(chunk));
+        }
+    }
+
+    for (auto chunkHeader : chunkHeaderInUse)
+    {
+        SharedChunk removedChunk;
+        EXPECT_TRUE(largeSut.remove(chunkHeader, removedChunk));
+        EXPECT_THAT(removedChunk.getChunkHeader(), Eq(chunkHeader));
+    }
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+}
+
+TEST_F(UsedChunkList_test, RemovingAChunkDoesNotHideChunksWhichCollidedWithIt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b64492e4-6433-4d00-982b-cb6fce64cf9b");
+    // the same chunk inserted multiple times always collides in the hash index
+    auto chunk = getChunkFromMemoryManager();
+    auto otherChunk = getChunkFromMemoryManager();
+    EXPECT_TRUE(sut.insert(chunk));
+    EXPECT_TRUE(sut.insert(chunk));
+    EXPECT_TRUE(sut.insert(otherChunk));
+    EXPECT_TRUE(sut.insert(chunk));
+
+    SharedChunk removedChunk;
+    EXPECT_TRUE(sut.remove(chunk.getChunkHeader(), removedChunk));
+    EXPECT_TRUE(sut.remove(otherChunk.getChunkHeader(), removedChunk));
+    EXPECT_TRUE(sut.remove(chunk.getChunkHeader(), removedChunk));
+    EXPECT_TRUE(sut.remove(chunk.getChunkHeader(), removedChunk));
+    EXPECT_FALSE(sut.remove(chunk.getChunkHeader(), removedChunk));
+
+    checkIfEmpty();
+}
+
 TEST_F(UsedChunkList_test, RemoveChunkFromEmptyListIsHandledGracefully)
 {
     ::testing::Test::RecordProperty("TEST_ID", "2c4a64d1-07cc-4334-89bf-dd58ad291af5");
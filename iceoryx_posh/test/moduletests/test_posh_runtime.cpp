@@ -23,14 +23,19 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/popo/publisher.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
 #include "iceoryx_posh/popo/untyped_client.hpp"
 #include "iceoryx_posh/popo/untyped_server.hpp"
+#include "iceoryx_posh/runtime/port_batch.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_posh/runtime/service_discovery.hpp"
 #include "iceoryx_posh/testing/mocks/posh_runtime_mock.hpp"
 #include "iceoryx_posh/testing/roudi_environment/roudi_environment.hpp"
 #include "test.hpp"
 
+#include <set>
 #include <type_traits>
+#include <vector>
 
 namespace
 {
@@ -379,9 +384,13 @@ TEST_F(PoshRuntime_test, GetMiddlewarePublisherWithForbiddenServiceDescriptionsF
     iox::vector<iox::capro::ServiceDescription, iox::NUMBER_OF_INTERNAL_PUBLISHERS> internalServices;
     const iox::capro::ServiceDescription serviceRegistry{
         iox::SERVICE_DISCOVERY_SERVICE_NAME, iox::SERVICE_DISCOVERY_INSTANCE_NAME, iox::SERVICE_DISCOVERY_EVENT_NAME};
+    const iox::capro::ServiceDescription serviceRegistryChanges{iox::SERVICE_DISCOVERY_SERVICE_NAME,
+                                                                iox::SERVICE_DISCOVERY_INSTANCE_NAME,
+                                                                iox::SERVICE_DISCOVERY_CHANGES_EVENT_NAME};
 
     // Added by PortManager
     internalServices.push_back(serviceRegistry);
+    internalServices.push_back(serviceRegistryChanges);
     internalServices.push_back(iox::roudi::IntrospectionPortService);
     internalServices.push_back(iox::roudi::IntrospectionPortThroughputService);
     internalServices.push_back(iox::roudi::IntrospectionSubscriberPortChangingDataService);
@@ -526,6 +535,22 @@ TEST_F(PoshRuntime_test, GetMiddlewareSubscriberWithHistoryRequestLargerThanQueu
     EXPECT_EQ(EXPECTED_HISTORY_REQUEST, subscriberPort->m_options.historyRequest);
 }
 
+TEST_F(PoshRuntime_test, GetMiddlewareSubscriberWithHistoryRequestAndQueueCapacityZeroClampsToTheClampedQueueCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f3a1c6d2-7b48-4e09-a5d3-2c9e8b0f1a64");
+    iox::popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.queueCapacity = 0U;
+    subscriberOptions.historyRequest = 1U;
+
+    auto subscriberPort =
+        m_runtime->getMiddlewareSubscriber(iox::capro::ServiceDescription("Harder", "Better", "Stronger"),
+                                           subscriberOptions,
+                                           iox::runtime::PortConfigInfo(33U, 11U, 22U));
+
+    EXPECT_EQ(1U, subscriberPort->m_chunkReceiverData.m_queue.capacity());
+    EXPECT_EQ(1U, subscriberPort->m_options.historyRequest);
+}
+
 TEST_F(PoshRuntime_test, GetMiddlewareSubscriberDefaultArgs)
 {
     ::testing::Test::RecordProperty("TEST_ID", "e06b999c-e237-4e32-b826-a5ffdb6bb737");
@@ -635,6 +660,189 @@ TEST_F(PoshRuntime_test, GetMiddlewareSubscriberWithQueueFullPolicySetToBlockPub
                 Eq(iox::popo::QueueFullPolicy::BLOCK_PRODUCER));
 }
 
+TEST_F(PoshRuntime_test, CreatePortsCreatesPublishersAndSubscribersOfMoreThanOneControlChannelBatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "88492c7d-d6e5-4546-82d0-c521bdaa7b6d");
+    constexpr uint64_t NUMBER_OF_PORTS{2U * iox::MAX_CONTROL_CHANNEL_REQUESTS + 3U};
+    std::vector<PortRequest> requests;
+    for (uint64_t i = 0U; i < NUMBER_OF_PORTS; ++i)
+    {
+        const iox::capro::ServiceDescription service{
+            "Bulk", "Port", into<lossy<iox::capro::IdString_t>>(convert::toString(i))};
+        requests.push_back((i % 2U == 0U) ? PortRequest::publisher(service) : PortRequest::subscriber(service));
+    }
+
+    const auto numberOfCreatedPorts = m_runtime->createPorts(iox::span<PortRequest>(requests.data(), requests.size()));
+
+    EXPECT_THAT(numberOfCreatedPorts, Eq(NUMBER_OF_PORTS));
+    std::set<void*> ports;
+    for (auto& request : requests)
+    {
+        if (request.type == PortRequestType::PUBLISHER)
+        {
+            ASSERT_THAT(request.publisherPortData, Ne(nullptr));
+            EXPECT_THAT(request.subscriberPortData, Eq(nullptr));
+            EXPECT_THAT(request.publisherPortData->m_serviceDescription, Eq(request.service));
+            EXPECT_THAT(request.publisherPortData->m_nodeName, Eq(m_runtimeName));
+            ports.insert(request.publisherPortData);
+        }
+        else
+        {
+            ASSERT_THAT(request.subscriberPortData, Ne(nullptr));
+            EXPECT_THAT(request.publisherPortData, Eq(nullptr));
+            EXPECT_THAT(request.subscriberPortData->m_serviceDescription, Eq(request.service));
+            EXPECT_THAT(request.subscriberPortData->m_nodeName, Eq(m_runtimeName));
+            ports.insert(request.subscriberPortData);
+        }
+    }
+    EXPECT_THAT(ports.size(), Eq(NUMBER_OF_PORTS));
+}
+
+TEST_F(PoshRuntime_test, CreatePortsClampsTheOptionsLikeTheSinglePortCreation)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5451d12e-2997-4a6f-8c28-e45233101d02");
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = iox::MAX_PUBLISHER_HISTORY + 1U;
+    iox::popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.queueCapacity = 0U;
+    PortRequest requests[]{PortRequest::publisher({"Clamp", "The", "Publisher"}, publisherOptions),
+                           PortRequest::subscriber({"Clamp", "The", "Subscriber"}, subscriberOptions)};
+
+    EXPECT_THAT(m_runtime->createPorts(iox::span<PortRequest>(requests)), Eq(2U));
+
+    ASSERT_THAT(requests[0].publisherPortData, Ne(nullptr));
+    EXPECT_THAT(requests[0].publisherPortData->m_chunkSenderData.m_historyCapacity, Eq(iox::MAX_PUBLISHER_HISTORY));
+    ASSERT_THAT(requests[1].subscriberPortData, Ne(nullptr));
+    EXPECT_THAT(requests[1].subscriberPortData->m_chunkReceiverData.m_queue.capacity(), Eq(1U));
+}
+
+TEST_F(PoshRuntime_test, CreatePortsReleasesTheCreatedPortsWhenAPortCouldNotBeCreated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "23d38510-f7a9-41b0-9bdc-c0d6cb21efa2");
+    bool forbiddenServiceDescriptionDetected{false};
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&forbiddenServiceDescriptionDetected](const iox::PoshError error, const iox::ErrorLevel) {
+            if (error == iox::PoshError::POSH__RUNTIME_SERVICE_DESCRIPTION_FORBIDDEN)
+            {
+                forbiddenServiceDescriptionDetected = true;
+            }
+        });
+
+    // the failing port belongs to the second control channel batch, i.e. the ports of the first batch are already
+    // created when the failure is detected
+    constexpr uint64_t FAILING_PORT_INDEX{iox::MAX_CONTROL_CHANNEL_REQUESTS + 1U};
+    constexpr uint64_t NUMBER_OF_PORTS{2U * iox::MAX_CONTROL_CHANNEL_REQUESTS + 3U};
+    std::vector<PortRequest> requests;
+    for (uint64_t i = 0U; i < NUMBER_OF_PORTS; ++i)
+    {
+        const iox::capro::ServiceDescription service{
+            "RolledBack", "Port", into<lossy<iox::capro::IdString_t>>(convert::toString(i))};
+        requests.push_back((i == FAILING_PORT_INDEX) ? PortRequest::publisher(iox::roudi::IntrospectionPortService)
+                                                     : PortRequest::publisher(service));
+    }
+
+    EXPECT_THAT(m_runtime->createPorts(iox::span<PortRequest>(requests.data(), requests.size())), Eq(0U));
+
+    EXPECT_TRUE(forbiddenServiceDescriptionDetected);
+    for (const auto& request : requests)
+    {
+        EXPECT_THAT(request.publisherPortData, Eq(nullptr));
+        EXPECT_THAT(request.subscriberPortData, Eq(nullptr));
+    }
+
+    InterOpWait();
+    uint64_t numberOfOfferedPorts{0U};
+    ServiceDiscovery serviceDiscovery;
+    serviceDiscovery.findService(
+        iox::capro::IdString_t("RolledBack"),
+        iox::nullopt,
+        iox::nullopt,
+        [&numberOfOfferedPorts](const iox::capro::ServiceDescription&) { ++numberOfOfferedPorts; },
+        iox::popo::MessagingPattern::PUB_SUB);
+    EXPECT_THAT(numberOfOfferedPorts, Eq(0U));
+}
+
+TEST_F(PoshRuntime_test, CreatePortsWithoutRequestsCreatesNoPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bfcf461f-a506-41dc-9dd3-f0954eaf3bf9");
+    EXPECT_THAT(m_runtime->createPorts(iox::span<PortRequest>(static_cast<PortRequest*>(nullptr), 0U)), Eq(0U));
+}
+
+TEST_F(PoshRuntime_test, PortBatchCreatesPublisherAndSubscriberWhichCommunicate)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "31fc4eb1-3117-4cc5-bcf2-3cc630198dc2");
+    const iox::capro::ServiceDescription service{"Prepared", "Then", "Committed"};
+    PortBatch<> sut;
+    const auto publisherIndex = sut.preparePublisher(service);
+    const auto subscriberIndex = sut.prepareSubscriber(service);
+    ASSERT_FALSE(publisherIndex.has_error());
+    ASSERT_FALSE(subscriberIndex.has_error());
+
+    EXPECT_THAT(sut.commit(), Eq(2U));
+    EXPECT_TRUE(sut.isCommitted());
+
+    auto preparedPublisher = sut.takePublisher(publisherIndex.value());
+    auto preparedSubscriber = sut.takeSubscriber(subscriberIndex.value());
+    ASSERT_TRUE(preparedPublisher.has_value());
+    ASSERT_TRUE(preparedSubscriber.has_value());
+    iox::popo::Publisher<uint64_t> publisher{preparedPublisher.value()};
+    iox::popo::Subscriber<uint64_t> subscriber{preparedSubscriber.value()};
+
+    EXPECT_THAT(publisher.getServiceDescription(), Eq(service));
+    ASSERT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+    ASSERT_FALSE(publisher.publishCopyOf(73U).has_error());
+    auto sample = subscriber.take();
+    ASSERT_FALSE(sample.has_error());
+    EXPECT_THAT(*sample.value(), Eq(73U));
+}
+
+TEST_F(PoshRuntime_test, PortBatchHandsOutEachPortOnlyOnceAndOnlyForTheMatchingType)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d8241619-7d8b-4bca-b3af-f6488df7fc31");
+    PortBatch<> sut;
+    const auto publisherIndex = sut.preparePublisher({"Taken", "Only", "Once"}).value();
+
+    EXPECT_FALSE(sut.takeSubscriber(publisherIndex).has_value());
+    EXPECT_FALSE(sut.takePublisher(publisherIndex + 1U).has_value());
+    auto preparedPublisher = sut.takePublisher(publisherIndex);
+    ASSERT_TRUE(preparedPublisher.has_value());
+    EXPECT_FALSE(sut.takePublisher(publisherIndex).has_value());
+    iox::popo::UntypedPublisher publisher{preparedPublisher.value()};
+}
+
+TEST_F(PoshRuntime_test, PortBatchReleasesTheCreatedPortsWhenAPortCouldNotBeCreated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3c0d8f5a-7b1e-4a92-9e6d-54f2a1c8b0e7");
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [](const iox::PoshError, const iox::ErrorLevel) {});
+    PortBatch<> sut;
+    const auto publisherIndex = sut.preparePublisher({"Rolled", "Back", "Publisher"}).value();
+    ASSERT_FALSE(sut.preparePublisher(iox::roudi::IntrospectionPortService).has_error());
+    const auto subscriberIndex = sut.prepareSubscriber({"Rolled", "Back", "Subscriber"}).value();
+
+    EXPECT_THAT(sut.commit(), Eq(0U));
+
+    EXPECT_FALSE(sut.takePublisher(publisherIndex).has_value());
+    EXPECT_FALSE(sut.takeSubscriber(subscriberIndex).has_value());
+}
+
+TEST_F(PoshRuntime_test, PortBatchRejectsPortsWhenFullOrAlreadyCommitted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9f361fdb-6651-4442-b91f-14b30500ee86");
+    PortBatch<1U> sut;
+    ASSERT_FALSE(sut.preparePublisher({"Full", "Batch", "First"}).has_error());
+
+    const auto fullResult = sut.prepareSubscriber({"Full", "Batch", "Second"});
+    ASSERT_TRUE(fullResult.has_error());
+    EXPECT_THAT(fullResult.error(), Eq(PortBatchError::BATCH_FULL));
+
+    EXPECT_THAT(sut.commit(), Eq(1U));
+    EXPECT_THAT(sut.commit(), Eq(0U));
+    const auto committedResult = sut.prepareSubscriber({"Full", "Batch", "Third"});
+    ASSERT_TRUE(committedResult.has_error());
+    EXPECT_THAT(committedResult.error(), Eq(PortBatchError::ALREADY_COMMITTED));
+}
+
 TEST_F(PoshRuntime_test, GetMiddlewareClientWithDefaultArgsIsSuccessful)
 {
     ::testing::Test::RecordProperty("TEST_ID", "2db35746-e402-443f-b374-3b6a239ab5fd");
@@ -36,7 +36,9 @@ bool operator==(const CmdLineArgs_t& lhs, const CmdLineArgs_t& rhs)
 {
     return (lhs.monitoringMode == rhs.monitoringMode) && (lhs.logLevel == rhs.logLevel)
            && (lhs.compatibilityCheckLevel == rhs.compatibilityCheckLevel)
-           && (lhs.processKillDelay == rhs.processKillDelay) && (lhs.uniqueRouDiId == rhs.uniqueRouDiId)
+           && (lhs.processKillDelay == rhs.processKillDelay)
+           && (lhs.numberOfRuntimeMessageWorkers == rhs.numberOfRuntimeMessageWorkers)
+           && (lhs.uniqueRouDiId == rhs.uniqueRouDiId)
            && (lhs.run == rhs.run) && (lhs.configFilePath == rhs.configFilePath);
 }
 } // namespace config
@@ -346,6 +348,72 @@ TEST_F(CmdLineParser_test, KillDelayOptionOutOfBoundsLeadsToProgrammNotRunning)
     EXPECT_FALSE(result.value().run);
 }
 
+TEST_F(CmdLineParser_test, RuntimeMessageWorkersLongOptionLeadsToCorrectNumberOfWorkers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d4c8b7e-5a47-4d0f-9f0b-3c1e6f2a8d51");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--runtime-message-workers";
+    char value[] = "4";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().numberOfRuntimeMessageWorkers, 4U);
+    EXPECT_TRUE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, RuntimeMessageWorkersShortOptionLeadsToCorrectNumberOfWorkers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b7f2e913-6c0a-4e58-8d2b-91a4c5e7f036");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "-w";
+    char value[] = "16";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().numberOfRuntimeMessageWorkers, 16U);
+    EXPECT_TRUE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, RuntimeMessageWorkersOptionOutOfBoundsLeadsToProgrammNotRunning)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e93a6d1-2f8c-47b4-a0e5-d6c817b2f94a");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--runtime-message-workers";
+    char valueArray[][10] = {"0", "17"}; // 0 and MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS + 1
+    args[0] = &appName[0];
+    args[1] = &option[0];
+
+    for (auto value : valueArray)
+    {
+        args[2] = value;
+
+        CmdLineParser sut;
+        auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+        ASSERT_FALSE(result.has_error());
+        EXPECT_FALSE(result.value().run);
+
+        // Reset optind to be able to parse again
+        optind = 0;
+    }
+}
+
 TEST_F(CmdLineParser_test, CompatibilityLevelOptionsLeadToCorrectCompatibilityLevel)
 {
     ::testing::Test::RecordProperty("TEST_ID", "62b7d5c9-0638-4314-b4f7-c622ef101045");
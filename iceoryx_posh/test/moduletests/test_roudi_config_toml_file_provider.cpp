@@ -103,6 +103,97 @@ TEST_F(RoudiConfigTomlFileProvider_test, ParsingFileIsSuccessful)
 #endif
 }
 
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingMemoryPagingConfigIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "92e94f91-3cae-4c48-8819-ce6d44dab75a");
+    std::istringstream stream(R"(
+        [general]
+        version = 1
+
+        [management]
+        lock_in_memory = true
+
+        [[segment]]
+        huge_pages = true
+        prefault = true
+        numa_node = 1
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& config = result.value();
+    EXPECT_FALSE(config.m_managementMemoryPagingConfig.m_useHugePages);
+    EXPECT_FALSE(config.m_managementMemoryPagingConfig.m_prefault);
+    EXPECT_TRUE(config.m_managementMemoryPagingConfig.m_lockInMemory);
+    EXPECT_FALSE(config.m_managementMemoryPagingConfig.m_numaNode.has_value());
+
+    ASSERT_THAT(config.m_sharedMemorySegments.size(), Eq(2U));
+    const auto& pagingConfig = config.m_sharedMemorySegments[0].m_memoryPagingConfig;
+    EXPECT_TRUE(pagingConfig.m_useHugePages);
+    EXPECT_TRUE(pagingConfig.m_prefault);
+    EXPECT_FALSE(pagingConfig.m_lockInMemory);
+    ASSERT_TRUE(pagingConfig.m_numaNode.has_value());
+    EXPECT_THAT(pagingConfig.m_numaNode.value(), Eq(1U));
+
+    const auto& defaultPagingConfig = config.m_sharedMemorySegments[1].m_memoryPagingConfig;
+    EXPECT_FALSE(defaultPagingConfig.m_useHugePages);
+    EXPECT_FALSE(defaultPagingConfig.m_prefault);
+    EXPECT_FALSE(defaultPagingConfig.m_lockInMemory);
+    EXPECT_FALSE(defaultPagingConfig.m_numaNode.has_value());
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingMemPoolExhaustedPolicyIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b0d6f4e2-8a3c-4f17-9e52-61c7d9a0b3f8");
+    std::istringstream stream(R"(
+        [general]
+        version = 1
+
+        [[segment]]
+        mempool_exhausted_policy = "fall_through_to_larger_mempool"
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [[segment]]
+        mempool_exhausted_policy = "return_error"
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& segments = result.value().m_sharedMemorySegments;
+    ASSERT_THAT(segments.size(), Eq(3U));
+    EXPECT_THAT(segments[0].m_mempoolConfig.m_memPoolExhaustedPolicy,
+                Eq(iox::mepoo::MemPoolExhaustedPolicy::FALL_THROUGH_TO_LARGER_MEMPOOL));
+    EXPECT_THAT(segments[1].m_mempoolConfig.m_memPoolExhaustedPolicy,
+                Eq(iox::mepoo::MemPoolExhaustedPolicy::RETURN_ERROR));
+    EXPECT_THAT(segments[2].m_mempoolConfig.m_memPoolExhaustedPolicy,
+                Eq(iox::mepoo::MemPoolExhaustedPolicy::RETURN_ERROR));
+}
+
 constexpr const char* CONFIG_NO_GENERAL_SECTION = R"(
     [[segment]]
 
@@ -186,6 +277,18 @@ constexpr const char* CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT = R"(
     size = 128
 )";
 
+constexpr const char* CONFIG_INVALID_MEMPOOL_EXHAUSTED_POLICY = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    mempool_exhausted_policy = "borrow_from_the_neighbour"
+
+    [[segment.mempool]]
+    size = 128
+    count = 1
+)";
+
 constexpr const char* CONFIG_EXCEPTION_IN_PARSER = R"(🐔)";
 
 INSTANTIATE_TEST_SUITE_P(
@@ -205,6 +308,8 @@ INSTANTIATE_TEST_SUITE_P(
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_SIZE},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT,
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_MEMPOOL_EXHAUSTED_POLICY,
+                                 CONFIG_INVALID_MEMPOOL_EXHAUSTED_POLICY},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::EXCEPTION_IN_PARSER,
                                  CONFIG_EXCEPTION_IN_PARSER}));
 
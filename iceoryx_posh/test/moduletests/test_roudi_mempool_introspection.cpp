@@ -135,6 +135,7 @@ class MemPoolIntrospection_test : public Test
         info.m_minFreeChunks = index * 100 + 45;
         info.m_numChunks = index * 100 + 50;
         info.m_usedChunks = index * 100 + 3;
+        info.m_failedAllocations = index * 100 + 7;
     }
 
     // initializes the mempool info with a defined pattern
@@ -171,6 +172,10 @@ class MemPoolIntrospection_test : public Test
             {
                 return false;
             }
+            if (info.m_failedAllocations != second[index].m_failedAllocations)
+            {
+                return false;
+            }
             index++;
         }
 
@@ -227,7 +232,7 @@ TEST_F(MemPoolIntrospection_test, Send_withSubscribers)
         m_rouDiInternalMemoryManager_mock, m_segmentManager_mock, std::move(m_publisherPortImpl_mock));
 
     MemPoolInfoContainer memPoolInfoContainer;
-    MemPoolInfo memPoolInfo{0, 0, 0, 0};
+    MemPoolInfo memPoolInfo{0, 0, 0, 0, 0};
     initMemPoolInfoContainer(memPoolInfoContainer);
 
     EXPECT_CALL(m_segmentManager_mock.m_segmentContainer.front().getMemoryManager(), getMemPoolInfo(_))
@@ -254,7 +259,7 @@ TIMING_TEST_F(MemPoolIntrospection_test, thread, Repeat(5), [&] {
         m_rouDiInternalMemoryManager_mock, m_segmentManager_mock, std::move(m_publisherPortImpl_mock));
 
     MemPoolInfoContainer memPoolInfoContainer;
-    MemPoolInfo memPoolInfo(0, 0, 0, 0);
+    MemPoolInfo memPoolInfo(0, 0, 0, 0, 0);
     initMemPoolInfoContainer(memPoolInfoContainer);
 
     EXPECT_CALL(m_rouDiInternalMemoryManager_mock, getMemPoolInfo(_)).WillRepeatedly(Invoke([&](uint32_t index) {
@@ -88,6 +88,38 @@ TEST_F(PortManager_test, DoDiscoveryWithSingleShotSubscriberFirst)
     EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
 }
 
+TEST_F(PortManager_test, DoDiscoveryForPendingRequestsConnectsSingleShotPublisherAndSubscriber)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e0d49bf2-42aa-452b-a3a5-7f0751d4cae0");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+
+    PublisherPortUser publisher(
+        m_portManager
+            ->acquirePublisherPortData(
+                {"1", "1", "1"}, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value());
+    ASSERT_TRUE(publisher);
+    SubscriberPortUser subscriber(
+        m_portManager->acquireSubscriberPortData({"1", "1", "1"}, subscriberOptions, "schlomo", PortConfigInfo())
+            .value());
+    ASSERT_TRUE(subscriber);
+    m_portManager->doDiscoveryForPendingRequests();
+
+    publisher.offer();
+    subscriber.subscribe();
+    m_portManager->doDiscoveryForPendingRequests();
+
+    ASSERT_TRUE(publisher.hasSubscribers());
+    EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+
+    subscriber.unsubscribe();
+    m_portManager->doDiscoveryForPendingRequests();
+
+    EXPECT_FALSE(publisher.hasSubscribers());
+    EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::NOT_SUBSCRIBED));
+}
+
 TEST_F(PortManager_test, DoDiscoveryWithDiscoveryLoopInBetweenCreationOfSubscriberAndPublisher)
 {
     ::testing::Test::RecordProperty("TEST_ID", "bbd475bd-23fd-4b8f-b2ae-88e41c39e6e2");
@@ -886,6 +918,162 @@ TEST_F(PortManager_test, UnblockProcessShutdownUnblocksBlockedPublisher)
                                   [&] { m_portManager->unblockProcessShutdown(publisherRuntimeName); });
 }
 
+TEST_F(PortManager_test, DestroyingSubscriberIsDeferredWhilePublisherPinsItsQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c8fcc256-041d-4038-906d-f2b33fcb8f61");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), true};
+    SubscriberOptions subscriberOptions{1U, 0U, iox::NodeName_t("node"), true};
+
+    auto publisherData =
+        m_portManager
+            ->acquirePublisherPortData(
+                {"1", "1", "1"}, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value();
+    auto subscriberData =
+        m_portManager->acquireSubscriberPortData({"1", "1", "1"}, subscriberOptions, "schlomo", PortConfigInfo())
+            .value();
+    PublisherPortUser publisher(publisherData);
+    ASSERT_TRUE(publisher.hasSubscribers());
+    auto portPool = m_roudiMemoryManager->portPool().value();
+    const auto numberOfSubscriberPorts = portPool->getSubscriberPortDataList().size();
+
+    // simulate a publisher which is preempted while it delivers to the subscriber queue
+    auto& publisherMembers = publisherData->m_chunkSenderData;
+    const auto pinnedIndex = publisherMembers.activeQueueContainerIndex();
+    publisherMembers.m_queueContainerReaders[pinnedIndex].store(1U);
+
+    SubscriberPortUser(subscriberData).destroy();
+    m_portManager->doDiscovery();
+
+    EXPECT_FALSE(publisher.hasSubscribers());
+    EXPECT_THAT(portPool->getSubscriberPortDataList().size(), Eq(numberOfSubscriberPorts));
+    EXPECT_TRUE(subscriberData->m_toBeDestroyed.load());
+
+    publisherMembers.m_queueContainerReaders[pinnedIndex].store(0U);
+    m_portManager->doDiscovery();
+
+    EXPECT_THAT(portPool->getSubscriberPortDataList().size(), Eq(numberOfSubscriberPorts - 1U));
+}
+
+TEST_F(PortManager_test, DeferredDestructionOfSubscriberIsRetriedWithThePendingRequests)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6d3e9b14-2a7c-4f05-b8d1-0e4c5a7f9312");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), true};
+    SubscriberOptions subscriberOptions{1U, 0U, iox::NodeName_t("node"), true};
+
+    auto publisherData =
+        m_portManager
+            ->acquirePublisherPortData(
+                {"1", "1", "1"}, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value();
+    auto subscriberData =
+        m_portManager->acquireSubscriberPortData({"1", "1", "1"}, subscriberOptions, "schlomo", PortConfigInfo())
+            .value();
+    m_portManager->doDiscoveryForPendingRequests();
+    auto portPool = m_roudiMemoryManager->portPool().value();
+    const auto numberOfSubscriberPorts = portPool->getSubscriberPortDataList().size();
+
+    auto& publisherMembers = publisherData->m_chunkSenderData;
+    const auto pinnedIndex = publisherMembers.activeQueueContainerIndex();
+    publisherMembers.m_queueContainerReaders[pinnedIndex].store(1U);
+
+    SubscriberPortUser(subscriberData).destroy();
+    m_portManager->doDiscoveryForPendingRequests();
+
+    EXPECT_THAT(portPool->getSubscriberPortDataList().size(), Eq(numberOfSubscriberPorts));
+
+    publisherMembers.m_queueContainerReaders[pinnedIndex].store(0U);
+    m_portManager->doDiscoveryForPendingRequests();
+
+    EXPECT_THAT(portPool->getSubscriberPortDataList().size(), Eq(numberOfSubscriberPorts - 1U));
+}
+
+TEST_F(PortManager_test, DeferredDestructionOfSubscriberRemovesItsQueueWhenTheUnsubscribeFailed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3b0f7a4e-9d21-4c58-8e6f-15a2c7d94b03");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), true};
+    SubscriberOptions subscriberOptions{1U, 0U, iox::NodeName_t("node"), true};
+
+    auto publisherData =
+        m_portManager
+            ->acquirePublisherPortData(
+                {"1", "1", "1"}, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value();
+    auto subscriberData =
+        m_portManager->acquireSubscriberPortData({"1", "1", "1"}, subscriberOptions, "schlomo", PortConfigInfo())
+            .value();
+    PublisherPortUser publisher(publisherData);
+    ASSERT_TRUE(publisher.hasSubscribers());
+    auto portPool = m_roudiMemoryManager->portPool().value();
+    const auto numberOfSubscriberPorts = portPool->getSubscriberPortDataList().size();
+
+    // simulate senders which pin all queue containers, hence the UNSUB cannot remove the queue
+    auto& publisherMembers = publisherData->m_chunkSenderData;
+    for (auto& readers : publisherMembers.m_queueContainerReaders)
+    {
+        readers.store(1U);
+    }
+
+    auto errorHandlerCalled{false};
+    {
+        auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+            [&errorHandlerCalled](const iox::PoshError, const iox::ErrorLevel) { errorHandlerCalled = true; });
+
+        SubscriberPortUser(subscriberData).destroy();
+        m_portManager->doDiscovery();
+    }
+
+    EXPECT_TRUE(errorHandlerCalled);
+    EXPECT_TRUE(publisher.hasSubscribers());
+    EXPECT_THAT(portPool->getSubscriberPortDataList().size(), Eq(numberOfSubscriberPorts));
+
+    for (auto& readers : publisherMembers.m_queueContainerReaders)
+    {
+        readers.store(0U);
+    }
+    m_portManager->doDiscovery();
+
+    EXPECT_FALSE(publisher.hasSubscribers());
+    EXPECT_THAT(portPool->getSubscriberPortDataList().size(), Eq(numberOfSubscriberPorts - 1U));
+}
+
+TEST_F(PortManager_test, DestroyingPublisherIsDeferredWhileSubscriberPinsItsChunkRing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a2b89c6d-8429-4d5a-b614-72c9e3548170");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), true};
+    publisherOptions.chunkRingCapacity = 2U;
+    SubscriberOptions subscriberOptions{1U, 0U, iox::NodeName_t("node"), true};
+
+    auto publisherData =
+        m_portManager
+            ->acquirePublisherPortData(
+                {"1", "1", "1"}, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value();
+    auto subscriberData =
+        m_portManager->acquireSubscriberPortData({"1", "1", "1"}, subscriberOptions, "schlomo", PortConfigInfo())
+            .value();
+    ASSERT_TRUE(PublisherPortUser(publisherData).hasSubscribers());
+    auto portPool = m_roudiMemoryManager->portPool().value();
+    const auto numberOfPublisherPorts = portPool->getPublisherPortDataList().size();
+
+    // simulate a subscriber which is preempted while it reads from the chunk ring
+    auto& attachment = subscriberData->m_chunkReceiverData.m_chunkRings[0U];
+    ASSERT_TRUE(attachment.m_isAttached.load());
+    attachment.m_readers.store(1U);
+
+    PublisherPortUser(publisherData).destroy();
+    m_portManager->doDiscovery();
+
+    EXPECT_FALSE(attachment.m_isAttached.load());
+    EXPECT_THAT(portPool->getPublisherPortDataList().size(), Eq(numberOfPublisherPorts));
+    EXPECT_TRUE(publisherData->m_toBeDestroyed.load());
+
+    attachment.m_readers.store(0U);
+    m_portManager->doDiscovery();
+
+    EXPECT_THAT(portPool->getPublisherPortDataList().size(), Eq(numberOfPublisherPorts - 1U));
+}
+
 TEST_F(PortManager_test, PortsDestroyInProcess2ChangeStatesOfPortsInProcess1)
 {
     ::testing::Test::RecordProperty("TEST_ID", "65815512-0298-46b7-9d19-64bc51079c1a");
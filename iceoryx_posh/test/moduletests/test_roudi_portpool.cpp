@@ -17,6 +17,7 @@
 
 #include "iceoryx_dust/cxx/convert.hpp"
 #include "iceoryx_dust/cxx/std_string_support.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
 #include "iceoryx_posh/popo/client_options.hpp"
@@ -25,6 +26,9 @@
 
 #include "test.hpp"
 
+#include <set>
+#include <thread>
+
 namespace
 {
 using namespace ::testing;
@@ -845,4 +849,158 @@ TEST_F(PortPool_test, RemoveConditionVariableDataIsSuccessful)
 
 // END ConditionVariable tests
 
+// BEGIN ControlChannel tests
+
+TEST_F(PortPool_test, AddControlChannelDataIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4a866ad9-b05b-4793-85ed-d8a386498894");
+    auto controlChannelData = sut.addControlChannelData(m_applicationName);
+
+    ASSERT_THAT(controlChannelData.has_error(), Eq(false));
+    EXPECT_EQ(controlChannelData.value()->m_runtimeName, m_applicationName);
+    EXPECT_EQ(controlChannelData.value()->m_numberOfRequests, 0U);
+    EXPECT_EQ(sut.getControlChannelDataList().size(), 1U);
+}
+
+TEST_F(PortPool_test, AddControlChannelDataWhenContainerIsFullReturnsError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b0f67cb3-04a1-471f-91a2-e5398160e7a5");
+    for (uint32_t i = 0U; i < MAX_NUMBER_OF_CONTROL_CHANNELS; ++i)
+    {
+        EXPECT_FALSE(sut.addControlChannelData(m_applicationName).has_error());
+    }
+
+    auto errorHandlerCalled{false};
+    PoshError error{PoshError::NO_ERROR};
+    auto errorHandlerGuard =
+        ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>([&](const auto e, const ErrorLevel) {
+            error = e;
+            errorHandlerCalled = true;
+        });
+    auto controlChannelData = sut.addControlChannelData(m_applicationName);
+
+    ASSERT_TRUE(controlChannelData.has_error());
+    EXPECT_EQ(controlChannelData.error(), roudi::PortPoolError::CONTROL_CHANNEL_LIST_FULL);
+    ASSERT_TRUE(errorHandlerCalled);
+    EXPECT_EQ(error, PoshError::PORT_POOL__CONTROL_CHANNEL_LIST_OVERFLOW);
+}
+
+TEST_F(PortPool_test, RemoveControlChannelDataIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "af70a0b5-8eef-498c-9bc1-2db404f1b938");
+    auto controlChannelData = sut.addControlChannelData(m_applicationName);
+
+    sut.removeControlChannelData(controlChannelData.value());
+
+    ASSERT_EQ(sut.getControlChannelDataList().size(), 0U);
+}
+
+// END ControlChannel tests
+
+// BEGIN Discovery tests
+
+TEST_F(PortPool_test, AddedPortIsPendingForTheDiscoveryOnlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d8f63ae1-6f20-4503-bcc0-66fc91e72b75");
+    auto publisherPort =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    ASSERT_FALSE(publisherPort.has_error());
+
+    auto pendingPublisherPorts = sut.getPendingPublisherPortDataList();
+    ASSERT_EQ(pendingPublisherPorts.size(), 1U);
+    EXPECT_EQ(pendingPublisherPorts[0], publisherPort.value());
+
+    EXPECT_TRUE(sut.getPendingPublisherPortDataList().empty());
+}
+
+TEST_F(PortPool_test, NotifiedPortIsPendingForTheDiscoveryAndWakesUpTheDiscovery)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d57f9271-2450-46af-87fd-d44c7f139660");
+    ASSERT_FALSE(sut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions).has_error());
+    auto subscriberPort = sut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions);
+    ASSERT_FALSE(subscriberPort.has_error());
+    sut.getPendingSubscriberPortDataList();
+    popo::ConditionListener discoveryListener(sut.getDiscoveryConditionVariableData());
+    discoveryListener.timedWait(units::Duration::zero());
+
+    subscriberPort.value()->m_discoveryNotifier.notify();
+
+    EXPECT_TRUE(discoveryListener.wasNotified());
+    auto pendingSubscriberPorts = sut.getPendingSubscriberPortDataList();
+    ASSERT_EQ(pendingSubscriberPorts.size(), 1U);
+    EXPECT_EQ(pendingSubscriberPorts[0], subscriberPort.value());
+}
+
+TEST_F(PortPool_test, RemovedPortIsNotPendingForTheDiscovery)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "25b51dc9-0c28-404f-9b28-a89199647d42");
+    auto nodeData = sut.addNodeData(m_runtimeName, m_nodeName, m_nodeDeviceId);
+    ASSERT_FALSE(nodeData.has_error());
+
+    sut.removeNodeData(nodeData.value());
+
+    EXPECT_TRUE(sut.getPendingNodeDataList().empty());
+}
+
+// END Discovery tests
+
+// BEGIN Concurrency tests
+
+TEST_F(PortPool_test, ConcurrentlyAddedPublisherPortsAreAllInTheListExactlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "085a39ad-8f3e-46ec-97b3-1f25f35ce105");
+    constexpr uint32_t NUMBER_OF_THREADS{4U};
+    constexpr uint32_t PORTS_PER_THREAD{MAX_PUBLISHERS / NUMBER_OF_THREADS};
+    std::atomic<uint32_t> numberOfFailedAdds{0U};
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0U; t < NUMBER_OF_THREADS; ++t)
+    {
+        threads.emplace_back([&, t] {
+            RuntimeName_t runtimeName = into<lossy<RuntimeName_t>>("AppName" + cxx::convert::toString(t));
+            for (uint32_t i = 0U; i < PORTS_PER_THREAD; ++i)
+            {
+                auto publisherPort = sut.addPublisherPort(
+                    m_serviceDescription, &m_memoryManager, runtimeName, m_publisherOptions, m_memoryInfo);
+                if (publisherPort.has_error() || publisherPort.value()->m_runtimeName != runtimeName)
+                {
+                    ++numberOfFailedAdds;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(numberOfFailedAdds.load(), 0U);
+    auto publisherPorts = sut.getPublisherPortDataList();
+    std::set<popo::PublisherPortData*> uniquePublisherPorts(publisherPorts.begin(), publisherPorts.end());
+    EXPECT_EQ(publisherPorts.size(), NUMBER_OF_THREADS * PORTS_PER_THREAD);
+    EXPECT_EQ(uniquePublisherPorts.size(), publisherPorts.size());
+    EXPECT_EQ(sut.getPendingPublisherPortDataList().size(), publisherPorts.size());
+}
+
+TEST_F(PortPool_test, AddPublisherPortReusesTheSlotOfARemovedPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "64ced06f-8244-4eb4-b8de-11bc299d719c");
+    auto firstPublisherPort = sut.addPublisherPort(
+        m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions, m_memoryInfo);
+    ASSERT_FALSE(firstPublisherPort.has_error());
+    ASSERT_FALSE(
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_runtimeName, m_publisherOptions, m_memoryInfo)
+            .has_error());
+
+    sut.removePublisherPort(firstPublisherPort.value());
+    auto newPublisherPort = sut.addPublisherPort(
+        m_serviceDescription, &m_memoryManager, m_runtimeName, m_publisherOptions, m_memoryInfo);
+
+    ASSERT_FALSE(newPublisherPort.has_error());
+    EXPECT_EQ(newPublisherPort.value(), firstPublisherPort.value());
+    EXPECT_EQ(sut.getPublisherPortDataList().size(), 2U);
+}
+
+// END Concurrency tests
+
 } // namespace
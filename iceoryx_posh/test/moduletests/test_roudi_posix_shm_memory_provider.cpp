@@ -117,4 +117,32 @@ TEST_F(PosixShmMemoryProvider_Test, CreationFailedWithAlignmentExceedingPageSize
     EXPECT_THAT(shmExists(), Eq(false));
 }
 
+TEST_F(PosixShmMemoryProvider_Test, PageSizeIsOnlyAvailableWhileMemoryIsCreated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "42590fc4-769a-4af0-9216-ac5652707eba");
+    iox::mepoo::MemoryPagingConfig memoryPagingConfig;
+    memoryPagingConfig.m_prefault = true;
+    PosixShmMemoryProvider sut(TEST_SHM_NAME,
+                               iox::posix::AccessMode::READ_WRITE,
+                               iox::posix::OpenMode::PURGE_AND_CREATE,
+                               memoryPagingConfig);
+    ASSERT_FALSE(sut.addMemoryBlock(&memoryBlock1).has_error());
+    uint64_t MEMORY_SIZE{16};
+    uint64_t MEMORY_ALIGNMENT{8};
+    EXPECT_CALL(memoryBlock1, size()).WillRepeatedly(Return(MEMORY_SIZE));
+    EXPECT_CALL(memoryBlock1, alignment()).WillRepeatedly(Return(MEMORY_ALIGNMENT));
+
+    EXPECT_FALSE(sut.pageSize().has_value());
+
+    ASSERT_FALSE(sut.create().has_error());
+
+    ASSERT_TRUE(sut.pageSize().has_value());
+    EXPECT_THAT(sut.pageSize().value(), Ge(iox::internal::pageSize()));
+
+    EXPECT_CALL(memoryBlock1, destroy());
+    ASSERT_FALSE(sut.destroy().has_error());
+
+    EXPECT_FALSE(sut.pageSize().has_value());
+}
+
 } // namespace
@@ -16,9 +16,11 @@
 
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_dust/cxx/convert.hpp"
 #include "iceoryx_platform/types.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/roudi/process_manager.hpp"
+#include "iceoryx_posh/internal/runtime/control_channel_data.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_posh/roudi/memory/iceoryx_roudi_memory_manager.hpp"
@@ -27,6 +29,8 @@
 #include "iox/string.hpp"
 #include "test.hpp"
 
+#include <cstring>
+
 namespace
 {
 using namespace ::testing;
@@ -54,6 +58,37 @@ class ProcessManager_test : public Test
     {
     }
 
+    IpcMessage receiveFromSut()
+    {
+        IpcMessage message;
+        EXPECT_TRUE(m_processIpcInterface.receive(message));
+        return message;
+    }
+
+    static ControlChannelData* controlChannelFromAck(const IpcMessage& message)
+    {
+        EXPECT_THAT(message.getNumberOfElements(), Eq(3U));
+        EXPECT_THAT(stringToIpcMessageType(message.getElementAtIndex(0U).c_str()),
+                    Eq(IpcMessageType::CREATE_CONTROL_CHANNEL_ACK));
+
+        iox::segment_id_underlying_t segmentId{0U};
+        iox::cxx::convert::fromString(message.getElementAtIndex(2U).c_str(), segmentId);
+        iox::UntypedRelativePointer::offset_t offset{0U};
+        iox::cxx::convert::fromString(message.getElementAtIndex(1U).c_str(), offset);
+        return static_cast<ControlChannelData*>(
+            iox::UntypedRelativePointer::getPtr(iox::segment_id_t{segmentId}, offset));
+    }
+
+    ControlChannelData* registerProcessAndAcquireControlChannel()
+    {
+        m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo);
+        // discard the REG_ACK
+        receiveFromSut();
+
+        m_sut->addControlChannelForProcess(m_processname);
+        return controlChannelFromAck(receiveFromSut());
+    }
+
     const iox::RuntimeName_t m_processname{"TestProcess"};
     const uint32_t m_pid{42U};
     PosixUser m_user{iox::posix::PosixUser::getUserOfCurrentProcess().getName()};
@@ -157,4 +192,132 @@ TEST_F(ProcessManager_test, HandleProcessShutdownPreparationRequestWorks)
     ASSERT_FALSE(publisher.isOffered());
 }
 
+TEST_F(ProcessManager_test, AddControlChannelForProcessSendsControlChannelOfProcess)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dc534808-448d-4c6d-81c5-413540283a5f");
+    auto controlChannel = registerProcessAndAcquireControlChannel();
+
+    ASSERT_THAT(controlChannel, Ne(nullptr));
+    EXPECT_THAT(controlChannel->m_runtimeName, Eq(m_processname));
+
+    m_sut->addControlChannelForProcess(m_processname);
+    EXPECT_THAT(controlChannelFromAck(receiveFromSut()), Eq(controlChannel));
+}
+
+TEST_F(ProcessManager_test, ProcessControlChannelRequestsCreatesBatchOfPortsWithOneAcknowledgement)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e7f1372-4c5f-494e-9712-faebac0c6c30");
+    auto controlChannel = registerProcessAndAcquireControlChannel();
+    ASSERT_THAT(controlChannel, Ne(nullptr));
+
+    const iox::capro::ServiceDescription publisherService{"Batch", "Publisher", "Port"};
+    const iox::capro::ServiceDescription subscriberService{"Batch", "Subscriber", "Port"};
+    constexpr uint64_t NUMBER_OF_PUBLISHERS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_PUBLISHERS; ++i)
+    {
+        controlChannel->m_requests[i].m_type = ControlRequestType::CREATE_PUBLISHER;
+        controlChannel->m_requests[i].m_service = publisherService;
+    }
+    controlChannel->m_requests[NUMBER_OF_PUBLISHERS].m_type = ControlRequestType::CREATE_SUBSCRIBER;
+    controlChannel->m_requests[NUMBER_OF_PUBLISHERS].m_service = subscriberService;
+    controlChannel->m_numberOfRequests = NUMBER_OF_PUBLISHERS + 1U;
+
+    m_sut->processControlChannelRequests(m_processname);
+
+    auto message = receiveFromSut();
+    ASSERT_THAT(message.getNumberOfElements(), Eq(2U));
+    EXPECT_THAT(stringToIpcMessageType(message.getElementAtIndex(0U).c_str()),
+                Eq(IpcMessageType::CONTROL_CHANNEL_DOORBELL_ACK));
+
+    for (uint64_t i = 0U; i <= NUMBER_OF_PUBLISHERS; ++i)
+    {
+        const auto& response = controlChannel->m_responses[i];
+        ASSERT_TRUE(response.m_isSuccessful);
+        auto port = static_cast<BasePortData*>(
+            iox::UntypedRelativePointer::getPtr(iox::segment_id_t{response.m_segmentId}, response.m_offset));
+        EXPECT_THAT(port->m_serviceDescription, Eq(i < NUMBER_OF_PUBLISHERS ? publisherService : subscriberService));
+        EXPECT_THAT(port->m_runtimeName, Eq(m_processname));
+    }
+}
+
+TEST_F(ProcessManager_test, ProcessControlChannelRequestsReportsInvalidRequestWithoutAffectingOtherRequests)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cf9f0dc9-c3c5-4f04-b78c-8c81f831e7a2");
+    auto controlChannel = registerProcessAndAcquireControlChannel();
+    ASSERT_THAT(controlChannel, Ne(nullptr));
+
+    controlChannel->m_requests[0U].m_type = ControlRequestType::NONE;
+    controlChannel->m_requests[1U].m_type = ControlRequestType::CREATE_SUBSCRIBER;
+    controlChannel->m_requests[1U].m_service = {"Valid", "Subscriber", "Port"};
+    controlChannel->m_numberOfRequests = 2U;
+
+    m_sut->processControlChannelRequests(m_processname);
+    receiveFromSut();
+
+    EXPECT_FALSE(controlChannel->m_responses[0U].m_isSuccessful);
+    EXPECT_THAT(controlChannel->m_responses[0U].m_error, Eq(IpcMessageErrorType::CONTROL_CHANNEL_INVALID_REQUEST));
+    EXPECT_TRUE(controlChannel->m_responses[1U].m_isSuccessful);
+}
+
+TEST_F(ProcessManager_test, ProcessControlChannelRequestsRejectsCorruptedRequestsWithoutAffectingOtherRequests)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "932c2abd-945e-4518-909c-ab5380936ec6");
+    auto controlChannel = registerProcessAndAcquireControlChannel();
+    ASSERT_THAT(controlChannel, Ne(nullptr));
+
+    constexpr uint64_t NUMBER_OF_REQUESTS{6U};
+    constexpr uint64_t NUMBER_OF_CORRUPTED_REQUESTS{4U};
+    const iox::capro::IdString_t events[NUMBER_OF_REQUESTS]{"0", "1", "2", "3", "4", "5"};
+    for (uint64_t i = 0U; i < NUMBER_OF_REQUESTS; ++i)
+    {
+        controlChannel->m_requests[i].m_type =
+            (i % 2U == 0U) ? ControlRequestType::CREATE_PUBLISHER : ControlRequestType::CREATE_SUBSCRIBER;
+        controlChannel->m_requests[i].m_service = {"Corrupted", "Request", events[i]};
+    }
+
+    // string without null termination at its size
+    controlChannel->m_requests[0U].m_publisherOptions.nodeName = "node";
+    const_cast<char*>(controlChannel->m_requests[0U].m_publisherOptions.nodeName.c_str())[4U] = 'x';
+    // bool with an invalid representation
+    std::memset(static_cast<void*>(&controlChannel->m_requests[1U].m_subscriberOptions.subscribeOnCreate), 2, 1U);
+    // enum out of range
+    controlChannel->m_requests[2U].m_publisherOptions.subscriberTooSlowPolicy =
+        static_cast<iox::popo::ConsumerTooSlowPolicy>(42U);
+    // capacity out of range
+    controlChannel->m_requests[3U].m_subscriberOptions.queueCapacity = 0U;
+    controlChannel->m_numberOfRequests = NUMBER_OF_REQUESTS;
+
+    m_sut->processControlChannelRequests(m_processname);
+    receiveFromSut();
+
+    for (uint64_t i = 0U; i < NUMBER_OF_REQUESTS; ++i)
+    {
+        if (i < NUMBER_OF_CORRUPTED_REQUESTS)
+        {
+            EXPECT_FALSE(controlChannel->m_responses[i].m_isSuccessful);
+            EXPECT_THAT(controlChannel->m_responses[i].m_error,
+                        Eq(IpcMessageErrorType::CONTROL_CHANNEL_INVALID_REQUEST));
+        }
+        else
+        {
+            EXPECT_TRUE(controlChannel->m_responses[i].m_isSuccessful);
+        }
+    }
+}
+
+TEST_F(ProcessManager_test, ProcessControlChannelRequestsWithoutControlChannelSendsError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "24e0eeb4-a2c6-449e-9c9c-cbbe2338761e");
+    m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo);
+    receiveFromSut();
+
+    m_sut->processControlChannelRequests(m_processname);
+
+    auto message = receiveFromSut();
+    ASSERT_THAT(message.getNumberOfElements(), Eq(2U));
+    EXPECT_THAT(stringToIpcMessageType(message.getElementAtIndex(0U).c_str()), Eq(IpcMessageType::ERROR));
+    EXPECT_THAT(stringToIpcMessageErrorType(message.getElementAtIndex(1U).c_str()),
+                Eq(IpcMessageErrorType::CONTROL_CHANNEL_INVALID_REQUEST));
+}
+
 } // namespace
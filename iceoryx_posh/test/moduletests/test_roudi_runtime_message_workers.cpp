@@ -0,0 +1,225 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/internal/roudi/roudi.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_message.hpp"
+#include "iceoryx_posh/roudi/iceoryx_roudi_components.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+using namespace iox::runtime;
+using namespace iox::units::duration_literals;
+
+class RouDiWithRuntimeMessageWorkers : public RouDi
+{
+  public:
+    RouDiWithRuntimeMessageWorkers(IceOryxRouDiComponents& components, const uint32_t numberOfWorkers)
+        : RouDi(components.rouDiMemoryManager,
+                components.portManager,
+                RoudiStartupParameters{MonitoringMode::OFF,
+                                       false,
+                                       RuntimeMessagesThreadStart::DEFER_START,
+                                       iox::version::CompatibilityCheckLevel::PATCH,
+                                       PROCESS_DEFAULT_KILL_DELAY,
+                                       numberOfWorkers})
+    {
+    }
+
+    ~RouDiWithRuntimeMessageWorkers() override
+    {
+        unblockProcessing();
+        stopRuntimeMessageWorkers();
+    }
+
+    using RouDi::dispatchRuntimeMessage;
+    using RouDi::numberOfRuntimeMessageWorkers;
+    using RouDi::startRuntimeMessageWorkers;
+    using RouDi::stopRuntimeMessageWorkers;
+
+    void blockProcessing()
+    {
+        m_isProcessingBlocked = true;
+    }
+
+    void unblockProcessing()
+    {
+        m_isProcessingBlocked = false;
+    }
+
+    std::map<std::string, std::vector<uint64_t>> processedMessages()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_processedMessages;
+    }
+
+  protected:
+    void processMessage(const IpcMessage& message, const IpcMessageType&, const iox::RuntimeName_t& runtimeName) noexcept
+        override
+    {
+        while (m_isProcessingBlocked)
+        {
+            std::this_thread::yield();
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_processedMessages[runtimeName.c_str()].push_back(std::stoull(message.getElementAtIndex(2)));
+    }
+
+  private:
+    std::atomic_bool m_isProcessingBlocked{false};
+    std::mutex m_mutex;
+    std::map<std::string, std::vector<uint64_t>> m_processedMessages;
+};
+
+class RouDiRuntimeMessageWorkers_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    }
+
+    static IpcMessage createMessage(const std::string& runtimeName, const uint64_t counter)
+    {
+        IpcMessage message;
+        message << IpcMessageTypeToString(IpcMessageType::KEEPALIVE) << runtimeName << counter;
+        return message;
+    }
+
+    Watchdog m_watchdog{10_s};
+    IceOryxRouDiComponents m_components{iox::RouDiConfig_t().setDefaults()};
+};
+
+TEST_F(RouDiRuntimeMessageWorkers_test, ZeroWorkersAreClampedToOneWorker)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "13ac911a-dff5-4b3e-8627-ef11689f8496");
+    RouDiWithRuntimeMessageWorkers sut{m_components, 0U};
+
+    EXPECT_THAT(sut.numberOfRuntimeMessageWorkers(), Eq(1U));
+}
+
+TEST_F(RouDiRuntimeMessageWorkers_test, TooManyWorkersAreClampedToMaximumNumberOfWorkers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c0b21569-2d94-4174-9372-0f5e1a7d49bf");
+    RouDiWithRuntimeMessageWorkers sut{m_components, MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS + 1U};
+
+    EXPECT_THAT(sut.numberOfRuntimeMessageWorkers(), Eq(MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS));
+}
+
+TEST_F(RouDiRuntimeMessageWorkers_test, SupportedNumberOfWorkersIsUsed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "29e01790-1216-44e9-a3a5-b8769633bae5");
+    RouDiWithRuntimeMessageWorkers sut{m_components, MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS};
+
+    EXPECT_THAT(sut.numberOfRuntimeMessageWorkers(), Eq(MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS));
+}
+
+TEST_F(RouDiRuntimeMessageWorkers_test, MessagesOfOneRuntimeAreProcessedInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6897f90c-5358-4dc1-8b34-c4062a90bfeb");
+    constexpr uint64_t NUMBER_OF_RUNTIMES{16U};
+    constexpr uint64_t NUMBER_OF_MESSAGES_PER_RUNTIME{200U};
+    RouDiWithRuntimeMessageWorkers sut{m_components, 4U};
+    sut.startRuntimeMessageWorkers();
+
+    for (uint64_t counter = 0U; counter < NUMBER_OF_MESSAGES_PER_RUNTIME; ++counter)
+    {
+        for (uint64_t runtime = 0U; runtime < NUMBER_OF_RUNTIMES; ++runtime)
+        {
+            sut.dispatchRuntimeMessage(createMessage("app" + std::to_string(runtime), counter));
+        }
+    }
+    sut.stopRuntimeMessageWorkers();
+
+    auto processedMessages = sut.processedMessages();
+    ASSERT_THAT(processedMessages.size(), Eq(NUMBER_OF_RUNTIMES));
+    for (const auto& runtime : processedMessages)
+    {
+        ASSERT_THAT(runtime.second.size(), Eq(NUMBER_OF_MESSAGES_PER_RUNTIME));
+        for (uint64_t counter = 0U; counter < NUMBER_OF_MESSAGES_PER_RUNTIME; ++counter)
+        {
+            EXPECT_THAT(runtime.second[counter], Eq(counter));
+        }
+    }
+}
+
+TEST_F(RouDiRuntimeMessageWorkers_test, StoppingTheWorkersProcessesAllQueuedMessages)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4894f826-bdac-4689-9e43-7ee3cd9e07c5");
+    constexpr uint64_t NUMBER_OF_MESSAGES{RUNTIME_MESSAGE_WORKER_QUEUE_CAPACITY};
+    RouDiWithRuntimeMessageWorkers sut{m_components, 2U};
+    sut.blockProcessing();
+    sut.startRuntimeMessageWorkers();
+
+    // the blocked worker takes at most one message out of the queue, the others stay queued
+    for (uint64_t counter = 0U; counter < NUMBER_OF_MESSAGES; ++counter)
+    {
+        sut.dispatchRuntimeMessage(createMessage("app", counter));
+    }
+    sut.unblockProcessing();
+    sut.stopRuntimeMessageWorkers();
+
+    auto processedMessages = sut.processedMessages();
+    ASSERT_THAT(processedMessages["app"].size(), Eq(NUMBER_OF_MESSAGES));
+}
+
+TEST_F(RouDiRuntimeMessageWorkers_test, DispatchingToAFullQueueBlocksUntilTheWorkerTakesAMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "486d2136-6e7d-4c0d-aac3-a1d94738ad11");
+    RouDiWithRuntimeMessageWorkers sut{m_components, 2U};
+    sut.blockProcessing();
+    sut.startRuntimeMessageWorkers();
+
+    // the blocked worker may take one message out of the queue before it blocks; the queue is full at the latest
+    // after one more message
+    constexpr uint64_t NUMBER_OF_MESSAGES{RUNTIME_MESSAGE_WORKER_QUEUE_CAPACITY + 2U};
+    std::atomic<uint64_t> numberOfDispatchedMessages{0U};
+    std::thread dispatcher([&] {
+        for (uint64_t counter = 0U; counter < NUMBER_OF_MESSAGES; ++counter)
+        {
+            sut.dispatchRuntimeMessage(createMessage("app", counter));
+            ++numberOfDispatchedMessages;
+        }
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_THAT(numberOfDispatchedMessages.load(), Lt(NUMBER_OF_MESSAGES));
+
+    sut.unblockProcessing();
+    dispatcher.join();
+    sut.stopRuntimeMessageWorkers();
+
+    auto processedMessages = sut.processedMessages();
+    ASSERT_THAT(processedMessages["app"].size(), Eq(NUMBER_OF_MESSAGES));
+    for (uint64_t counter = 0U; counter < NUMBER_OF_MESSAGES; ++counter)
+    {
+        EXPECT_THAT(processedMessages["app"][counter], Eq(counter));
+    }
+}
+
+} // namespace
@@ -23,6 +23,7 @@
 #include "test.hpp"
 
 #include <chrono>
+#include <memory>
 #include <random>
 #include <vector>
 
@@ -676,6 +677,114 @@ TYPED_TEST(ServiceRegistry_test, FindWithEmptyCallableDoesNotDie)
     this->find(iox::capro::Wildcard, iox::capro::Wildcard, iox::capro::Wildcard);
 }
 
+TYPED_TEST(ServiceRegistry_test, FindWorksAfterManyRemovalsAndReinsertions)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8c2f5e17-0b94-4d3a-a6e1-5f7d9c03b248");
+    auto toIdString = [](const uint64_t i) {
+        return iox::into<iox::lossy<IdString_t>>(iox::cxx::convert::toString(i));
+    };
+
+    for (uint64_t i = 0U; i < CAPACITY; i++)
+    {
+        ASSERT_FALSE(this->sut.add(ServiceDescription("Foo", toIdString(i % 7U), toIdString(i))).has_error());
+    }
+    for (uint64_t i = 0U; i < CAPACITY; i += 2U)
+    {
+        this->sut.remove(ServiceDescription("Foo", toIdString(i % 7U), toIdString(i)));
+    }
+    for (uint64_t i = 0U; i < CAPACITY; i += 4U)
+    {
+        ASSERT_FALSE(this->sut.add(ServiceDescription("Foo", toIdString(i % 7U), toIdString(i))).has_error());
+    }
+
+    uint64_t expectedNumberOfServices{0U};
+    for (uint64_t i = 0U; i < CAPACITY; i++)
+    {
+        const bool isStored = (i % 2U == 1U) || (i % 4U == 0U);
+        this->find(IdString_t("Foo"), toIdString(i % 7U), toIdString(i));
+        EXPECT_THAT(this->searchResult.size(), Eq(isStored ? 1U : 0U));
+        this->find(iox::capro::Wildcard, iox::capro::Wildcard, toIdString(i));
+        EXPECT_THAT(this->searchResult.size(), Eq(isStored ? 1U : 0U));
+        expectedNumberOfServices += isStored ? 1U : 0U;
+    }
+
+    this->find(IdString_t("Foo"), iox::capro::Wildcard, iox::capro::Wildcard);
+    EXPECT_THAT(this->searchResult.size(), Eq(expectedNumberOfServices));
+    EXPECT_THAT(this->countServices(), Eq(expectedNumberOfServices));
+}
+
+TYPED_TEST(ServiceRegistry_test, CopiedServiceRegistryFindsAllServices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d16a0b9e-47c3-4f58-9e2d-3b8a71c5f0e6");
+    ServiceDescription service1("a", "b", "c");
+    ServiceDescription service2("a", "d", "e");
+    ASSERT_FALSE(this->sut.add(service1).has_error());
+    ASSERT_FALSE(this->sut.add(service2).has_error());
+
+    std::unique_ptr<ServiceRegistry> copy{new ServiceRegistry(*this->sut.operator->())};
+
+    SearchResult_t searchResult;
+    copy->find(IdString_t("a"), IdString_t("d"), iox::capro::Wildcard, [&](const auto& entry) {
+        searchResult.push_back(entry);
+    });
+    ASSERT_THAT(searchResult.size(), Eq(1U));
+    EXPECT_THAT(searchResult[0].serviceDescription, Eq(service2));
+
+    copy->removePublisher(service1);
+    copy->removeServer(service1);
+    searchResult.clear();
+    copy->find(IdString_t("a"), iox::capro::Wildcard, iox::capro::Wildcard, [&](const auto& entry) {
+        searchResult.push_back(entry);
+    });
+    ASSERT_THAT(searchResult.size(), Eq(1U));
+    EXPECT_THAT(searchResult[0].serviceDescription, Eq(service2));
+}
+
+TYPED_TEST(ServiceRegistry_test, ApplyingChangesTakesOverTheirSequenceNumber)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fe808249-478b-42fc-951e-804493a90784");
+    auto& registry = *this->sut.operator->();
+    ServiceDescription service("a", "b", "c");
+    EXPECT_THAT(registry.sequenceNumber(), Eq(0U));
+
+    ASSERT_FALSE(registry.apply({1U, ServiceRegistryChange::Operation::ADD_PUBLISHER, service}).has_error());
+    ASSERT_FALSE(registry.apply({2U, ServiceRegistryChange::Operation::ADD_SERVER, service}).has_error());
+    ASSERT_FALSE(registry.apply({3U, ServiceRegistryChange::Operation::REMOVE_PUBLISHER, service}).has_error());
+    EXPECT_THAT(registry.sequenceNumber(), Eq(3U));
+
+    SearchResult_t searchResult;
+    registry.find(IdString_t("a"), IdString_t("b"), IdString_t("c"), [&](const auto& entry) {
+        searchResult.push_back(entry);
+    });
+    ASSERT_THAT(searchResult.size(), Eq(1U));
+    EXPECT_THAT(searchResult[0].publisherCount, Eq(0U));
+    EXPECT_THAT(searchResult[0].serverCount, Eq(1U));
+
+    ASSERT_FALSE(registry.apply({4U, ServiceRegistryChange::Operation::REMOVE_SERVER, service}).has_error());
+    EXPECT_THAT(registry.sequenceNumber(), Eq(4U));
+    EXPECT_THAT(this->countServices(), Eq(0U));
+}
+
+TYPED_TEST(ServiceRegistry_test, FailingChangeDoesNotTakeOverItsSequenceNumber)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "29afb5d8-31f2-4236-b280-f7c780a5cafe");
+    auto& registry = *this->sut.operator->();
+    for (uint32_t i = 0U; i < ServiceRegistry::CAPACITY; ++i)
+    {
+        auto id = iox::into<iox::lossy<IdString_t>>(iox::cxx::convert::toString(i));
+        ServiceDescription service(id, id, id);
+        ASSERT_FALSE(registry.apply({i + 1U, ServiceRegistryChange::Operation::ADD_PUBLISHER, service}).has_error());
+    }
+
+    auto result = registry.apply({ServiceRegistry::CAPACITY + 1U,
+                                  ServiceRegistryChange::Operation::ADD_SERVER,
+                                  ServiceDescription("does", "not", "fit")});
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(ServiceRegistry::Error::SERVICE_REGISTRY_FULL));
+    EXPECT_THAT(registry.sequenceNumber(), Eq(ServiceRegistry::CAPACITY));
+}
+
 TYPED_TEST(ServiceRegistry_test, FindWithMixOfPublishersAndServersWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "3e8a9647-69cc-4cad-afb1-9188927aff04");
@@ -0,0 +1,171 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/chunk_management.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+#include "iox/vector.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+namespace
+{
+constexpr uint32_t CHUNK_COUNT{64U};
+constexpr uint32_t CHUNK_SIZE_INCREMENT{128U};
+constexpr uint64_t NUMBER_OF_ITERATIONS{1000000U};
+
+/// @brief baseline with the mempool lookup of MemoryManager::getChunk before the size class index, i.e. a linear scan
+/// over all mempools which are smaller than the required chunk size
+class LinearScanMemoryManager
+{
+  public:
+    LinearScanMemoryManager(const iox::mepoo::MePooConfig& mePooConfig, iox::BumpAllocator& allocator) noexcept
+    {
+        uint32_t totalNumberOfChunks{0U};
+        for (const auto& entry : mePooConfig.m_mempoolConfig)
+        {
+            const auto chunkSize = entry.m_size + static_cast<uint32_t>(sizeof(iox::mepoo::ChunkHeader));
+            m_memPools.emplace_back(chunkSize, entry.m_chunkCount, allocator, allocator);
+            totalNumberOfChunks += entry.m_chunkCount;
+        }
+        m_chunkManagementPool.emplace_back(
+            static_cast<uint32_t>(sizeof(iox::mepoo::ChunkManagement)), totalNumberOfChunks, allocator, allocator);
+    }
+
+    bool getChunk(const iox::mepoo::ChunkSettings& chunkSettings) noexcept
+    {
+        for (auto& memPool : m_memPools)
+        {
+            if (memPool.getChunkSize() < chunkSettings.requiredChunkSize())
+            {
+                continue;
+            }
+
+            void* chunk = memPool.getChunk();
+            if (chunk == nullptr)
+            {
+                return false;
+            }
+            auto chunkHeader = new (chunk) iox::mepoo::ChunkHeader(memPool.getChunkSize(), chunkSettings);
+            auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
+                iox::mepoo::ChunkManagement(chunkHeader, &memPool, &m_chunkManagementPool.front());
+            // the chunk is released immediately since the SharedChunk goes out of scope
+            return static_cast<bool>(iox::mepoo::SharedChunk(chunkManagement));
+        }
+        return false;
+    }
+
+  private:
+    iox::vector<iox::mepoo::MemPool, iox::MAX_NUMBER_OF_MEMPOOLS> m_memPools;
+    iox::vector<iox::mepoo::MemPool, 1> m_chunkManagementPool;
+};
+
+/// @brief the MemoryManager with its size class index and a chunk magazine with 'MagazineCapacity'
+template <uint32_t MagazineCapacity>
+class IndexedMemoryManager
+{
+  public:
+    IndexedMemoryManager(const iox::mepoo::MePooConfig& mePooConfig, iox::BumpAllocator& allocator) noexcept
+    {
+        m_memoryManager.configureMemoryManager(mePooConfig, allocator, allocator);
+    }
+
+    ~IndexedMemoryManager() noexcept
+    {
+        m_chunkMagazine.drain();
+    }
+
+    bool getChunk(const iox::mepoo::ChunkSettings& chunkSettings) noexcept
+    {
+        // the chunk is released immediately since the SharedChunk goes out of scope
+        return !m_memoryManager.getChunk(chunkSettings, m_chunkMagazine).has_error();
+    }
+
+  private:
+    iox::mepoo::MemoryManager m_memoryManager;
+    iox::mepoo::ChunkMagazine m_chunkMagazine{MagazineCapacity};
+};
+
+/// @brief measures the average latency of a getChunk call and the release of the chunk for the smallest and the
+/// largest mempool of a 'Sut' with 'numberOfMemPools' mempools
+template <typename Sut>
+void benchmarkGetChunk(const uint32_t numberOfMemPools)
+{
+    iox::mepoo::MePooConfig mePooConfig;
+    for (uint32_t i = 1U; i <= numberOfMemPools; ++i)
+    {
+        mePooConfig.addMemPool({i * CHUNK_SIZE_INCREMENT, CHUNK_COUNT});
+    }
+
+    const auto memorySize = iox::mepoo::MemoryManager::requiredFullMemorySize(mePooConfig);
+    std::unique_ptr<uint8_t[]> memory{new uint8_t[memorySize]};
+    iox::BumpAllocator allocator{memory.get(), memorySize};
+    std::unique_ptr<Sut> sut{new Sut(mePooConfig, allocator)};
+
+    std::cout << std::setw(10) << numberOfMemPools;
+    for (const uint32_t userPayloadSize : {CHUNK_SIZE_INCREMENT, numberOfMemPools * CHUNK_SIZE_INCREMENT})
+    {
+        const auto chunkSettings =
+            iox::mepoo::ChunkSettings::create(userPayloadSize, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+
+        const auto start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+        {
+            if (!sut->getChunk(chunkSettings))
+            {
+                std::cerr << "getChunk failed!" << std::endl;
+                return;
+            }
+        }
+        const auto duration =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+        std::cout << std::setw(20) << std::fixed << std::setprecision(2)
+                  << static_cast<double>(duration.count()) / static_cast<double>(NUMBER_OF_ITERATIONS);
+    }
+    std::cout << std::endl;
+}
+
+template <typename Sut>
+void benchmarkAllMemPoolConfigurations(const char* const title)
+{
+    // Not using iceoryx logger due to width requirements
+    std::cout << "getChunk latency [ns] " << title << std::endl;
+    std::cout << std::setw(10) << "mempools" << std::setw(20) << "smallest mempool" << std::setw(20)
+              << "largest mempool" << std::endl;
+    for (uint32_t numberOfMemPools = 1U; numberOfMemPools <= iox::MAX_NUMBER_OF_MEMPOOLS; numberOfMemPools *= 2U)
+    {
+        benchmarkGetChunk<Sut>(numberOfMemPools);
+    }
+    std::cout << std::endl;
+}
+} // namespace
+
+int main()
+{
+    benchmarkAllMemPoolConfigurations<LinearScanMemoryManager>("with the linear scan baseline");
+    benchmarkAllMemPoolConfigurations<IndexedMemoryManager<0U>>("with the size class index");
+    benchmarkAllMemPoolConfigurations<IndexedMemoryManager<iox::MAX_CHUNK_MAGAZINE_CAPACITY>>(
+        "with the size class index and a chunk magazine with the maximum capacity");
+
+    return 0;
+}
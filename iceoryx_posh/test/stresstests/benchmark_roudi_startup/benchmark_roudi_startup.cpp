@@ -0,0 +1,191 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_dust/cxx/convert.hpp"
+#include "iceoryx_posh/iceoryx_posh_config.hpp"
+#include "iceoryx_posh/internal/roudi/roudi.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/roudi/iceoryx_roudi_components.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iox/logging.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+constexpr uint32_t DEFAULT_NUMBER_OF_RUNTIMES{200U};
+constexpr iox::log::LogLevel BENCHMARK_LOG_LEVEL{iox::log::LogLevel::WARN};
+
+iox::capro::ServiceDescription serviceOfRuntime(const uint32_t runtimeIndex)
+{
+    return {"Benchmark",
+            "Startup",
+            iox::into<iox::lossy<iox::capro::IdString_t>>(iox::cxx::convert::toString(runtimeIndex))};
+}
+
+/// @brief a synthetic runtime which waits for the start signal, registers at RouDi, creates a publisher and a
+/// subscriber, reports that it is connected and stays connected until the benchmark closes the exit pipe
+void runSyntheticRuntime(const uint32_t runtimeIndex,
+                         const uint32_t numberOfRuntimes,
+                         const int startPipe,
+                         const int connectedPipe,
+                         const int exitPipe)
+{
+    char signal{0};
+    if (read(startPipe, &signal, 1U) != 1)
+    {
+        _exit(EXIT_FAILURE);
+    }
+
+    iox::RuntimeName_t runtimeName{"iox-bm-runtime-"};
+    runtimeName.append(iox::TruncateToCapacity, iox::cxx::convert::toString(runtimeIndex));
+    iox::runtime::PoshRuntime::initRuntime(runtimeName);
+
+    iox::popo::UntypedPublisher publisher(serviceOfRuntime(runtimeIndex));
+    iox::popo::UntypedSubscriber subscriber(serviceOfRuntime((runtimeIndex + 1U) % numberOfRuntimes));
+
+    if (write(connectedPipe, &signal, 1U) != 1)
+    {
+        _exit(EXIT_FAILURE);
+    }
+
+    // returns with 0 when the benchmark closes the pipe
+    IOX_DISCARD_RESULT(read(exitPipe, &signal, 1U));
+}
+
+/// @brief starts RouDi with 'numberOfWorkers' runtime message workers and measures the time until all
+/// 'numberOfRuntimes' synthetic runtimes are registered and have created their ports
+void benchmarkStartup(const uint32_t numberOfRuntimes, const uint32_t numberOfWorkers)
+{
+    int startPipe[2];
+    int connectedPipe[2];
+    int exitPipe[2];
+    if (pipe(startPipe) != 0 || pipe(connectedPipe) != 0 || pipe(exitPipe) != 0)
+    {
+        std::cerr << "could not create the pipes!" << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    // the runtimes are forked before RouDi starts its threads
+    std::vector<pid_t> runtimes;
+    for (uint32_t i = 0U; i < numberOfRuntimes; ++i)
+    {
+        auto pid = fork();
+        if (pid == 0)
+        {
+            close(startPipe[1]);
+            close(connectedPipe[0]);
+            close(exitPipe[1]);
+            runSyntheticRuntime(i, numberOfRuntimes, startPipe[0], connectedPipe[1], exitPipe[0]);
+            _exit(EXIT_SUCCESS);
+        }
+        if (pid < 0)
+        {
+            std::cerr << "could not fork the synthetic runtime " << i << "!" << std::endl;
+            break;
+        }
+        runtimes.push_back(pid);
+    }
+    close(startPipe[0]);
+    close(connectedPipe[1]);
+    close(exitPipe[0]);
+
+    {
+        iox::roudi::IceOryxRouDiComponents roudiComponents(iox::RouDiConfig_t().setDefaults());
+        iox::roudi::RouDi::RoudiStartupParameters startupParameters{
+            iox::roudi::MonitoringMode::OFF,
+            false,
+            iox::roudi::RouDi::RuntimeMessagesThreadStart::IMMEDIATE,
+            iox::version::CompatibilityCheckLevel::PATCH,
+            iox::roudi::PROCESS_DEFAULT_KILL_DELAY,
+            numberOfWorkers};
+        iox::roudi::RouDi roudi(roudiComponents.rouDiMemoryManager, roudiComponents.portManager, startupParameters);
+
+        // wait for the IPC channel of RouDi to not measure the retries of the runtimes; the failed attempts to open
+        // the channel are not worth an error message
+        iox::log::Logger::setLogLevel(iox::log::LogLevel::OFF);
+        while (!iox::runtime::IpcInterfaceUser(iox::roudi::IPC_CHANNEL_ROUDI_NAME).isInitialized())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        iox::log::Logger::setLogLevel(BENCHMARK_LOG_LEVEL);
+
+        const auto start = std::chrono::steady_clock::now();
+        const std::vector<char> startSignals(runtimes.size(), 0);
+        IOX_DISCARD_RESULT(write(startPipe[1], startSignals.data(), startSignals.size()));
+
+        uint64_t numberOfConnectedRuntimes{0U};
+        char signal{0};
+        while (numberOfConnectedRuntimes < runtimes.size() && read(connectedPipe[0], &signal, 1U) == 1)
+        {
+            ++numberOfConnectedRuntimes;
+        }
+        const auto duration =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        std::cout << std::setw(10) << numberOfWorkers << std::setw(12) << numberOfConnectedRuntimes << std::setw(25)
+                  << std::fixed << std::setprecision(2) << static_cast<double>(duration.count()) / 1000.0 << std::endl;
+
+        // the runtimes unregister while RouDi is still running
+        close(exitPipe[1]);
+        for (auto pid : runtimes)
+        {
+            waitpid(pid, nullptr, 0);
+        }
+    }
+
+    close(startPipe[1]);
+    close(connectedPipe[0]);
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    uint32_t numberOfRuntimes{DEFAULT_NUMBER_OF_RUNTIMES};
+    if (argc > 1 && !iox::cxx::convert::fromString(argv[1], numberOfRuntimes))
+    {
+        std::cerr << "usage: " << argv[0] << " [number of runtimes]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (numberOfRuntimes == 0U || numberOfRuntimes > iox::MAX_PROCESS_NUMBER)
+    {
+        std::cerr << "the number of runtimes must be between 1 and " << iox::MAX_PROCESS_NUMBER << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    iox::log::Logger::init(BENCHMARK_LOG_LEVEL);
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << "time until " << numberOfRuntimes << " runtimes are connected" << std::endl;
+    std::cout << std::setw(10) << "workers" << std::setw(12) << "runtimes" << std::setw(25) << "time-to-connected [ms]"
+              << std::endl;
+    for (uint32_t numberOfWorkers = 1U; numberOfWorkers <= iox::roudi::MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS;
+         numberOfWorkers *= 2U)
+    {
+        benchmarkStartup(numberOfRuntimes, numberOfWorkers);
+    }
+
+    return EXIT_SUCCESS;
+}
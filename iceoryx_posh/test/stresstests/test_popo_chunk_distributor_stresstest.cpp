@@ -0,0 +1,302 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#if !defined(_WIN32)
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_platform/mman.hpp"
+#include "iceoryx_platform/signal.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iceoryx_platform/wait.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iox/bump_allocator.hpp"
+#include "iox/deadline_timer.hpp"
+
+#include "test.hpp"
+
+#include <array>
+#include <random>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::mepoo;
+using namespace iox::units::duration_literals;
+
+/// @brief The publishers are separate processes which are killed with SIGKILL while they are sending. The test process
+/// takes the role of RouDi, it adds and removes queues concurrently, cleans up the killed publishers and drains the
+/// queues. A publisher which is killed while sending must neither block the modification of the queues nor corrupt
+/// them.
+class ChunkDistributorStress_test : public Test
+{
+  public:
+    static constexpr uint32_t NUMBER_OF_PUBLISHERS{4U};
+    static constexpr uint32_t NUMBER_OF_QUEUES{8U};
+    static constexpr uint32_t QUEUE_CAPACITY{16U};
+    static constexpr uint32_t USER_PAYLOAD_SIZE{64U};
+    static constexpr uint32_t NUMBER_OF_CHUNKS{4096U};
+    static constexpr uint64_t SHARED_MEMORY_SIZE{16U << 20U};
+    static constexpr uint32_t MAX_NUMBER_OF_KILLED_PUBLISHERS{200U};
+
+    struct ChunkDistributorConfig
+    {
+        static constexpr uint32_t MAX_QUEUES = NUMBER_OF_QUEUES;
+        static constexpr uint64_t MAX_HISTORY_CAPACITY = iox::MAX_PUBLISHER_HISTORY;
+    };
+
+    struct ChunkQueueConfig
+    {
+        static constexpr uint64_t MAX_QUEUE_CAPACITY = QUEUE_CAPACITY;
+    };
+
+    using ChunkQueueData_t = ChunkQueueData<ChunkQueueConfig, SingleThreadedPolicy>;
+    using ChunkDistributorData_t =
+        ChunkDistributorData<ChunkDistributorConfig, ThreadSafePolicy, ChunkQueuePusher<ChunkQueueData_t>>;
+    using ChunkDistributor_t = ChunkDistributor<ChunkDistributorData_t>;
+
+    /// @brief everything which is accessed by the publisher processes is placed in this shared memory
+    struct SharedState
+    {
+        SharedState(iox::BumpAllocator& allocator) noexcept
+            : chunkMemoryPool{sizeof(ChunkHeader) + USER_PAYLOAD_SIZE, NUMBER_OF_CHUNKS, allocator, allocator}
+            , chunkManagementPool{sizeof(ChunkManagement), NUMBER_OF_CHUNKS, allocator, allocator}
+        {
+        }
+
+        MemPool chunkMemoryPool;
+        MemPool chunkManagementPool;
+        iox::optional<ChunkQueueData_t> queues[NUMBER_OF_QUEUES];
+        iox::optional<ChunkDistributorData_t> distributors[NUMBER_OF_PUBLISHERS];
+    };
+
+    void SetUp() override
+    {
+        m_sharedMemory =
+            mmap(nullptr, SHARED_MEMORY_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        ASSERT_NE(m_sharedMemory, MAP_FAILED);
+
+        iox::BumpAllocator allocator{m_sharedMemory, SHARED_MEMORY_SIZE};
+        auto stateMemory = allocator.allocate(sizeof(SharedState), alignof(SharedState));
+        ASSERT_FALSE(stateMemory.has_error());
+        m_state = new (stateMemory.value()) SharedState(allocator);
+
+        for (auto& queue : m_state->queues)
+        {
+            queue.emplace(iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA,
+                          iox::cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+        }
+        for (auto& distributor : m_state->distributors)
+        {
+            distributor.emplace(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0U);
+        }
+
+        m_watchdog.watchAndActOnFailure([this] {
+            killAllPublishers();
+            std::terminate();
+        });
+    }
+
+    void TearDown() override
+    {
+        killAllPublishers();
+        if (m_state != nullptr)
+        {
+            m_state->~SharedState();
+        }
+        if (m_sharedMemory != MAP_FAILED)
+        {
+            munmap(m_sharedMemory, SHARED_MEMORY_SIZE);
+        }
+    }
+
+    SharedChunk allocateChunk(const uint64_t value) noexcept
+    {
+        auto chunkSettingsResult = ChunkSettings::create(USER_PAYLOAD_SIZE, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+        if (chunkSettingsResult.has_error())
+        {
+            return nullptr;
+        }
+
+        auto chunk = m_state->chunkMemoryPool.getChunk();
+        if (chunk == nullptr)
+        {
+            return nullptr;
+        }
+        auto chunkMgmt = m_state->chunkManagementPool.getChunk();
+        if (chunkMgmt == nullptr)
+        {
+            m_state->chunkMemoryPool.freeChunk(chunk);
+            return nullptr;
+        }
+
+        auto chunkHeader = new (chunk) ChunkHeader(m_state->chunkMemoryPool.getChunkSize(), chunkSettingsResult.value());
+        new (chunkMgmt) ChunkManagement{chunkHeader, &m_state->chunkMemoryPool, &m_state->chunkManagementPool};
+        *static_cast<uint64_t*>(chunkHeader->userPayload()) = value;
+        return SharedChunk(static_cast<ChunkManagement*>(chunkMgmt));
+    }
+
+    [[noreturn]] void publish(const uint32_t publisherIndex) noexcept
+    {
+        ChunkDistributor_t sut{&m_state->distributors[publisherIndex].value()};
+        for (uint64_t i = 0U;; ++i)
+        {
+            auto chunk = allocateChunk(i);
+            if (chunk)
+            {
+                IOX_DISCARD_RESULT(sut.deliverToAllStoredQueues(chunk));
+            }
+        }
+    }
+
+    void startPublisher(const uint32_t publisherIndex) noexcept
+    {
+        auto pid = fork();
+        ASSERT_NE(pid, -1);
+        if (pid == 0)
+        {
+            publish(publisherIndex);
+        }
+        m_publisherPids[publisherIndex] = pid;
+    }
+
+    void killPublisher(const uint32_t publisherIndex) noexcept
+    {
+        auto& pid = m_publisherPids[publisherIndex];
+        if (pid > 0)
+        {
+            kill(pid, SIGKILL);
+            waitpid(pid, nullptr, 0);
+            pid = 0;
+        }
+    }
+
+    void killAllPublishers() noexcept
+    {
+        for (uint32_t i = 0U; i < NUMBER_OF_PUBLISHERS; ++i)
+        {
+            killPublisher(i);
+        }
+    }
+
+    uint64_t drainQueues() noexcept
+    {
+        uint64_t numberOfReceivedChunks{0U};
+        for (auto& queue : m_state->queues)
+        {
+            ChunkQueuePopper<ChunkQueueData_t> popper{&queue.value()};
+            while (popper.tryPop().has_value())
+            {
+                ++numberOfReceivedChunks;
+            }
+        }
+        return numberOfReceivedChunks;
+    }
+
+    void* m_sharedMemory{MAP_FAILED};
+    SharedState* m_state{nullptr};
+    std::array<pid_t, NUMBER_OF_PUBLISHERS> m_publisherPids{};
+
+    static constexpr iox::units::Duration STRESS_TEST_DURATION{5_s};
+    static constexpr iox::units::Duration DEADLOCK_TIMEOUT{STRESS_TEST_DURATION + 10_s};
+    Watchdog m_watchdog{DEADLOCK_TIMEOUT};
+};
+
+constexpr uint32_t ChunkDistributorStress_test::NUMBER_OF_PUBLISHERS;
+constexpr uint32_t ChunkDistributorStress_test::NUMBER_OF_QUEUES;
+constexpr uint32_t ChunkDistributorStress_test::MAX_NUMBER_OF_KILLED_PUBLISHERS;
+constexpr iox::units::Duration ChunkDistributorStress_test::STRESS_TEST_DURATION;
+constexpr iox::units::Duration ChunkDistributorStress_test::DEADLOCK_TIMEOUT;
+
+TEST_F(ChunkDistributorStress_test, ModifyingQueuesWhilePublishersAreKilledDuringSendingWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3b6f0d52-8a1e-4c57-9d1a-6c2e7b94f0a8");
+
+    for (uint32_t i = 0U; i < NUMBER_OF_PUBLISHERS; ++i)
+    {
+        startPublisher(i);
+    }
+
+    std::mt19937 generator{std::random_device{}()};
+    std::uniform_int_distribution<uint32_t> publisherDistribution{0U, NUMBER_OF_PUBLISHERS - 1U};
+    std::uniform_int_distribution<uint32_t> queueDistribution{0U, NUMBER_OF_QUEUES - 1U};
+    std::uniform_int_distribution<uint32_t> actionDistribution{0U, 99U};
+
+    bool isQueueStored[NUMBER_OF_PUBLISHERS][NUMBER_OF_QUEUES]{};
+    uint64_t numberOfReceivedChunks{0U};
+    uint32_t numberOfKilledPublishers{0U};
+
+    iox::deadline_timer testDuration{STRESS_TEST_DURATION};
+    while (!testDuration.hasExpired())
+    {
+        const auto publisherIndex = publisherDistribution(generator);
+        ChunkDistributor_t roudiSideDistributor{&m_state->distributors[publisherIndex].value()};
+
+        if (actionDistribution(generator) == 0U && numberOfKilledPublishers < MAX_NUMBER_OF_KILLED_PUBLISHERS)
+        {
+            killPublisher(publisherIndex);
+            roudiSideDistributor.cleanup();
+            ++numberOfKilledPublishers;
+            startPublisher(publisherIndex);
+        }
+        else
+        {
+            const auto queueIndex = queueDistribution(generator);
+            auto& queue = m_state->queues[queueIndex].value();
+            if (isQueueStored[publisherIndex][queueIndex])
+            {
+                EXPECT_FALSE(roudiSideDistributor.tryRemoveQueue(&queue).has_error());
+            }
+            else
+            {
+                EXPECT_FALSE(roudiSideDistributor.tryAddQueue(&queue).has_error());
+            }
+            isQueueStored[publisherIndex][queueIndex] = !isQueueStored[publisherIndex][queueIndex];
+        }
+
+        numberOfReceivedChunks += drainQueues();
+    }
+
+    killAllPublishers();
+
+    for (uint32_t publisherIndex = 0U; publisherIndex < NUMBER_OF_PUBLISHERS; ++publisherIndex)
+    {
+        ChunkDistributor_t roudiSideDistributor{&m_state->distributors[publisherIndex].value()};
+        roudiSideDistributor.cleanup();
+        for (uint32_t queueIndex = 0U; queueIndex < NUMBER_OF_QUEUES; ++queueIndex)
+        {
+            EXPECT_THAT(
+                roudiSideDistributor.getQueueIndex(m_state->queues[queueIndex]->m_uniqueId, 0U).has_value(),
+                Eq(isQueueStored[publisherIndex][queueIndex]));
+        }
+        roudiSideDistributor.removeAllQueues();
+        EXPECT_FALSE(roudiSideDistributor.hasStoredQueues());
+    }
+
+    numberOfReceivedChunks += drainQueues();
+    EXPECT_THAT(numberOfReceivedChunks, Gt(0U));
+    EXPECT_THAT(numberOfKilledPublishers, Gt(0U));
+}
+
+} // namespace
+#endif